@@ -19,1882 +19,1882 @@
 /*--------------------------------------------------------------------------------*/
 
 // MSG1_RTOS_EVENT_GROUP_CREATE_STATIC_ENTER ""
-#define MSG1_RTOS_EVENT_GROUP_CREATE_STATIC_ENTER 422U
+#define MSG1_RTOS_EVENT_GROUP_CREATE_STATIC_ENTER 388U
 // >>RTOS_MAIN "%N %t xEventGroupCreateStatic ENTER: pxEventGroupBuffer 0x%08X\n"
 
 // MSG1_RTOS_EVENT_GROUP_CREATE_STATIC_RETURN ""
-#define MSG1_RTOS_EVENT_GROUP_CREATE_STATIC_RETURN 428U
+#define MSG1_RTOS_EVENT_GROUP_CREATE_STATIC_RETURN 390U
 // >>RTOS_MAIN "%N %t xEventGroupCreateStatic RETURN: pxEventBits 0x%08X, "
 // >>RTOS_MAIN "dt=%[t-MSG1_RTOS_EVENT_GROUP_CREATE_STATIC_ENTER](*1e6).3f us\n"
 
 // MSG0_RTOS_EVENT_GROUP_CREATE_ENTER ""
-#define MSG0_RTOS_EVENT_GROUP_CREATE_ENTER 387U
+#define MSG0_RTOS_EVENT_GROUP_CREATE_ENTER 414U
 // >>RTOS_MAIN "%N %t xEventGroupCreate ENTER\n"
 
 // MSG1_RTOS_EVENT_GROUP_CREATE_RETURN ""
-#define MSG1_RTOS_EVENT_GROUP_CREATE_RETURN 430U
+#define MSG1_RTOS_EVENT_GROUP_CREATE_RETURN 412U
 // >>RTOS_MAIN "%N %t xEventGroupCreate RETURN: pxEventBits 0x%08X, "
 // >>RTOS_MAIN "dt=%[t-MSG0_RTOS_EVENT_GROUP_CREATE_ENTER](*1e6).3f us\n"
 
 // MSG4_RTOS_EVENT_GROUP_SYNC_ENTER ""
-#define MSG4_RTOS_EVENT_GROUP_SYNC_ENTER 432U
+#define MSG4_RTOS_EVENT_GROUP_SYNC_ENTER 416U
 // >>RTOS_MAIN "%N %t xEventGroupSync ENTER: xEventGroup 0x%08X, uxBitsToSet 0x%08X, "
 // >>RTOS_MAIN "uxBitsToWaitFor 0x%08X, xTicksToWait %u\n"
 
 // MSG1_RTOS_EVENT_GROUP_SYNC_RETURN ""
-#define MSG1_RTOS_EVENT_GROUP_SYNC_RETURN 448U
+#define MSG1_RTOS_EVENT_GROUP_SYNC_RETURN 432U
 // >>RTOS_MAIN "%N %t xEventGroupSync RETURN: uxReturn %u, "
 // >>RTOS_MAIN "dt=%[t-MSG4_RTOS_EVENT_GROUP_SYNC_ENTER](*1e6).3f us\n"
 
 // MSG5_RTOS_EVENT_GROUP_WAIT_BITS_ENTER ""
-#define MSG5_RTOS_EVENT_GROUP_WAIT_BITS_ENTER 464U
+#define MSG5_RTOS_EVENT_GROUP_WAIT_BITS_ENTER 448U
 // >>RTOS_MAIN "%N %t xEventGroupWaitBits ENTER: xEventGroup 0x%08X, uxBitsToWaitFor 0x%08X, "
 // >>RTOS_MAIN "xClearOnExit %u, xWaitForAllBits %u, xTicksToWait %u\n"
 
 // MSG1_RTOS_EVENT_GROUP_WAIT_BITS_RETURN ""
-#define MSG1_RTOS_EVENT_GROUP_WAIT_BITS_RETURN 450U
+#define MSG1_RTOS_EVENT_GROUP_WAIT_BITS_RETURN 464U
 // >>RTOS_MAIN "%N %t xEventGroupWaitBits RETURN: uxReturn %u, "
 // >>RTOS_MAIN "dt=%[t-MSG5_RTOS_EVENT_GROUP_WAIT_BITS_ENTER](*1e6).3f us\n"
 
 // MSG2_RTOS_EVENT_GROUP_CLEAR_BITS_ENTER ""
-#define MSG2_RTOS_EVENT_GROUP_CLEAR_BITS_ENTER 452U
+#define MSG2_RTOS_EVENT_GROUP_CLEAR_BITS_ENTER 392U
 // >>RTOS_MAIN "%N %t xEventGroupClearBits ENTER: xEventGroup 0x%08X, uxBitsToClear 0x%08X\n"
 
 // MSG1_RTOS_EVENT_GROUP_CLEAR_BITS_RETURN ""
-#define MSG1_RTOS_EVENT_GROUP_CLEAR_BITS_RETURN 456U
+#define MSG1_RTOS_EVENT_GROUP_CLEAR_BITS_RETURN 396U
 // >>RTOS_MAIN "%N %t xEventGroupClearBits RETURN: uxReturn %u, "
 // >>RTOS_MAIN "dt=%[t-MSG2_RTOS_EVENT_GROUP_CLEAR_BITS_ENTER](*1e6).3f us\n"
 
 // MSG2_RTOS_EVENT_GROUP_CLEAR_BITS_FROM_ISR_ENTER ""
-#define MSG2_RTOS_EVENT_GROUP_CLEAR_BITS_FROM_ISR_ENTER 460U
+#define MSG2_RTOS_EVENT_GROUP_CLEAR_BITS_FROM_ISR_ENTER 440U
 // >>RTOS_MAIN "%N %t xEventGroupClearBitsFromISR ENTER: xEventGroup 0x%08X, uxBitsToClear 0x%08X\n"
 
 // MSG1_RTOS_EVENT_GROUP_CLEAR_BITS_FROM_ISR_RETURN ""
-#define MSG1_RTOS_EVENT_GROUP_CLEAR_BITS_FROM_ISR_RETURN 458U
+#define MSG1_RTOS_EVENT_GROUP_CLEAR_BITS_FROM_ISR_RETURN 444U
 // >>RTOS_MAIN "%N %t xEventGroupClearBitsFromISR RETURN: xReturn %u, "
 // >>RTOS_MAIN "dt=%[t-MSG2_RTOS_EVENT_GROUP_CLEAR_BITS_FROM_ISR_ENTER](*1e6).3f us\n"
 
 // MSG1_RTOS_EVENT_GROUP_GET_BITS_FROM_ISR_ENTER ""
-#define MSG1_RTOS_EVENT_GROUP_GET_BITS_FROM_ISR_ENTER 480U
+#define MSG1_RTOS_EVENT_GROUP_GET_BITS_FROM_ISR_ENTER 436U
 // >>RTOS_MAIN "%N %t xEventGroupGetBitsFromISR ENTER: xEventGroup 0x%08X\n"
 
 // MSG1_RTOS_EVENT_GROUP_GET_BITS_FROM_ISR_RETURN ""
-#define MSG1_RTOS_EVENT_GROUP_GET_BITS_FROM_ISR_RETURN 482U
+#define MSG1_RTOS_EVENT_GROUP_GET_BITS_FROM_ISR_RETURN 438U
 // >>RTOS_MAIN "%N %t xEventGroupGetBitsFromISR RETURN: uxReturn 0x%08X, "
 // >>RTOS_MAIN "dt=%[t-MSG1_RTOS_EVENT_GROUP_GET_BITS_FROM_ISR_ENTER](*1e6).3f us\n"
 
 // MSG2_RTOS_EVENT_GROUP_SET_BITS_ENTER ""
-#define MSG2_RTOS_EVENT_GROUP_SET_BITS_ENTER 484U
+#define MSG2_RTOS_EVENT_GROUP_SET_BITS_ENTER 472U
 // >>RTOS_MAIN "%N %t xEventGroupSetBits ENTER: xEventGroup 0x%08X, uxBitsToSet 0x%08X\n"
 
 // MSG1_RTOS_EVENT_GROUP_SET_BITS_RETURN ""
-#define MSG1_RTOS_EVENT_GROUP_SET_BITS_RETURN 488U
+#define MSG1_RTOS_EVENT_GROUP_SET_BITS_RETURN 476U
 // >>RTOS_MAIN "%N %t xEventGroupSetBits RETURN: uxEventBits 0x%08X, "
 // >>RTOS_MAIN "dt=%[t-MSG2_RTOS_EVENT_GROUP_SET_BITS_ENTER](*1e6).3f us\n"
 
 // MSG1_RTOS_EVENT_GROUP_DELETE_ENTER ""
-#define MSG1_RTOS_EVENT_GROUP_DELETE_ENTER 490U
+#define MSG1_RTOS_EVENT_GROUP_DELETE_ENTER 468U
 // >>RTOS_MAIN "%N %t vEventGroupDelete ENTER: xEventGroup 0x%08X\n"
 
 // MSG0_RTOS_EVENT_GROUP_DELETE_RETURN ""
-#define MSG0_RTOS_EVENT_GROUP_DELETE_RETURN 492U
+#define MSG0_RTOS_EVENT_GROUP_DELETE_RETURN 470U
 // >>RTOS_MAIN "%N %t vEventGroupDelete RETURN, "
 // >>RTOS_MAIN "dt=%[t-MSG1_RTOS_EVENT_GROUP_DELETE_ENTER](*1e6).3f us\n"
 
 // MSG2_RTOS_EVENT_GROUP_GET_STATIC_BUFFER_ENTER ""
-#define MSG2_RTOS_EVENT_GROUP_GET_STATIC_BUFFER_ENTER 496U
+#define MSG2_RTOS_EVENT_GROUP_GET_STATIC_BUFFER_ENTER 504U
 // >>RTOS_MAIN "%N %t xEventGroupGetStaticBuffer ENTER: xEventGroup 0x%08X, ppxEventGroupBuffer 0x%08X\n"
 
 // MSG1_RTOS_EVENT_GROUP_GET_STATIC_BUFFER_RETURN ""
-#define MSG1_RTOS_EVENT_GROUP_GET_STATIC_BUFFER_RETURN 494U
+#define MSG1_RTOS_EVENT_GROUP_GET_STATIC_BUFFER_RETURN 508U
 // >>RTOS_MAIN "%N %t xEventGroupGetStaticBuffer RETURN: xReturn %u, "
 // >>RTOS_MAIN "dt=%[t-MSG2_RTOS_EVENT_GROUP_GET_STATIC_BUFFER_ENTER](*1e6).3f us\n"
 
 // MSG2_RTOS_EVENT_GROUP_SET_BITS_CALLBACK_ENTER ""
-#define MSG2_RTOS_EVENT_GROUP_SET_BITS_CALLBACK_ENTER 500U
+#define MSG2_RTOS_EVENT_GROUP_SET_BITS_CALLBACK_ENTER 536U
 // >>RTOS_MAIN "%N %t vEventGroupSetBitsCallback ENTER: pvEventGroup 0x%08X, ulBitsToSet 0x%08X\n"
 
 // MSG0_RTOS_EVENT_GROUP_SET_BITS_CALLBACK_RETURN ""
-#define MSG0_RTOS_EVENT_GROUP_SET_BITS_CALLBACK_RETURN 493U
+#define MSG0_RTOS_EVENT_GROUP_SET_BITS_CALLBACK_RETURN 540U
 // >>RTOS_MAIN "%N %t vEventGroupSetBitsCallback RETURN, "
 // >>RTOS_MAIN "dt=%[t-MSG2_RTOS_EVENT_GROUP_SET_BITS_CALLBACK_ENTER](*1e6).3f us\n"
 
 // MSG2_RTOS_EVENT_GROUP_CLEAR_BITS_CALLBACK_ENTER ""
-#define MSG2_RTOS_EVENT_GROUP_CLEAR_BITS_CALLBACK_ENTER 504U
+#define MSG2_RTOS_EVENT_GROUP_CLEAR_BITS_CALLBACK_ENTER 568U
 // >>RTOS_MAIN "%N %t vEventGroupClearBitsCallback ENTER: pvEventGroup 0x%08X, ulBitsToClear 0x%08X\n"
 
 // MSG0_RTOS_EVENT_GROUP_CLEAR_BITS_CALLBACK_RETURN ""
-#define MSG0_RTOS_EVENT_GROUP_CLEAR_BITS_CALLBACK_RETURN 508U
+#define MSG0_RTOS_EVENT_GROUP_CLEAR_BITS_CALLBACK_RETURN 572U
 // >>RTOS_MAIN "%N %t vEventGroupClearBitsCallback RETURN, "
 // >>RTOS_MAIN "dt=%[t-MSG2_RTOS_EVENT_GROUP_CLEAR_BITS_CALLBACK_ENTER](*1e6).3f us\n"
 
 // MSG3_RTOS_EVENT_GROUP_SET_BITS_FROM_ISR_ENTER ""
-#define MSG3_RTOS_EVENT_GROUP_SET_BITS_FROM_ISR_ENTER 512U
+#define MSG3_RTOS_EVENT_GROUP_SET_BITS_FROM_ISR_ENTER 400U
 // >>RTOS_MAIN "%N %t xEventGroupSetBitsFromISR ENTER: xEventGroup 0x%08X, uxBitsToSet 0x%08X, "
 // >>RTOS_MAIN "pxHigherPriorityTaskWoken 0x%08X\n"
 
 // MSG1_RTOS_EVENT_GROUP_SET_BITS_FROM_ISR_RETURN ""
-#define MSG1_RTOS_EVENT_GROUP_SET_BITS_FROM_ISR_RETURN 510U
+#define MSG1_RTOS_EVENT_GROUP_SET_BITS_FROM_ISR_RETURN 408U
 // >>RTOS_MAIN "%N %t xEventGroupSetBitsFromISR RETURN: xReturn %u, "
 // >>RTOS_MAIN "dt=%[t-MSG3_RTOS_EVENT_GROUP_SET_BITS_FROM_ISR_ENTER](*1e6).3f us\n"
 
 // MSG1_RTOS_EVENT_GROUP_GET_NUMBER_ENTER ""
-#define MSG1_RTOS_EVENT_GROUP_GET_NUMBER_ENTER 520U
+#define MSG1_RTOS_EVENT_GROUP_GET_NUMBER_ENTER 500U
 // >>RTOS_MAIN "%N %t uxEventGroupGetNumber ENTER: xEventGroup 0x%08X\n"
 
 // MSG1_RTOS_EVENT_GROUP_GET_NUMBER_RETURN ""
-#define MSG1_RTOS_EVENT_GROUP_GET_NUMBER_RETURN 522U
+#define MSG1_RTOS_EVENT_GROUP_GET_NUMBER_RETURN 502U
 // >>RTOS_MAIN "%N %t uxEventGroupGetNumber RETURN: xReturn %u, "
 // >>RTOS_MAIN "dt=%[t-MSG1_RTOS_EVENT_GROUP_GET_NUMBER_ENTER](*1e6).3f us\n"
 
 // MSG2_RTOS_EVENT_GROUP_SET_NUMBER_ENTER ""
-#define MSG2_RTOS_EVENT_GROUP_SET_NUMBER_ENTER 524U
+#define MSG2_RTOS_EVENT_GROUP_SET_NUMBER_ENTER 600U
 // >>RTOS_MAIN "%N %t vEventGroupSetNumber ENTER: xEventGroup 0x%08X, uxEventGroupNumber %u\n"
 
 // MSG0_RTOS_EVENT_GROUP_SET_NUMBER_RETURN ""
-#define MSG0_RTOS_EVENT_GROUP_SET_NUMBER_RETURN 509U
+#define MSG0_RTOS_EVENT_GROUP_SET_NUMBER_RETURN 604U
 // >>RTOS_MAIN "%N %t vEventGroupSetNumber RETURN, "
 // >>RTOS_MAIN "dt=%[t-MSG2_RTOS_EVENT_GROUP_SET_NUMBER_ENTER](*1e6).3f us\n"
 
 // MSG7_RTOS_TASK_CREATE_STATIC_ENTER ""
-#define MSG7_RTOS_TASK_CREATE_STATIC_ENTER 528U
+#define MSG7_RTOS_TASK_CREATE_STATIC_ENTER 480U
 // >>RTOS_MAIN "%N %t xTaskCreateStatic ENTER: pxTaskCode 0x%08X, pcName 0x%08X, uxStackDepth %u, "
 // >>RTOS_MAIN "pvParameters 0x%08X, uxPriority %u, puxStackBuffer 0x%08X, "
 // >>RTOS_MAIN "pxTaskBuffer 0x%08X\n"
 
 // MSG1_RTOS_TASK_CREATE_STATIC_RETURN ""
-#define MSG1_RTOS_TASK_CREATE_STATIC_RETURN 544U
+#define MSG1_RTOS_TASK_CREATE_STATIC_RETURN 496U
 // >>RTOS_MAIN "%N %t xTaskCreateStatic RETURN: xReturn 0x%08X, "
 // >>RTOS_MAIN "dt=%[t-MSG7_RTOS_TASK_CREATE_STATIC_ENTER](*1e6).3f us\n"
 
 // MSG8_RTOS_TASK_CREATE_STATIC_AFFINITY_SET_ENTER ""
-#define MSG8_RTOS_TASK_CREATE_STATIC_AFFINITY_SET_ENTER 560U
+#define MSG8_RTOS_TASK_CREATE_STATIC_AFFINITY_SET_ENTER 512U
 // >>RTOS_MAIN "%N %t xTaskCreateStaticAffinitySet ENTER: pxTaskCode 0x%08X, pcName 0x%08X, "
 // >>RTOS_MAIN "uxStackDepth %u, pvParameters 0x%08X, uxPriority %u, puxStackBuffer 0x%08X, "
 // >>RTOS_MAIN "pxTaskBuffer 0x%08X, uxCoreAffinityMask %u\n"
 
 // MSG1_RTOS_TASK_CREATE_STATIC_AFFINITY_SET_RETURN ""
-#define MSG1_RTOS_TASK_CREATE_STATIC_AFFINITY_SET_RETURN 546U
+#define MSG1_RTOS_TASK_CREATE_STATIC_AFFINITY_SET_RETURN 528U
 // >>RTOS_MAIN "%N %t xTaskCreateStaticAffinitySet RETURN: xReturn 0x%08X, "
 // >>RTOS_MAIN "dt=%[t-MSG8_RTOS_TASK_CREATE_STATIC_AFFINITY_SET_ENTER](*1e6).3f us\n"
 
 // MSG2_RTOS_TASK_CREATE_RESTRICTED_STATIC_ENTER ""
-#define MSG2_RTOS_TASK_CREATE_RESTRICTED_STATIC_ENTER 548U
+#define MSG2_RTOS_TASK_CREATE_RESTRICTED_STATIC_ENTER 632U
 // >>RTOS_MAIN "%N %t xTaskCreateRestrictedStatic ENTER: pxTaskDefinition 0x%08X, "
 // >>RTOS_MAIN "pxCreatedTask 0x%08X\n"
 
 // MSG1_RTOS_TASK_CREATE_RESTRICTED_STATIC_RETURN ""
-#define MSG1_RTOS_TASK_CREATE_RESTRICTED_STATIC_RETURN 552U
+#define MSG1_RTOS_TASK_CREATE_RESTRICTED_STATIC_RETURN 636U
 // >>RTOS_MAIN "%N %t xTaskCreateRestrictedStatic RETURN: xReturn %u, "
 // >>RTOS_MAIN "dt=%[t-MSG2_RTOS_TASK_CREATE_RESTRICTED_STATIC_ENTER](*1e6).3f us\n"
 
 // MSG3_RTOS_TASK_CREATE_RESTRICTED_STATIC_AFFINITY_SET_ENTER ""
-#define MSG3_RTOS_TASK_CREATE_RESTRICTED_STATIC_AFFINITY_SET_ENTER 576U
+#define MSG3_RTOS_TASK_CREATE_RESTRICTED_STATIC_AFFINITY_SET_ENTER 1216U
 // >>RTOS_MAIN "%N %t xTaskCreateRestrictedStaticAffinitySet ENTER: pxTaskDefinition 0x%08X, "
 // >>RTOS_MAIN "uxCoreAffinityMask %u, pxCreatedTask 0x%08X\n"
 
 // MSG1_RTOS_TASK_CREATE_RESTRICTED_STATIC_AFFINITY_SET_RETURN ""
-#define MSG1_RTOS_TASK_CREATE_RESTRICTED_STATIC_AFFINITY_SET_RETURN 554U
+#define MSG1_RTOS_TASK_CREATE_RESTRICTED_STATIC_AFFINITY_SET_RETURN 1224U
 // >>RTOS_MAIN "%N %t xTaskCreateRestrictedStaticAffinitySet RETURN: xReturn %u, "
 // >>RTOS_MAIN "dt=%[t-MSG3_RTOS_TASK_CREATE_RESTRICTED_STATIC_AFFINITY_SET_ENTER](*1e6).3f us\n"
 
 // MSG2_RTOS_TASK_CREATE_RESTRICTED_ENTER ""
-#define MSG2_RTOS_TASK_CREATE_RESTRICTED_ENTER 556U
+#define MSG2_RTOS_TASK_CREATE_RESTRICTED_ENTER 664U
 // >>RTOS_MAIN "%N %t xTaskCreateRestricted ENTER: pxTaskDefinition 0x%08X, pxCreatedTask 0x%08X\n"
 
 // MSG1_RTOS_TASK_CREATE_RESTRICTED_RETURN ""
-#define MSG1_RTOS_TASK_CREATE_RESTRICTED_RETURN 584U
+#define MSG1_RTOS_TASK_CREATE_RESTRICTED_RETURN 668U
 // >>RTOS_MAIN "%N %t xTaskCreateRestricted RETURN: xReturn %u, "
 // >>RTOS_MAIN "dt=%[t-MSG2_RTOS_TASK_CREATE_RESTRICTED_ENTER](*1e6).3f us\n"
 
 // MSG3_RTOS_TASK_CREATE_RESTRICTED_AFFINITY_SET_ENTER ""
-#define MSG3_RTOS_TASK_CREATE_RESTRICTED_AFFINITY_SET_ENTER 592U
+#define MSG3_RTOS_TASK_CREATE_RESTRICTED_AFFINITY_SET_ENTER 1232U
 // >>RTOS_MAIN "%N %t xTaskCreateRestrictedAffinitySet ENTER: pxTaskDefinition 0x%08X, "
 // >>RTOS_MAIN "uxCoreAffinityMask %u, pxCreatedTask 0x%08X\n"
 
 // MSG1_RTOS_TASK_CREATE_RESTRICTED_AFFINITY_SET_RETURN ""
-#define MSG1_RTOS_TASK_CREATE_RESTRICTED_AFFINITY_SET_RETURN 586U
+#define MSG1_RTOS_TASK_CREATE_RESTRICTED_AFFINITY_SET_RETURN 1240U
 // >>RTOS_MAIN "%N %t xTaskCreateRestrictedAffinitySet RETURN: xReturn %u, "
 // >>RTOS_MAIN "dt=%[t-MSG3_RTOS_TASK_CREATE_RESTRICTED_AFFINITY_SET_ENTER](*1e6).3f us\n"
 
 // MSG6_RTOS_TASK_CREATE_ENTER ""
-#define MSG6_RTOS_TASK_CREATE_ENTER 608U
+#define MSG6_RTOS_TASK_CREATE_ENTER 544U
 // >>RTOS_MAIN "%N %t xTaskCreate ENTER: pxTaskCode: 0x%08X, pcName 0x%08X, uxStackDepth %u, "
 // >>RTOS_MAIN "pvParameters 0x%08X, uxPriority %u, pxCreatedTask 0x%08X\n"
 
 // MSG1_RTOS_TASK_CREATE_RETURN ""
-#define MSG1_RTOS_TASK_CREATE_RETURN 588U
+#define MSG1_RTOS_TASK_CREATE_RETURN 560U
 // >>RTOS_MAIN "%N %t xTaskCreate RETURN: xReturn 0x%08X, "
 // >>RTOS_MAIN "dt=%[t-MSG6_RTOS_TASK_CREATE_ENTER](*1e6).3f us\n"
 
 // MSG7_RTOS_TASK_CREATE_AFFINITY_SET_ENTER ""
-#define MSG7_RTOS_TASK_CREATE_AFFINITY_SET_ENTER 624U
+#define MSG7_RTOS_TASK_CREATE_AFFINITY_SET_ENTER 576U
 // >>RTOS_MAIN "%N %t xTaskCreateAffinitySet ENTER: pxTaskCode 0x%08X, pcName 0x%08X, uxStackDepth %u, "
 // >>RTOS_MAIN "pvParameters 0x%08X, uxPriority %u, uxCoreAffinityMask %u, pxCreatedTask 0x%08X\n"
 
 // MSG1_RTOS_TASK_CREATE_AFFINITY_SET_RETURN ""
-#define MSG1_RTOS_TASK_CREATE_AFFINITY_SET_RETURN 590U
+#define MSG1_RTOS_TASK_CREATE_AFFINITY_SET_RETURN 592U
 // >>RTOS_MAIN "%N %t xTaskCreateAffinitySet RETURN: xReturn 0x%08X, "
 // >>RTOS_MAIN "dt=%[t-MSG7_RTOS_TASK_CREATE_AFFINITY_SET_ENTER](*1e6).3f us\n"
 
 // MSG1_RTOS_TASK_DELETE_ENTER ""
-#define MSG1_RTOS_TASK_DELETE_ENTER 600U
+#define MSG1_RTOS_TASK_DELETE_ENTER 532U
 // >>RTOS_MAIN "%N %t vTaskDelete ENTER: xTaskToDelete 0x%08X\n"
 
 // MSG0_RTOS_TASK_DELETE_RETURN ""
-#define MSG0_RTOS_TASK_DELETE_RETURN 602U
+#define MSG0_RTOS_TASK_DELETE_RETURN 534U
 // >>RTOS_MAIN "%N %t vTaskDelete RETURN, "
 // >>RTOS_MAIN "dt=%[t-MSG1_RTOS_TASK_DELETE_ENTER](*1e6).3f us\n"
 
 // MSG2_RTOS_TASK_DELAY_UNTIL_ENTER ""
-#define MSG2_RTOS_TASK_DELAY_UNTIL_ENTER 604U
+#define MSG2_RTOS_TASK_DELAY_UNTIL_ENTER 696U
 // >>RTOS_MAIN "%N %t xTaskDelayUntil ENTER: pxPreviousWakeTime 0x%08X, xTimeIncrement %u\n"
 
 // MSG1_RTOS_TASK_DELAY_UNTIL_RETURN ""
-#define MSG1_RTOS_TASK_DELAY_UNTIL_RETURN 640U
+#define MSG1_RTOS_TASK_DELAY_UNTIL_RETURN 700U
 // >>RTOS_MAIN "%N %t xTaskDelayUntil RETURN: xShouldDelay %u, "
 // >>RTOS_MAIN "dt=%[t-MSG2_RTOS_TASK_DELAY_UNTIL_ENTER](*1e6).3f us\n"
 
 // MSG1_RTOS_TASK_DELAY_ENTER ""
-#define MSG1_RTOS_TASK_DELAY_ENTER 642U
+#define MSG1_RTOS_TASK_DELAY_ENTER 564U
 // >>RTOS_MAIN "%N %t vTaskDelay ENTER: xTicksToDelay %u\n"
 
 // MSG0_RTOS_TASK_DELAY_RETURN ""
-#define MSG0_RTOS_TASK_DELAY_RETURN 603U
+#define MSG0_RTOS_TASK_DELAY_RETURN 566U
 // >>RTOS_MAIN "%N %t vTaskDelay RETURN, "
 // >>RTOS_MAIN "dt=%[t-MSG1_RTOS_TASK_DELAY_ENTER](*1e6).3f us\n"
 
 // MSG1_RTOS_TASK_GET_STATE_ENTER ""
-#define MSG1_RTOS_TASK_GET_STATE_ENTER 644U
+#define MSG1_RTOS_TASK_GET_STATE_ENTER 596U
 // >>RTOS_MAIN "%N %t eTaskGetState ENTER: xTask 0x%08X\n"
 
 // MSG1_RTOS_TASK_GET_STATE_RETURN ""
-#define MSG1_RTOS_TASK_GET_STATE_RETURN 646U
+#define MSG1_RTOS_TASK_GET_STATE_RETURN 598U
 // >>RTOS_MAIN "%N %t eTaskGetState RETURN: eReturn %u, "
 // >>RTOS_MAIN "dt=%[t-MSG1_RTOS_TASK_GET_STATE_ENTER](*1e6).3f us\n"
 
 // MSG1_RTOS_TASK_PRIORITY_GET_ENTER ""
-#define MSG1_RTOS_TASK_PRIORITY_GET_ENTER 648U
+#define MSG1_RTOS_TASK_PRIORITY_GET_ENTER 628U
 // >>RTOS_MAIN "%N %t uxTaskPriorityGet ENTER: xTask 0x%08X\n"
 
 // MSG1_RTOS_TASK_PRIORITY_GET_RETURN ""
-#define MSG1_RTOS_TASK_PRIORITY_GET_RETURN 650U
+#define MSG1_RTOS_TASK_PRIORITY_GET_RETURN 630U
 // >>RTOS_MAIN "%N %t uxTaskPriorityGet RETURN: uxReturn %u, "
 // >>RTOS_MAIN "dt=%[t-MSG1_RTOS_TASK_PRIORITY_GET_ENTER](*1e6).3f us\n"
 
 // MSG1_RTOS_TASK_PRIORITY_GET_FROM_ISR_ENTER ""
-#define MSG1_RTOS_TASK_PRIORITY_GET_FROM_ISR_ENTER 652U
+#define MSG1_RTOS_TASK_PRIORITY_GET_FROM_ISR_ENTER 660U
 // >>RTOS_MAIN "%N %t uxTaskPriorityGetFromISR ENTER: xTask 0x%08X\n"
 
 // MSG1_RTOS_TASK_PRIORITY_GET_FROM_ISR_RETURN ""
-#define MSG1_RTOS_TASK_PRIORITY_GET_FROM_ISR_RETURN 654U
+#define MSG1_RTOS_TASK_PRIORITY_GET_FROM_ISR_RETURN 662U
 // >>RTOS_MAIN "%N %t uxTaskPriorityGetFromISR RETURN: uxReturn %u, "
 // >>RTOS_MAIN "dt=%[t-MSG1_RTOS_TASK_PRIORITY_GET_FROM_ISR_ENTER](*1e6).3f us\n"
 
 // MSG1_RTOS_TASK_BASE_PRIORITY_GET_ENTER ""
-#define MSG1_RTOS_TASK_BASE_PRIORITY_GET_ENTER 656U
+#define MSG1_RTOS_TASK_BASE_PRIORITY_GET_ENTER 692U
 // >>RTOS_MAIN "%N %t uxTaskBasePriorityGet ENTER: xTask 0x%08X\n"
 
 // MSG1_RTOS_TASK_BASE_PRIORITY_GET_RETURN ""
-#define MSG1_RTOS_TASK_BASE_PRIORITY_GET_RETURN 658U
+#define MSG1_RTOS_TASK_BASE_PRIORITY_GET_RETURN 694U
 // >>RTOS_MAIN "%N %t uxTaskBasePriorityGet RETURN: uxReturn %u, "
 // >>RTOS_MAIN "dt=%[t-MSG1_RTOS_TASK_BASE_PRIORITY_GET_ENTER](*1e6).3f us\n"
 
 // MSG1_RTOS_TASK_BASE_PRIORITY_GET_FROM_ISR_ENTER ""
-#define MSG1_RTOS_TASK_BASE_PRIORITY_GET_FROM_ISR_ENTER 660U
+#define MSG1_RTOS_TASK_BASE_PRIORITY_GET_FROM_ISR_ENTER 724U
 // >>RTOS_MAIN "%N %t uxTaskBasePriorityGetFromISR ENTER: xTask 0x%08X\n"
 
 // MSG1_RTOS_TASK_BASE_PRIORITY_GET_FROM_ISR_RETURN ""
-#define MSG1_RTOS_TASK_BASE_PRIORITY_GET_FROM_ISR_RETURN 662U
+#define MSG1_RTOS_TASK_BASE_PRIORITY_GET_FROM_ISR_RETURN 726U
 // >>RTOS_MAIN "%N %t uxTaskBasePriorityGetFromISR RETURN: uxReturn %u, "
 // >>RTOS_MAIN "dt=%[t-MSG1_RTOS_TASK_BASE_PRIORITY_GET_FROM_ISR_ENTER](*1e6).3f us\n"
 
 // MSG2_RTOS_TASK_PRIORITY_SET_ENTER ""
-#define MSG2_RTOS_TASK_PRIORITY_SET_ENTER 664U
+#define MSG2_RTOS_TASK_PRIORITY_SET_ENTER 728U
 // >>RTOS_MAIN "%N %t vTaskPrioritySet ENTER: xTask 0x%08X, uxNewPriority %u\n"
 
 // MSG0_RTOS_TASK_PRIORITY_SET_RETURN ""
-#define MSG0_RTOS_TASK_PRIORITY_SET_RETURN 668U
+#define MSG0_RTOS_TASK_PRIORITY_SET_RETURN 732U
 // >>RTOS_MAIN "%N %t vTaskPrioritySet RETURN, "
 // >>RTOS_MAIN "dt=%[t-MSG2_RTOS_TASK_PRIORITY_SET_ENTER](*1e6).3f us\n"
 
 // MSG2_RTOS_TASK_CORE_AFFINITY_SET_ENTER ""
-#define MSG2_RTOS_TASK_CORE_AFFINITY_SET_ENTER 672U
+#define MSG2_RTOS_TASK_CORE_AFFINITY_SET_ENTER 760U
 // >>RTOS_MAIN "%N %t vTaskCoreAffinitySet ENTER: xTask 0x%08X, uxCoreAffinityMask %u\n"
 
 // MSG0_RTOS_TASK_CORE_AFFINITY_SET_RETURN ""
-#define MSG0_RTOS_TASK_CORE_AFFINITY_SET_RETURN 669U
+#define MSG0_RTOS_TASK_CORE_AFFINITY_SET_RETURN 764U
 // >>RTOS_MAIN "%N %t vTaskCoreAffinitySet RETURN, "
 // >>RTOS_MAIN "dt=%[t-MSG2_RTOS_TASK_CORE_AFFINITY_SET_ENTER](*1e6).3f us\n"
 
 // MSG1_RTOS_TASK_CORE_AFFINITY_GET_ENTER ""
-#define MSG1_RTOS_TASK_CORE_AFFINITY_GET_ENTER 670U
+#define MSG1_RTOS_TASK_CORE_AFFINITY_GET_ENTER 756U
 // >>RTOS_MAIN "%N %t vTaskCoreAffinityGet ENTER: xTask 0x%08X\n"
 
 // MSG1_RTOS_TASK_CORE_AFFINITY_GET_RETURN ""
-#define MSG1_RTOS_TASK_CORE_AFFINITY_GET_RETURN 676U
+#define MSG1_RTOS_TASK_CORE_AFFINITY_GET_RETURN 758U
 // >>RTOS_MAIN "%N %t vTaskCoreAffinityGet RETURN: uxCoreAffinityMask %u, "
 // >>RTOS_MAIN "dt=%[t-MSG1_RTOS_TASK_CORE_AFFINITY_GET_ENTER](*1e6).3f us\n"
 
 // MSG1_RTOS_TASK_PREEMPTION_DISABLE_ENTER ""
-#define MSG1_RTOS_TASK_PREEMPTION_DISABLE_ENTER 678U
+#define MSG1_RTOS_TASK_PREEMPTION_DISABLE_ENTER 788U
 // >>RTOS_MAIN "%N %t vTaskPreemptionDisable ENTER: xTask 0x%08X\n"
 
 // MSG0_RTOS_TASK_PREEMPTION_DISABLE_RETURN ""
-#define MSG0_RTOS_TASK_PREEMPTION_DISABLE_RETURN 680U
+#define MSG0_RTOS_TASK_PREEMPTION_DISABLE_RETURN 790U
 // >>RTOS_MAIN "%N %t vTaskPreemptionDisable RETURN, "
 // >>RTOS_MAIN "dt=%[t-MSG1_RTOS_TASK_PREEMPTION_DISABLE_ENTER](*1e6).3f us\n"
 
 // MSG1_RTOS_TASK_PREEMPTION_ENABLE_ENTER ""
-#define MSG1_RTOS_TASK_PREEMPTION_ENABLE_ENTER 682U
+#define MSG1_RTOS_TASK_PREEMPTION_ENABLE_ENTER 820U
 // >>RTOS_MAIN "%N %t vTaskPreemptionEnable ENTER: xTask 0x%08X\n"
 
 // MSG0_RTOS_TASK_PREEMPTION_ENABLE_RETURN ""
-#define MSG0_RTOS_TASK_PREEMPTION_ENABLE_RETURN 681U
+#define MSG0_RTOS_TASK_PREEMPTION_ENABLE_RETURN 822U
 // >>RTOS_MAIN "%N %t vTaskPreemptionEnable RETURN, "
 // >>RTOS_MAIN "dt=%[t-MSG1_RTOS_TASK_PREEMPTION_ENABLE_ENTER](*1e6).3f us\n"
 
 // MSG1_RTOS_TASK_SUSPEND_ENTER ""
-#define MSG1_RTOS_TASK_SUSPEND_ENTER 684U
+#define MSG1_RTOS_TASK_SUSPEND_ENTER 852U
 // >>RTOS_MAIN "%N %t vTaskSuspend ENTER: xTaskToSuspend 0x%08X\n"
 
 // MSG0_RTOS_TASK_SUSPEND_RETURN ""
-#define MSG0_RTOS_TASK_SUSPEND_RETURN 686U
+#define MSG0_RTOS_TASK_SUSPEND_RETURN 854U
 // >>RTOS_MAIN "%N %t vTaskSuspend RETURN, "
 // >>RTOS_MAIN "dt=%[t-MSG1_RTOS_TASK_SUSPEND_ENTER](*1e6).3f us\n"
 
 // MSG1_RTOS_TASK_RESUME_ENTER ""
-#define MSG1_RTOS_TASK_RESUME_ENTER 688U
+#define MSG1_RTOS_TASK_RESUME_ENTER 884U
 // >>RTOS_MAIN "%N %t vTaskResume ENTER: xTaskToResume 0x%08X\n"
 
 // MSG0_RTOS_TASK_RESUME_RETURN ""
-#define MSG0_RTOS_TASK_RESUME_RETURN 687U
+#define MSG0_RTOS_TASK_RESUME_RETURN 886U
 // >>RTOS_MAIN "%N %t vTaskResume RETURN, "
 // >>RTOS_MAIN "dt=%[t-MSG1_RTOS_TASK_RESUME_ENTER](*1e6).3f us\n"
 
 // MSG1_RTOS_TASK_RESUME_FROM_ISR_ENTER ""
-#define MSG1_RTOS_TASK_RESUME_FROM_ISR_ENTER 690U
+#define MSG1_RTOS_TASK_RESUME_FROM_ISR_ENTER 916U
 // >>RTOS_MAIN "%N %t xTaskResumeFromISR ENTER: xTaskToResume 0x%08X\n"
 
 // MSG1_RTOS_TASK_RESUME_FROM_ISR_RETURN ""
-#define MSG1_RTOS_TASK_RESUME_FROM_ISR_RETURN 692U
+#define MSG1_RTOS_TASK_RESUME_FROM_ISR_RETURN 918U
 // >>RTOS_MAIN "%N %t xTaskResumeFromISR RETURN: xYieldRequired %u, "
 // >>RTOS_MAIN "dt=%[t-MSG1_RTOS_TASK_RESUME_FROM_ISR_ENTER](*1e6).3f us\n"
 
 // MSG0_RTOS_START_SCHEDULER_ENTER ""
-#define MSG0_RTOS_START_SCHEDULER_ENTER 694U
+#define MSG0_RTOS_START_SCHEDULER_ENTER 398U
 // >>RTOS_MAIN "%N %t vTaskStartScheduler ENTER\n"
 
 // MSG0_RTOS_START_SCHEDULER_RETURN ""
-#define MSG0_RTOS_START_SCHEDULER_RETURN 695U
+#define MSG0_RTOS_START_SCHEDULER_RETURN 399U
 // >>RTOS_MAIN "%N %t vTaskStartScheduler RETURN, "
 // >>RTOS_MAIN "dt=%[t-MSG0_RTOS_START_SCHEDULER_ENTER](*1e6).3f us\n"
 
 // MSG0_RTOS_END_SCHEDULER_ENTER ""
-#define MSG0_RTOS_END_SCHEDULER_ENTER 696U
+#define MSG0_RTOS_END_SCHEDULER_ENTER 410U
 // >>RTOS_MAIN "%N %t vTaskEndScheduler ENTER\n"
 
 // MSG0_RTOS_END_SCHEDULER_RETURN ""
-#define MSG0_RTOS_END_SCHEDULER_RETURN 697U
+#define MSG0_RTOS_END_SCHEDULER_RETURN 411U
 // >>RTOS_MAIN "%N %t vTaskEndScheduler RETURN, "
 // >>RTOS_MAIN "dt=%[t-MSG0_RTOS_END_SCHEDULER_ENTER](*1e6).3f us\n"
 
 // MSG0_RTOS_SUSPEND_ALL_ENTER ""
-#define MSG0_RTOS_SUSPEND_ALL_ENTER 698U
+#define MSG0_RTOS_SUSPEND_ALL_ENTER 434U
 // >>RTOS_MAIN "%N %t vTaskSuspendAll ENTER\n"
 
 // MSG0_RTOS_SUSPEND_ALL_RETURN ""
-#define MSG0_RTOS_SUSPEND_ALL_RETURN 699U
+#define MSG0_RTOS_SUSPEND_ALL_RETURN 435U
 // >>RTOS_MAIN "%N %t vTaskSuspendAll RETURN, "
 // >>RTOS_MAIN "dt=%[t-MSG0_RTOS_SUSPEND_ALL_ENTER](*1e6).3f us\n"
 
 // MSG0_RTOS_RESUME_ALL_ENTER ""
-#define MSG0_RTOS_RESUME_ALL_ENTER 700U
+#define MSG0_RTOS_RESUME_ALL_ENTER 950U
 // >>RTOS_MAIN "%N %t xTaskResumeAll ENTER\n"
 
 // MSG1_RTOS_RESUME_ALL_RETURN ""
-#define MSG1_RTOS_RESUME_ALL_RETURN 702U
+#define MSG1_RTOS_RESUME_ALL_RETURN 948U
 // >>RTOS_MAIN "%N %t xTaskResumeAll RETURN: xAlreadyYielded %u, "
 // >>RTOS_MAIN "dt=%[t-MSG0_RTOS_RESUME_ALL_ENTER](*1e6).3f us\n"
 
 // MSG0_RTOS_GET_TICK_COUNT_ENTER ""
-#define MSG0_RTOS_GET_TICK_COUNT_ENTER 701U
+#define MSG0_RTOS_GET_TICK_COUNT_ENTER 982U
 // >>RTOS_MAIN "%N %t xTaskGetTickCount ENTER\n"
 
 // MSG1_RTOS_GET_TICK_COUNT_RETURN ""
-#define MSG1_RTOS_GET_TICK_COUNT_RETURN 704U
+#define MSG1_RTOS_GET_TICK_COUNT_RETURN 980U
 // >>RTOS_MAIN "%N %t xTaskGetTickCount RETURN: xTicks %u, "
 // >>RTOS_MAIN "dt=%[t-MSG0_RTOS_GET_TICK_COUNT_ENTER](*1e6).3f us\n"
 
 // MSG0_RTOS_GET_TICK_COUNT_FROM_ISR_ENTER ""
-#define MSG0_RTOS_GET_TICK_COUNT_FROM_ISR_ENTER 706U
+#define MSG0_RTOS_GET_TICK_COUNT_FROM_ISR_ENTER 1014U
 // >>RTOS_MAIN "%N %t xTaskGetTickCountFromISR ENTER\n"
 
 // MSG1_RTOS_GET_TICK_COUNT_FROM_ISR_RETURN ""
-#define MSG1_RTOS_GET_TICK_COUNT_FROM_ISR_RETURN 708U
+#define MSG1_RTOS_GET_TICK_COUNT_FROM_ISR_RETURN 1012U
 // >>RTOS_MAIN "%N %t xTaskGetTickCountFromISR RETURN: xReturn %u, "
 // >>RTOS_MAIN "dt=%[t-MSG0_RTOS_GET_TICK_COUNT_FROM_ISR_ENTER](*1e6).3f us\n"
 
 // MSG0_RTOS_GET_NUMBER_OF_TASKS_ENTER ""
-#define MSG0_RTOS_GET_NUMBER_OF_TASKS_ENTER 707U
+#define MSG0_RTOS_GET_NUMBER_OF_TASKS_ENTER 1046U
 // >>RTOS_MAIN "%N %t uxTaskGetNumberOfTasks ENTER\n"
 
 // MSG1_RTOS_GET_NUMBER_OF_TASKS_RETURN ""
-#define MSG1_RTOS_GET_NUMBER_OF_TASKS_RETURN 710U
+#define MSG1_RTOS_GET_NUMBER_OF_TASKS_RETURN 1044U
 // >>RTOS_MAIN "%N %t uxTaskGetNumberOfTasks RETURN: uxCurrentNumberOfTasks %u, "
 // >>RTOS_MAIN "dt=%[t-MSG0_RTOS_GET_NUMBER_OF_TASKS_ENTER](*1e6).3f us\n"
 
 // MSG1_RTOS_TASK_GET_NAME_ENTER ""
-#define MSG1_RTOS_TASK_GET_NAME_ENTER 712U
+#define MSG1_RTOS_TASK_GET_NAME_ENTER 1076U
 // >>RTOS_MAIN "%N %t pcTaskGetName ENTER: xTaskToQuery 0x%08X\n"
 
 // MSG1_RTOS_TASK_GET_NAME_RETURN ""
-#define MSG1_RTOS_TASK_GET_NAME_RETURN 714U
+#define MSG1_RTOS_TASK_GET_NAME_RETURN 1078U
 // >>RTOS_MAIN "%N %t pcTaskGetName RETURN: pcTaskName 0x%08X, "
 // >>RTOS_MAIN "dt=%[t-MSG1_RTOS_TASK_GET_NAME_ENTER](*1e6).3f us\n"
 
 // MSG1_RTOS_TASK_GET_HANDLE_ENTER ""
-#define MSG1_RTOS_TASK_GET_HANDLE_ENTER 716U
+#define MSG1_RTOS_TASK_GET_HANDLE_ENTER 1108U
 // >>RTOS_MAIN "%N %t xTaskGetHandle ENTER: pcNameToQuery 0x%08X\n"
 
 // MSG1_RTOS_TASK_GET_HANDLE_RETURN ""
-#define MSG1_RTOS_TASK_GET_HANDLE_RETURN 718U
+#define MSG1_RTOS_TASK_GET_HANDLE_RETURN 1110U
 // >>RTOS_MAIN "%N %t xTaskGetHandle RETURN: pxTCB 0x%08X, "
 // >>RTOS_MAIN "dt=%[t-MSG1_RTOS_TASK_GET_HANDLE_ENTER](*1e6).3f us\n"
 
 // MSG3_RTOS_TASK_GET_STATIC_BUFFERS_ENTER ""
-#define MSG3_RTOS_TASK_GET_STATIC_BUFFERS_ENTER 720U
+#define MSG3_RTOS_TASK_GET_STATIC_BUFFERS_ENTER 1248U
 // >>RTOS_MAIN "%N %t xTaskGetStaticBuffers ENTER: xTask 0x%08X, ppuxStackBuffer 0x%08X, "
 // >>RTOS_MAIN "ppxTaskBuffer 0x%08X\n"
 
 // MSG1_RTOS_TASK_GET_STATIC_BUFFERS_RETURN ""
-#define MSG1_RTOS_TASK_GET_STATIC_BUFFERS_RETURN 728U
+#define MSG1_RTOS_TASK_GET_STATIC_BUFFERS_RETURN 1256U
 // >>RTOS_MAIN "%N %t xTaskGetStaticBuffers RETURN: xReturn %u, "
 // >>RTOS_MAIN "dt=%[t-MSG3_RTOS_TASK_GET_STATIC_BUFFERS_ENTER](*1e6).3f us\n"
 
 // MSG3_RTOS_TASK_GET_SYSTEM_STATE_ENTER ""
-#define MSG3_RTOS_TASK_GET_SYSTEM_STATE_ENTER 736U
+#define MSG3_RTOS_TASK_GET_SYSTEM_STATE_ENTER 1264U
 // >>RTOS_MAIN "%N %t uxTaskGetSystemState ENTER: pxTaskStatusArray 0x%08X, "
 // >>RTOS_MAIN "uxArraySize %u, pulTotalRunTime 0x%08X\n"
 
 // MSG1_RTOS_TASK_GET_SYSTEM_STATE_RETURN ""
-#define MSG1_RTOS_TASK_GET_SYSTEM_STATE_RETURN 730U
+#define MSG1_RTOS_TASK_GET_SYSTEM_STATE_RETURN 1272U
 // >>RTOS_MAIN "%N %t uxTaskGetSystemState RETURN: uxTask 0x%08X, "
 // >>RTOS_MAIN "dt=%[t-MSG3_RTOS_TASK_GET_SYSTEM_STATE_ENTER](*1e6).3f us\n"
 
 // MSG0_RTOS_GET_IDLE_TASK_HANDLE_ENTER ""
-#define MSG0_RTOS_GET_IDLE_TASK_HANDLE_ENTER 732U
+#define MSG0_RTOS_GET_IDLE_TASK_HANDLE_ENTER 1142U
 // >>RTOS_MAIN "%N %t xTaskGetIdleTaskHandle ENTER\n"
 
 // MSG1_RTOS_GET_IDLE_TASK_HANDLE_RETURN ""
-#define MSG1_RTOS_GET_IDLE_TASK_HANDLE_RETURN 734U
+#define MSG1_RTOS_GET_IDLE_TASK_HANDLE_RETURN 1140U
 // >>RTOS_MAIN "%N %t xTaskGetIdleTaskHandle RETURN: xIdleTaskHandle 0x%08X, "
 // >>RTOS_MAIN "dt=%[t-MSG0_RTOS_GET_IDLE_TASK_HANDLE_ENTER](*1e6).3f us\n"
 
 // MSG1_RTOS_GET_IDLE_TASK_HANDLE_FOR_CORE_ENTER ""
-#define MSG1_RTOS_GET_IDLE_TASK_HANDLE_FOR_CORE_ENTER 744U
+#define MSG1_RTOS_GET_IDLE_TASK_HANDLE_FOR_CORE_ENTER 1172U
 // >>RTOS_MAIN "%N %t xTaskGetIdleTaskHandleForCore ENTER: xCoreID %u\n"
 
 // MSG1_RTOS_GET_IDLE_TASK_HANDLE_FOR_CORE_RETURN ""
-#define MSG1_RTOS_GET_IDLE_TASK_HANDLE_FOR_CORE_RETURN 746U
+#define MSG1_RTOS_GET_IDLE_TASK_HANDLE_FOR_CORE_RETURN 1174U
 // >>RTOS_MAIN "%N %t xTaskGetIdleTaskHandleForCore RETURN: xIdleTaskHandle 0x%08X, "
 // >>RTOS_MAIN "dt=%[t-MSG1_RTOS_GET_IDLE_TASK_HANDLE_FOR_CORE_ENTER](*1e6).3f us\n"
 
 // MSG1_RTOS_STEP_TICK_ENTER ""
-#define MSG1_RTOS_STEP_TICK_ENTER 748U
+#define MSG1_RTOS_STEP_TICK_ENTER 1204U
 // >>RTOS_MAIN "%N %t vTaskStepTick ENTER: xTicksToJump %u\n"
 
 // MSG0_RTOS_STEP_TICK_RETURN ""
-#define MSG0_RTOS_STEP_TICK_RETURN 733U
+#define MSG0_RTOS_STEP_TICK_RETURN 1206U
 // >>RTOS_MAIN "%N %t vTaskStepTick RETURN, "
 // >>RTOS_MAIN "dt=%[t-MSG1_RTOS_STEP_TICK_ENTER](*1e6).3f us\n"
 
 // MSG1_RTOS_CATCH_UP_TICKS_ENTER ""
-#define MSG1_RTOS_CATCH_UP_TICKS_ENTER 750U
+#define MSG1_RTOS_CATCH_UP_TICKS_ENTER 1228U
 // >>RTOS_MAIN "%N %t xTaskCatchUpTicks ENTER: xTicksToCatchUp %u\n"
 
 // MSG1_RTOS_CATCH_UP_TICKS_RETURN ""
-#define MSG1_RTOS_CATCH_UP_TICKS_RETURN 752U
+#define MSG1_RTOS_CATCH_UP_TICKS_RETURN 1230U
 // >>RTOS_MAIN "%N %t xTaskCatchUpTicks RETURN: xYieldOccurred %u, "
 // >>RTOS_MAIN "dt=%[t-MSG1_RTOS_CATCH_UP_TICKS_ENTER](*1e6).3f us\n"
 
 // MSG1_RTOS_ABORT_DELAY_ENTER ""
-#define MSG1_RTOS_ABORT_DELAY_ENTER 754U
+#define MSG1_RTOS_ABORT_DELAY_ENTER 1244U
 // >>RTOS_MAIN "%N %t xTaskAbortDelay ENTER: xTask 0x%08X\n"
 
 // MSG1_RTOS_ABORT_DELAY_RETURN ""
-#define MSG1_RTOS_ABORT_DELAY_RETURN 756U
+#define MSG1_RTOS_ABORT_DELAY_RETURN 1246U
 // >>RTOS_MAIN "%N %t xTaskAbortDelay RETURN: xReturn %u, "
 // >>RTOS_MAIN "dt=%[t-MSG1_RTOS_ABORT_DELAY_ENTER](*1e6).3f us\n"
 
 // MSG0_RTOS_INCREMENT_TICK_ENTER ""
-#define MSG0_RTOS_INCREMENT_TICK_ENTER 758U
+#define MSG0_RTOS_INCREMENT_TICK_ENTER 1262U
 // >>RTOS_MAIN "%N %t xTaskIncrementTick ENTER\n"
 
 // MSG1_RTOS_INCREMENT_TICK_RETURN ""
-#define MSG1_RTOS_INCREMENT_TICK_RETURN 760U
+#define MSG1_RTOS_INCREMENT_TICK_RETURN 1260U
 // >>RTOS_MAIN "%N %t xTaskIncrementTick RETURN: xSwitchRequired %u, "
 // >>RTOS_MAIN "dt=%[t-MSG0_RTOS_INCREMENT_TICK_ENTER](*1e6).3f us\n"
 
 // MSG2_RTOS_SET_APPLICATION_TASK_TAG_ENTER ""
-#define MSG2_RTOS_SET_APPLICATION_TASK_TAG_ENTER 764U
+#define MSG2_RTOS_SET_APPLICATION_TASK_TAG_ENTER 792U
 // >>RTOS_MAIN "%N %t vTaskSetApplicationTaskTag ENTER: xTask 0x%08X, pxHookFunction 0x%08X\n"
 
 // MSG0_RTOS_SET_APPLICATION_TASK_TAG_RETURN ""
-#define MSG0_RTOS_SET_APPLICATION_TASK_TAG_RETURN 759U
+#define MSG0_RTOS_SET_APPLICATION_TASK_TAG_RETURN 796U
 // >>RTOS_MAIN "%N %t vTaskSetApplicationTaskTag RETURN, "
 // >>RTOS_MAIN "dt=%[t-MSG2_RTOS_SET_APPLICATION_TASK_TAG_ENTER](*1e6).3f us\n"
 
 // MSG1_RTOS_GET_APPLICATION_TASK_TAG_ENTER ""
-#define MSG1_RTOS_GET_APPLICATION_TASK_TAG_ENTER 762U
+#define MSG1_RTOS_GET_APPLICATION_TASK_TAG_ENTER 1276U
 // >>RTOS_MAIN "%N %t xTaskGetApplicationTaskTag ENTER: xTask 0x%08X\n"
 
 // MSG1_RTOS_GET_APPLICATION_TASK_TAG_RETURN ""
-#define MSG1_RTOS_GET_APPLICATION_TASK_TAG_RETURN 768U
+#define MSG1_RTOS_GET_APPLICATION_TASK_TAG_RETURN 1278U
 // >>RTOS_MAIN "%N %t xTaskGetApplicationTaskTag RETURN: xReturn 0x%08X, "
 // >>RTOS_MAIN "dt=%[t-MSG1_RTOS_GET_APPLICATION_TASK_TAG_ENTER](*1e6).3f us\n"
 
 // MSG1_RTOS_GET_APPLICATION_TASK_TAG_FROM_ISR_ENTER ""
-#define MSG1_RTOS_GET_APPLICATION_TASK_TAG_FROM_ISR_ENTER 770U
+#define MSG1_RTOS_GET_APPLICATION_TASK_TAG_FROM_ISR_ENTER 1292U
 // >>RTOS_MAIN "%N %t xTaskGetApplicationTaskTagFromISR ENTER: xTask 0x%08X\n"
 
 // MSG1_RTOS_GET_APPLICATION_TASK_TAG_FROM_ISR_RETURN ""
-#define MSG1_RTOS_GET_APPLICATION_TASK_TAG_FROM_ISR_RETURN 772U
+#define MSG1_RTOS_GET_APPLICATION_TASK_TAG_FROM_ISR_RETURN 1294U
 // >>RTOS_MAIN "%N %t xTaskGetApplicationTaskTagFromISR RETURN: xReturn 0x%08X, "
 // >>RTOS_MAIN "dt=%[t-MSG1_RTOS_GET_APPLICATION_TASK_TAG_FROM_ISR_ENTER](*1e6).3f us\n"
 
 // MSG2_RTOS_CALL_APPLICATION_TASK_HOOK_ENTER ""
-#define MSG2_RTOS_CALL_APPLICATION_TASK_HOOK_ENTER 776U
+#define MSG2_RTOS_CALL_APPLICATION_TASK_HOOK_ENTER 824U
 // >>RTOS_MAIN "%N %t xTaskCallApplicationTaskHook ENTER: xTask 0x%08X, pvParameter 0x%08X\n"
 
 // MSG1_RTOS_CALL_APPLICATION_TASK_HOOK_RETURN ""
-#define MSG1_RTOS_CALL_APPLICATION_TASK_HOOK_RETURN 774U
+#define MSG1_RTOS_CALL_APPLICATION_TASK_HOOK_RETURN 828U
 // >>RTOS_MAIN "%N %t xTaskCallApplicationTaskHook RETURN: xReturn %u, "
 // >>RTOS_MAIN "dt=%[t-MSG2_RTOS_CALL_APPLICATION_TASK_HOOK_ENTER](*1e6).3f us\n"
 
 // MSG0_RTOS_SWITCH_CONTEXT_ENTER ""
-#define MSG0_RTOS_SWITCH_CONTEXT_ENTER 780U
+#define MSG0_RTOS_SWITCH_CONTEXT_ENTER 446U
 // >>RTOS_MAIN "%N %t vTaskSwitchContext ENTER\n"
 
 // MSG0_RTOS_SWITCH_CONTEXT_RETURN ""
-#define MSG0_RTOS_SWITCH_CONTEXT_RETURN 781U
+#define MSG0_RTOS_SWITCH_CONTEXT_RETURN 447U
 // >>RTOS_MAIN "%N %t vTaskSwitchContext RETURN, "
 // >>RTOS_MAIN "dt=%[t-MSG0_RTOS_SWITCH_CONTEXT_ENTER](*1e6).3f us\n"
 
 // MSG2_RTOS_PLACE_ON_EVENT_LIST_ENTER ""
-#define MSG2_RTOS_PLACE_ON_EVENT_LIST_ENTER 784U
+#define MSG2_RTOS_PLACE_ON_EVENT_LIST_ENTER 856U
 // >>RTOS_MAIN "%N %t vTaskPlaceOnEventList ENTER: pxEventList 0x%08X, xTicksToWait %u\n"
 
 // MSG0_RTOS_PLACE_ON_EVENT_LIST_RETURN ""
-#define MSG0_RTOS_PLACE_ON_EVENT_LIST_RETURN 782U
+#define MSG0_RTOS_PLACE_ON_EVENT_LIST_RETURN 860U
 // >>RTOS_MAIN "%N %t vTaskPlaceOnEventList RETURN, "
 // >>RTOS_MAIN "dt=%[t-MSG2_RTOS_PLACE_ON_EVENT_LIST_ENTER](*1e6).3f us\n"
 
 // MSG3_RTOS_PLACE_ON_UNORDERED_EVENT_LIST_ENTER ""
-#define MSG3_RTOS_PLACE_ON_UNORDERED_EVENT_LIST_ENTER 792U
+#define MSG3_RTOS_PLACE_ON_UNORDERED_EVENT_LIST_ENTER 1280U
 // >>RTOS_MAIN "%N %t vTaskPlaceOnUnorderedEventList ENTER: pxEventList 0x%08X, "
 // >>RTOS_MAIN "xItemValue %u, xTicksToWait %u\n"
 
 // MSG0_RTOS_PLACE_ON_UNORDERED_EVENT_LIST_RETURN ""
-#define MSG0_RTOS_PLACE_ON_UNORDERED_EVENT_LIST_RETURN 783U
+#define MSG0_RTOS_PLACE_ON_UNORDERED_EVENT_LIST_RETURN 1288U
 // >>RTOS_MAIN "%N %t vTaskPlaceOnUnorderedEventList RETURN, "
 // >>RTOS_MAIN "dt=%[t-MSG3_RTOS_PLACE_ON_UNORDERED_EVENT_LIST_ENTER](*1e6).3f us\n"
 
 // MSG3_RTOS_PLACE_ON_EVENT_LIST_RESTRICTED_ENTER ""
-#define MSG3_RTOS_PLACE_ON_EVENT_LIST_RESTRICTED_ENTER 800U
+#define MSG3_RTOS_PLACE_ON_EVENT_LIST_RESTRICTED_ENTER 1296U
 // >>RTOS_MAIN "%N %t vTaskPlaceOnEventListRestricted ENTER: pxEventList 0x%08X, "
 // >>RTOS_MAIN "xTicksToWait %u, xWaitIndefinitely %u\n"
 
 // MSG0_RTOS_PLACE_ON_EVENT_LIST_RESTRICTED_RETURN ""
-#define MSG0_RTOS_PLACE_ON_EVENT_LIST_RESTRICTED_RETURN 788U
+#define MSG0_RTOS_PLACE_ON_EVENT_LIST_RESTRICTED_RETURN 1304U
 // >>RTOS_MAIN "%N %t vTaskPlaceOnEventListRestricted RETURN, "
 // >>RTOS_MAIN "dt=%[t-MSG3_RTOS_PLACE_ON_EVENT_LIST_RESTRICTED_ENTER](*1e6).3f us\n"
 
 // MSG1_RTOS_REMOVE_FROM_EVENT_LIST_ENTER ""
-#define MSG1_RTOS_REMOVE_FROM_EVENT_LIST_ENTER 790U
+#define MSG1_RTOS_REMOVE_FROM_EVENT_LIST_ENTER 1308U
 // >>RTOS_MAIN "%N %t xTaskRemoveFromEventList ENTER: pxEventList 0x%08X\n"
 
 // MSG1_RTOS_REMOVE_FROM_EVENT_LIST_RETURN ""
-#define MSG1_RTOS_REMOVE_FROM_EVENT_LIST_RETURN 808U
+#define MSG1_RTOS_REMOVE_FROM_EVENT_LIST_RETURN 1310U
 // >>RTOS_MAIN "%N %t xTaskRemoveFromEventList RETURN: xReturn %u, "
 // >>RTOS_MAIN "dt=%[t-MSG1_RTOS_REMOVE_FROM_EVENT_LIST_ENTER](*1e6).3f us\n"
 
 // MSG2_RTOS_REMOVE_FROM_UNORDERED_EVENT_LIST_ENTER ""
-#define MSG2_RTOS_REMOVE_FROM_UNORDERED_EVENT_LIST_ENTER 812U
+#define MSG2_RTOS_REMOVE_FROM_UNORDERED_EVENT_LIST_ENTER 888U
 // >>RTOS_MAIN "%N %t vTaskRemoveFromUnorderedEventList ENTER: pxEventListItem 0x%08X, xItemValue %u\n"
 
 // MSG0_RTOS_REMOVE_FROM_UNORDERED_EVENT_LIST_RETURN ""
-#define MSG0_RTOS_REMOVE_FROM_UNORDERED_EVENT_LIST_RETURN 789U
+#define MSG0_RTOS_REMOVE_FROM_UNORDERED_EVENT_LIST_RETURN 892U
 // >>RTOS_MAIN "%N %t vTaskRemoveFromUnorderedEventList RETURN, "
 // >>RTOS_MAIN "dt=%[t-MSG2_RTOS_REMOVE_FROM_UNORDERED_EVENT_LIST_ENTER](*1e6).3f us\n"
 
 // MSG1_RTOS_SET_TIME_OUT_STATE_ENTER ""
-#define MSG1_RTOS_SET_TIME_OUT_STATE_ENTER 810U
+#define MSG1_RTOS_SET_TIME_OUT_STATE_ENTER 1324U
 // >>RTOS_MAIN "%N %t vTaskSetTimeOutState ENTER: pxTimeOut 0x%08X\n"
 
 // MSG0_RTOS_SET_TIME_OUT_STATE_RETURN ""
-#define MSG0_RTOS_SET_TIME_OUT_STATE_RETURN 816U
+#define MSG0_RTOS_SET_TIME_OUT_STATE_RETURN 1326U
 // >>RTOS_MAIN "%N %t vTaskSetTimeOutState RETURN, "
 // >>RTOS_MAIN "dt=%[t-MSG1_RTOS_SET_TIME_OUT_STATE_ENTER](*1e6).3f us\n"
 
 // MSG1_RTOS_INTERNAL_SET_TIME_OUT_STATE_ENTER ""
-#define MSG1_RTOS_INTERNAL_SET_TIME_OUT_STATE_ENTER 818U
+#define MSG1_RTOS_INTERNAL_SET_TIME_OUT_STATE_ENTER 1340U
 // >>RTOS_MAIN "%N %t vTaskInternalSetTimeOutState ENTER: pxTimeOut 0x%08X\n"
 
 // MSG0_RTOS_INTERNAL_SET_TIME_OUT_STATE_RETURN ""
-#define MSG0_RTOS_INTERNAL_SET_TIME_OUT_STATE_RETURN 817U
+#define MSG0_RTOS_INTERNAL_SET_TIME_OUT_STATE_RETURN 1342U
 // >>RTOS_MAIN "%N %t vTaskInternalSetTimeOutState RETURN, "
 // >>RTOS_MAIN "dt=%[t-MSG1_RTOS_INTERNAL_SET_TIME_OUT_STATE_ENTER](*1e6).3f us\n"
 
 // MSG2_RTOS_CHECK_FOR_TIME_OUT_ENTER ""
-#define MSG2_RTOS_CHECK_FOR_TIME_OUT_ENTER 820U
+#define MSG2_RTOS_CHECK_FOR_TIME_OUT_ENTER 920U
 // >>RTOS_MAIN "%N %t xTaskCheckForTimeOut ENTER: pxTimeOut 0x%08X, pxTicksToWait 0x%08X\n"
 
 // MSG1_RTOS_CHECK_FOR_TIME_OUT_RETURN ""
-#define MSG1_RTOS_CHECK_FOR_TIME_OUT_RETURN 824U
+#define MSG1_RTOS_CHECK_FOR_TIME_OUT_RETURN 924U
 // >>RTOS_MAIN "%N %t xTaskCheckForTimeOut RETURN: xReturn %u, "
 // >>RTOS_MAIN "dt=%[t-MSG2_RTOS_CHECK_FOR_TIME_OUT_ENTER](*1e6).3f us\n"
 
 // MSG0_RTOS_MISSED_YIELD_ENTER ""
-#define MSG0_RTOS_MISSED_YIELD_ENTER 826U
+#define MSG0_RTOS_MISSED_YIELD_ENTER 466U
 // >>RTOS_MAIN "%N %t vTaskMissedYield ENTER\n"
 
 // MSG0_RTOS_MISSED_YIELD_RETURN ""
-#define MSG0_RTOS_MISSED_YIELD_RETURN 827U
+#define MSG0_RTOS_MISSED_YIELD_RETURN 467U
 // >>RTOS_MAIN "%N %t vTaskMissedYield RETURN, "
 // >>RTOS_MAIN "dt=%[t-MSG0_RTOS_MISSED_YIELD_ENTER](*1e6).3f us\n"
 
 // MSG1_RTOS_GET_TASK_NUMBER_ENTER ""
-#define MSG1_RTOS_GET_TASK_NUMBER_ENTER 828U
+#define MSG1_RTOS_GET_TASK_NUMBER_ENTER 1356U
 // >>RTOS_MAIN "%N %t uxTaskGetTaskNumber ENTER: xTask 0x%08X\n"
 
 // MSG1_RTOS_GET_TASK_NUMBER_RETURN ""
-#define MSG1_RTOS_GET_TASK_NUMBER_RETURN 830U
+#define MSG1_RTOS_GET_TASK_NUMBER_RETURN 1358U
 // >>RTOS_MAIN "%N %t uxTaskGetTaskNumber RETURN: uxReturn %u, "
 // >>RTOS_MAIN "dt=%[t-MSG1_RTOS_GET_TASK_NUMBER_ENTER](*1e6).3f us\n"
 
 // MSG2_RTOS_SET_TASK_NUMBER_ENTER ""
-#define MSG2_RTOS_SET_TASK_NUMBER_ENTER 832U
+#define MSG2_RTOS_SET_TASK_NUMBER_ENTER 952U
 // >>RTOS_MAIN "%N %t vTaskSetTaskNumber ENTER: xTask 0x%08X, uxHandle 0x%08X\n"
 
 // MSG0_RTOS_SET_TASK_NUMBER_RETURN ""
-#define MSG0_RTOS_SET_TASK_NUMBER_RETURN 836U
+#define MSG0_RTOS_SET_TASK_NUMBER_RETURN 956U
 // >>RTOS_MAIN "%N %t vTaskSetTaskNumber RETURN, "
 // >>RTOS_MAIN "dt=%[t-MSG2_RTOS_SET_TASK_NUMBER_ENTER](*1e6).3f us\n"
 
 // MSG0_RTOS_CONFIRM_SLEEP_MODE_STATUS_ENTER ""
-#define MSG0_RTOS_CONFIRM_SLEEP_MODE_STATUS_ENTER 837U
+#define MSG0_RTOS_CONFIRM_SLEEP_MODE_STATUS_ENTER 1374U
 // >>RTOS_MAIN "%N %t eTaskConfirmSleepModeStatus ENTER\n"
 
 // MSG1_RTOS_CONFIRM_SLEEP_MODE_STATUS_RETURN ""
-#define MSG1_RTOS_CONFIRM_SLEEP_MODE_STATUS_RETURN 838U
+#define MSG1_RTOS_CONFIRM_SLEEP_MODE_STATUS_RETURN 1372U
 // >>RTOS_MAIN "%N %t eTaskConfirmSleepModeStatus RETURN: eReturn %u, "
 // >>RTOS_MAIN "dt=%[t-MSG0_RTOS_CONFIRM_SLEEP_MODE_STATUS_ENTER](*1e6).3f us\n"
 
 // MSG3_RTOS_SET_THREAD_LOCAL_STORAGE_POINTER_ENTER ""
-#define MSG3_RTOS_SET_THREAD_LOCAL_STORAGE_POINTER_ENTER 840U
+#define MSG3_RTOS_SET_THREAD_LOCAL_STORAGE_POINTER_ENTER 1312U
 // >>RTOS_MAIN "%N %t vTaskSetThreadLocalStoragePointer ENTER: xTaskToSet 0x%08X, "
 // >>RTOS_MAIN "xIndex %u, pvValue 0x%08X\n"
 
 // MSG0_RTOS_SET_THREAD_LOCAL_STORAGE_POINTER_RETURN ""
-#define MSG0_RTOS_SET_THREAD_LOCAL_STORAGE_POINTER_RETURN 848U
+#define MSG0_RTOS_SET_THREAD_LOCAL_STORAGE_POINTER_RETURN 1320U
 // >>RTOS_MAIN "%N %t vTaskSetThreadLocalStoragePointer RETURN, "
 // >>RTOS_MAIN "dt=%[t-MSG3_RTOS_SET_THREAD_LOCAL_STORAGE_POINTER_ENTER](*1e6).3f us\n"
 
 // MSG2_RTOS_GET_THREAD_LOCAL_STORAGE_POINTER_ENTER ""
-#define MSG2_RTOS_GET_THREAD_LOCAL_STORAGE_POINTER_ENTER 852U
+#define MSG2_RTOS_GET_THREAD_LOCAL_STORAGE_POINTER_ENTER 984U
 // >>RTOS_MAIN "%N %t pvTaskGetThreadLocalStoragePointer ENTER: xTaskToQuery 0x%08X, xIndex %u\n"
 
 // MSG1_RTOS_GET_THREAD_LOCAL_STORAGE_POINTER_RETURN ""
-#define MSG1_RTOS_GET_THREAD_LOCAL_STORAGE_POINTER_RETURN 850U
+#define MSG1_RTOS_GET_THREAD_LOCAL_STORAGE_POINTER_RETURN 988U
 // >>RTOS_MAIN "%N %t pvTaskGetThreadLocalStoragePointer RETURN: pvReturn 0x%08X, "
 // >>RTOS_MAIN "dt=%[t-MSG2_RTOS_GET_THREAD_LOCAL_STORAGE_POINTER_ENTER](*1e6).3f us\n"
 
 // MSG2_RTOS_ALLOCATE_MPU_REGIONS_ENTER ""
-#define MSG2_RTOS_ALLOCATE_MPU_REGIONS_ENTER 856U
+#define MSG2_RTOS_ALLOCATE_MPU_REGIONS_ENTER 1016U
 // >>RTOS_MAIN "%N %t vTaskAllocateMPURegions ENTER: xTaskToModify 0x%08X, pxRegions 0x%08X\n"
 
 // MSG0_RTOS_ALLOCATE_MPU_REGIONS_RETURN ""
-#define MSG0_RTOS_ALLOCATE_MPU_REGIONS_RETURN 849U
+#define MSG0_RTOS_ALLOCATE_MPU_REGIONS_RETURN 1020U
 // >>RTOS_MAIN "%N %t vTaskAllocateMPURegions RETURN, "
 // >>RTOS_MAIN "dt=%[t-MSG2_RTOS_ALLOCATE_MPU_REGIONS_ENTER](*1e6).3f us\n"
 
 // MSG4_RTOS_TASK_GET_INFO_ENTER ""
-#define MSG4_RTOS_TASK_GET_INFO_ENTER 864U
+#define MSG4_RTOS_TASK_GET_INFO_ENTER 608U
 // >>RTOS_MAIN "%N %t vTaskGetInfo ENTER: xTask 0x%08X, pxTaskStatus 0x%08X, "
 // >>RTOS_MAIN "xGetFreeStackSpace %u, eState %u\n"
 
 // MSG0_RTOS_TASK_GET_INFO_RETURN ""
-#define MSG0_RTOS_TASK_GET_INFO_RETURN 860U
+#define MSG0_RTOS_TASK_GET_INFO_RETURN 624U
 // >>RTOS_MAIN "%N %t vTaskGetInfo RETURN, "
 // >>RTOS_MAIN "dt=%[t-MSG4_RTOS_TASK_GET_INFO_ENTER](*1e6).3f us\n"
 
 // MSG1_RTOS_GET_STACK_HIGH_WATER_MARK2_ENTER ""
-#define MSG1_RTOS_GET_STACK_HIGH_WATER_MARK2_ENTER 862U
+#define MSG1_RTOS_GET_STACK_HIGH_WATER_MARK2_ENTER 1388U
 // >>RTOS_MAIN "%N %t uxTaskGetStackHighWaterMark2 ENTER: xTask 0x%08X\n"
 
 // MSG1_RTOS_GET_STACK_HIGH_WATER_MARK2_RETURN ""
-#define MSG1_RTOS_GET_STACK_HIGH_WATER_MARK2_RETURN 880U
+#define MSG1_RTOS_GET_STACK_HIGH_WATER_MARK2_RETURN 1390U
 // >>RTOS_MAIN "%N %t uxTaskGetStackHighWaterMark2 RETURN: uxReturn %u, "
 // >>RTOS_MAIN "dt=%[t-MSG1_RTOS_GET_STACK_HIGH_WATER_MARK2_ENTER](*1e6).3f us\n"
 
 // MSG1_RTOS_GET_STACK_HIGH_WATER_MARK_ENTER ""
-#define MSG1_RTOS_GET_STACK_HIGH_WATER_MARK_ENTER 882U
+#define MSG1_RTOS_GET_STACK_HIGH_WATER_MARK_ENTER 1404U
 // >>RTOS_MAIN "%N %t uxTaskGetStackHighWaterMark ENTER: xTask 0x%08X\n"
 
 // MSG1_RTOS_GET_STACK_HIGH_WATER_MARK_RETURN ""
-#define MSG1_RTOS_GET_STACK_HIGH_WATER_MARK_RETURN 884U
+#define MSG1_RTOS_GET_STACK_HIGH_WATER_MARK_RETURN 1406U
 // >>RTOS_MAIN "%N %t uxTaskGetStackHighWaterMark RETURN: uxReturn %u, "
 // >>RTOS_MAIN "dt=%[t-MSG1_RTOS_GET_STACK_HIGH_WATER_MARK_ENTER](*1e6).3f us\n"
 
 // MSG0_RTOS_GET_CURRENT_TASK_HANDLE_ENTER ""
-#define MSG0_RTOS_GET_CURRENT_TASK_HANDLE_ENTER 861U
+#define MSG0_RTOS_GET_CURRENT_TASK_HANDLE_ENTER 1422U
 // >>RTOS_MAIN "%N %t xTaskGetCurrentTaskHandle ENTER\n"
 
 // MSG1_RTOS_GET_CURRENT_TASK_HANDLE_RETURN ""
-#define MSG1_RTOS_GET_CURRENT_TASK_HANDLE_RETURN 886U
+#define MSG1_RTOS_GET_CURRENT_TASK_HANDLE_RETURN 1420U
 // >>RTOS_MAIN "%N %t xTaskGetCurrentTaskHandle RETURN: xReturn 0x%08X, "
 // >>RTOS_MAIN "dt=%[t-MSG0_RTOS_GET_CURRENT_TASK_HANDLE_ENTER](*1e6).3f us\n"
 
 // MSG1_RTOS_GET_CURRENT_TASK_HANDLE_FOR_CORE_ENTER ""
-#define MSG1_RTOS_GET_CURRENT_TASK_HANDLE_FOR_CORE_ENTER 888U
+#define MSG1_RTOS_GET_CURRENT_TASK_HANDLE_FOR_CORE_ENTER 1436U
 // >>RTOS_MAIN "%N %t xTaskGetCurrentTaskHandleForCore ENTER: xCoreID %u\n"
 
 // MSG1_RTOS_GET_CURRENT_TASK_HANDLE_FOR_CORE_RETURN ""
-#define MSG1_RTOS_GET_CURRENT_TASK_HANDLE_FOR_CORE_RETURN 890U
+#define MSG1_RTOS_GET_CURRENT_TASK_HANDLE_FOR_CORE_RETURN 1438U
 // >>RTOS_MAIN "%N %t xTaskGetCurrentTaskHandleForCore RETURN: xReturn 0x%08X, "
 // >>RTOS_MAIN "dt=%[t-MSG1_RTOS_GET_CURRENT_TASK_HANDLE_FOR_CORE_ENTER](*1e6).3f us\n"
 
 // MSG0_RTOS_GET_SCHEDULER_STATE_ENTER ""
-#define MSG0_RTOS_GET_SCHEDULER_STATE_ENTER 892U
+#define MSG0_RTOS_GET_SCHEDULER_STATE_ENTER 1454U
 // >>RTOS_MAIN "%N %t xTaskGetSchedulerState ENTER\n"
 
 // MSG1_RTOS_GET_SCHEDULER_STATE_RETURN ""
-#define MSG1_RTOS_GET_SCHEDULER_STATE_RETURN 894U
+#define MSG1_RTOS_GET_SCHEDULER_STATE_RETURN 1452U
 // >>RTOS_MAIN "%N %t xTaskGetSchedulerState RETURN: xReturn %u, "
 // >>RTOS_MAIN "dt=%[t-MSG0_RTOS_GET_SCHEDULER_STATE_ENTER](*1e6).3f us\n"
 
 // MSG1_RTOS_PRIORITY_INHERIT_ENTER ""
-#define MSG1_RTOS_PRIORITY_INHERIT_ENTER 896U
+#define MSG1_RTOS_PRIORITY_INHERIT_ENTER 1468U
 // >>RTOS_MAIN "%N %t xTaskPriorityInherit ENTER: pxMutexHolder 0x%08X\n"
 
 // MSG1_RTOS_PRIORITY_INHERIT_RETURN ""
-#define MSG1_RTOS_PRIORITY_INHERIT_RETURN 898U
+#define MSG1_RTOS_PRIORITY_INHERIT_RETURN 1470U
 // >>RTOS_MAIN "%N %t xTaskPriorityInherit RETURN: xReturn %u, "
 // >>RTOS_MAIN "dt=%[t-MSG1_RTOS_PRIORITY_INHERIT_ENTER](*1e6).3f us\n"
 
 // MSG1_RTOS_PRIORITY_DISINHERIT_ENTER ""
-#define MSG1_RTOS_PRIORITY_DISINHERIT_ENTER 900U
+#define MSG1_RTOS_PRIORITY_DISINHERIT_ENTER 1484U
 // >>RTOS_MAIN "%N %t xTaskPriorityDisinherit ENTER: pxMutexHolder 0x%08X\n"
 
 // MSG1_RTOS_PRIORITY_DISINHERIT_RETURN ""
-#define MSG1_RTOS_PRIORITY_DISINHERIT_RETURN 902U
+#define MSG1_RTOS_PRIORITY_DISINHERIT_RETURN 1486U
 // >>RTOS_MAIN "%N %t xTaskPriorityDisinherit RETURN: xReturn %u, "
 // >>RTOS_MAIN "dt=%[t-MSG1_RTOS_PRIORITY_DISINHERIT_ENTER](*1e6).3f us\n"
 
 // MSG2_RTOS_PRIORITY_DISINHERIT_AFTER_TIMEOUT_ENTER ""
-#define MSG2_RTOS_PRIORITY_DISINHERIT_AFTER_TIMEOUT_ENTER 904U
+#define MSG2_RTOS_PRIORITY_DISINHERIT_AFTER_TIMEOUT_ENTER 1048U
 // >>RTOS_MAIN "%N %t vTaskPriorityDisinheritAfterTimeout ENTER: pxMutexHolder 0x%08X, "
 // >>RTOS_MAIN "uxHighestPriorityWaitingTask 0x%08X\n"
 
 // MSG0_RTOS_PRIORITY_DISINHERIT_AFTER_TIMEOUT_RETURN ""
-#define MSG0_RTOS_PRIORITY_DISINHERIT_AFTER_TIMEOUT_RETURN 893U
+#define MSG0_RTOS_PRIORITY_DISINHERIT_AFTER_TIMEOUT_RETURN 1052U
 // >>RTOS_MAIN "%N %t vTaskPriorityDisinheritAfterTimeout RETURN, "
 // >>RTOS_MAIN "dt=%[t-MSG2_RTOS_PRIORITY_DISINHERIT_AFTER_TIMEOUT_ENTER](*1e6).3f us\n"
 
 // MSG0_RTOS_YIELD_WITHIN_API_ENTER ""
-#define MSG0_RTOS_YIELD_WITHIN_API_ENTER 908U
+#define MSG0_RTOS_YIELD_WITHIN_API_ENTER 478U
 // >>RTOS_MAIN "%N %t vTaskYieldWithinAPI ENTER\n"
 
 // MSG0_RTOS_YIELD_WITHIN_API_RETURN ""
-#define MSG0_RTOS_YIELD_WITHIN_API_RETURN 909U
+#define MSG0_RTOS_YIELD_WITHIN_API_RETURN 479U
 // >>RTOS_MAIN "%N %t vTaskYieldWithinAPI RETURN, "
 // >>RTOS_MAIN "dt=%[t-MSG0_RTOS_YIELD_WITHIN_API_ENTER](*1e6).3f us\n"
 
 // MSG0_RTOS_ENTER_CRITICAL_ENTER ""
-#define MSG0_RTOS_ENTER_CRITICAL_ENTER 910U
+#define MSG0_RTOS_ENTER_CRITICAL_ENTER 498U
 // >>RTOS_MAIN "%N %t vTaskEnterCritical ENTER\n"
 
 // MSG0_RTOS_ENTER_CRITICAL_RETURN ""
-#define MSG0_RTOS_ENTER_CRITICAL_RETURN 911U
+#define MSG0_RTOS_ENTER_CRITICAL_RETURN 499U
 // >>RTOS_MAIN "%N %t vTaskEnterCritical RETURN, "
 // >>RTOS_MAIN "dt=%[t-MSG0_RTOS_ENTER_CRITICAL_ENTER](*1e6).3f us\n"
 
 // MSG0_RTOS_ENTER_CRITICAL_FROM_ISR_ENTER ""
-#define MSG0_RTOS_ENTER_CRITICAL_FROM_ISR_ENTER 912U
+#define MSG0_RTOS_ENTER_CRITICAL_FROM_ISR_ENTER 1502U
 // >>RTOS_MAIN "%N %t vTaskEnterCriticalFromISR ENTER\n"
 
 // MSG1_RTOS_ENTER_CRITICAL_FROM_ISR_RETURN ""
-#define MSG1_RTOS_ENTER_CRITICAL_FROM_ISR_RETURN 914U
+#define MSG1_RTOS_ENTER_CRITICAL_FROM_ISR_RETURN 1500U
 // >>RTOS_MAIN "%N %t vTaskEnterCriticalFromISR RETURN: uxSavedInterruptStatus %u, "
 // >>RTOS_MAIN "dt=%[t-MSG0_RTOS_ENTER_CRITICAL_FROM_ISR_ENTER](*1e6).3f us\n"
 
 // MSG0_RTOS_EXIT_CRITICAL_ENTER ""
-#define MSG0_RTOS_EXIT_CRITICAL_ENTER 913U
+#define MSG0_RTOS_EXIT_CRITICAL_ENTER 510U
 // >>RTOS_MAIN "%N %t vTaskExitCritical ENTER\n"
 
 // MSG0_RTOS_EXIT_CRITICAL_RETURN ""
-#define MSG0_RTOS_EXIT_CRITICAL_RETURN 916U
+#define MSG0_RTOS_EXIT_CRITICAL_RETURN 511U
 // >>RTOS_MAIN "%N %t vTaskExitCritical RETURN, "
 // >>RTOS_MAIN "dt=%[t-MSG0_RTOS_EXIT_CRITICAL_ENTER](*1e6).3f us\n"
 
 // MSG1_RTOS_EXIT_CRITICAL_FROM_ISR_ENTER ""
-#define MSG1_RTOS_EXIT_CRITICAL_FROM_ISR_ENTER 918U
+#define MSG1_RTOS_EXIT_CRITICAL_FROM_ISR_ENTER 1516U
 // >>RTOS_MAIN "%N %t vTaskExitCriticalFromISR ENTER: uxSavedInterruptStatus %u\n"
 
 // MSG0_RTOS_EXIT_CRITICAL_FROM_ISR_RETURN ""
-#define MSG0_RTOS_EXIT_CRITICAL_FROM_ISR_RETURN 917U
+#define MSG0_RTOS_EXIT_CRITICAL_FROM_ISR_RETURN 1518U
 // >>RTOS_MAIN "%N %t vTaskExitCriticalFromISR RETURN, "
 // >>RTOS_MAIN "dt=%[t-MSG1_RTOS_EXIT_CRITICAL_FROM_ISR_ENTER](*1e6).3f us\n"
 
 // MSG2_RTOS_LIST_TASKS_ENTER ""
-#define MSG2_RTOS_LIST_TASKS_ENTER 920U
+#define MSG2_RTOS_LIST_TASKS_ENTER 1080U
 // >>RTOS_MAIN "%N %t vTaskListTasks ENTER: pcWriteBuffer 0x%08X, uxBufferLength %u\n"
 
 // MSG0_RTOS_LIST_TASKS_RETURN ""
-#define MSG0_RTOS_LIST_TASKS_RETURN 924U
+#define MSG0_RTOS_LIST_TASKS_RETURN 1084U
 // >>RTOS_MAIN "%N %t vTaskListTasks RETURN, "
 // >>RTOS_MAIN "dt=%[t-MSG2_RTOS_LIST_TASKS_ENTER](*1e6).3f us\n"
 
 // MSG2_RTOS_GET_RUN_TIME_STATISTICS_ENTER ""
-#define MSG2_RTOS_GET_RUN_TIME_STATISTICS_ENTER 928U
+#define MSG2_RTOS_GET_RUN_TIME_STATISTICS_ENTER 1112U
 // >>RTOS_MAIN "%N %t vTaskGetRunTimeStatistics ENTER: pcWriteBuffer 0x%08X, uxBufferLength %u\n"
 
 // MSG0_RTOS_GET_RUN_TIME_STATISTICS_RETURN ""
-#define MSG0_RTOS_GET_RUN_TIME_STATISTICS_RETURN 925U
+#define MSG0_RTOS_GET_RUN_TIME_STATISTICS_RETURN 1116U
 // >>RTOS_MAIN "%N %t vTaskGetRunTimeStatistics RETURN, "
 // >>RTOS_MAIN "dt=%[t-MSG2_RTOS_GET_RUN_TIME_STATISTICS_ENTER](*1e6).3f us\n"
 
 // MSG0_RTOS_RESET_EVENT_ITEM_VALUE_ENTER ""
-#define MSG0_RTOS_RESET_EVENT_ITEM_VALUE_ENTER 926U
+#define MSG0_RTOS_RESET_EVENT_ITEM_VALUE_ENTER 1534U
 // >>RTOS_MAIN "%N %t uxTaskResetEventItemValue ENTER\n"
 
 // MSG1_RTOS_RESET_EVENT_ITEM_VALUE_RETURN ""
-#define MSG1_RTOS_RESET_EVENT_ITEM_VALUE_RETURN 932U
+#define MSG1_RTOS_RESET_EVENT_ITEM_VALUE_RETURN 1532U
 // >>RTOS_MAIN "%N %t uxTaskResetEventItemValue RETURN: uxReturn %u, "
 // >>RTOS_MAIN "dt=%[t-MSG0_RTOS_RESET_EVENT_ITEM_VALUE_ENTER](*1e6).3f us\n"
 
 // MSG0_RTOS_INCREMENT_MUTEX_HELD_COUNT_ENTER ""
-#define MSG0_RTOS_INCREMENT_MUTEX_HELD_COUNT_ENTER 927U
+#define MSG0_RTOS_INCREMENT_MUTEX_HELD_COUNT_ENTER 1550U
 // >>RTOS_MAIN "%N %t pvTaskIncrementMutexHeldCount ENTER\n"
 
 // MSG1_RTOS_INCREMENT_MUTEX_HELD_COUNT_RETURN ""
-#define MSG1_RTOS_INCREMENT_MUTEX_HELD_COUNT_RETURN 934U
+#define MSG1_RTOS_INCREMENT_MUTEX_HELD_COUNT_RETURN 1548U
 // >>RTOS_MAIN "%N %t pvTaskIncrementMutexHeldCount RETURN: pxTCB 0x%08X, "
 // >>RTOS_MAIN "dt=%[t-MSG0_RTOS_INCREMENT_MUTEX_HELD_COUNT_ENTER](*1e6).3f us\n"
 
 // MSG3_RTOS_GENERIC_NOTIFY_TAKE_ENTER ""
-#define MSG3_RTOS_GENERIC_NOTIFY_TAKE_ENTER 936U
+#define MSG3_RTOS_GENERIC_NOTIFY_TAKE_ENTER 1328U
 // >>RTOS_MAIN "%N %t ulTaskGenericNotifyTake ENTER: uxIndexToWaitOn %u, "
 // >>RTOS_MAIN "xClearCountOnExit %u, xTicksToWait %u\n"
 
 // MSG1_RTOS_GENERIC_NOTIFY_TAKE_RETURN ""
-#define MSG1_RTOS_GENERIC_NOTIFY_TAKE_RETURN 944U
+#define MSG1_RTOS_GENERIC_NOTIFY_TAKE_RETURN 1336U
 // >>RTOS_MAIN "%N %t ulTaskGenericNotifyTake RETURN: ulReturn %u, "
 // >>RTOS_MAIN "dt=%[t-MSG3_RTOS_GENERIC_NOTIFY_TAKE_ENTER](*1e6).3f us\n"
 
 // MSG5_RTOS_GENERIC_NOTIFY_WAIT_ENTER ""
-#define MSG5_RTOS_GENERIC_NOTIFY_WAIT_ENTER 960U
+#define MSG5_RTOS_GENERIC_NOTIFY_WAIT_ENTER 640U
 // >>RTOS_MAIN "%N %t xTaskGenericNotifyWait ENTER: uxIndexToWaitOn %u, ulBitsToClearOnEntry 0x%08X, "
 // >>RTOS_MAIN "ulBitsToClearOnExit 0x%08X, pulNotificationValue 0x%08X, xTicksToWait %u\n"
 
 // MSG1_RTOS_GENERIC_NOTIFY_WAIT_RETURN ""
-#define MSG1_RTOS_GENERIC_NOTIFY_WAIT_RETURN 946U
+#define MSG1_RTOS_GENERIC_NOTIFY_WAIT_RETURN 656U
 // >>RTOS_MAIN "%N %t xTaskGenericNotifyWait RETURN: xReturn %u, "
 // >>RTOS_MAIN "dt=%[t-MSG5_RTOS_GENERIC_NOTIFY_WAIT_ENTER](*1e6).3f us\n"
 
 // MSG5_RTOS_GENERIC_NOTIFY_ENTER ""
-#define MSG5_RTOS_GENERIC_NOTIFY_ENTER 976U
+#define MSG5_RTOS_GENERIC_NOTIFY_ENTER 672U
 // >>RTOS_MAIN "%N %t xTaskGenericNotify ENTER: xTaskToNotify 0x%08X, uxIndexToNotify %u, "
 // >>RTOS_MAIN "ulValue %u, eAction %u, pulPreviousNotificationValue 0x%08X\n"
 
 // MSG1_RTOS_GENERIC_NOTIFY_RETURN ""
-#define MSG1_RTOS_GENERIC_NOTIFY_RETURN 948U
+#define MSG1_RTOS_GENERIC_NOTIFY_RETURN 688U
 // >>RTOS_MAIN "%N %t xTaskGenericNotify RETURN: xReturn %u, "
 // >>RTOS_MAIN "dt=%[t-MSG5_RTOS_GENERIC_NOTIFY_ENTER](*1e6).3f us\n"
 
 // MSG6_RTOS_GENERIC_NOTIFY_FROM_ISR_ENTER ""
-#define MSG6_RTOS_GENERIC_NOTIFY_FROM_ISR_ENTER 992U
+#define MSG6_RTOS_GENERIC_NOTIFY_FROM_ISR_ENTER 704U
 // >>RTOS_MAIN "%N %t xTaskGenericNotifyFromISR ENTER: xTaskToNotify 0x%08X, uxIndexToNotify %u, "
 // >>RTOS_MAIN "ulValue %u, eAction %u, pulPreviousNotificationValue %u, pxHigherPriorityTaskWoken 0x%08X\n"
 
 // MSG1_RTOS_GENERIC_NOTIFY_FROM_ISR_RETURN ""
-#define MSG1_RTOS_GENERIC_NOTIFY_FROM_ISR_RETURN 950U
+#define MSG1_RTOS_GENERIC_NOTIFY_FROM_ISR_RETURN 720U
 // >>RTOS_MAIN "%N %t xTaskGenericNotifyFromISR RETURN: xReturn %u, "
 // >>RTOS_MAIN "dt=%[t-MSG6_RTOS_GENERIC_NOTIFY_FROM_ISR_ENTER](*1e6).3f us\n"
 
 // MSG3_RTOS_GENERIC_NOTIFY_GIVE_FROM_ISR_ENTER ""
-#define MSG3_RTOS_GENERIC_NOTIFY_GIVE_FROM_ISR_ENTER 952U
+#define MSG3_RTOS_GENERIC_NOTIFY_GIVE_FROM_ISR_ENTER 1344U
 // >>RTOS_MAIN "%N %t vTaskGenericNotifyGiveFromISR ENTER: xTaskToNotify 0x%08X, uxIndexToNotify %u, "
 // >>RTOS_MAIN "pxHigherPriorityTaskWoken 0x%08X\n"
 
 // MSG0_RTOS_GENERIC_NOTIFY_GIVE_FROM_ISR_RETURN ""
-#define MSG0_RTOS_GENERIC_NOTIFY_GIVE_FROM_ISR_RETURN 1008U
+#define MSG0_RTOS_GENERIC_NOTIFY_GIVE_FROM_ISR_RETURN 1352U
 // >>RTOS_MAIN "%N %t vTaskGenericNotifyGiveFromISR RETURN, "
 // >>RTOS_MAIN "dt=%[t-MSG3_RTOS_GENERIC_NOTIFY_GIVE_FROM_ISR_ENTER](*1e6).3f us\n"
 
 // MSG2_RTOS_GENERIC_NOTIFY_STATE_CLEAR_ENTER ""
-#define MSG2_RTOS_GENERIC_NOTIFY_STATE_CLEAR_ENTER 1012U
+#define MSG2_RTOS_GENERIC_NOTIFY_STATE_CLEAR_ENTER 1144U
 // >>RTOS_MAIN "%N %t xTaskGenericNotifyStateClear ENTER: xTask 0x%08X, uxIndexToClear %u\n"
 
 // MSG1_RTOS_GENERIC_NOTIFY_STATE_CLEAR_RETURN ""
-#define MSG1_RTOS_GENERIC_NOTIFY_STATE_CLEAR_RETURN 1010U
+#define MSG1_RTOS_GENERIC_NOTIFY_STATE_CLEAR_RETURN 1148U
 // >>RTOS_MAIN "%N %t xTaskGenericNotifyStateClear RETURN: xReturn %u, "
 // >>RTOS_MAIN "dt=%[t-MSG2_RTOS_GENERIC_NOTIFY_STATE_CLEAR_ENTER](*1e6).3f us\n"
 
 // MSG3_RTOS_GENERIC_NOTIFY_VALUE_CLEAR_ENTER ""
-#define MSG3_RTOS_GENERIC_NOTIFY_VALUE_CLEAR_ENTER 1016U
+#define MSG3_RTOS_GENERIC_NOTIFY_VALUE_CLEAR_ENTER 1360U
 // >>RTOS_MAIN "%N %t ulTaskGenericNotifyValueClear ENTER: xTask 0x%08X, uxIndexToClear %u, "
 // >>RTOS_MAIN "ulBitsToClear 0x%08X\n"
 
 // MSG1_RTOS_GENERIC_NOTIFY_VALUE_CLEAR_RETURN ""
-#define MSG1_RTOS_GENERIC_NOTIFY_VALUE_CLEAR_RETURN 1024U
+#define MSG1_RTOS_GENERIC_NOTIFY_VALUE_CLEAR_RETURN 1368U
 // >>RTOS_MAIN "%N %t ulTaskGenericNotifyValueClear RETURN: ulReturn %u, "
 // >>RTOS_MAIN "dt=%[t-MSG3_RTOS_GENERIC_NOTIFY_VALUE_CLEAR_ENTER](*1e6).3f us\n"
 
 // MSG1_RTOS_GET_RUN_TIME_COUNTER_ENTER ""
-#define MSG1_RTOS_GET_RUN_TIME_COUNTER_ENTER 1026U
+#define MSG1_RTOS_GET_RUN_TIME_COUNTER_ENTER 1564U
 // >>RTOS_MAIN "%N %t ulTaskGetRunTimeCounter ENTER: xTask 0x%08X\n"
 
 // MSG1_RTOS_GET_RUN_TIME_COUNTER_RETURN ""
-#define MSG1_RTOS_GET_RUN_TIME_COUNTER_RETURN 1028U
+#define MSG1_RTOS_GET_RUN_TIME_COUNTER_RETURN 1566U
 // >>RTOS_MAIN "%N %t ulTaskGetRunTimeCounter RETURN: ulRunTimeCounter %u, "
 // >>RTOS_MAIN "dt=%[t-MSG1_RTOS_GET_RUN_TIME_COUNTER_ENTER](*1e6).3f us\n"
 
 // MSG1_RTOS_GET_RUN_TIME_PERCENT_ENTER ""
-#define MSG1_RTOS_GET_RUN_TIME_PERCENT_ENTER 1030U
+#define MSG1_RTOS_GET_RUN_TIME_PERCENT_ENTER 1580U
 // >>RTOS_MAIN "%N %t ulTaskGetRunTimePercent ENTER: xTask 0x%08X\n"
 
 // MSG1_RTOS_GET_RUN_TIME_PERCENT_RETURN ""
-#define MSG1_RTOS_GET_RUN_TIME_PERCENT_RETURN 1032U
+#define MSG1_RTOS_GET_RUN_TIME_PERCENT_RETURN 1582U
 // >>RTOS_MAIN "%N %t ulTaskGetRunTimePercent RETURN: ulReturn %u, "
 // >>RTOS_MAIN "dt=%[t-MSG1_RTOS_GET_RUN_TIME_PERCENT_ENTER](*1e6).3f us\n"
 
 // MSG0_RTOS_GET_IDLE_RUN_TIME_COUNTER_ENTER ""
-#define MSG0_RTOS_GET_IDLE_RUN_TIME_COUNTER_ENTER 1009U
+#define MSG0_RTOS_GET_IDLE_RUN_TIME_COUNTER_ENTER 1762U
 // >>RTOS_MAIN "%N %t ulTaskGetIdleRunTimeCounter ENTER\n"
 
 // MSG1_RTOS_GET_IDLE_RUN_TIME_COUNTER_RETURN ""
-#define MSG1_RTOS_GET_IDLE_RUN_TIME_COUNTER_RETURN 1034U
+#define MSG1_RTOS_GET_IDLE_RUN_TIME_COUNTER_RETURN 1760U
 // >>RTOS_MAIN "%N %t ulTaskGetIdleRunTimeCounter RETURN: ulReturn %u, "
 // >>RTOS_MAIN "dt=%[t-MSG0_RTOS_GET_IDLE_RUN_TIME_COUNTER_ENTER](*1e6).3f us\n"
 
 // MSG0_RTOS_GET_IDLE_RUN_TIME_PERCENT_ENTER ""
-#define MSG0_RTOS_GET_IDLE_RUN_TIME_PERCENT_ENTER 1036U
+#define MSG0_RTOS_GET_IDLE_RUN_TIME_PERCENT_ENTER 1766U
 // >>RTOS_MAIN "%N %t ulTaskGetIdleRunTimePercent ENTER\n"
 
 // MSG1_RTOS_GET_IDLE_RUN_TIME_PERCENT_RETURN ""
-#define MSG1_RTOS_GET_IDLE_RUN_TIME_PERCENT_RETURN 1038U
+#define MSG1_RTOS_GET_IDLE_RUN_TIME_PERCENT_RETURN 1764U
 // >>RTOS_MAIN "%N %t ulTaskGetIdleRunTimePercent RETURN: ulReturn %u, "
 // >>RTOS_MAIN "dt=%[t-MSG0_RTOS_GET_IDLE_RUN_TIME_PERCENT_ENTER](*1e6).3f us\n"
 
 // MSG1_RTOS_GET_MPU_SETTINGS_ENTER ""
-#define MSG1_RTOS_GET_MPU_SETTINGS_ENTER 1040U
+#define MSG1_RTOS_GET_MPU_SETTINGS_ENTER 1768U
 // >>RTOS_MAIN "%N %t xTaskGetMPUSettings ENTER: xTask 0x%08X\n"
 
 // MSG1_RTOS_GET_MPU_SETTINGS_RETURN ""
-#define MSG1_RTOS_GET_MPU_SETTINGS_RETURN 1042U
+#define MSG1_RTOS_GET_MPU_SETTINGS_RETURN 1770U
 // >>RTOS_MAIN "%N %t xTaskGetMPUSettings RETURN: xMPUSettings 0x%08X, "
 // >>RTOS_MAIN "dt=%[t-MSG1_RTOS_GET_MPU_SETTINGS_ENTER](*1e6).3f us\n"
 
 // MSG2_RTOS_QUEUE_GENERIC_RESET_ENTER ""
-#define MSG2_RTOS_QUEUE_GENERIC_RESET_ENTER 1044U
+#define MSG2_RTOS_QUEUE_GENERIC_RESET_ENTER 1176U
 // >>RTOS_MAIN "%N %t xQueueGenericReset ENTER: xQueue 0x%08X, xNewQueue 0x%08X\n"
 
 // MSG1_RTOS_QUEUE_GENERIC_RESET_RETURN ""
-#define MSG1_RTOS_QUEUE_GENERIC_RESET_RETURN 1048U
+#define MSG1_RTOS_QUEUE_GENERIC_RESET_RETURN 1180U
 // >>RTOS_MAIN "%N %t xQueueGenericReset RETURN: xReturn %u, "
 // >>RTOS_MAIN "dt=%[t-MSG2_RTOS_QUEUE_GENERIC_RESET_ENTER](*1e6).3f us\n"
 
 // MSG5_RTOS_QUEUE_GENERIC_CREATE_STATIC_ENTER ""
-#define MSG5_RTOS_QUEUE_GENERIC_CREATE_STATIC_ENTER 1056U
+#define MSG5_RTOS_QUEUE_GENERIC_CREATE_STATIC_ENTER 736U
 // >>RTOS_MAIN "%N %t xQueueGenericCreateStatic ENTER: uxQueueLength %u, uxItemSize %u, "
 // >>RTOS_MAIN "pucQueueStorage 0x%08X, pxStaticQueue 0x%08X, ucQueueType %u\n"
 
 // MSG1_RTOS_QUEUE_GENERIC_CREATE_STATIC_RETURN ""
-#define MSG1_RTOS_QUEUE_GENERIC_CREATE_STATIC_RETURN 1050U
+#define MSG1_RTOS_QUEUE_GENERIC_CREATE_STATIC_RETURN 752U
 // >>RTOS_MAIN "%N %t xQueueGenericCreateStatic RETURN: pxNewQueue 0x%08X, "
 // >>RTOS_MAIN "dt=%[t-MSG5_RTOS_QUEUE_GENERIC_CREATE_STATIC_ENTER](*1e6).3f us\n"
 
 // MSG3_RTOS_QUEUE_GENERIC_GET_STATIC_BUFFERS_ENTER ""
-#define MSG3_RTOS_QUEUE_GENERIC_GET_STATIC_BUFFERS_ENTER 1072U
+#define MSG3_RTOS_QUEUE_GENERIC_GET_STATIC_BUFFERS_ENTER 1376U
 // >>RTOS_MAIN "%N %t xQueueGenericGetStaticBuffers ENTER: xQueue 0x%08X, ppucQueueStorage 0x%08X, "
 // >>RTOS_MAIN "ppxStaticQueue 0x%08X\n"
 
 // MSG1_RTOS_QUEUE_GENERIC_GET_STATIC_BUFFERS_RETURN ""
-#define MSG1_RTOS_QUEUE_GENERIC_GET_STATIC_BUFFERS_RETURN 1052U
+#define MSG1_RTOS_QUEUE_GENERIC_GET_STATIC_BUFFERS_RETURN 1384U
 // >>RTOS_MAIN "%N %t xQueueGenericGetStaticBuffers RETURN: xReturn %u, "
 // >>RTOS_MAIN "dt=%[t-MSG3_RTOS_QUEUE_GENERIC_GET_STATIC_BUFFERS_ENTER](*1e6).3f us\n"
 
 // MSG3_RTOS_QUEUE_GENERIC_CREATE_ENTER ""
-#define MSG3_RTOS_QUEUE_GENERIC_CREATE_ENTER 1080U
+#define MSG3_RTOS_QUEUE_GENERIC_CREATE_ENTER 1392U
 // >>RTOS_MAIN "%N %t xQueueGenericCreate ENTER: uxQueueLength %u, uxItemSize %u, ucQueueType %u\n"
 
 // MSG1_RTOS_QUEUE_GENERIC_CREATE_RETURN ""
-#define MSG1_RTOS_QUEUE_GENERIC_CREATE_RETURN 1054U
+#define MSG1_RTOS_QUEUE_GENERIC_CREATE_RETURN 1400U
 // >>RTOS_MAIN "%N %t xQueueGenericCreate RETURN: pxNewQueue 0x%08X, "
 // >>RTOS_MAIN "dt=%[t-MSG3_RTOS_QUEUE_GENERIC_CREATE_ENTER](*1e6).3f us\n"
 
 // MSG1_RTOS_QUEUE_CREATE_MUTEX_ENTER ""
-#define MSG1_RTOS_QUEUE_CREATE_MUTEX_ENTER 1088U
+#define MSG1_RTOS_QUEUE_CREATE_MUTEX_ENTER 1772U
 // >>RTOS_MAIN "%N %t xQueueCreateMutex ENTER: ucQueueType %u\n"
 
 // MSG1_RTOS_QUEUE_CREATE_MUTEX_RETURN ""
-#define MSG1_RTOS_QUEUE_CREATE_MUTEX_RETURN 1090U
+#define MSG1_RTOS_QUEUE_CREATE_MUTEX_RETURN 1774U
 // >>RTOS_MAIN "%N %t xQueueCreateMutex RETURN: xNewQueue 0x%08X, "
 // >>RTOS_MAIN "dt=%[t-MSG1_RTOS_QUEUE_CREATE_MUTEX_ENTER](*1e6).3f us\n"
 
 // MSG2_RTOS_QUEUE_CREATE_MUTEX_STATIC_ENTER ""
-#define MSG2_RTOS_QUEUE_CREATE_MUTEX_STATIC_ENTER 1092U
+#define MSG2_RTOS_QUEUE_CREATE_MUTEX_STATIC_ENTER 1208U
 // >>RTOS_MAIN "%N %t xQueueCreateMutexStatic ENTER: ucQueueType %u, pxStaticQueue 0x%08X\n"
 
 // MSG1_RTOS_QUEUE_CREATE_MUTEX_STATIC_RETURN ""
-#define MSG1_RTOS_QUEUE_CREATE_MUTEX_STATIC_RETURN 1096U
+#define MSG1_RTOS_QUEUE_CREATE_MUTEX_STATIC_RETURN 1212U
 // >>RTOS_MAIN "%N %t xQueueCreateMutexStatic RETURN: xNewQueue 0x%08X, "
 // >>RTOS_MAIN "dt=%[t-MSG2_RTOS_QUEUE_CREATE_MUTEX_STATIC_ENTER](*1e6).3f us\n"
 
 // MSG1_RTOS_QUEUE_GET_MUTEX_HOLDER_ENTER ""
-#define MSG1_RTOS_QUEUE_GET_MUTEX_HOLDER_ENTER 1098U
+#define MSG1_RTOS_QUEUE_GET_MUTEX_HOLDER_ENTER 1776U
 // >>RTOS_MAIN "%N %t xQueueGetMutexHolder ENTER: xSemaphore 0x%08X\n"
 
 // MSG1_RTOS_QUEUE_GET_MUTEX_HOLDER_RETURN ""
-#define MSG1_RTOS_QUEUE_GET_MUTEX_HOLDER_RETURN 1100U
+#define MSG1_RTOS_QUEUE_GET_MUTEX_HOLDER_RETURN 1778U
 // >>RTOS_MAIN "%N %t xQueueGetMutexHolder RETURN: pxReturn 0x%08X, "
 // >>RTOS_MAIN "dt=%[t-MSG1_RTOS_QUEUE_GET_MUTEX_HOLDER_ENTER](*1e6).3f us\n"
 
 // MSG1_RTOS_QUEUE_GET_MUTEX_HOLDER_FROM_ISR_ENTER ""
-#define MSG1_RTOS_QUEUE_GET_MUTEX_HOLDER_FROM_ISR_ENTER 1102U
+#define MSG1_RTOS_QUEUE_GET_MUTEX_HOLDER_FROM_ISR_ENTER 1780U
 // >>RTOS_MAIN "%N %t xQueueGetMutexHolderFromISR ENTER: xSemaphore 0x%08X\n"
 
 // MSG1_RTOS_QUEUE_GET_MUTEX_HOLDER_FROM_ISR_RETURN ""
-#define MSG1_RTOS_QUEUE_GET_MUTEX_HOLDER_FROM_ISR_RETURN 1104U
+#define MSG1_RTOS_QUEUE_GET_MUTEX_HOLDER_FROM_ISR_RETURN 1782U
 // >>RTOS_MAIN "%N %t xQueueGetMutexHolderFromISR RETURN: pxReturn 0x%08X, "
 // >>RTOS_MAIN "dt=%[t-MSG1_RTOS_QUEUE_GET_MUTEX_HOLDER_FROM_ISR_ENTER](*1e6).3f us\n"
 
 // MSG1_RTOS_GIVE_MUTEX_RECURSIVE_ENTER ""
-#define MSG1_RTOS_GIVE_MUTEX_RECURSIVE_ENTER 1106U
+#define MSG1_RTOS_GIVE_MUTEX_RECURSIVE_ENTER 1784U
 // >>RTOS_MAIN "%N %t xQueueGiveMutexRecursive ENTER: xMutex 0x%08X\n"
 
 // MSG1_RTOS_GIVE_MUTEX_RECURSIVE_RETURN ""
-#define MSG1_RTOS_GIVE_MUTEX_RECURSIVE_RETURN 1108U
+#define MSG1_RTOS_GIVE_MUTEX_RECURSIVE_RETURN 1786U
 // >>RTOS_MAIN "%N %t xQueueGiveMutexRecursive RETURN: xReturn %u, "
 // >>RTOS_MAIN "dt=%[t-MSG1_RTOS_GIVE_MUTEX_RECURSIVE_ENTER](*1e6).3f us\n"
 
 // MSG2_RTOS_TAKE_MUTEX_RECURSIVE_ENTER ""
-#define MSG2_RTOS_TAKE_MUTEX_RECURSIVE_ENTER 1112U
+#define MSG2_RTOS_TAKE_MUTEX_RECURSIVE_ENTER 1584U
 // >>RTOS_MAIN "%N %t xQueueTakeMutexRecursive ENTER: xMutex 0x%08X, xTicksToWait %u\n"
 
 // MSG1_RTOS_TAKE_MUTEX_RECURSIVE_RETURN ""
-#define MSG1_RTOS_TAKE_MUTEX_RECURSIVE_RETURN 1110U
+#define MSG1_RTOS_TAKE_MUTEX_RECURSIVE_RETURN 1588U
 // >>RTOS_MAIN "%N %t xQueueTakeMutexRecursive RETURN: xReturn %u, "
 // >>RTOS_MAIN "dt=%[t-MSG2_RTOS_TAKE_MUTEX_RECURSIVE_ENTER](*1e6).3f us\n"
 
 // MSG3_RTOS_QUEUE_CREATE_COUNTING_SEMAPHORE_STATIC_ENTER ""
-#define MSG3_RTOS_QUEUE_CREATE_COUNTING_SEMAPHORE_STATIC_ENTER 1120U
+#define MSG3_RTOS_QUEUE_CREATE_COUNTING_SEMAPHORE_STATIC_ENTER 1408U
 // >>RTOS_MAIN "%N %t xQueueCreateCountingSemaphoreStatic ENTER: uxMaxCount %u, "
 // >>RTOS_MAIN "uxInitialCount %u, pxStaticQueue 0x%08X\n"
 
 // MSG1_RTOS_QUEUE_CREATE_COUNTING_SEMAPHORE_STATIC_RETURN ""
-#define MSG1_RTOS_QUEUE_CREATE_COUNTING_SEMAPHORE_STATIC_RETURN 1116U
+#define MSG1_RTOS_QUEUE_CREATE_COUNTING_SEMAPHORE_STATIC_RETURN 1416U
 // >>RTOS_MAIN "%N %t xQueueCreateCountingSemaphoreStatic RETURN: xHandle 0x%08X, "
 // >>RTOS_MAIN "dt=%[t-MSG3_RTOS_QUEUE_CREATE_COUNTING_SEMAPHORE_STATIC_ENTER](*1e6).3f us\n"
 
 // MSG2_RTOS_QUEUE_CREATE_COUNTING_SEMAPHORE_ENTER ""
-#define MSG2_RTOS_QUEUE_CREATE_COUNTING_SEMAPHORE_ENTER 1128U
+#define MSG2_RTOS_QUEUE_CREATE_COUNTING_SEMAPHORE_ENTER 1592U
 // >>RTOS_MAIN "%N %t xQueueCreateCountingSemaphore ENTER: uxMaxCount %u, uxInitialCount %u\n"
 
 // MSG1_RTOS_QUEUE_CREATE_COUNTING_SEMAPHORE_RETURN ""
-#define MSG1_RTOS_QUEUE_CREATE_COUNTING_SEMAPHORE_RETURN 1118U
+#define MSG1_RTOS_QUEUE_CREATE_COUNTING_SEMAPHORE_RETURN 1596U
 // >>RTOS_MAIN "%N %t xQueueCreateCountingSemaphore RETURN: xHandle 0x%08X, "
 // >>RTOS_MAIN "dt=%[t-MSG2_RTOS_QUEUE_CREATE_COUNTING_SEMAPHORE_ENTER](*1e6).3f us\n"
 
 // MSG4_RTOS_QUEUE_GENERIC_SEND_ENTER ""
-#define MSG4_RTOS_QUEUE_GENERIC_SEND_ENTER 1136U
+#define MSG4_RTOS_QUEUE_GENERIC_SEND_ENTER 768U
 // >>RTOS_MAIN "%N %t xQueueGenericSend ENTER: xQueue 0x%08X, pvItemToQueue 0x%08X, "
 // >>RTOS_MAIN "xTicksToWait %u, xCopyPosition %u\n"
 
 // MSG1_RTOS_QUEUE_GENERIC_SEND_RETURN ""
-#define MSG1_RTOS_QUEUE_GENERIC_SEND_RETURN 1132U
+#define MSG1_RTOS_QUEUE_GENERIC_SEND_RETURN 784U
 // >>RTOS_MAIN "%N %t xQueueGenericSend RETURN: xReturn %u, "
 // >>RTOS_MAIN "dt=%[t-MSG4_RTOS_QUEUE_GENERIC_SEND_ENTER](*1e6).3f us\n"
 
 // MSG4_RTOS_QUEUE_GENERIC_SEND_FROM_ISR_ENTER ""
-#define MSG4_RTOS_QUEUE_GENERIC_SEND_FROM_ISR_ENTER 1152U
+#define MSG4_RTOS_QUEUE_GENERIC_SEND_FROM_ISR_ENTER 800U
 // >>RTOS_MAIN "%N %t xQueueGenericSendFromISR ENTER: xQueue 0x%08X, pvItemToQueue 0x%08X, "
 // >>RTOS_MAIN "pxHigherPriorityTaskWoken 0x%08X, xCopyPosition %u\n"
 
 // MSG1_RTOS_QUEUE_GENERIC_SEND_FROM_ISR_RETURN ""
-#define MSG1_RTOS_QUEUE_GENERIC_SEND_FROM_ISR_RETURN 1134U
+#define MSG1_RTOS_QUEUE_GENERIC_SEND_FROM_ISR_RETURN 816U
 // >>RTOS_MAIN "%N %t xQueueGenericSendFromISR RETURN: xReturn %u, "
 // >>RTOS_MAIN "dt=%[t-MSG4_RTOS_QUEUE_GENERIC_SEND_FROM_ISR_ENTER](*1e6).3f us\n"
 
 // MSG2_RTOS_QUEUE_GIVE_FROM_ISR_ENTER ""
-#define MSG2_RTOS_QUEUE_GIVE_FROM_ISR_ENTER 1168U
+#define MSG2_RTOS_QUEUE_GIVE_FROM_ISR_ENTER 1600U
 // >>RTOS_MAIN "%N %t xQueueGiveFromISR ENTER: xQueue 0x%08X, pxHigherPriorityTaskWoken 0x%08X\n"
 
 // MSG1_RTOS_QUEUE_GIVE_FROM_ISR_RETURN ""
-#define MSG1_RTOS_QUEUE_GIVE_FROM_ISR_RETURN 1172U
+#define MSG1_RTOS_QUEUE_GIVE_FROM_ISR_RETURN 1604U
 // >>RTOS_MAIN "%N %t xQueueGiveFromISR RETURN: xReturn %u, "
 // >>RTOS_MAIN "dt=%[t-MSG2_RTOS_QUEUE_GIVE_FROM_ISR_ENTER](*1e6).3f us\n"
 
 // MSG3_RTOS_QUEUE_RECEIVE_ENTER ""
-#define MSG3_RTOS_QUEUE_RECEIVE_ENTER 1176U
+#define MSG3_RTOS_QUEUE_RECEIVE_ENTER 1424U
 // >>RTOS_MAIN "%N %t xQueueReceive ENTER: xQueue 0x%08X, pvBuffer 0x%08X, xTicksToWait %u\n"
 
 // MSG1_RTOS_QUEUE_RECEIVE_RETURN ""
-#define MSG1_RTOS_QUEUE_RECEIVE_RETURN 1174U
+#define MSG1_RTOS_QUEUE_RECEIVE_RETURN 1432U
 // >>RTOS_MAIN "%N %t xQueueReceive RETURN: xReturn %u, "
 // >>RTOS_MAIN "dt=%[t-MSG3_RTOS_QUEUE_RECEIVE_ENTER](*1e6).3f us\n"
 
 // MSG2_RTOS_QUEUE_SEMAPHORE_TAKE_ENTER ""
-#define MSG2_RTOS_QUEUE_SEMAPHORE_TAKE_ENTER 1184U
+#define MSG2_RTOS_QUEUE_SEMAPHORE_TAKE_ENTER 1608U
 // >>RTOS_MAIN "%N %t xQueueSemaphoreTake ENTER: xQueue 0x%08X, xTicksToWait %u\n"
 
 // MSG1_RTOS_QUEUE_SEMAPHORE_TAKE_RETURN ""
-#define MSG1_RTOS_QUEUE_SEMAPHORE_TAKE_RETURN 1188U
+#define MSG1_RTOS_QUEUE_SEMAPHORE_TAKE_RETURN 1612U
 // >>RTOS_MAIN "%N %t xQueueSemaphoreTake RETURN: xReturn %u, "
 // >>RTOS_MAIN "dt=%[t-MSG2_RTOS_QUEUE_SEMAPHORE_TAKE_ENTER](*1e6).3f us\n"
 
 // MSG3_RTOS_QUEUE_PEEK_ENTER ""
-#define MSG3_RTOS_QUEUE_PEEK_ENTER 1192U
+#define MSG3_RTOS_QUEUE_PEEK_ENTER 1440U
 // >>RTOS_MAIN "%N %t xQueuePeek ENTER: xQueue 0x%08X, pvBuffer 0x%08X, xTicksToWait %u\n"
 
 // MSG1_RTOS_QUEUE_PEEK_RETURN ""
-#define MSG1_RTOS_QUEUE_PEEK_RETURN 1190U
+#define MSG1_RTOS_QUEUE_PEEK_RETURN 1448U
 // >>RTOS_MAIN "%N %t xQueuePeek RETURN: xReturn %u, "
 // >>RTOS_MAIN "dt=%[t-MSG3_RTOS_QUEUE_PEEK_ENTER](*1e6).3f us\n"
 
 // MSG3_RTOS_QUEUE_RECEIVE_FROM_ISR_ENTER ""
-#define MSG3_RTOS_QUEUE_RECEIVE_FROM_ISR_ENTER 1200U
+#define MSG3_RTOS_QUEUE_RECEIVE_FROM_ISR_ENTER 1456U
 // >>RTOS_MAIN "%N %t xQueueReceiveFromISR ENTER: xQueue 0x%08X, pvBuffer 0x%08X, "
 // >>RTOS_MAIN "pxHigherPriorityTaskWoken 0x%08X\n"
 
 // MSG1_RTOS_QUEUE_RECEIVE_FROM_ISR_RETURN ""
-#define MSG1_RTOS_QUEUE_RECEIVE_FROM_ISR_RETURN 1208U
+#define MSG1_RTOS_QUEUE_RECEIVE_FROM_ISR_RETURN 1464U
 // >>RTOS_MAIN "%N %t xQueueReceiveFromISR RETURN: xReturn %u, "
 // >>RTOS_MAIN "dt=%[t-MSG3_RTOS_QUEUE_RECEIVE_FROM_ISR_ENTER](*1e6).3f us\n"
 
 // MSG2_RTOS_QUEUE_PEEK_FROM_ISR_ENTER ""
-#define MSG2_RTOS_QUEUE_PEEK_FROM_ISR_ENTER 1212U
+#define MSG2_RTOS_QUEUE_PEEK_FROM_ISR_ENTER 1616U
 // >>RTOS_MAIN "%N %t xQueuePeekFromISR ENTER: xQueue 0x%08X, pvBuffer 0x%08X\n"
 
 // MSG1_RTOS_QUEUE_PEEK_FROM_ISR_RETURN ""
-#define MSG1_RTOS_QUEUE_PEEK_FROM_ISR_RETURN 1210U
+#define MSG1_RTOS_QUEUE_PEEK_FROM_ISR_RETURN 1620U
 // >>RTOS_MAIN "%N %t xQueuePeekFromISR RETURN: xReturn %u, "
 // >>RTOS_MAIN "dt=%[t-MSG2_RTOS_QUEUE_PEEK_FROM_ISR_ENTER](*1e6).3f us\n"
 
 // MSG1_RTOS_QUEUE_MESSAGES_WAITING_ENTER ""
-#define MSG1_RTOS_QUEUE_MESSAGES_WAITING_ENTER 1216U
+#define MSG1_RTOS_QUEUE_MESSAGES_WAITING_ENTER 1788U
 // >>RTOS_MAIN "%N %t uxQueueMessagesWaiting ENTER: xQueue 0x%08X\n"
 
 // MSG1_RTOS_QUEUE_MESSAGES_WAITING_RETURN ""
-#define MSG1_RTOS_QUEUE_MESSAGES_WAITING_RETURN 1218U
+#define MSG1_RTOS_QUEUE_MESSAGES_WAITING_RETURN 1790U
 // >>RTOS_MAIN "%N %t uxQueueMessagesWaiting RETURN: uxReturn %u, "
 // >>RTOS_MAIN "dt=%[t-MSG1_RTOS_QUEUE_MESSAGES_WAITING_ENTER](*1e6).3f us\n"
 
 // MSG1_RTOS_QUEUE_SPACES_AVAILABLE_ENTER ""
-#define MSG1_RTOS_QUEUE_SPACES_AVAILABLE_ENTER 1220U
+#define MSG1_RTOS_QUEUE_SPACES_AVAILABLE_ENTER 1792U
 // >>RTOS_MAIN "%N %t uxQueueSpacesAvailable ENTER: xQueue 0x%08X\n"
 
 // MSG1_RTOS_QUEUE_SPACES_AVAILABLE_RETURN ""
-#define MSG1_RTOS_QUEUE_SPACES_AVAILABLE_RETURN 1222U
+#define MSG1_RTOS_QUEUE_SPACES_AVAILABLE_RETURN 1794U
 // >>RTOS_MAIN "%N %t uxQueueSpacesAvailable RETURN: uxReturn %u, "
 // >>RTOS_MAIN "dt=%[t-MSG1_RTOS_QUEUE_SPACES_AVAILABLE_ENTER](*1e6).3f us\n"
 
 // MSG1_RTOS_QUEUE_MESSAGES_WAITING_FROM_ISR_ENTER ""
-#define MSG1_RTOS_QUEUE_MESSAGES_WAITING_FROM_ISR_ENTER 1224U
+#define MSG1_RTOS_QUEUE_MESSAGES_WAITING_FROM_ISR_ENTER 1796U
 // >>RTOS_MAIN "%N %t uxQueueMessagesWaitingFromISR ENTER: xQueue 0x%08X\n"
 
 // MSG1_RTOS_QUEUE_MESSAGES_WAITING_FROM_ISR_RETURN ""
-#define MSG1_RTOS_QUEUE_MESSAGES_WAITING_FROM_ISR_RETURN 1226U
+#define MSG1_RTOS_QUEUE_MESSAGES_WAITING_FROM_ISR_RETURN 1798U
 // >>RTOS_MAIN "%N %t uxQueueMessagesWaitingFromISR RETURN: uxReturn %u, "
 // >>RTOS_MAIN "dt=%[t-MSG1_RTOS_QUEUE_MESSAGES_WAITING_FROM_ISR_ENTER](*1e6).3f us\n"
 
 // MSG1_RTOS_QUEUE_DELETE_ENTER ""
-#define MSG1_RTOS_QUEUE_DELETE_ENTER 1228U
+#define MSG1_RTOS_QUEUE_DELETE_ENTER 1800U
 // >>RTOS_MAIN "%N %t vQueueDelete ENTER: xQueue 0x%08X\n"
 
 // MSG0_RTOS_QUEUE_DELETE_RETURN ""
-#define MSG0_RTOS_QUEUE_DELETE_RETURN 1037U
+#define MSG0_RTOS_QUEUE_DELETE_RETURN 1802U
 // >>RTOS_MAIN "%N %t vQueueDelete RETURN, "
 // >>RTOS_MAIN "dt=%[t-MSG1_RTOS_QUEUE_DELETE_ENTER](*1e6).3f us\n"
 
 // MSG1_RTOS_QUEUE_GET_QUEUE_NUMBER_ENTER ""
-#define MSG1_RTOS_QUEUE_GET_QUEUE_NUMBER_ENTER 1230U
+#define MSG1_RTOS_QUEUE_GET_QUEUE_NUMBER_ENTER 1804U
 // >>RTOS_MAIN "%N %t uxQueueGetQueueNumber ENTER: xQueue 0x%08X\n"
 
 // MSG1_RTOS_QUEUE_GET_QUEUE_NUMBER_RETURN ""
-#define MSG1_RTOS_QUEUE_GET_QUEUE_NUMBER_RETURN 1232U
+#define MSG1_RTOS_QUEUE_GET_QUEUE_NUMBER_RETURN 1806U
 // >>RTOS_MAIN "%N %t uxQueueGetQueueNumber RETURN: uxQueueNumber %u, "
 // >>RTOS_MAIN "dt=%[t-MSG1_RTOS_QUEUE_GET_QUEUE_NUMBER_ENTER](*1e6).3f us\n"
 
 // MSG2_RTOS_QUEUE_SET_QUEUE_NUMBER_ENTER ""
-#define MSG2_RTOS_QUEUE_SET_QUEUE_NUMBER_ENTER 1236U
+#define MSG2_RTOS_QUEUE_SET_QUEUE_NUMBER_ENTER 1624U
 // >>RTOS_MAIN "%N %t vQueueSetQueueNumber ENTER: xQueue 0x%08X, uxQueueNumber %u\n"
 
 // MSG0_RTOS_QUEUE_SET_QUEUE_NUMBER_RETURN ""
-#define MSG0_RTOS_QUEUE_SET_QUEUE_NUMBER_RETURN 1234U
+#define MSG0_RTOS_QUEUE_SET_QUEUE_NUMBER_RETURN 1628U
 // >>RTOS_MAIN "%N %t vQueueSetQueueNumber RETURN, "
 // >>RTOS_MAIN "dt=%[t-MSG2_RTOS_QUEUE_SET_QUEUE_NUMBER_ENTER](*1e6).3f us\n"
 
 // MSG1_RTOS_QUEUE_GET_QUEUE_TYPE_ENTER ""
-#define MSG1_RTOS_QUEUE_GET_QUEUE_TYPE_ENTER 1240U
+#define MSG1_RTOS_QUEUE_GET_QUEUE_TYPE_ENTER 1808U
 // >>RTOS_MAIN "%N %t ucQueueGetQueueType ENTER: xQueue 0x%08X\n"
 
 // MSG1_RTOS_QUEUE_GET_QUEUE_TYPE_RETURN ""
-#define MSG1_RTOS_QUEUE_GET_QUEUE_TYPE_RETURN 1242U
+#define MSG1_RTOS_QUEUE_GET_QUEUE_TYPE_RETURN 1810U
 // >>RTOS_MAIN "%N %t ucQueueGetQueueType RETURN: ucQueueType %u, "
 // >>RTOS_MAIN "dt=%[t-MSG1_RTOS_QUEUE_GET_QUEUE_TYPE_ENTER](*1e6).3f us\n"
 
 // MSG1_RTOS_QUEUE_GET_QUEUE_ITEM_SIZE_ENTER ""
-#define MSG1_RTOS_QUEUE_GET_QUEUE_ITEM_SIZE_ENTER 1244U
+#define MSG1_RTOS_QUEUE_GET_QUEUE_ITEM_SIZE_ENTER 1812U
 // >>RTOS_MAIN "%N %t uxQueueGetQueueItemSize ENTER: xQueue 0x%08X\n"
 
 // MSG1_RTOS_QUEUE_GET_QUEUE_ITEM_SIZE_RETURN ""
-#define MSG1_RTOS_QUEUE_GET_QUEUE_ITEM_SIZE_RETURN 1246U
+#define MSG1_RTOS_QUEUE_GET_QUEUE_ITEM_SIZE_RETURN 1814U
 // >>RTOS_MAIN "%N %t uxQueueGetQueueItemSize RETURN: uxItemSize %u, "
 // >>RTOS_MAIN "dt=%[t-MSG1_RTOS_QUEUE_GET_QUEUE_ITEM_SIZE_ENTER](*1e6).3f us\n"
 
 // MSG1_RTOS_QUEUE_GET_QUEUE_LENGTH_ENTER ""
-#define MSG1_RTOS_QUEUE_GET_QUEUE_LENGTH_ENTER 1248U
+#define MSG1_RTOS_QUEUE_GET_QUEUE_LENGTH_ENTER 1816U
 // >>RTOS_MAIN "%N %t uxQueueGetQueueLength ENTER: xQueue 0x%08X\n"
 
 // MSG1_RTOS_QUEUE_GET_QUEUE_LENGTH_RETURN ""
-#define MSG1_RTOS_QUEUE_GET_QUEUE_LENGTH_RETURN 1250U
+#define MSG1_RTOS_QUEUE_GET_QUEUE_LENGTH_RETURN 1818U
 // >>RTOS_MAIN "%N %t uxQueueGetQueueLength RETURN: uxLength %u, "
 // >>RTOS_MAIN "dt=%[t-MSG1_RTOS_QUEUE_GET_QUEUE_LENGTH_ENTER](*1e6).3f us\n"
 
 // MSG1_RTOS_QUEUE_IS_EMPTY_FROM_ISR_ENTER ""
-#define MSG1_RTOS_QUEUE_IS_EMPTY_FROM_ISR_ENTER 1252U
+#define MSG1_RTOS_QUEUE_IS_EMPTY_FROM_ISR_ENTER 1820U
 // >>RTOS_MAIN "%N %t xQueueIsQueueEmptyFromISR ENTER: xQueue 0x%08X\n"
 
 // MSG1_RTOS_QUEUE_IS_EMPTY_FROM_ISR_RETURN ""
-#define MSG1_RTOS_QUEUE_IS_EMPTY_FROM_ISR_RETURN 1254U
+#define MSG1_RTOS_QUEUE_IS_EMPTY_FROM_ISR_RETURN 1822U
 // >>RTOS_MAIN "%N %t xQueueIsQueueEmptyFromISR RETURN: xReturn %u, "
 // >>RTOS_MAIN "dt=%[t-MSG1_RTOS_QUEUE_IS_EMPTY_FROM_ISR_ENTER](*1e6).3f us\n"
 
 // MSG1_RTOS_QUEUE_IS_FULL_FROM_ISR_ENTER ""
-#define MSG1_RTOS_QUEUE_IS_FULL_FROM_ISR_ENTER 1256U
+#define MSG1_RTOS_QUEUE_IS_FULL_FROM_ISR_ENTER 1824U
 // >>RTOS_MAIN "%N %t xQueueIsQueueFullFromISR ENTER: xQueue 0x%08X\n"
 
 // MSG1_RTOS_QUEUE_IS_FULL_FROM_ISR_RETURN ""
-#define MSG1_RTOS_QUEUE_IS_FULL_FROM_ISR_RETURN 1258U
+#define MSG1_RTOS_QUEUE_IS_FULL_FROM_ISR_RETURN 1826U
 // >>RTOS_MAIN "%N %t xQueueIsQueueFullFromISR RETURN: xReturn %u, "
 // >>RTOS_MAIN "dt=%[t-MSG1_RTOS_QUEUE_IS_FULL_FROM_ISR_ENTER](*1e6).3f us\n"
 
 // MSG3_RTOS_QUEUE_CR_SEND_ENTER ""
-#define MSG3_RTOS_QUEUE_CR_SEND_ENTER 1264U
+#define MSG3_RTOS_QUEUE_CR_SEND_ENTER 1472U
 // >>RTOS_MAIN "%N %t xQueueCRSend ENTER: xQueue 0x%08X, pvItemToQueue 0x%08X, xTicksToWait %u\n"
 
 // MSG1_RTOS_QUEUE_CR_SEND_RETURN ""
-#define MSG1_RTOS_QUEUE_CR_SEND_RETURN 1260U
+#define MSG1_RTOS_QUEUE_CR_SEND_RETURN 1480U
 // >>RTOS_MAIN "%N %t xQueueCRSend RETURN: xReturn %u, "
 // >>RTOS_MAIN "dt=%[t-MSG3_RTOS_QUEUE_CR_SEND_ENTER](*1e6).3f us\n"
 
 // MSG3_RTOS_QUEUE_CR_RECEIVE_ENTER ""
-#define MSG3_RTOS_QUEUE_CR_RECEIVE_ENTER 1272U
+#define MSG3_RTOS_QUEUE_CR_RECEIVE_ENTER 1488U
 // >>RTOS_MAIN "%N %t xQueueCRReceive ENTER: xQueue 0x%08X, pvBuffer 0x%08X, xTicksToWait %u\n"
 
 // MSG1_RTOS_QUEUE_CR_RECEIVE_RETURN ""
-#define MSG1_RTOS_QUEUE_CR_RECEIVE_RETURN 1262U
+#define MSG1_RTOS_QUEUE_CR_RECEIVE_RETURN 1496U
 // >>RTOS_MAIN "%N %t xQueueCRReceive RETURN: xReturn %u, "
 // >>RTOS_MAIN "dt=%[t-MSG3_RTOS_QUEUE_CR_RECEIVE_ENTER](*1e6).3f us\n"
 
 // MSG3_RTOS_QUEUE_CR_SEND_FROM_ISR_ENTER ""
-#define MSG3_RTOS_QUEUE_CR_SEND_FROM_ISR_ENTER 1280U
+#define MSG3_RTOS_QUEUE_CR_SEND_FROM_ISR_ENTER 1504U
 // >>RTOS_MAIN "%N %t xQueueCRSendFromISR ENTER: xQueue 0x%08X, pvItemToQueue 0x%08X, "
 // >>RTOS_MAIN "xCoRoutinePreviouslyWoken 0x%08X\n"
 
 // MSG1_RTOS_QUEUE_CR_SEND_FROM_ISR_RETURN ""
-#define MSG1_RTOS_QUEUE_CR_SEND_FROM_ISR_RETURN 1288U
+#define MSG1_RTOS_QUEUE_CR_SEND_FROM_ISR_RETURN 1512U
 // >>RTOS_MAIN "%N %t xQueueCRSendFromISR RETURN: xCoRoutinePreviouslyWoken 0x%08X, "
 // >>RTOS_MAIN "dt=%[t-MSG3_RTOS_QUEUE_CR_SEND_FROM_ISR_ENTER](*1e6).3f us\n"
 
 // MSG3_RTOS_QUEUE_CR_RECEIVE_FROM_ISR_ENTER ""
-#define MSG3_RTOS_QUEUE_CR_RECEIVE_FROM_ISR_ENTER 1296U
+#define MSG3_RTOS_QUEUE_CR_RECEIVE_FROM_ISR_ENTER 1520U
 // >>RTOS_MAIN "%N %t xQueueCRReceiveFromISR ENTER: xQueue 0x%08X, pvBuffer 0x%08X, "
 // >>RTOS_MAIN "pxCoRoutineWoken 0x%08X\n"
 
 // MSG1_RTOS_QUEUE_CR_RECEIVE_FROM_ISR_RETURN ""
-#define MSG1_RTOS_QUEUE_CR_RECEIVE_FROM_ISR_RETURN 1290U
+#define MSG1_RTOS_QUEUE_CR_RECEIVE_FROM_ISR_RETURN 1528U
 // >>RTOS_MAIN "%N %t xQueueCRReceiveFromISR RETURN: xReturn %u, "
 // >>RTOS_MAIN "dt=%[t-MSG3_RTOS_QUEUE_CR_RECEIVE_FROM_ISR_ENTER](*1e6).3f us\n"
 
 // MSG2_RTOS_QUEUE_ADD_TO_REGISTRY_ENTER ""
-#define MSG2_RTOS_QUEUE_ADD_TO_REGISTRY_ENTER 1292U
+#define MSG2_RTOS_QUEUE_ADD_TO_REGISTRY_ENTER 1632U
 // >>RTOS_MAIN "%N %t vQueueAddToRegistry ENTER: xQueue 0x%08X, pcQueueName 0x%08X\n"
 
 // MSG0_RTOS_QUEUE_ADD_TO_REGISTRY_RETURN ""
-#define MSG0_RTOS_QUEUE_ADD_TO_REGISTRY_RETURN 1235U
+#define MSG0_RTOS_QUEUE_ADD_TO_REGISTRY_RETURN 1636U
 // >>RTOS_MAIN "%N %t vQueueAddToRegistry RETURN, "
 // >>RTOS_MAIN "dt=%[t-MSG2_RTOS_QUEUE_ADD_TO_REGISTRY_ENTER](*1e6).3f us\n"
 
 // MSG1_RTOS_QUEUE_GET_NAME_ENTER ""
-#define MSG1_RTOS_QUEUE_GET_NAME_ENTER 1304U
+#define MSG1_RTOS_QUEUE_GET_NAME_ENTER 1828U
 // >>RTOS_MAIN "%N %t pcQueueGetName ENTER - 0x%08X\n"
 
 // MSG1_RTOS_QUEUE_GET_NAME_RETURN ""
-#define MSG1_RTOS_QUEUE_GET_NAME_RETURN 1306U
+#define MSG1_RTOS_QUEUE_GET_NAME_RETURN 1830U
 // >>RTOS_MAIN "%N %t pcQueueGetName RETURN: pcReturn 0x%08X, "
 // >>RTOS_MAIN "dt=%[t-MSG1_RTOS_QUEUE_GET_NAME_ENTER](*1e6).3f us\n"
 
 // MSG1_RTOS_QUEUE_UNREGISTER_ENTER ""
-#define MSG1_RTOS_QUEUE_UNREGISTER_ENTER 1308U
+#define MSG1_RTOS_QUEUE_UNREGISTER_ENTER 1832U
 // >>RTOS_MAIN "%N %t vQueueUnregisterQueue ENTER: xQueue 0x%08X\n"
 
 // MSG0_RTOS_QUEUE_UNREGISTER_RETURN ""
-#define MSG0_RTOS_QUEUE_UNREGISTER_RETURN 1310U
+#define MSG0_RTOS_QUEUE_UNREGISTER_RETURN 1834U
 // >>RTOS_MAIN "%N %t vQueueUnregisterQueue RETURN, "
 // >>RTOS_MAIN "dt=%[t-MSG1_RTOS_QUEUE_UNREGISTER_ENTER](*1e6).3f us\n"
 
 // MSG3_RTOS_QUEUE_WAIT_FOR_MESSAGE_RESTRICTED_ENTER ""
-#define MSG3_RTOS_QUEUE_WAIT_FOR_MESSAGE_RESTRICTED_ENTER 1312U
+#define MSG3_RTOS_QUEUE_WAIT_FOR_MESSAGE_RESTRICTED_ENTER 1536U
 // >>RTOS_MAIN "%N %t vQueueWaitForMessageRestricted ENTER: xQueue 0x%08X, "
 // >>RTOS_MAIN "xTicksToWait %u, xWaitIndefinitely %u\n"
 
 // MSG0_RTOS_QUEUE_WAIT_FOR_MESSAGE_RESTRICTED_RETURN ""
-#define MSG0_RTOS_QUEUE_WAIT_FOR_MESSAGE_RESTRICTED_RETURN 1311U
+#define MSG0_RTOS_QUEUE_WAIT_FOR_MESSAGE_RESTRICTED_RETURN 1544U
 // >>RTOS_MAIN "%N %t vQueueWaitForMessageRestricted RETURN, "
 // >>RTOS_MAIN "dt=%[t-MSG3_RTOS_QUEUE_WAIT_FOR_MESSAGE_RESTRICTED_ENTER](*1e6).3f us\n"
 
 // MSG1_RTOS_QUEUE_CREATE_SET_ENTER ""
-#define MSG1_RTOS_QUEUE_CREATE_SET_ENTER 1320U
+#define MSG1_RTOS_QUEUE_CREATE_SET_ENTER 1836U
 // >>RTOS_MAIN "%N %t xQueueCreateSet ENTER: uxEventQueueLength %u\n"
 
 // MSG1_RTOS_QUEUE_CREATE_SET_RETURN ""
-#define MSG1_RTOS_QUEUE_CREATE_SET_RETURN 1322U
+#define MSG1_RTOS_QUEUE_CREATE_SET_RETURN 1838U
 // >>RTOS_MAIN "%N %t xQueueCreateSet RETURN: pxQueue 0x%08X, "
 // >>RTOS_MAIN "dt=%[t-MSG1_RTOS_QUEUE_CREATE_SET_ENTER](*1e6).3f us\n"
 
 // MSG1_RTOS_QUEUE_CREATE_SET_STATIC_ENTER ""
-#define MSG1_RTOS_QUEUE_CREATE_SET_STATIC_ENTER 1324U
+#define MSG1_RTOS_QUEUE_CREATE_SET_STATIC_ENTER 1840U
 // >>RTOS_MAIN "%N %t xQueueCreateSetStatic ENTER: uxEventQueueLength %u\n"
 
 // MSG1_RTOS_QUEUE_CREATE_SET_STATIC_RETURN ""
-#define MSG1_RTOS_QUEUE_CREATE_SET_STATIC_RETURN 1326U
+#define MSG1_RTOS_QUEUE_CREATE_SET_STATIC_RETURN 1842U
 // >>RTOS_MAIN "%N %t xQueueCreateSetStatic RETURN: pxQueue 0x%08X, "
 // >>RTOS_MAIN "dt=%[t-MSG1_RTOS_QUEUE_CREATE_SET_STATIC_ENTER](*1e6).3f us\n"
 
 // MSG2_RTOS_QUEUE_ADD_TO_SET_ENTER ""
-#define MSG2_RTOS_QUEUE_ADD_TO_SET_ENTER 1328U
+#define MSG2_RTOS_QUEUE_ADD_TO_SET_ENTER 1640U
 // >>RTOS_MAIN "%N %t xQueueAddToSet ENTER: xQueueOrSemaphore 0x%08X, xQueueSet 0x%08X\n"
 
 // MSG1_RTOS_QUEUE_ADD_TO_SET_RETURN ""
-#define MSG1_RTOS_QUEUE_ADD_TO_SET_RETURN 1332U
+#define MSG1_RTOS_QUEUE_ADD_TO_SET_RETURN 1644U
 // >>RTOS_MAIN "%N %t xQueueAddToSet RETURN: xReturn %u, "
 // >>RTOS_MAIN "dt=%[t-MSG2_RTOS_QUEUE_ADD_TO_SET_ENTER](*1e6).3f us\n"
 
 // MSG2_RTOS_QUEUE_REMOVE_FROM_SET_ENTER ""
-#define MSG2_RTOS_QUEUE_REMOVE_FROM_SET_ENTER 1336U
+#define MSG2_RTOS_QUEUE_REMOVE_FROM_SET_ENTER 1648U
 // >>RTOS_MAIN "%N %t xQueueRemoveFromSet ENTER: xQueueOrSemaphore 0x%08X, xQueueSet 0x%08X\n"
 
 // MSG1_RTOS_QUEUE_REMOVE_FROM_SET_RETURN ""
-#define MSG1_RTOS_QUEUE_REMOVE_FROM_SET_RETURN 1334U
+#define MSG1_RTOS_QUEUE_REMOVE_FROM_SET_RETURN 1652U
 // >>RTOS_MAIN "%N %t xQueueRemoveFromSet RETURN: xReturn %u, "
 // >>RTOS_MAIN "dt=%[t-MSG2_RTOS_QUEUE_REMOVE_FROM_SET_ENTER](*1e6).3f us\n"
 
 // MSG2_RTOS_QUEUE_SELECT_FROM_SET_ENTER ""
-#define MSG2_RTOS_QUEUE_SELECT_FROM_SET_ENTER 1340U
+#define MSG2_RTOS_QUEUE_SELECT_FROM_SET_ENTER 1656U
 // >>RTOS_MAIN "%N %t xQueueSelectFromSet ENTER: xQueueSet 0x%08X, xTicksToWait %u\n"
 
 // MSG1_RTOS_QUEUE_SELECT_FROM_SET_RETURN ""
-#define MSG1_RTOS_QUEUE_SELECT_FROM_SET_RETURN 1344U
+#define MSG1_RTOS_QUEUE_SELECT_FROM_SET_RETURN 1660U
 // >>RTOS_MAIN "%N %t xQueueSelectFromSet RETURN: xReturn 0x%08X, "
 // >>RTOS_MAIN "dt=%[t-MSG2_RTOS_QUEUE_SELECT_FROM_SET_ENTER](*1e6).3f us\n"
 
 // MSG1_RTOS_QUEUE_SELECT_FROM_SET_FROM_ISR_ENTER ""
-#define MSG1_RTOS_QUEUE_SELECT_FROM_SET_FROM_ISR_ENTER 1346U
+#define MSG1_RTOS_QUEUE_SELECT_FROM_SET_FROM_ISR_ENTER 1844U
 // >>RTOS_MAIN "%N %t xQueueSelectFromSetFromISR ENTER: xQueueSet 0x%08X\n"
 
 // MSG1_RTOS_QUEUE_SELECT_FROM_SET_FROM_ISR_RETURN ""
-#define MSG1_RTOS_QUEUE_SELECT_FROM_SET_FROM_ISR_RETURN 1348U
+#define MSG1_RTOS_QUEUE_SELECT_FROM_SET_FROM_ISR_RETURN 1846U
 // >>RTOS_MAIN "%N %t xQueueSelectFromSetFromISR RETURN: xReturn 0x%08X, "
 // >>RTOS_MAIN "dt=%[t-MSG1_RTOS_QUEUE_SELECT_FROM_SET_FROM_ISR_ENTER](*1e6).3f us\n"
 
 // MSG0_RTOS_TIMER_CREATE_TIMER_TASK_ENTER ""
-#define MSG0_RTOS_TIMER_CREATE_TIMER_TASK_ENTER 1350U
+#define MSG0_RTOS_TIMER_CREATE_TIMER_TASK_ENTER 1850U
 // >>RTOS_MAIN "%N %t xTimerCreateTimerTask ENTER\n"
 
 // MSG1_RTOS_TIMER_CREATE_TIMER_TASK_RETURN ""
-#define MSG1_RTOS_TIMER_CREATE_TIMER_TASK_RETURN 1352U
+#define MSG1_RTOS_TIMER_CREATE_TIMER_TASK_RETURN 1848U
 // >>RTOS_MAIN "%N %t xTimerCreateTimerTask RETURN: xReturn %u, "
 // >>RTOS_MAIN "dt=%[t-MSG0_RTOS_TIMER_CREATE_TIMER_TASK_ENTER](*1e6).3f us\n"
 
 // MSG5_RTOS_TIMER_CREATE_ENTER ""
-#define MSG5_RTOS_TIMER_CREATE_ENTER 1360U
+#define MSG5_RTOS_TIMER_CREATE_ENTER 832U
 // >>RTOS_MAIN "%N %t xTimerCreate ENTER: pcTimerName 0x%08X, xTimerPeriodInTicks %u, xAutoReload %u, "
 // >>RTOS_MAIN "pvTimerID 0x%08X, pxCallbackFunction 0x%08X\n"
 
 // MSG1_RTOS_TIMER_CREATE_RETURN ""
-#define MSG1_RTOS_TIMER_CREATE_RETURN 1354U
+#define MSG1_RTOS_TIMER_CREATE_RETURN 848U
 // >>RTOS_MAIN "%N %t xTimerCreate RETURN: pxNewTimer 0x%08X, "
 // >>RTOS_MAIN "dt=%[t-MSG5_RTOS_TIMER_CREATE_ENTER](*1e6).3f us\n"
 
 // MSG6_RTOS_TIMER_CREATE_STATIC_ENTER ""
-#define MSG6_RTOS_TIMER_CREATE_STATIC_ENTER 1376U
+#define MSG6_RTOS_TIMER_CREATE_STATIC_ENTER 864U
 // >>RTOS_MAIN "%N %t xTimerCreateStatic ENTER: pcTimerName 0x%08X, xTimerPeriodInTicks %u, xAutoReload %u, "
 // >>RTOS_MAIN "pvTimerID 0x%08X, pxCallbackFunction 0x%08X, pxTimerBuffer 0x%08X\n"
 
 // MSG1_RTOS_TIMER_CREATE_STATIC_RETURN ""
-#define MSG1_RTOS_TIMER_CREATE_STATIC_RETURN 1356U
+#define MSG1_RTOS_TIMER_CREATE_STATIC_RETURN 880U
 // >>RTOS_MAIN "%N %t xTimerCreateStatic RETURN: pxNewTimer 0x%08X, "
 // >>RTOS_MAIN "dt=%[t-MSG6_RTOS_TIMER_CREATE_STATIC_ENTER](*1e6).3f us\n"
 
 // MSG5_RTOS_TIMER_GENERIC_COMMAND_FROM_TASK_ENTER ""
-#define MSG5_RTOS_TIMER_GENERIC_COMMAND_FROM_TASK_ENTER 1392U
+#define MSG5_RTOS_TIMER_GENERIC_COMMAND_FROM_TASK_ENTER 896U
 // >>RTOS_MAIN "%N %t xTimerGenericCommandFromTask ENTER: xTimer 0x%08X, xCommandID %u, "
 // >>RTOS_MAIN "xOptionalValue %u, pxHigherPriorityTaskWoken 0x%08X, xTicksToWait %u\n"
 
 // MSG1_RTOS_TIMER_GENERIC_COMMAND_FROM_TASK_RETURN ""
-#define MSG1_RTOS_TIMER_GENERIC_COMMAND_FROM_TASK_RETURN 1358U
+#define MSG1_RTOS_TIMER_GENERIC_COMMAND_FROM_TASK_RETURN 912U
 // >>RTOS_MAIN "%N %t xTimerGenericCommandFromTask RETURN: xReturn %u, "
 // >>RTOS_MAIN "dt=%[t-MSG5_RTOS_TIMER_GENERIC_COMMAND_FROM_TASK_ENTER](*1e6).3f us\n"
 
 // MSG5_RTOS_TIMER_GENERIC_COMMAND_FROM_ISR_ENTER ""
-#define MSG5_RTOS_TIMER_GENERIC_COMMAND_FROM_ISR_ENTER 1408U
+#define MSG5_RTOS_TIMER_GENERIC_COMMAND_FROM_ISR_ENTER 928U
 // >>RTOS_MAIN "%N %t xTimerGenericCommandFromISR ENTER: xTimer 0x%08X, xCommandID %u, "
 // >>RTOS_MAIN "xOptionalValue %u, pxHigherPriorityTaskWoken 0x%08X, xTicksToWait %u\n"
 
 // MSG1_RTOS_TIMER_GENERIC_COMMAND_FROM_ISR_RETURN ""
-#define MSG1_RTOS_TIMER_GENERIC_COMMAND_FROM_ISR_RETURN 1424U
+#define MSG1_RTOS_TIMER_GENERIC_COMMAND_FROM_ISR_RETURN 944U
 // >>RTOS_MAIN "%N %t xTimerGenericCommandFromISR RETURN: xReturn %u, "
 // >>RTOS_MAIN "dt=%[t-MSG5_RTOS_TIMER_GENERIC_COMMAND_FROM_ISR_ENTER](*1e6).3f us\n"
 
 // MSG0_RTOS_TIMER_GET_DAEMON_TASK_HANDLE_ENTER ""
-#define MSG0_RTOS_TIMER_GET_DAEMON_TASK_HANDLE_ENTER 1351U
+#define MSG0_RTOS_TIMER_GET_DAEMON_TASK_HANDLE_ENTER 1854U
 // >>RTOS_MAIN "%N %t xTimerGetTimerDaemonTaskHandle ENTER\n"
 
 // MSG1_RTOS_TIMER_GET_DAEMON_TASK_HANDLE_RETURN ""
-#define MSG1_RTOS_TIMER_GET_DAEMON_TASK_HANDLE_RETURN 1426U
+#define MSG1_RTOS_TIMER_GET_DAEMON_TASK_HANDLE_RETURN 1852U
 // >>RTOS_MAIN "%N %t xTimerGetTimerDaemonTaskHandle RETURN: xTimerTaskHandle 0x%08X, "
 // >>RTOS_MAIN "dt=%[t-MSG0_RTOS_TIMER_GET_DAEMON_TASK_HANDLE_ENTER](*1e6).3f us\n"
 
 // MSG1_RTOS_TIMER_GET_PERIOD_ENTER ""
-#define MSG1_RTOS_TIMER_GET_PERIOD_ENTER 1428U
+#define MSG1_RTOS_TIMER_GET_PERIOD_ENTER 1856U
 // >>RTOS_MAIN "%N %t xTimerGetPeriod ENTER: xTimer 0x%08X\n"
 
 // MSG1_RTOS_TIMER_GET_PERIOD_RETURN ""
-#define MSG1_RTOS_TIMER_GET_PERIOD_RETURN 1430U
+#define MSG1_RTOS_TIMER_GET_PERIOD_RETURN 1858U
 // >>RTOS_MAIN "%N %t xTimerGetPeriod RETURN: xTimerPeriodInTicks %u, "
 // >>RTOS_MAIN "dt=%[t-MSG1_RTOS_TIMER_GET_PERIOD_ENTER](*1e6).3f us\n"
 
 // MSG2_RTOS_TIMER_SET_RELOAD_MODE_ENTER ""
-#define MSG2_RTOS_TIMER_SET_RELOAD_MODE_ENTER 1432U
+#define MSG2_RTOS_TIMER_SET_RELOAD_MODE_ENTER 1664U
 // >>RTOS_MAIN "%N %t vTimerSetReloadMode ENTER: xTimer 0x%08X, xAutoReload %u\n"
 
 // MSG0_RTOS_TIMER_SET_RELOAD_MODE_RETURN ""
-#define MSG0_RTOS_TIMER_SET_RELOAD_MODE_RETURN 1436U
+#define MSG0_RTOS_TIMER_SET_RELOAD_MODE_RETURN 1668U
 // >>RTOS_MAIN "%N %t vTimerSetReloadMode RETURN, "
 // >>RTOS_MAIN "dt=%[t-MSG2_RTOS_TIMER_SET_RELOAD_MODE_ENTER](*1e6).3f us\n"
 
 // MSG1_RTOS_TIMER_GET_RELOAD_MODE_ENTER ""
-#define MSG1_RTOS_TIMER_GET_RELOAD_MODE_ENTER 1438U
+#define MSG1_RTOS_TIMER_GET_RELOAD_MODE_ENTER 1860U
 // >>RTOS_MAIN "%N %t xTimerGetReloadMode ENTER: xTimer 0x%08X\n"
 
 // MSG1_RTOS_TIMER_GET_RELOAD_MODE_RETURN ""
-#define MSG1_RTOS_TIMER_GET_RELOAD_MODE_RETURN 1440U
+#define MSG1_RTOS_TIMER_GET_RELOAD_MODE_RETURN 1862U
 // >>RTOS_MAIN "%N %t xTimerGetReloadMode RETURN: xReturn %u, "
 // >>RTOS_MAIN "dt=%[t-MSG1_RTOS_TIMER_GET_RELOAD_MODE_ENTER](*1e6).3f us\n"
 
 // MSG1_RTOS_TIMER_UX_GET_RELOAD_MODE_ENTER ""
-#define MSG1_RTOS_TIMER_UX_GET_RELOAD_MODE_ENTER 1442U
+#define MSG1_RTOS_TIMER_UX_GET_RELOAD_MODE_ENTER 1864U
 // >>RTOS_MAIN "%N %t uxTimerGetReloadMode ENTER: xTimer 0x%08X\n"
 
 // MSG1_RTOS_TIMER_UX_GET_RELOAD_MODE_RETURN ""
-#define MSG1_RTOS_TIMER_UX_GET_RELOAD_MODE_RETURN 1444U
+#define MSG1_RTOS_TIMER_UX_GET_RELOAD_MODE_RETURN 1866U
 // >>RTOS_MAIN "%N %t uxTimerGetReloadMode RETURN: uxReturn %u, "
 // >>RTOS_MAIN "dt=%[t-MSG1_RTOS_TIMER_UX_GET_RELOAD_MODE_ENTER](*1e6).3f us\n"
 
 // MSG1_RTOS_TIMER_GET_EXPIRY_TIME_ENTER ""
-#define MSG1_RTOS_TIMER_GET_EXPIRY_TIME_ENTER 1446U
+#define MSG1_RTOS_TIMER_GET_EXPIRY_TIME_ENTER 1868U
 // >>RTOS_MAIN "%N %t xTimerGetExpiryTime ENTER: xTimer 0x%08X\n"
 
 // MSG1_RTOS_TIMER_GET_EXPIRY_TIME_RETURN ""
-#define MSG1_RTOS_TIMER_GET_EXPIRY_TIME_RETURN 1448U
+#define MSG1_RTOS_TIMER_GET_EXPIRY_TIME_RETURN 1870U
 // >>RTOS_MAIN "%N %t xTimerGetExpiryTime RETURN: xReturn %u, "
 // >>RTOS_MAIN "dt=%[t-MSG1_RTOS_TIMER_GET_EXPIRY_TIME_ENTER](*1e6).3f us\n"
 
 // MSG2_RTOS_TIMER_GET_STATIC_BUFFER_ENTER ""
-#define MSG2_RTOS_TIMER_GET_STATIC_BUFFER_ENTER 1452U
+#define MSG2_RTOS_TIMER_GET_STATIC_BUFFER_ENTER 1672U
 // >>RTOS_MAIN "%N %t xTimerGetStaticBuffer ENTER: xTimer 0x%08X, ppxTimerBuffer 0x%08X\n"
 
 // MSG1_RTOS_TIMER_GET_STATIC_BUFFER_RETURN ""
-#define MSG1_RTOS_TIMER_GET_STATIC_BUFFER_RETURN 1450U
+#define MSG1_RTOS_TIMER_GET_STATIC_BUFFER_RETURN 1676U
 // >>RTOS_MAIN "%N %t xTimerGetStaticBuffer RETURN: xReturn %u, "
 // >>RTOS_MAIN "dt=%[t-MSG2_RTOS_TIMER_GET_STATIC_BUFFER_ENTER](*1e6).3f us\n"
 
 // MSG1_RTOS_TIMER_GET_NAME_ENTER ""
-#define MSG1_RTOS_TIMER_GET_NAME_ENTER 1456U
+#define MSG1_RTOS_TIMER_GET_NAME_ENTER 1872U
 // >>RTOS_MAIN "%N %t pcTimerGetName ENTER: xTimer 0x%08X\n"
 
 // MSG1_RTOS_TIMER_GET_NAME_RETURN ""
-#define MSG1_RTOS_TIMER_GET_NAME_RETURN 1458U
+#define MSG1_RTOS_TIMER_GET_NAME_RETURN 1874U
 // >>RTOS_MAIN "%N %t pcTimerGetName RETURN: pcTimerName 0x%08X, "
 // >>RTOS_MAIN "dt=%[t-MSG1_RTOS_TIMER_GET_NAME_ENTER](*1e6).3f us\n"
 
 // MSG1_RTOS_TIMER_IS_ACTIVE_ENTER ""
-#define MSG1_RTOS_TIMER_IS_ACTIVE_ENTER 1460U
+#define MSG1_RTOS_TIMER_IS_ACTIVE_ENTER 1876U
 // >>RTOS_MAIN "%N %t xTimerIsTimerActive ENTER: xTimer 0x%08X\n"
 
 // MSG1_RTOS_TIMER_IS_ACTIVE_RETURN ""
-#define MSG1_RTOS_TIMER_IS_ACTIVE_RETURN 1462U
+#define MSG1_RTOS_TIMER_IS_ACTIVE_RETURN 1878U
 // >>RTOS_MAIN "%N %t xTimerIsTimerActive RETURN: xReturn %u, "
 // >>RTOS_MAIN "dt=%[t-MSG1_RTOS_TIMER_IS_ACTIVE_ENTER](*1e6).3f us\n"
 
 // MSG1_RTOS_TIMER_GET_TIMER_ID_ENTER ""
-#define MSG1_RTOS_TIMER_GET_TIMER_ID_ENTER 1464U
+#define MSG1_RTOS_TIMER_GET_TIMER_ID_ENTER 1880U
 // >>RTOS_MAIN "%N %t pvTimerGetTimerID ENTER: xTimer 0x%08X\n"
 
 // MSG1_RTOS_TIMER_GET_TIMER_ID_RETURN ""
-#define MSG1_RTOS_TIMER_GET_TIMER_ID_RETURN 1466U
+#define MSG1_RTOS_TIMER_GET_TIMER_ID_RETURN 1882U
 // >>RTOS_MAIN "%N %t pvTimerGetTimerID RETURN: pvReturn 0x%08X, "
 // >>RTOS_MAIN "dt=%[t-MSG1_RTOS_TIMER_GET_TIMER_ID_ENTER](*1e6).3f us\n"
 
 // MSG2_RTOS_TIMER_SET_TIMER_ID_ENTER ""
-#define MSG2_RTOS_TIMER_SET_TIMER_ID_ENTER 1468U
+#define MSG2_RTOS_TIMER_SET_TIMER_ID_ENTER 1680U
 // >>RTOS_MAIN "%N %t vTimerSetTimerID ENTER: xTimer 0x%08X, pvNewID 0x%08X\n"
 
 // MSG0_RTOS_TIMER_SET_TIMER_ID_RETURN ""
-#define MSG0_RTOS_TIMER_SET_TIMER_ID_RETURN 1437U
+#define MSG0_RTOS_TIMER_SET_TIMER_ID_RETURN 1684U
 // >>RTOS_MAIN "%N %t vTimerSetTimerID RETURN, "
 // >>RTOS_MAIN "dt=%[t-MSG2_RTOS_TIMER_SET_TIMER_ID_ENTER](*1e6).3f us\n"
 
 // MSG4_RTOS_TIMER_PEND_FUNCTION_CALL_FROM_ISR_ENTER ""
-#define MSG4_RTOS_TIMER_PEND_FUNCTION_CALL_FROM_ISR_ENTER 1472U
+#define MSG4_RTOS_TIMER_PEND_FUNCTION_CALL_FROM_ISR_ENTER 960U
 // >>RTOS_MAIN "%N %t xTimerPendFunctionCallFromISR ENTER: xFunctionToPend 0x%08X, "
 // >>RTOS_MAIN "pvParameter1 0x%08X, ulParameter2 %u, pxHigherPriorityTaskWoken 0x%08X\n"
 
 // MSG1_RTOS_TIMER_PEND_FUNCTION_CALL_FROM_ISR_RETURN ""
-#define MSG1_RTOS_TIMER_PEND_FUNCTION_CALL_FROM_ISR_RETURN 1488U
+#define MSG1_RTOS_TIMER_PEND_FUNCTION_CALL_FROM_ISR_RETURN 976U
 // >>RTOS_MAIN "%N %t xTimerPendFunctionCallFromISR RETURN: xReturn %u, "
 // >>RTOS_MAIN "dt=%[t-MSG4_RTOS_TIMER_PEND_FUNCTION_CALL_FROM_ISR_ENTER](*1e6).3f us\n"
 
 // MSG4_RTOS_TIMER_PEND_FUNCTION_CALL_ENTER ""
-#define MSG4_RTOS_TIMER_PEND_FUNCTION_CALL_ENTER 1504U
+#define MSG4_RTOS_TIMER_PEND_FUNCTION_CALL_ENTER 992U
 // >>RTOS_MAIN "%N %t xTimerPendFunctionCall ENTER: xFunctionToPend 0x%08X, pvParameter1 0x%08X, "
 // >>RTOS_MAIN "ulParameter2 %u, xTicksToWait %u\n"
 
 // MSG1_RTOS_TIMER_PEND_FUNCTION_CALL_RETURN ""
-#define MSG1_RTOS_TIMER_PEND_FUNCTION_CALL_RETURN 1490U
+#define MSG1_RTOS_TIMER_PEND_FUNCTION_CALL_RETURN 1008U
 // >>RTOS_MAIN "%N %t xTimerPendFunctionCall RETURN: xReturn %u, "
 // >>RTOS_MAIN "dt=%[t-MSG4_RTOS_TIMER_PEND_FUNCTION_CALL_ENTER](*1e6).3f us\n"
 
 // MSG1_RTOS_TIMER_GET_TIMER_NUMBER_ENTER ""
-#define MSG1_RTOS_TIMER_GET_TIMER_NUMBER_ENTER 1492U
+#define MSG1_RTOS_TIMER_GET_TIMER_NUMBER_ENTER 1884U
 // >>RTOS_MAIN "%N %t uxTimerGetTimerNumber ENTER: xTimer 0x%08X\n"
 
 // MSG1_RTOS_TIMER_GET_TIMER_NUMBER_RETURN ""
-#define MSG1_RTOS_TIMER_GET_TIMER_NUMBER_RETURN 1494U
+#define MSG1_RTOS_TIMER_GET_TIMER_NUMBER_RETURN 1886U
 // >>RTOS_MAIN "%N %t uxTimerGetTimerNumber RETURN: uxTimerNumber %u, "
 // >>RTOS_MAIN "dt=%[t-MSG1_RTOS_TIMER_GET_TIMER_NUMBER_ENTER](*1e6).3f us\n"
 
 // MSG2_RTOS_TIMER_SET_TIMER_NUMBER_ENTER ""
-#define MSG2_RTOS_TIMER_SET_TIMER_NUMBER_ENTER 1496U
+#define MSG2_RTOS_TIMER_SET_TIMER_NUMBER_ENTER 1688U
 // >>RTOS_MAIN "%N %t vTimerSetTimerNumber ENTER: xTimer 0x%08X, uxTimerNumber %u\n"
 
 // MSG0_RTOS_TIMER_SET_TIMER_NUMBER_RETURN ""
-#define MSG0_RTOS_TIMER_SET_TIMER_NUMBER_RETURN 1500U
+#define MSG0_RTOS_TIMER_SET_TIMER_NUMBER_RETURN 1692U
 // >>RTOS_MAIN "%N %t vTimerSetTimerNumber RETURN, "
 // >>RTOS_MAIN "dt=%[t-MSG2_RTOS_TIMER_SET_TIMER_NUMBER_ENTER](*1e6).3f us\n"
 
 // MSG5_RTOS_STREAM_BUFFER_GENERIC_CREATE_ENTER ""
-#define MSG5_RTOS_STREAM_BUFFER_GENERIC_CREATE_ENTER 1520U
+#define MSG5_RTOS_STREAM_BUFFER_GENERIC_CREATE_ENTER 1024U
 // >>RTOS_MAIN "%N %t xStreamBufferGenericCreate ENTER: xBufferSizeBytes %u, xTriggerLevelBytes %u, "
 // >>RTOS_MAIN "xStreamBufferType %u, pxSendCompletedCallback 0x%08X, "
 // >>RTOS_MAIN "pxReceiveCompletedCallback 0x%08X\n"
 
 // MSG1_RTOS_STREAM_BUFFER_GENERIC_CREATE_RETURN ""
-#define MSG1_RTOS_STREAM_BUFFER_GENERIC_CREATE_RETURN 1502U
+#define MSG1_RTOS_STREAM_BUFFER_GENERIC_CREATE_RETURN 1040U
 // >>RTOS_MAIN "%N %t xStreamBufferGenericCreate RETURN: pvAllocatedMemory 0x%08X, "
 // >>RTOS_MAIN "dt=%[t-MSG5_RTOS_STREAM_BUFFER_GENERIC_CREATE_ENTER](*1e6).3f us\n"
 
 // MSG7_RTOS_STREAM_BUFFER_GENERIC_CREATE_STATIC_ENTER ""
-#define MSG7_RTOS_STREAM_BUFFER_GENERIC_CREATE_STATIC_ENTER 1536U
+#define MSG7_RTOS_STREAM_BUFFER_GENERIC_CREATE_STATIC_ENTER 1056U
 // >>RTOS_MAIN "%N %t xStreamBufferGenericCreateStatic ENTER: xBufferSizeBytes %u, xTriggerLevelBytes %u, "
 // >>RTOS_MAIN "xStreamBufferType %u, pucStreamBufferStorageArea 0x%08X, pxStaticStreamBuffer 0x%08X, "
 // >>RTOS_MAIN "pxSendCompletedCallback 0x%08X, pxReceiveCompletedCallback 0x%08X\n"
 
 // MSG1_RTOS_STREAM_BUFFER_GENERIC_CREATE_STATIC_RETURN ""
-#define MSG1_RTOS_STREAM_BUFFER_GENERIC_CREATE_STATIC_RETURN 1552U
+#define MSG1_RTOS_STREAM_BUFFER_GENERIC_CREATE_STATIC_RETURN 1072U
 // >>RTOS_MAIN "%N %t xStreamBufferGenericCreateStatic RETURN: xReturn 0x%08X, "
 // >>RTOS_MAIN "dt=%[t-MSG7_RTOS_STREAM_BUFFER_GENERIC_CREATE_STATIC_ENTER](*1e6).3f us\n"
 
 // MSG3_RTOS_STREAM_BUFFER_GET_STATIC_BUFFERS_ENTER ""
-#define MSG3_RTOS_STREAM_BUFFER_GET_STATIC_BUFFERS_ENTER 1560U
+#define MSG3_RTOS_STREAM_BUFFER_GET_STATIC_BUFFERS_ENTER 1552U
 // >>RTOS_MAIN "%N %t xStreamBufferGetStaticBuffers ENTER: xStreamBuffer 0x%08X, "
 // >>RTOS_MAIN "ppucStreamBufferStorageArea 0x%08X, ppxStaticStreamBuffer 0x%08X\n"
 
 // MSG1_RTOS_STREAM_BUFFER_GET_STATIC_BUFFERS_RETURN ""
-#define MSG1_RTOS_STREAM_BUFFER_GET_STATIC_BUFFERS_RETURN 1554U
+#define MSG1_RTOS_STREAM_BUFFER_GET_STATIC_BUFFERS_RETURN 1560U
 // >>RTOS_MAIN "%N %t xStreamBufferGetStaticBuffers RETURN: xReturn %u, "
 // >>RTOS_MAIN "dt=%[t-MSG3_RTOS_STREAM_BUFFER_GET_STATIC_BUFFERS_ENTER](*1e6).3f us\n"
 
 // MSG1_RTOS_STREAM_BUFFER_DELETE_ENTER ""
-#define MSG1_RTOS_STREAM_BUFFER_DELETE_ENTER 1556U
+#define MSG1_RTOS_STREAM_BUFFER_DELETE_ENTER 1888U
 // >>RTOS_MAIN "%N %t vStreamBufferDelete ENTER: xStreamBuffer 0x%08X\n"
 
 // MSG0_RTOS_STREAM_BUFFER_DELETE_RETURN ""
-#define MSG0_RTOS_STREAM_BUFFER_DELETE_RETURN 1501U
+#define MSG0_RTOS_STREAM_BUFFER_DELETE_RETURN 1890U
 // >>RTOS_MAIN "%N %t vStreamBufferDelete RETURN, "
 // >>RTOS_MAIN "dt=%[t-MSG1_RTOS_STREAM_BUFFER_DELETE_ENTER](*1e6).3f us\n"
 
 // MSG1_RTOS_STREAM_BUFFER_RESET_ENTER ""
-#define MSG1_RTOS_STREAM_BUFFER_RESET_ENTER 1558U
+#define MSG1_RTOS_STREAM_BUFFER_RESET_ENTER 1892U
 // >>RTOS_MAIN "%N %t xStreamBufferReset ENTER: xStreamBuffer 0x%08X\n"
 
 // MSG1_RTOS_STREAM_BUFFER_RESET_RETURN ""
-#define MSG1_RTOS_STREAM_BUFFER_RESET_RETURN 1568U
+#define MSG1_RTOS_STREAM_BUFFER_RESET_RETURN 1894U
 // >>RTOS_MAIN "%N %t xStreamBufferReset RETURN: xReturn %u, "
 // >>RTOS_MAIN "dt=%[t-MSG1_RTOS_STREAM_BUFFER_RESET_ENTER](*1e6).3f us\n"
 
 // MSG1_RTOS_STREAM_BUFFER_RESET_FROM_ISR_ENTER ""
-#define MSG1_RTOS_STREAM_BUFFER_RESET_FROM_ISR_ENTER 1570U
+#define MSG1_RTOS_STREAM_BUFFER_RESET_FROM_ISR_ENTER 1896U
 // >>RTOS_MAIN "%N %t xStreamBufferResetFromISR ENTER: xStreamBuffer 0x%08X\n"
 
 // MSG1_RTOS_STREAM_BUFFER_RESET_FROM_ISR_RETURN ""
-#define MSG1_RTOS_STREAM_BUFFER_RESET_FROM_ISR_RETURN 1572U
+#define MSG1_RTOS_STREAM_BUFFER_RESET_FROM_ISR_RETURN 1898U
 // >>RTOS_MAIN "%N %t xStreamBufferResetFromISR RETURN: xReturn %u, "
 // >>RTOS_MAIN "dt=%[t-MSG1_RTOS_STREAM_BUFFER_RESET_FROM_ISR_ENTER](*1e6).3f us\n"
 
 // MSG2_RTOS_STREAM_BUFFER_SET_TRIGGER_LEVEL_ENTER ""
-#define MSG2_RTOS_STREAM_BUFFER_SET_TRIGGER_LEVEL_ENTER 1576U
+#define MSG2_RTOS_STREAM_BUFFER_SET_TRIGGER_LEVEL_ENTER 1696U
 // >>RTOS_MAIN "%N %t xStreamBufferSetTriggerLevel ENTER: xStreamBuffer 0x%08X, xTriggerLevel %u\n"
 
 // MSG1_RTOS_STREAM_BUFFER_SET_TRIGGER_LEVEL_RETURN ""
-#define MSG1_RTOS_STREAM_BUFFER_SET_TRIGGER_LEVEL_RETURN 1574U
+#define MSG1_RTOS_STREAM_BUFFER_SET_TRIGGER_LEVEL_RETURN 1700U
 // >>RTOS_MAIN "%N %t xStreamBufferSetTriggerLevel RETURN: xReturn %u, "
 // >>RTOS_MAIN "dt=%[t-MSG2_RTOS_STREAM_BUFFER_SET_TRIGGER_LEVEL_ENTER](*1e6).3f us\n"
 
 // MSG1_RTOS_STREAM_BUFFER_SPACES_AVAILABLE_ENTER ""
-#define MSG1_RTOS_STREAM_BUFFER_SPACES_AVAILABLE_ENTER 1580U
+#define MSG1_RTOS_STREAM_BUFFER_SPACES_AVAILABLE_ENTER 1900U
 // >>RTOS_MAIN "%N %t xStreamBufferSpacesAvailable ENTER: xStreamBuffer 0x%08X\n"
 
 // MSG1_RTOS_STREAM_BUFFER_SPACES_AVAILABLE_RETURN ""
-#define MSG1_RTOS_STREAM_BUFFER_SPACES_AVAILABLE_RETURN 1582U
+#define MSG1_RTOS_STREAM_BUFFER_SPACES_AVAILABLE_RETURN 1902U
 // >>RTOS_MAIN "%N %t xStreamBufferSpacesAvailable RETURN: xSpace %u, "
 // >>RTOS_MAIN "dt=%[t-MSG1_RTOS_STREAM_BUFFER_SPACES_AVAILABLE_ENTER](*1e6).3f us\n"
 
 // MSG1_RTOS_STREAM_BUFFER_BYTES_AVAILABLE_ENTER ""
-#define MSG1_RTOS_STREAM_BUFFER_BYTES_AVAILABLE_ENTER 1584U
+#define MSG1_RTOS_STREAM_BUFFER_BYTES_AVAILABLE_ENTER 1904U
 // >>RTOS_MAIN "%N %t xStreamBufferBytesAvailable ENTER: xStreamBuffer 0x%08X\n"
 
 // MSG1_RTOS_STREAM_BUFFER_BYTES_AVAILABLE_RETURN ""
-#define MSG1_RTOS_STREAM_BUFFER_BYTES_AVAILABLE_RETURN 1586U
+#define MSG1_RTOS_STREAM_BUFFER_BYTES_AVAILABLE_RETURN 1906U
 // >>RTOS_MAIN "%N %t xStreamBufferBytesAvailable RETURN: xReturn %u, "
 // >>RTOS_MAIN "dt=%[t-MSG1_RTOS_STREAM_BUFFER_BYTES_AVAILABLE_ENTER](*1e6).3f us\n"
 
 // MSG4_RTOS_STREAM_BUFFER_SEND_ENTER ""
-#define MSG4_RTOS_STREAM_BUFFER_SEND_ENTER 1600U
+#define MSG4_RTOS_STREAM_BUFFER_SEND_ENTER 1088U
 // >>RTOS_MAIN "%N %t xStreamBufferSend ENTER: xStreamBuffer 0x%08X, pvTxData 0x%08X, "
 // >>RTOS_MAIN "xDataLengthBytes %u, xTicksToWait %u\n"
 
 // MSG1_RTOS_STREAM_BUFFER_SEND_RETURN ""
-#define MSG1_RTOS_STREAM_BUFFER_SEND_RETURN 1588U
+#define MSG1_RTOS_STREAM_BUFFER_SEND_RETURN 1104U
 // >>RTOS_MAIN "%N %t xStreamBufferSend RETURN: xReturn %u, "
 // >>RTOS_MAIN "dt=%[t-MSG4_RTOS_STREAM_BUFFER_SEND_ENTER](*1e6).3f us\n"
 
 // MSG4_RTOS_STREAM_BUFFER_SEND_FROM_ISR_ENTER ""
-#define MSG4_RTOS_STREAM_BUFFER_SEND_FROM_ISR_ENTER 1616U
+#define MSG4_RTOS_STREAM_BUFFER_SEND_FROM_ISR_ENTER 1120U
 // >>RTOS_MAIN "%N %t xStreamBufferSendFromISR ENTER: xStreamBuffer 0x%08X, pvTxData 0x%08X, "
 // >>RTOS_MAIN "xDataLengthBytes %u, pxHigherPriorityTaskWoken 0x%08X\n"
 
 // MSG1_RTOS_STREAM_BUFFER_SEND_FROM_ISR_RETURN ""
-#define MSG1_RTOS_STREAM_BUFFER_SEND_FROM_ISR_RETURN 1590U
+#define MSG1_RTOS_STREAM_BUFFER_SEND_FROM_ISR_RETURN 1136U
 // >>RTOS_MAIN "%N %t xStreamBufferSendFromISR RETURN: xReturn %u, "
 // >>RTOS_MAIN "dt=%[t-MSG4_RTOS_STREAM_BUFFER_SEND_FROM_ISR_ENTER](*1e6).3f us\n"
 
 // MSG4_RTOS_STREAM_BUFFER_RECEIVE_ENTER ""
-#define MSG4_RTOS_STREAM_BUFFER_RECEIVE_ENTER 1632U
+#define MSG4_RTOS_STREAM_BUFFER_RECEIVE_ENTER 1152U
 // >>RTOS_MAIN "%N %t xStreamBufferReceive ENTER: xStreamBuffer 0x%08X, pvRxData 0x%08X, "
 // >>RTOS_MAIN "xBufferLengthBytes %u, xTicksToWait %u\n"
 
 // MSG1_RTOS_STREAM_BUFFER_RECEIVE_RETURN ""
-#define MSG1_RTOS_STREAM_BUFFER_RECEIVE_RETURN 1592U
+#define MSG1_RTOS_STREAM_BUFFER_RECEIVE_RETURN 1168U
 // >>RTOS_MAIN "%N %t xStreamBufferReceive RETURN: xReceivedLength %u, "
 // >>RTOS_MAIN "dt=%[t-MSG4_RTOS_STREAM_BUFFER_RECEIVE_ENTER](*1e6).3f us\n"
 
 // MSG1_RTOS_STREAM_BUFFER_NEXT_MESSAGE_LENGTH_BYTES_ENTER ""
-#define MSG1_RTOS_STREAM_BUFFER_NEXT_MESSAGE_LENGTH_BYTES_ENTER 1594U
+#define MSG1_RTOS_STREAM_BUFFER_NEXT_MESSAGE_LENGTH_BYTES_ENTER 1908U
 // >>RTOS_MAIN "%N %t xStreamBufferNextMessageLengthBytes ENTER: xStreamBuffer 0x%08X\n"
 
 // MSG1_RTOS_STREAM_BUFFER_NEXT_MESSAGE_LENGTH_BYTES_RETURN ""
-#define MSG1_RTOS_STREAM_BUFFER_NEXT_MESSAGE_LENGTH_BYTES_RETURN 1596U
+#define MSG1_RTOS_STREAM_BUFFER_NEXT_MESSAGE_LENGTH_BYTES_RETURN 1910U
 // >>RTOS_MAIN "%N %t xStreamBufferNextMessageLengthBytes RETURN: xReturn %u, "
 // >>RTOS_MAIN "dt=%[t-MSG1_RTOS_STREAM_BUFFER_NEXT_MESSAGE_LENGTH_BYTES_ENTER](*1e6).3f us\n"
 
 // MSG4_RTOS_STREAM_BUFFER_RECEIVE_FROM_ISR_ENTER ""
-#define MSG4_RTOS_STREAM_BUFFER_RECEIVE_FROM_ISR_ENTER 1648U
+#define MSG4_RTOS_STREAM_BUFFER_RECEIVE_FROM_ISR_ENTER 1184U
 // >>RTOS_MAIN "%N %t xStreamBufferReceiveFromISR ENTER: xStreamBuffer 0x%08X, pvRxData 0x%08X, "
 // >>RTOS_MAIN "xBufferLengthBytes %u, pxHigherPriorityTaskWoken 0x%08X\n"
 
 // MSG1_RTOS_STREAM_BUFFER_RECEIVE_FROM_ISR_RETURN ""
-#define MSG1_RTOS_STREAM_BUFFER_RECEIVE_FROM_ISR_RETURN 1598U
+#define MSG1_RTOS_STREAM_BUFFER_RECEIVE_FROM_ISR_RETURN 1200U
 // >>RTOS_MAIN "%N %t xStreamBufferReceiveFromISR RETURN: xReceivedLength %u, "
 // >>RTOS_MAIN "dt=%[t-MSG4_RTOS_STREAM_BUFFER_RECEIVE_FROM_ISR_ENTER](*1e6).3f us\n"
 
 // MSG1_RTOS_STREAM_BUFFER_IS_EMPTY_ENTER ""
-#define MSG1_RTOS_STREAM_BUFFER_IS_EMPTY_ENTER 1664U
+#define MSG1_RTOS_STREAM_BUFFER_IS_EMPTY_ENTER 1912U
 // >>RTOS_MAIN "%N %t xStreamBufferIsEmpty ENTER: xStreamBuffer 0x%08X\n"
 
 // MSG1_RTOS_STREAM_BUFFER_IS_EMPTY_RETURN ""
-#define MSG1_RTOS_STREAM_BUFFER_IS_EMPTY_RETURN 1666U
+#define MSG1_RTOS_STREAM_BUFFER_IS_EMPTY_RETURN 1914U
 // >>RTOS_MAIN "%N %t xStreamBufferIsEmpty RETURN: xReturn %u, "
 // >>RTOS_MAIN "dt=%[t-MSG1_RTOS_STREAM_BUFFER_IS_EMPTY_ENTER](*1e6).3f us\n"
 
 // MSG1_RTOS_STREAM_BUFFER_IS_FULL_ENTER ""
-#define MSG1_RTOS_STREAM_BUFFER_IS_FULL_ENTER 1668U
+#define MSG1_RTOS_STREAM_BUFFER_IS_FULL_ENTER 1916U
 // >>RTOS_MAIN "%N %t xStreamBufferIsFull ENTER: xStreamBuffer 0x%08X\n"
 
 // MSG1_RTOS_STREAM_BUFFER_IS_FULL_RETURN ""
-#define MSG1_RTOS_STREAM_BUFFER_IS_FULL_RETURN 1670U
+#define MSG1_RTOS_STREAM_BUFFER_IS_FULL_RETURN 1918U
 // >>RTOS_MAIN "%N %t xStreamBufferIsFull RETURN: xReturn %u, "
 // >>RTOS_MAIN "dt=%[t-MSG1_RTOS_STREAM_BUFFER_IS_FULL_ENTER](*1e6).3f us\n"
 
 // MSG2_RTOS_STREAM_BUFFER_SEND_COMPLETED_FROM_ISR_ENTER ""
-#define MSG2_RTOS_STREAM_BUFFER_SEND_COMPLETED_FROM_ISR_ENTER 1672U
+#define MSG2_RTOS_STREAM_BUFFER_SEND_COMPLETED_FROM_ISR_ENTER 1704U
 // >>RTOS_MAIN "%N %t xStreamBufferSendCompletedFromISR ENTER: xStreamBuffer 0x%08X, "
 // >>RTOS_MAIN "pxHigherPriorityTaskWoken 0x%08X\n"
 
 // MSG1_RTOS_STREAM_BUFFER_SEND_COMPLETED_FROM_ISR_RETURN ""
-#define MSG1_RTOS_STREAM_BUFFER_SEND_COMPLETED_FROM_ISR_RETURN 1676U
+#define MSG1_RTOS_STREAM_BUFFER_SEND_COMPLETED_FROM_ISR_RETURN 1708U
 // >>RTOS_MAIN "%N %t xStreamBufferSendCompletedFromISR RETURN: xReturn %u, "
 // >>RTOS_MAIN "dt=%[t-MSG2_RTOS_STREAM_BUFFER_SEND_COMPLETED_FROM_ISR_ENTER](*1e6).3f us\n"
 
 // MSG2_RTOS_STREAM_BUFFER_RECEIVE_COMPLETED_FROM_ISR_ENTER ""
-#define MSG2_RTOS_STREAM_BUFFER_RECEIVE_COMPLETED_FROM_ISR_ENTER 1680U
+#define MSG2_RTOS_STREAM_BUFFER_RECEIVE_COMPLETED_FROM_ISR_ENTER 1712U
 // >>RTOS_MAIN "%N %t xStreamBufferReceiveCompletedFromISR ENTER: xStreamBuffer 0x%08X, "
 // >>RTOS_MAIN "pxHigherPriorityTaskWoken 0x%08X\n"
 
 // MSG1_RTOS_STREAM_BUFFER_RECEIVE_COMPLETED_FROM_ISR_RETURN ""
-#define MSG1_RTOS_STREAM_BUFFER_RECEIVE_COMPLETED_FROM_ISR_RETURN 1678U
+#define MSG1_RTOS_STREAM_BUFFER_RECEIVE_COMPLETED_FROM_ISR_RETURN 1716U
 // >>RTOS_MAIN "%N %t xStreamBufferReceiveCompletedFromISR RETURN: xReturn %u, "
 // >>RTOS_MAIN "dt=%[t-MSG2_RTOS_STREAM_BUFFER_RECEIVE_COMPLETED_FROM_ISR_ENTER](*1e6).3f us\n"
 
 // MSG1_RTOS_STREAM_BUFFER_GET_NOTIFICATION_INDEX_ENTER ""
-#define MSG1_RTOS_STREAM_BUFFER_GET_NOTIFICATION_INDEX_ENTER 1684U
+#define MSG1_RTOS_STREAM_BUFFER_GET_NOTIFICATION_INDEX_ENTER 1920U
 // >>RTOS_MAIN "%N %t uxStreamBufferGetStreamBufferNotificationIndex ENTER: xStreamBuffer 0x%08X\n"
 
 // MSG1_RTOS_STREAM_BUFFER_GET_NOTIFICATION_INDEX_RETURN ""
-#define MSG1_RTOS_STREAM_BUFFER_GET_NOTIFICATION_INDEX_RETURN 1686U
+#define MSG1_RTOS_STREAM_BUFFER_GET_NOTIFICATION_INDEX_RETURN 1922U
 // >>RTOS_MAIN "%N %t uxStreamBufferGetStreamBufferNotificationIndex RETURN: uxNotificationIndex %u, "
 // >>RTOS_MAIN "dt=%[t-MSG1_RTOS_STREAM_BUFFER_GET_NOTIFICATION_INDEX_ENTER](*1e6).3f us\n"
 
 // MSG2_RTOS_STREAM_BUFFER_SET_NOTIFICATION_INDEX_ENTER ""
-#define MSG2_RTOS_STREAM_BUFFER_SET_NOTIFICATION_INDEX_ENTER 1688U
+#define MSG2_RTOS_STREAM_BUFFER_SET_NOTIFICATION_INDEX_ENTER 1720U
 // >>RTOS_MAIN "%N %t vStreamBufferSetStreamBufferNotificationIndex ENTER: xStreamBuffer 0x%08X, "
 // >>RTOS_MAIN "uxNotificationIndex %u\n"
 
 // MSG0_RTOS_STREAM_BUFFER_SET_NOTIFICATION_INDEX_RETURN ""
-#define MSG0_RTOS_STREAM_BUFFER_SET_NOTIFICATION_INDEX_RETURN 1692U
+#define MSG0_RTOS_STREAM_BUFFER_SET_NOTIFICATION_INDEX_RETURN 1724U
 // >>RTOS_MAIN "%N %t vStreamBufferSetStreamBufferNotificationIndex RETURN, "
 // >>RTOS_MAIN "dt=%[t-MSG2_RTOS_STREAM_BUFFER_SET_NOTIFICATION_INDEX_ENTER](*1e6).3f us\n"
 
 // MSG1_RTOS_STREAM_BUFFER_GET_NUMBER_ENTER ""
-#define MSG1_RTOS_STREAM_BUFFER_GET_NUMBER_ENTER 1694U
+#define MSG1_RTOS_STREAM_BUFFER_GET_NUMBER_ENTER 1924U
 // >>RTOS_MAIN "%N %t uxStreamBufferGetStreamBufferNumber ENTER: xStreamBuffer 0x%08X\n"
 
 // MSG1_RTOS_STREAM_BUFFER_GET_NUMBER_RETURN ""
-#define MSG1_RTOS_STREAM_BUFFER_GET_NUMBER_RETURN 1696U
+#define MSG1_RTOS_STREAM_BUFFER_GET_NUMBER_RETURN 1926U
 // >>RTOS_MAIN "%N %t uxStreamBufferGetStreamBufferNumber RETURN: uxStreamBufferNumber %u, "
 // >>RTOS_MAIN "dt=%[t-MSG1_RTOS_STREAM_BUFFER_GET_NUMBER_ENTER](*1e6).3f us\n"
 
 // MSG2_RTOS_STREAM_BUFFER_SET_NUMBER_ENTER ""
-#define MSG2_RTOS_STREAM_BUFFER_SET_NUMBER_ENTER 1700U
+#define MSG2_RTOS_STREAM_BUFFER_SET_NUMBER_ENTER 1728U
 // >>RTOS_MAIN "%N %t vStreamBufferSetStreamBufferNumber ENTER: xStreamBuffer 0x%08X, "
 // >>RTOS_MAIN "uxStreamBufferNumber %u\n"
 
 // MSG0_RTOS_STREAM_BUFFER_SET_NUMBER_RETURN ""
-#define MSG0_RTOS_STREAM_BUFFER_SET_NUMBER_RETURN 1693U
+#define MSG0_RTOS_STREAM_BUFFER_SET_NUMBER_RETURN 1732U
 // >>RTOS_MAIN "%N %t vStreamBufferSetStreamBufferNumber RETURN, "
 // >>RTOS_MAIN "dt=%[t-MSG2_RTOS_STREAM_BUFFER_SET_NUMBER_ENTER](*1e6).3f us\n"
 
 // MSG1_RTOS_STREAM_BUFFER_GET_TYPE_ENTER ""
-#define MSG1_RTOS_STREAM_BUFFER_GET_TYPE_ENTER 1698U
+#define MSG1_RTOS_STREAM_BUFFER_GET_TYPE_ENTER 1928U
 // >>RTOS_MAIN "%N %t ucStreamBufferGetStreamBufferType ENTER: xStreamBuffer 0x%08X\n"
 
 // MSG1_RTOS_STREAM_BUFFER_GET_TYPE_RETURN ""
-#define MSG1_RTOS_STREAM_BUFFER_GET_TYPE_RETURN 1704U
+#define MSG1_RTOS_STREAM_BUFFER_GET_TYPE_RETURN 1930U
 // >>RTOS_MAIN "%N %t ucStreamBufferGetStreamBufferType RETURN: ucStreamBufferType %u, "
 // >>RTOS_MAIN "dt=%[t-MSG1_RTOS_STREAM_BUFFER_GET_TYPE_ENTER](*1e6).3f us\n"
 
 // MSG1_RTOS_LIST_INITIALISE_ENTER ""
-#define MSG1_RTOS_LIST_INITIALISE_ENTER 1706U
+#define MSG1_RTOS_LIST_INITIALISE_ENTER 1932U
 // >>RTOS_MAIN "%N %t vListInitialise ENTER: pxList 0x%08X\n"
 
 // MSG0_RTOS_LIST_INITIALISE_RETURN ""
-#define MSG0_RTOS_LIST_INITIALISE_RETURN 1708U
+#define MSG0_RTOS_LIST_INITIALISE_RETURN 1934U
 // >>RTOS_MAIN "%N %t vListInitialise RETURN, "
 // >>RTOS_MAIN "dt=%[t-MSG1_RTOS_LIST_INITIALISE_ENTER](*1e6).3f us\n"
 
 // MSG1_RTOS_LIST_INITIALISE_ITEM_ENTER ""
-#define MSG1_RTOS_LIST_INITIALISE_ITEM_ENTER 1710U
+#define MSG1_RTOS_LIST_INITIALISE_ITEM_ENTER 1936U
 // >>RTOS_MAIN "%N %t vListInitialiseItem ENTER: pxItem 0x%08X\n"
 
 // MSG0_RTOS_LIST_INITIALISE_ITEM_RETURN ""
-#define MSG0_RTOS_LIST_INITIALISE_ITEM_RETURN 1709U
+#define MSG0_RTOS_LIST_INITIALISE_ITEM_RETURN 1938U
 // >>RTOS_MAIN "%N %t vListInitialiseItem RETURN, "
 // >>RTOS_MAIN "dt=%[t-MSG1_RTOS_LIST_INITIALISE_ITEM_ENTER](*1e6).3f us\n"
 
 // MSG2_RTOS_LIST_INSERT_END_ENTER ""
-#define MSG2_RTOS_LIST_INSERT_END_ENTER 1712U
+#define MSG2_RTOS_LIST_INSERT_END_ENTER 1736U
 // >>RTOS_MAIN "%N %t vListInsertEnd ENTER: pxList 0x%08X, pxNewListItem 0x%08X\n"
 
 // MSG0_RTOS_LIST_INSERT_END_RETURN ""
-#define MSG0_RTOS_LIST_INSERT_END_RETURN 1716U
+#define MSG0_RTOS_LIST_INSERT_END_RETURN 1740U
 // >>RTOS_MAIN "%N %t vListInsertEnd RETURN, "
 // >>RTOS_MAIN "dt=%[t-MSG2_RTOS_LIST_INSERT_END_ENTER](*1e6).3f us\n"
 
 // MSG2_RTOS_LIST_INSERT_ENTER ""
-#define MSG2_RTOS_LIST_INSERT_ENTER 1720U
+#define MSG2_RTOS_LIST_INSERT_ENTER 1744U
 // >>RTOS_MAIN "%N %t vListInsert ENTER: pxList 0x%08X, pxNewListItem 0x%08X\n"
 
 // MSG0_RTOS_LIST_INSERT_RETURN ""
-#define MSG0_RTOS_LIST_INSERT_RETURN 1717U
+#define MSG0_RTOS_LIST_INSERT_RETURN 1748U
 // >>RTOS_MAIN "%N %t vListInsert RETURN, "
 // >>RTOS_MAIN "dt=%[t-MSG2_RTOS_LIST_INSERT_ENTER](*1e6).3f us\n"
 
 // MSG1_RTOS_LIST_REMOVE_ENTER ""
-#define MSG1_RTOS_LIST_REMOVE_ENTER 1718U
+#define MSG1_RTOS_LIST_REMOVE_ENTER 1940U
 // >>RTOS_MAIN "%N %t uxListRemove ENTER: pxItemToRemove 0x%08X\n"
 
 // MSG1_RTOS_LIST_REMOVE_RETURN ""
-#define MSG1_RTOS_LIST_REMOVE_RETURN 1724U
+#define MSG1_RTOS_LIST_REMOVE_RETURN 1942U
 // >>RTOS_MAIN "%N %t uxListRemove RETURN: uxNumberOfItems %u, "
 // >>RTOS_MAIN "dt=%[t-MSG1_RTOS_LIST_REMOVE_ENTER](*1e6).3f us\n"
 
 // MSG3_RTOS_CO_ROUTINE_CREATE_ENTER ""
-#define MSG3_RTOS_CO_ROUTINE_CREATE_ENTER 1728U
+#define MSG3_RTOS_CO_ROUTINE_CREATE_ENTER 1568U
 // >>RTOS_MAIN "%N %t xCoRoutineCreate ENTER: pxCoRoutineCode 0x%08X, uxPriority %u, uxIndex %u\n"
 
 // MSG1_RTOS_CO_ROUTINE_CREATE_RETURN ""
-#define MSG1_RTOS_CO_ROUTINE_CREATE_RETURN 1726U
+#define MSG1_RTOS_CO_ROUTINE_CREATE_RETURN 1576U
 // >>RTOS_MAIN "%N %t xCoRoutineCreate RETURN: xReturn %u, "
 // >>RTOS_MAIN "dt=%[t-MSG3_RTOS_CO_ROUTINE_CREATE_ENTER](*1e6).3f us\n"
 
 // MSG2_RTOS_CO_ROUTINE_ADD_TO_DELAYED_LIST_ENTER ""
-#define MSG2_RTOS_CO_ROUTINE_ADD_TO_DELAYED_LIST_ENTER 1736U
+#define MSG2_RTOS_CO_ROUTINE_ADD_TO_DELAYED_LIST_ENTER 1752U
 // >>RTOS_MAIN "%N %t vCoRoutineAddToDelayedList ENTER: xTicksToDelay %u, pxEventList 0x%08X\n"
 
 // MSG0_RTOS_CO_ROUTINE_ADD_TO_DELAYED_LIST_RETURN ""
-#define MSG0_RTOS_CO_ROUTINE_ADD_TO_DELAYED_LIST_RETURN 1740U
+#define MSG0_RTOS_CO_ROUTINE_ADD_TO_DELAYED_LIST_RETURN 1756U
 // >>RTOS_MAIN "%N %t vCoRoutineAddToDelayedList RETURN, "
 // >>RTOS_MAIN "dt=%[t-MSG2_RTOS_CO_ROUTINE_ADD_TO_DELAYED_LIST_ENTER](*1e6).3f us\n"
 
 // MSG0_RTOS_CO_ROUTINE_SCHEDULE_ENTER ""
-#define MSG0_RTOS_CO_ROUTINE_SCHEDULE_ENTER 1741U
+#define MSG0_RTOS_CO_ROUTINE_SCHEDULE_ENTER 530U
 // >>RTOS_MAIN "%N %t vCoRoutineSchedule ENTER\n"
 
 // MSG0_RTOS_CO_ROUTINE_SCHEDULE_RETURN ""
-#define MSG0_RTOS_CO_ROUTINE_SCHEDULE_RETURN 1742U
+#define MSG0_RTOS_CO_ROUTINE_SCHEDULE_RETURN 531U
 // >>RTOS_MAIN "%N %t vCoRoutineSchedule RETURN, "
 // >>RTOS_MAIN "dt=%[t-MSG0_RTOS_CO_ROUTINE_SCHEDULE_ENTER](*1e6).3f us\n"
 
 // MSG1_RTOS_CO_ROUTINE_REMOVE_FROM_EVENT_LIST_ENTER ""
-#define MSG1_RTOS_CO_ROUTINE_REMOVE_FROM_EVENT_LIST_ENTER 1744U
+#define MSG1_RTOS_CO_ROUTINE_REMOVE_FROM_EVENT_LIST_ENTER 1944U
 // >>RTOS_MAIN "%N %t xCoRoutineRemoveFromEventList ENTER: pxEventList 0x%08X\n"
 
 // MSG1_RTOS_CO_ROUTINE_REMOVE_FROM_EVENT_LIST_RETURN ""
-#define MSG1_RTOS_CO_ROUTINE_REMOVE_FROM_EVENT_LIST_RETURN 1746U
+#define MSG1_RTOS_CO_ROUTINE_REMOVE_FROM_EVENT_LIST_RETURN 1946U
 // >>RTOS_MAIN "%N %t xCoRoutineRemoveFromEventList RETURN: xReturn %u, "
 // >>RTOS_MAIN "dt=%[t-MSG1_RTOS_CO_ROUTINE_REMOVE_FROM_EVENT_LIST_ENTER](*1e6).3f us\n"
 
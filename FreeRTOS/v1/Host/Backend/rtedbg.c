@@ -0,0 +1,351 @@
+/*
+ * Copyright (c) Branko Premzel.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/*******************************************************************************
+ * @file    rtedbg.c
+ * @author  Branko Premzel
+ * @brief   Host (Linux) in-memory implementation of the RTEdbg write path.
+ *          See "rtedbg.h" for the description of the circular buffer format.
+ *
+ * @note    Space in the circular buffer is reserved with a compare-and-swap
+ *          loop on g_rtedbg.last_index. Any number of threads and signal
+ *          handlers (standing in for cores and ISRs) may log concurrently.
+ ******************************************************************************/
+
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "rtedbg.h"
+
+#define RTE_TSTAMP_MASK     ((1UL << RTE_TSTAMP_BITS) - 1U)
+
+rtedbg_t g_rtedbg;
+
+/**
+ * @brief Default timestamp source - CLOCK_MONOTONIC scaled to RTE_TIMESTAMP_FREQUENCY.
+ */
+
+static uint64_t rte_monotonic_timestamp(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    uint64_t ns = (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+    return ns / (1000000000ULL / RTE_TIMESTAMP_FREQUENCY);
+}
+
+static rte_timestamp_fn_t rte_timestamp_fn = rte_monotonic_timestamp;
+static uint32_t rte_timestamp_frequency = RTE_TIMESTAMP_FREQUENCY;
+static _Atomic uint64_t rte_timestamp_offset;     // See rte_host_timestamp_advance()
+static _Atomic uint64_t rte_last_long_timestamp;
+static atomic_uint rte_dropped;
+static _Atomic uint64_t rte_laps;               // See rte_host_words_written()
+static _Atomic uint64_t rte_skipped;
+
+
+static inline uint32_t rte_fmt_word(uint32_t fmt_id_field, uint64_t timestamp)
+{
+    return (fmt_id_field << (32U - RTE_FMT_ID_BITS))
+         | (((uint32_t)timestamp & RTE_TSTAMP_MASK) << 1U)
+         | 1U;
+}
+
+
+/**
+ * @brief Reserve space for a message in the circular buffer.
+ *
+ * @param words  Number of words (data + FMT word).
+ * @return Pointer to the reserved space or NULL if the message can't be logged.
+ */
+
+static uint32_t * rte_reserve(uint32_t words)
+{
+    uint32_t size = g_rtedbg.buffer_size;
+    uint32_t old_index = atomic_load_explicit((_Atomic uint32_t *)&g_rtedbg.last_index,
+                                              memory_order_relaxed);
+    uint32_t start;
+
+    do
+    {
+        start = old_index;
+
+        if ((start + words) > size)
+        {
+            if ((g_rtedbg.rte_cfg & RTE_CFG_SINGLE_SHOT) != 0U)
+            {
+                atomic_fetch_add_explicit(&rte_dropped, 1U, memory_order_relaxed);
+                return NULL;
+            }
+
+            start = 0U;
+        }
+    }
+    while (!atomic_compare_exchange_weak_explicit((_Atomic uint32_t *)&g_rtedbg.last_index,
+                                                  &old_index, start + words,
+                                                  memory_order_acq_rel, memory_order_relaxed));
+
+    if ((start == 0U) && (old_index != 0U))
+    {
+        /* The end of the buffer was skipped - the words there belong to the previous lap. */
+        atomic_fetch_add_explicit(&rte_laps, 1U, memory_order_relaxed);
+        atomic_fetch_add_explicit(&rte_skipped, size - old_index, memory_order_relaxed);
+
+        for (uint32_t i = old_index; i < size; i++)
+        {
+            g_rtedbg.buffer[i] = RTE_EMPTY_WORD;
+        }
+    }
+
+    return &g_rtedbg.buffer[start];
+}
+
+
+/**
+ * @brief Get the timestamp and log the long timestamp message first if the
+ *        short timestamp period has changed since the last message.
+ */
+
+static uint64_t rte_get_timestamp(void)
+{
+    uint64_t timestamp = rte_host_timestamp();
+    uint64_t long_part = timestamp >> RTE_TSTAMP_BITS;
+    uint64_t last = atomic_load_explicit(&rte_last_long_timestamp, memory_order_relaxed);
+
+    /* Only move forward - a message with an older timestamp from another thread
+     * (or an interrupted one) must not log the previous period again. */
+    if (((long_part > last) || (last == UINT64_MAX))
+        && atomic_compare_exchange_strong(&rte_last_long_timestamp, &last, long_part))
+    {
+        uint32_t * p = rte_reserve(2U);
+
+        if (p != NULL)
+        {
+            p[0] = (uint32_t)long_part << 1U;
+            p[1] = rte_fmt_word(RTE_LONG_TIMESTAMP_ID | ((uint32_t)long_part >> 31U), timestamp);
+        }
+    }
+
+    return timestamp;
+}
+
+
+/***
+ * Host specific functions.
+ */
+
+int rte_host_init(uint32_t buffer_words, uint32_t mode)
+{
+    free(g_rtedbg.buffer);
+    memset(&g_rtedbg, 0, sizeof(g_rtedbg));
+
+    g_rtedbg.buffer = malloc((size_t)buffer_words * sizeof(uint32_t));
+
+    if (g_rtedbg.buffer == NULL)
+    {
+        return -1;
+    }
+
+    memset(g_rtedbg.buffer, 0xFF, (size_t)buffer_words * sizeof(uint32_t));
+    g_rtedbg.buffer_size = buffer_words;
+    g_rtedbg.rte_cfg = RTE_FMT_ID_BITS | ((mode == RTE_MODE_SINGLE_SHOT) ? RTE_CFG_SINGLE_SHOT : 0U);
+
+    g_rtedbg.timestamp_frequency = rte_timestamp_frequency;
+    atomic_store(&rte_dropped, 0U);
+    atomic_store(&rte_laps, 0U);
+    atomic_store(&rte_skipped, 0U);
+    atomic_store(&rte_timestamp_offset, 0U);
+    atomic_store(&rte_last_long_timestamp, UINT64_MAX);
+    g_rtedbg.filter = 0xFFFFFFFFUL;
+    g_rtedbg.filter_copy = 0xFFFFFFFFUL;
+    return 0;
+}
+
+
+void rte_host_set_timestamp_source(rte_timestamp_fn_t fn, uint32_t frequency)
+{
+    rte_timestamp_fn = fn;
+    rte_timestamp_frequency = frequency;
+    g_rtedbg.timestamp_frequency = frequency;
+    atomic_store(&rte_timestamp_offset, 0U);
+    atomic_store(&rte_last_long_timestamp, UINT64_MAX);
+}
+
+
+uint64_t rte_host_timestamp(void)
+{
+    return rte_timestamp_fn() + atomic_load_explicit(&rte_timestamp_offset, memory_order_relaxed);
+}
+
+
+void rte_host_timestamp_advance(uint64_t counts)
+{
+    atomic_fetch_add(&rte_timestamp_offset, counts);
+}
+
+
+uint32_t rte_host_dropped(void)
+{
+    return atomic_load(&rte_dropped);
+}
+
+
+uint64_t rte_host_words_written(void)
+{
+    uint64_t laps = atomic_load_explicit(&rte_laps, memory_order_relaxed);
+    uint64_t skipped = atomic_load_explicit(&rte_skipped, memory_order_relaxed);
+    return (laps * g_rtedbg.buffer_size) + g_rtedbg.last_index - skipped;
+}
+
+
+int rte_host_dump(const char * file_name)
+{
+    FILE * out = fopen(file_name, "wb");
+
+    if (out == NULL)
+    {
+        return -1;
+    }
+
+    const uint32_t header[RTE_HEADER_WORDS] =
+    {
+        g_rtedbg.last_index, g_rtedbg.filter, g_rtedbg.rte_cfg,
+        g_rtedbg.timestamp_frequency, g_rtedbg.filter_copy, g_rtedbg.buffer_size
+    };
+
+    size_t written = fwrite(header, sizeof(uint32_t), RTE_HEADER_WORDS, out);
+    written += fwrite(g_rtedbg.buffer, sizeof(uint32_t), g_rtedbg.buffer_size, out);
+
+    if ((fclose(out) != 0) || (written != (RTE_HEADER_WORDS + g_rtedbg.buffer_size)))
+    {
+        return -1;
+    }
+
+    return 0;
+}
+
+
+void rte_host_exit(void)
+{
+    free(g_rtedbg.buffer);
+    memset(&g_rtedbg, 0, sizeof(g_rtedbg));
+}
+
+
+/***
+ * RTEdbg library interface.
+ */
+
+void rte_set_filter(uint32_t filter)
+{
+    if ((filter == 0U) && (g_rtedbg.filter != 0U))
+    {
+        g_rtedbg.filter_copy = g_rtedbg.filter;
+    }
+
+    g_rtedbg.filter = filter;
+}
+
+
+uint32_t rte_get_filter(void)
+{
+    return g_rtedbg.filter;
+}
+
+
+void __rte_msg0(uint32_t fmt_id)
+{
+    uint64_t timestamp = rte_get_timestamp();
+    uint32_t * p = rte_reserve(1U);
+
+    if (p != NULL)
+    {
+        p[0] = rte_fmt_word(fmt_id, timestamp);
+    }
+}
+
+
+void __rte_msg1(uint32_t fmt_id, uint32_t data1)
+{
+    uint64_t timestamp = rte_get_timestamp();
+    uint32_t * p = rte_reserve(2U);
+
+    if (p != NULL)
+    {
+        p[0] = data1 << 1U;
+        p[1] = rte_fmt_word(fmt_id | (data1 >> 31U), timestamp);
+    }
+}
+
+
+void __rte_msg2(uint32_t fmt_id, uint32_t data1, uint32_t data2)
+{
+    uint64_t timestamp = rte_get_timestamp();
+    uint32_t * p = rte_reserve(3U);
+
+    if (p != NULL)
+    {
+        p[0] = data1 << 1U;
+        p[1] = data2 << 1U;
+        p[2] = rte_fmt_word(fmt_id | (data1 >> 31U) | ((data2 >> 31U) << 1U), timestamp);
+    }
+}
+
+
+void __rte_msg3(uint32_t fmt_id, uint32_t data1, uint32_t data2, uint32_t data3)
+{
+    uint64_t timestamp = rte_get_timestamp();
+    uint32_t * p = rte_reserve(4U);
+
+    if (p != NULL)
+    {
+        p[0] = data1 << 1U;
+        p[1] = data2 << 1U;
+        p[2] = data3 << 1U;
+        p[3] = rte_fmt_word(fmt_id | (data1 >> 31U) | ((data2 >> 31U) << 1U)
+                           | ((data3 >> 31U) << 2U), timestamp);
+    }
+}
+
+
+void __rte_msg4(uint32_t fmt_id, uint32_t data1, uint32_t data2, uint32_t data3, uint32_t data4)
+{
+    uint64_t timestamp = rte_get_timestamp();
+    uint32_t * p = rte_reserve(5U);
+
+    if (p != NULL)
+    {
+        p[0] = data1 << 1U;
+        p[1] = data2 << 1U;
+        p[2] = data3 << 1U;
+        p[3] = data4 << 1U;
+        p[4] = rte_fmt_word(fmt_id | (data1 >> 31U) | ((data2 >> 31U) << 1U)
+                           | ((data3 >> 31U) << 2U) | ((data4 >> 31U) << 3U), timestamp);
+    }
+}
+
+
+void __rte_msgx(uint32_t fmt_id, const uint32_t * p_data, uint32_t words)
+{
+    uint64_t timestamp = rte_get_timestamp();
+    uint32_t * p = rte_reserve(words + 2U);
+
+    if (p != NULL)
+    {
+        uint32_t top_bits = 0U;
+
+        for (uint32_t i = 0U; i < words; i++)
+        {
+            p[i] = p_data[i] << 1U;
+            top_bits |= (p_data[i] >> 31U) << i;
+        }
+
+        p[words] = top_bits << 1U;
+        p[words + 1U] = rte_fmt_word(fmt_id, timestamp);
+    }
+}
+
+/*==== End of file ====*/
@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) Branko Premzel.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/*******************************************************************************
+ * @file    rtedbg.h
+ * @author  Branko Premzel
+ * @brief   Host (Linux) in-memory implementation of the RTEdbg logging API
+ *          used by the FreeRTOS trace macros.
+ *
+ * @note    This is not the RTEdbg library. It implements just enough of the
+ *          library interface (RTE_MSGx macros, message filter, circular
+ *          buffer) to compile and exercise the FreeRTOS trace macros on a
+ *          Linux host. The message IDs and filter numbers are generated by
+ *          Scripts/rte_fmt_ids.py from the format definition files.
+ *
+ * Circular buffer word layout:
+ *  - Every message is written as N data words followed by one FMT word.
+ *  - Data word: (data << 1) - bit 0 is always 0.
+ *  - FMT word:  (fmt_id_field << (32 - RTE_FMT_ID_BITS)) | (timestamp << 1) | 1
+ *    The timestamp field holds the lowest RTE_TSTAMP_BITS bits of the timestamp.
+ *  - MSG1..MSG4: bit k of fmt_id_field is the top bit of data word k.
+ *  - MSG5..MSG8: the top bits of all data words are stored in an additional
+ *    data word (bit k = top bit of data word k) placed just before the FMT word.
+ *  - EXT_MSGx_y: the y extra bits are stored in the fmt_id_field bits x..x+y-1.
+ *  - The long timestamp message (format ID 0, one data word) contains the
+ *    timestamp bits above RTE_TSTAMP_BITS. It is logged before the first message
+ *    whose timestamp no longer fits into the short timestamp period. A decoder
+ *    unwraps every short timestamp to the value nearest to the previous one.
+ *  - Words that do not contain data are set to RTE_EMPTY_WORD.
+ ******************************************************************************/
+
+#ifndef RTEDBG_H
+#define RTEDBG_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stdint.h>
+#include "rte_fmt_ids.h"        // Generated format IDs and filter numbers
+
+#ifndef RTE_FMT_ID_BITS
+#define RTE_FMT_ID_BITS         12U
+#endif
+#define RTE_TSTAMP_BITS         (31U - RTE_FMT_ID_BITS)
+#define RTE_LONG_TIMESTAMP_ID   0U
+#define RTE_EMPTY_WORD          0xFFFFFFFFUL
+
+#ifndef RTE_TIMESTAMP_FREQUENCY
+#define RTE_TIMESTAMP_FREQUENCY 1000000UL   // Default host timestamp frequency [Hz]
+#endif
+
+/* Logging modes - see rte_host_init() */
+#define RTE_MODE_CIRCULAR       0U      // Oldest data is overwritten
+#define RTE_MODE_SINGLE_SHOT    1U      // Logging stops when the buffer is full
+
+/* rtedbg_t.rte_cfg: bits 0-7 RTE_FMT_ID_BITS, flags below */
+#define RTE_CFG_SINGLE_SHOT     (1UL << 8)
+
+
+/* Header of the data logging structure. The binary capture file written by
+ * rte_host_dump() contains these six words followed by the buffer contents. */
+typedef struct
+{
+    volatile uint32_t last_index;       // Index of the next free word in the circular buffer
+    volatile uint32_t filter;           // Message filter (bit n enables filter n), 0 - logging disabled
+    uint32_t rte_cfg;                   // Configuration - see RTE_CFG_xxx
+    uint32_t timestamp_frequency;       // Timestamp frequency [Hz]
+    uint32_t filter_copy;               // Filter value saved by rte_set_filter(0)
+    uint32_t buffer_size;               // Size of the circular buffer [32-bit words]
+    uint32_t * buffer;                  // Circular buffer (not part of the capture header)
+} rtedbg_t;
+
+#define RTE_HEADER_WORDS        6U
+
+extern rtedbg_t g_rtedbg;
+
+/* Timestamp source - returns a free running 64-bit counter */
+typedef uint64_t (*rte_timestamp_fn_t)(void);
+
+
+/***
+ * Host specific functions.
+ */
+
+/**
+ * @brief Allocate the circular buffer and enable logging for all filters.
+ * @param buffer_words  Circular buffer size [32-bit words].
+ * @param mode          RTE_MODE_CIRCULAR or RTE_MODE_SINGLE_SHOT.
+ * @return 0 - OK, -1 - out of memory.
+ */
+int rte_host_init(uint32_t buffer_words, uint32_t mode);
+
+/**
+ * @brief Set the timestamp source. The default source is CLOCK_MONOTONIC
+ *        with RTE_TIMESTAMP_FREQUENCY resolution.
+ */
+void rte_host_set_timestamp_source(rte_timestamp_fn_t fn, uint32_t frequency);
+
+/** @brief Return the current timestamp (timestamp source units). */
+uint64_t rte_host_timestamp(void);
+
+/**
+ * @brief Add counts to all following timestamps - the host version of the
+ *        long timestamp correction after a sleep with the timestamp counter
+ *        stopped. The offset is cleared by rte_host_init() and
+ *        rte_host_set_timestamp_source().
+ */
+void rte_host_timestamp_advance(uint64_t counts);
+
+/** @brief Number of messages not logged because the buffer was full (single shot mode). */
+uint32_t rte_host_dropped(void);
+
+/**
+ * @brief Number of words written since rte_host_init(), including the words
+ *        overwritten in circular mode - the trace data rate. The skipped
+ *        words at the end of the buffer are not counted.
+ */
+uint64_t rte_host_words_written(void);
+
+/**
+ * @brief Write the header and the circular buffer contents to a binary file.
+ * @return 0 - OK, -1 - file error.
+ */
+int rte_host_dump(const char * file_name);
+
+/** @brief Release the circular buffer. */
+void rte_host_exit(void);
+
+
+/***
+ * RTEdbg library interface.
+ */
+
+void rte_set_filter(uint32_t filter);
+uint32_t rte_get_filter(void);
+
+void __rte_msg0(uint32_t fmt_id);
+void __rte_msg1(uint32_t fmt_id, uint32_t data1);
+void __rte_msg2(uint32_t fmt_id, uint32_t data1, uint32_t data2);
+void __rte_msg3(uint32_t fmt_id, uint32_t data1, uint32_t data2, uint32_t data3);
+void __rte_msg4(uint32_t fmt_id, uint32_t data1, uint32_t data2, uint32_t data3, uint32_t data4);
+void __rte_msgx(uint32_t fmt_id, const uint32_t * p_data, uint32_t words);
+
+#define RTE_FILTER_ENABLED(filter_no)  ((g_rtedbg.filter & (1UL << (filter_no))) != 0U)
+
+#define RTE_MSG0(fmt_id, filter) \
+    do { if (RTE_FILTER_ENABLED(filter)) { __rte_msg0((fmt_id)); } } while (0)
+
+#define RTE_MSG1(fmt_id, filter, d1) \
+    do { if (RTE_FILTER_ENABLED(filter)) { __rte_msg1((fmt_id), (uint32_t)(d1)); } } while (0)
+
+#define RTE_MSG2(fmt_id, filter, d1, d2) \
+    do { if (RTE_FILTER_ENABLED(filter)) { \
+        __rte_msg2((fmt_id), (uint32_t)(d1), (uint32_t)(d2)); } } while (0)
+
+#define RTE_MSG3(fmt_id, filter, d1, d2, d3) \
+    do { if (RTE_FILTER_ENABLED(filter)) { \
+        __rte_msg3((fmt_id), (uint32_t)(d1), (uint32_t)(d2), (uint32_t)(d3)); } } while (0)
+
+#define RTE_MSG4(fmt_id, filter, d1, d2, d3, d4) \
+    do { if (RTE_FILTER_ENABLED(filter)) { \
+        __rte_msg4((fmt_id), (uint32_t)(d1), (uint32_t)(d2), (uint32_t)(d3), (uint32_t)(d4)); } } while (0)
+
+#define RTE_MSG5(fmt_id, filter, d1, d2, d3, d4, d5) \
+    do { if (RTE_FILTER_ENABLED(filter)) { \
+        const uint32_t rte_data_[5] = { (uint32_t)(d1), (uint32_t)(d2), (uint32_t)(d3), \
+                                        (uint32_t)(d4), (uint32_t)(d5) }; \
+        __rte_msgx((fmt_id), rte_data_, 5U); } } while (0)
+
+#define RTE_MSG6(fmt_id, filter, d1, d2, d3, d4, d5, d6) \
+    do { if (RTE_FILTER_ENABLED(filter)) { \
+        const uint32_t rte_data_[6] = { (uint32_t)(d1), (uint32_t)(d2), (uint32_t)(d3), \
+                                        (uint32_t)(d4), (uint32_t)(d5), (uint32_t)(d6) }; \
+        __rte_msgx((fmt_id), rte_data_, 6U); } } while (0)
+
+#define RTE_MSG7(fmt_id, filter, d1, d2, d3, d4, d5, d6, d7) \
+    do { if (RTE_FILTER_ENABLED(filter)) { \
+        const uint32_t rte_data_[7] = { (uint32_t)(d1), (uint32_t)(d2), (uint32_t)(d3), \
+                                        (uint32_t)(d4), (uint32_t)(d5), (uint32_t)(d6), \
+                                        (uint32_t)(d7) }; \
+        __rte_msgx((fmt_id), rte_data_, 7U); } } while (0)
+
+#define RTE_MSG8(fmt_id, filter, d1, d2, d3, d4, d5, d6, d7, d8) \
+    do { if (RTE_FILTER_ENABLED(filter)) { \
+        const uint32_t rte_data_[8] = { (uint32_t)(d1), (uint32_t)(d2), (uint32_t)(d3), \
+                                        (uint32_t)(d4), (uint32_t)(d5), (uint32_t)(d6), \
+                                        (uint32_t)(d7), (uint32_t)(d8) }; \
+        __rte_msgx((fmt_id), rte_data_, 8U); } } while (0)
+
+/* Extended message - 'ext' (1 bit) is stored in the unused format ID bit. */
+#define RTE_EXT_MSG3_1(fmt_id, filter, d1, d2, d3, ext) \
+    do { if (RTE_FILTER_ENABLED(filter)) { \
+        __rte_msg3((fmt_id) | (((uint32_t)(ext) & 1U) << 3U), \
+                   (uint32_t)(d1), (uint32_t)(d2), (uint32_t)(d3)); } } while (0)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // RTEDBG_H
+
+/*==== End of file ====*/
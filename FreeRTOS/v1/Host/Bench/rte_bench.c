@@ -0,0 +1,616 @@
+/*
+ * Copyright (c) Branko Premzel.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/*******************************************************************************
+ * @file    rte_bench.c
+ * @author  Branko Premzel
+ * @brief   Per-macro micro-benchmark of the FreeRTOS trace macros.
+ *
+ * Every trace macro from "rte_FreeRTOS_trace.h" is expanded in its own
+ * function, with the kernel variables the macro uses declared as file scope
+ * variables of the same names. Each function is placed in its own section -
+ * the section size (__start_/__stop_ linker symbols) is the code size of the
+ * macro expansion. The size and time of an empty function are subtracted.
+ *
+ * Timing: warmup calls, then a number of repetitions of a tight loop of calls.
+ * The time per call of every repetition is recorded and the median, 99th
+ * percentile and minimum over the repetitions are reported. The messages are
+ * written to a circular buffer (the host RTEdbg write path). The timestamp
+ * source is a stub counter by default, so that the results do not include
+ * the host clock read time.
+ *
+ * The configuration is selected at compile time - see the rte_bench_xxx
+ * targets in CMakeLists.txt:
+ *  - configQUEUE_REGISTRY_SIZE == 0: queues are logged by address, otherwise
+ *    by name from the queue registry. The registry is filled and the traced
+ *    queue is the last entry (worst case search time).
+ *  - RTE_BENCH_LTO == 1: built with link time optimization - the helper
+ *    functions (task/queue name, RTEdbg message functions) can be inlined
+ *    into the macro expansion. The code size then includes the inlined code.
+ *
+ * Exit code: 0 - OK, 2 - usage or setup error.
+ ******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "rte_sim.h"
+
+#ifndef RTE_BENCH_LTO
+#define RTE_BENCH_LTO       0
+#endif
+
+#ifndef RTE_BENCH_VARIANT
+#define RTE_BENCH_VARIANT   "default"
+#endif
+
+#define MAX_REPETITIONS     10000U
+
+typedef void (*bench_fn_t)(void);
+
+typedef struct
+{
+    const char * name;          // Trace macro name
+    const char * group;         // Trace group (RTE_TRACE_RTOS_xxx)
+    bench_fn_t fn;
+    const uint8_t * start;      // Code of the function (section limits)
+    const uint8_t * stop;
+} bench_t;
+
+typedef struct
+{
+    double median;              // [ns/call]
+    double p99;
+    double min;
+} bench_time_t;
+
+static struct
+{
+    uint32_t repetitions;
+    uint32_t calls;             // Calls per repetition
+    uint32_t warmup;            // Calls before the first repetition
+    uint32_t buffer_words;
+    uint32_t filter;
+    int host_clock;             // 1 - timestamps from the host clock
+    const char * report_file;
+} cfg =
+{
+    .repetitions = 101U,
+    .calls = 2000U,
+    .warmup = 20000U,
+    .buffer_words = 16384U,
+    .filter = 0xFFFFFFFFU,
+    .host_clock = 0,
+    .report_file = NULL,
+};
+
+static double rep_time[MAX_REPETITIONS];
+
+
+/***
+ * Kernel variables used by the trace macros. The names are the same as in the
+ * FreeRTOS kernel functions that call the macros.
+ */
+
+static TaskHandle_t task;
+static QueueHandle_t queue;
+static TimerHandle_t timer;
+
+static TaskHandle_t xTaskToNotify;
+static BaseType_t xCopyPosition;
+static uint8_t ucQueueType;
+static QueueHandle_t xHandle;
+static UBaseType_t uxMaxCount;
+static UBaseType_t uxInitialCount;
+static TickType_t xTicksToWait;
+static TickType_t xTicksToDelay;
+static TickType_t xTimerPeriodInTicks;
+static BaseType_t xClearCountOnExit;
+static uint32_t ulBitsToClearOnEntry;
+static uint32_t ulBitsToClearOnExit;
+static eNotifyAction eAction;
+static uint32_t ulValue;
+static UBaseType_t uxIndex;
+static uint32_t ulBits;
+static uint32_t ulSize;
+static void * pvObject;
+static const char * pcName;
+
+
+/***
+ * Benchmarked functions - one per trace macro.
+ */
+
+#define BENCH_FN(name, call) \
+    extern const uint8_t __start_rte_bench_##name[]; \
+    extern const uint8_t __stop_rte_bench_##name[]; \
+    static void __attribute__((noinline, used, section("rte_bench_" #name))) bench_##name(void) \
+    { \
+        call; \
+    }
+
+#define BENCH(name, group)  { #name, group, bench_##name, __start_rte_bench_##name, __stop_rte_bench_##name }
+
+BENCH_FN(empty, (void)0)
+
+BENCH_FN(traceTASK_SWITCHED_IN, traceTASK_SWITCHED_IN())
+BENCH_FN(traceTASK_SWITCHED_OUT, traceTASK_SWITCHED_OUT())
+BENCH_FN(traceSTARTING_SCHEDULER, traceSTARTING_SCHEDULER(NULL))
+BENCH_FN(traceINCREASE_TICK_COUNT, traceINCREASE_TICK_COUNT(xTicksToDelay))
+BENCH_FN(traceLOW_POWER_IDLE_BEGIN, traceLOW_POWER_IDLE_BEGIN())
+BENCH_FN(traceLOW_POWER_IDLE_END, traceLOW_POWER_IDLE_END())
+BENCH_FN(traceTASK_PRIORITY_INHERIT, traceTASK_PRIORITY_INHERIT(task, uxIndex))
+BENCH_FN(traceTASK_PRIORITY_DISINHERIT, traceTASK_PRIORITY_DISINHERIT(task, uxIndex))
+BENCH_FN(traceBLOCKING_ON_QUEUE_RECEIVE, traceBLOCKING_ON_QUEUE_RECEIVE(queue))
+BENCH_FN(traceBLOCKING_ON_QUEUE_PEEK, traceBLOCKING_ON_QUEUE_PEEK(queue))
+BENCH_FN(traceBLOCKING_ON_QUEUE_SEND, traceBLOCKING_ON_QUEUE_SEND(queue))
+BENCH_FN(traceMOVED_TASK_TO_READY_STATE, traceMOVED_TASK_TO_READY_STATE(task))
+BENCH_FN(tracePOST_MOVED_TASK_TO_READY_STATE, tracePOST_MOVED_TASK_TO_READY_STATE(task))
+BENCH_FN(traceMOVED_TASK_TO_DELAYED_LIST, traceMOVED_TASK_TO_DELAYED_LIST())
+BENCH_FN(traceMOVED_TASK_TO_OVERFLOW_DELAYED_LIST, traceMOVED_TASK_TO_OVERFLOW_DELAYED_LIST())
+BENCH_FN(traceQUEUE_REGISTRY_ADD, traceQUEUE_REGISTRY_ADD(queue, pcName))
+BENCH_FN(traceQUEUE_CREATE, traceQUEUE_CREATE(queue))
+BENCH_FN(traceQUEUE_CREATE_FAILED, traceQUEUE_CREATE_FAILED(ucQueueType))
+BENCH_FN(traceCREATE_MUTEX, traceCREATE_MUTEX(queue))
+BENCH_FN(traceCREATE_MUTEX_FAILED, traceCREATE_MUTEX_FAILED())
+BENCH_FN(traceGIVE_MUTEX_RECURSIVE, traceGIVE_MUTEX_RECURSIVE(queue))
+BENCH_FN(traceGIVE_MUTEX_RECURSIVE_FAILED, traceGIVE_MUTEX_RECURSIVE_FAILED(queue))
+BENCH_FN(traceTAKE_MUTEX_RECURSIVE, traceTAKE_MUTEX_RECURSIVE(queue))
+BENCH_FN(traceTAKE_MUTEX_RECURSIVE_FAILED, traceTAKE_MUTEX_RECURSIVE_FAILED(queue))
+BENCH_FN(traceCREATE_COUNTING_SEMAPHORE, traceCREATE_COUNTING_SEMAPHORE())
+BENCH_FN(traceCREATE_COUNTING_SEMAPHORE_FAILED, traceCREATE_COUNTING_SEMAPHORE_FAILED())
+BENCH_FN(traceQUEUE_SEND, traceQUEUE_SEND(queue))
+BENCH_FN(traceQUEUE_SEND_FAILED, traceQUEUE_SEND_FAILED(queue))
+BENCH_FN(traceQUEUE_RECEIVE, traceQUEUE_RECEIVE(queue))
+BENCH_FN(traceQUEUE_PEEK, traceQUEUE_PEEK(queue))
+BENCH_FN(traceQUEUE_PEEK_FAILED, traceQUEUE_PEEK_FAILED(queue))
+BENCH_FN(traceQUEUE_PEEK_FROM_ISR, traceQUEUE_PEEK_FROM_ISR(queue))
+BENCH_FN(traceQUEUE_RECEIVE_FAILED, traceQUEUE_RECEIVE_FAILED(queue))
+BENCH_FN(traceQUEUE_SEND_FROM_ISR, traceQUEUE_SEND_FROM_ISR(queue))
+BENCH_FN(traceQUEUE_SEND_FROM_ISR_FAILED, traceQUEUE_SEND_FROM_ISR_FAILED(queue))
+BENCH_FN(traceQUEUE_RECEIVE_FROM_ISR, traceQUEUE_RECEIVE_FROM_ISR(queue))
+BENCH_FN(traceQUEUE_RECEIVE_FROM_ISR_FAILED, traceQUEUE_RECEIVE_FROM_ISR_FAILED(queue))
+BENCH_FN(traceQUEUE_DELETE, traceQUEUE_DELETE(queue))
+BENCH_FN(traceQUEUE_PEEK_FROM_ISR_FAILED, traceQUEUE_PEEK_FROM_ISR_FAILED(queue))
+BENCH_FN(traceTASK_CREATE, traceTASK_CREATE(task))
+BENCH_FN(traceTASK_CREATE_FAILED, traceTASK_CREATE_FAILED())
+BENCH_FN(traceTASK_DELETE, traceTASK_DELETE(task))
+BENCH_FN(traceTASK_DELAY_UNTIL, traceTASK_DELAY_UNTIL(xTicksToDelay))
+BENCH_FN(traceTASK_DELAY, traceTASK_DELAY())
+BENCH_FN(traceTASK_PRIORITY_SET, traceTASK_PRIORITY_SET(task, uxIndex))
+BENCH_FN(traceTASK_SUSPEND, traceTASK_SUSPEND(task))
+BENCH_FN(traceTASK_RESUME, traceTASK_RESUME(task))
+BENCH_FN(traceTASK_RESUME_FROM_ISR, traceTASK_RESUME_FROM_ISR(task))
+BENCH_FN(traceTASK_INCREMENT_TICK, traceTASK_INCREMENT_TICK(xTicksToDelay))
+BENCH_FN(traceTIMER_CREATE, traceTIMER_CREATE(timer))
+BENCH_FN(traceTIMER_CREATE_FAILED, traceTIMER_CREATE_FAILED())
+BENCH_FN(traceTIMER_COMMAND_SEND, traceTIMER_COMMAND_SEND(timer, uxIndex, xTicksToWait, pdPASS))
+BENCH_FN(traceTIMER_EXPIRED, traceTIMER_EXPIRED(timer))
+BENCH_FN(traceTIMER_COMMAND_RECEIVED, traceTIMER_COMMAND_RECEIVED(timer, uxIndex, xTicksToWait))
+BENCH_FN(traceMALLOC, traceMALLOC(pvObject, ulSize))
+BENCH_FN(traceFREE, traceFREE(pvObject, ulSize))
+BENCH_FN(traceEVENT_GROUP_CREATE, traceEVENT_GROUP_CREATE(pvObject))
+BENCH_FN(traceEVENT_GROUP_CREATE_FAILED, traceEVENT_GROUP_CREATE_FAILED())
+BENCH_FN(traceEVENT_GROUP_SYNC_BLOCK, traceEVENT_GROUP_SYNC_BLOCK(pvObject, ulBits, ulBits))
+BENCH_FN(traceEVENT_GROUP_SYNC_END, traceEVENT_GROUP_SYNC_END(pvObject, ulBits, ulBits, pdFALSE))
+BENCH_FN(traceEVENT_GROUP_WAIT_BITS_BLOCK, traceEVENT_GROUP_WAIT_BITS_BLOCK(pvObject, ulBits))
+BENCH_FN(traceEVENT_GROUP_WAIT_BITS_END, traceEVENT_GROUP_WAIT_BITS_END(pvObject, ulBits, pdFALSE))
+BENCH_FN(traceEVENT_GROUP_CLEAR_BITS, traceEVENT_GROUP_CLEAR_BITS(pvObject, ulBits))
+BENCH_FN(traceEVENT_GROUP_CLEAR_BITS_FROM_ISR, traceEVENT_GROUP_CLEAR_BITS_FROM_ISR(pvObject, ulBits))
+BENCH_FN(traceEVENT_GROUP_SET_BITS, traceEVENT_GROUP_SET_BITS(pvObject, ulBits))
+BENCH_FN(traceEVENT_GROUP_SET_BITS_FROM_ISR, traceEVENT_GROUP_SET_BITS_FROM_ISR(pvObject, ulBits))
+BENCH_FN(traceEVENT_GROUP_DELETE, traceEVENT_GROUP_DELETE(pvObject))
+BENCH_FN(tracePEND_FUNC_CALL, tracePEND_FUNC_CALL(pvObject, pvObject, ulValue, pdPASS))
+BENCH_FN(tracePEND_FUNC_CALL_FROM_ISR, tracePEND_FUNC_CALL_FROM_ISR(pvObject, pvObject, ulValue, pdPASS))
+#if RTE_FREERTOS_VERSION >= 100400
+BENCH_FN(traceTASK_NOTIFY_TAKE_BLOCK, traceTASK_NOTIFY_TAKE_BLOCK(uxIndex))
+BENCH_FN(traceTASK_NOTIFY_TAKE, traceTASK_NOTIFY_TAKE(uxIndex))
+BENCH_FN(traceTASK_NOTIFY_WAIT_BLOCK, traceTASK_NOTIFY_WAIT_BLOCK(uxIndex))
+BENCH_FN(traceTASK_NOTIFY_WAIT, traceTASK_NOTIFY_WAIT(uxIndex))
+BENCH_FN(traceTASK_NOTIFY, traceTASK_NOTIFY(uxIndex))
+BENCH_FN(traceTASK_NOTIFY_FROM_ISR, traceTASK_NOTIFY_FROM_ISR(uxIndex))
+BENCH_FN(traceTASK_NOTIFY_GIVE_FROM_ISR, traceTASK_NOTIFY_GIVE_FROM_ISR(uxIndex))
+#else
+BENCH_FN(traceTASK_NOTIFY_TAKE_BLOCK, traceTASK_NOTIFY_TAKE_BLOCK())
+BENCH_FN(traceTASK_NOTIFY_TAKE, traceTASK_NOTIFY_TAKE())
+BENCH_FN(traceTASK_NOTIFY_WAIT_BLOCK, traceTASK_NOTIFY_WAIT_BLOCK())
+BENCH_FN(traceTASK_NOTIFY_WAIT, traceTASK_NOTIFY_WAIT())
+BENCH_FN(traceTASK_NOTIFY, traceTASK_NOTIFY())
+BENCH_FN(traceTASK_NOTIFY_FROM_ISR, traceTASK_NOTIFY_FROM_ISR())
+BENCH_FN(traceTASK_NOTIFY_GIVE_FROM_ISR, traceTASK_NOTIFY_GIVE_FROM_ISR())
+#endif  // RTE_FREERTOS_VERSION >= 100400
+BENCH_FN(traceISR_ENTER, traceISR_ENTER())
+BENCH_FN(traceISR_EXIT, traceISR_EXIT())
+BENCH_FN(traceISR_EXIT_TO_SCHEDULER, traceISR_EXIT_TO_SCHEDULER())
+BENCH_FN(traceSTREAM_BUFFER_CREATE_FAILED, traceSTREAM_BUFFER_CREATE_FAILED(ulValue))
+BENCH_FN(traceSTREAM_BUFFER_CREATE_STATIC_FAILED, traceSTREAM_BUFFER_CREATE_STATIC_FAILED(NULL, ulValue))
+BENCH_FN(traceSTREAM_BUFFER_CREATE, traceSTREAM_BUFFER_CREATE(pvObject, ulValue))
+BENCH_FN(traceSTREAM_BUFFER_DELETE, traceSTREAM_BUFFER_DELETE(pvObject))
+BENCH_FN(traceSTREAM_BUFFER_RESET, traceSTREAM_BUFFER_RESET(pvObject))
+BENCH_FN(traceSTREAM_BUFFER_RESET_FROM_ISR, traceSTREAM_BUFFER_RESET_FROM_ISR(pvObject))
+BENCH_FN(traceBLOCKING_ON_STREAM_BUFFER_SEND, traceBLOCKING_ON_STREAM_BUFFER_SEND(pvObject))
+BENCH_FN(traceSTREAM_BUFFER_SEND, traceSTREAM_BUFFER_SEND(pvObject, ulSize))
+BENCH_FN(traceSTREAM_BUFFER_SEND_FAILED, traceSTREAM_BUFFER_SEND_FAILED(pvObject))
+BENCH_FN(traceSTREAM_BUFFER_SEND_FROM_ISR, traceSTREAM_BUFFER_SEND_FROM_ISR(pvObject, ulSize))
+BENCH_FN(traceBLOCKING_ON_STREAM_BUFFER_RECEIVE, traceBLOCKING_ON_STREAM_BUFFER_RECEIVE(pvObject))
+BENCH_FN(traceSTREAM_BUFFER_RECEIVE, traceSTREAM_BUFFER_RECEIVE(pvObject, ulSize))
+BENCH_FN(traceSTREAM_BUFFER_RECEIVE_FAILED, traceSTREAM_BUFFER_RECEIVE_FAILED(pvObject))
+BENCH_FN(traceSTREAM_BUFFER_RECEIVE_FROM_ISR, traceSTREAM_BUFFER_RECEIVE_FROM_ISR(pvObject, ulSize))
+
+static const bench_t baseline = BENCH(empty, "");
+
+static const bench_t benches[] =
+{
+    BENCH(traceTASK_SWITCHED_IN, "BASIC"),
+    BENCH(traceTASK_SWITCHED_OUT, "EXPERT"),
+    BENCH(traceSTARTING_SCHEDULER, "EXPERT"),
+    BENCH(traceINCREASE_TICK_COUNT, "TASKS"),
+    BENCH(traceLOW_POWER_IDLE_BEGIN, "TASKS"),
+    BENCH(traceLOW_POWER_IDLE_END, "TASKS"),
+    BENCH(traceTASK_PRIORITY_INHERIT, "TASKS"),
+    BENCH(traceTASK_PRIORITY_DISINHERIT, "TASKS"),
+    BENCH(traceBLOCKING_ON_QUEUE_RECEIVE, "TASKS"),
+    BENCH(traceBLOCKING_ON_QUEUE_PEEK, "TASKS"),
+    BENCH(traceBLOCKING_ON_QUEUE_SEND, "TASKS"),
+    BENCH(traceMOVED_TASK_TO_READY_STATE, "EXPERT"),
+    BENCH(tracePOST_MOVED_TASK_TO_READY_STATE, "EXPERT"),
+    BENCH(traceMOVED_TASK_TO_DELAYED_LIST, "EXPERT"),
+    BENCH(traceMOVED_TASK_TO_OVERFLOW_DELAYED_LIST, "EXPERT"),
+    BENCH(traceQUEUE_REGISTRY_ADD, "EXPERT"),
+    BENCH(traceQUEUE_CREATE, "QUEUE"),
+    BENCH(traceQUEUE_CREATE_FAILED, "QUEUE"),
+    BENCH(traceCREATE_MUTEX, "QUEUE"),
+    BENCH(traceCREATE_MUTEX_FAILED, "QUEUE"),
+    BENCH(traceGIVE_MUTEX_RECURSIVE, "QUEUE"),
+    BENCH(traceGIVE_MUTEX_RECURSIVE_FAILED, "QUEUE"),
+    BENCH(traceTAKE_MUTEX_RECURSIVE, "QUEUE"),
+    BENCH(traceTAKE_MUTEX_RECURSIVE_FAILED, "QUEUE"),
+    BENCH(traceCREATE_COUNTING_SEMAPHORE, "QUEUE"),
+    BENCH(traceCREATE_COUNTING_SEMAPHORE_FAILED, "QUEUE"),
+    BENCH(traceQUEUE_SEND, "BASIC"),
+    BENCH(traceQUEUE_SEND_FAILED, "BASIC"),
+    BENCH(traceQUEUE_RECEIVE, "BASIC"),
+    BENCH(traceQUEUE_PEEK, "BASIC"),
+    BENCH(traceQUEUE_PEEK_FAILED, "BASIC"),
+    BENCH(traceQUEUE_PEEK_FROM_ISR, "BASIC"),
+    BENCH(traceQUEUE_RECEIVE_FAILED, "BASIC"),
+    BENCH(traceQUEUE_SEND_FROM_ISR, "BASIC"),
+    BENCH(traceQUEUE_SEND_FROM_ISR_FAILED, "BASIC"),
+    BENCH(traceQUEUE_RECEIVE_FROM_ISR, "BASIC"),
+    BENCH(traceQUEUE_RECEIVE_FROM_ISR_FAILED, "BASIC"),
+    BENCH(traceQUEUE_DELETE, "BASIC"),
+    BENCH(traceQUEUE_PEEK_FROM_ISR_FAILED, "BASIC"),
+    BENCH(traceTASK_CREATE, "TASKS"),
+    BENCH(traceTASK_CREATE_FAILED, "TASKS"),
+    BENCH(traceTASK_DELETE, "TASKS"),
+    BENCH(traceTASK_DELAY_UNTIL, "BASIC"),
+    BENCH(traceTASK_DELAY, "BASIC"),
+    BENCH(traceTASK_PRIORITY_SET, "BASIC"),
+    BENCH(traceTASK_SUSPEND, "BASIC"),
+    BENCH(traceTASK_RESUME, "BASIC"),
+    BENCH(traceTASK_RESUME_FROM_ISR, "BASIC"),
+    BENCH(traceTASK_INCREMENT_TICK, "TASKS"),
+    BENCH(traceTIMER_CREATE, "TIMER"),
+    BENCH(traceTIMER_CREATE_FAILED, "TIMER"),
+    BENCH(traceTIMER_COMMAND_SEND, "TIMER"),
+    BENCH(traceTIMER_EXPIRED, "TIMER"),
+    BENCH(traceTIMER_COMMAND_RECEIVED, "TIMER"),
+    BENCH(traceMALLOC, "MALLOC"),
+    BENCH(traceFREE, "MALLOC"),
+    BENCH(traceEVENT_GROUP_CREATE, "TASKS"),
+    BENCH(traceEVENT_GROUP_CREATE_FAILED, "TASKS"),
+    BENCH(traceEVENT_GROUP_SYNC_BLOCK, "TASKS"),
+    BENCH(traceEVENT_GROUP_SYNC_END, "TASKS"),
+    BENCH(traceEVENT_GROUP_WAIT_BITS_BLOCK, "TASKS"),
+    BENCH(traceEVENT_GROUP_WAIT_BITS_END, "TASKS"),
+    BENCH(traceEVENT_GROUP_CLEAR_BITS, "TASKS"),
+    BENCH(traceEVENT_GROUP_CLEAR_BITS_FROM_ISR, "TASKS"),
+    BENCH(traceEVENT_GROUP_SET_BITS, "TASKS"),
+    BENCH(traceEVENT_GROUP_SET_BITS_FROM_ISR, "TASKS"),
+    BENCH(traceEVENT_GROUP_DELETE, "TASKS"),
+    BENCH(tracePEND_FUNC_CALL, "TIMER"),
+    BENCH(tracePEND_FUNC_CALL_FROM_ISR, "TIMER"),
+    BENCH(traceTASK_NOTIFY_TAKE_BLOCK, "BASIC"),
+    BENCH(traceTASK_NOTIFY_TAKE, "BASIC"),
+    BENCH(traceTASK_NOTIFY_WAIT_BLOCK, "BASIC"),
+    BENCH(traceTASK_NOTIFY_WAIT, "BASIC"),
+    BENCH(traceTASK_NOTIFY, "BASIC"),
+    BENCH(traceTASK_NOTIFY_FROM_ISR, "BASIC"),
+    BENCH(traceTASK_NOTIFY_GIVE_FROM_ISR, "BASIC"),
+    BENCH(traceISR_ENTER, "EXPERT"),
+    BENCH(traceISR_EXIT, "EXPERT"),
+    BENCH(traceISR_EXIT_TO_SCHEDULER, "EXPERT"),
+    BENCH(traceSTREAM_BUFFER_CREATE_FAILED, "STREAMS"),
+    BENCH(traceSTREAM_BUFFER_CREATE_STATIC_FAILED, "STREAMS"),
+    BENCH(traceSTREAM_BUFFER_CREATE, "STREAMS"),
+    BENCH(traceSTREAM_BUFFER_DELETE, "STREAMS"),
+    BENCH(traceSTREAM_BUFFER_RESET, "STREAMS"),
+    BENCH(traceSTREAM_BUFFER_RESET_FROM_ISR, "STREAMS"),
+    BENCH(traceBLOCKING_ON_STREAM_BUFFER_SEND, "STREAMS"),
+    BENCH(traceSTREAM_BUFFER_SEND, "STREAMS"),
+    BENCH(traceSTREAM_BUFFER_SEND_FAILED, "STREAMS"),
+    BENCH(traceSTREAM_BUFFER_SEND_FROM_ISR, "STREAMS"),
+    BENCH(traceBLOCKING_ON_STREAM_BUFFER_RECEIVE, "STREAMS"),
+    BENCH(traceSTREAM_BUFFER_RECEIVE, "STREAMS"),
+    BENCH(traceSTREAM_BUFFER_RECEIVE_FAILED, "STREAMS"),
+    BENCH(traceSTREAM_BUFFER_RECEIVE_FROM_ISR, "STREAMS"),
+};
+
+#define BENCHES             (sizeof(benches) / sizeof(benches[0]))
+
+static bench_time_t results[BENCHES];
+static bench_time_t baseline_time;
+
+
+/***
+ * Setup and measurement.
+ */
+
+static uint64_t stub_clock;
+
+/* Stub timestamp source - a free running counter read without the cost of
+ * the host clock. It advances by one per read. */
+static uint64_t stub_timestamp(void)
+{
+    return stub_clock++;
+}
+
+
+static inline uint64_t now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+
+static int compare_double(const void * a, const void * b)
+{
+    double x = *(const double *)a;
+    double y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+
+/**
+ * @brief Create the traced objects and set the kernel variables. The queue
+ *        registry (if configured) is filled - the traced queue is registered
+ *        last, so the name lookup searches the whole registry.
+ */
+
+static void setup_objects(void)
+{
+#if configQUEUE_REGISTRY_SIZE > 1
+    for (uint32_t i = 0U; i < (configQUEUE_REGISTRY_SIZE - 1U); i++)
+    {
+        (void)rte_sim_queue_create("Fill", 4U);
+    }
+#endif
+
+    task = rte_sim_task_create("Bench", 2U);
+    queue = rte_sim_queue_create("Queue", 8U);
+    timer = rte_sim_timer_create("Timer", 10U);
+    rte_sim_task_switch(task);
+
+    queue->uxMessagesWaiting = 3U;
+    xTaskToNotify = task;
+    xCopyPosition = queueSEND_TO_BACK;
+    ucQueueType = queueQUEUE_TYPE_BASE;
+    xHandle = queue;
+    uxMaxCount = 10U;
+    uxInitialCount = 0U;
+    xTicksToWait = 100U;
+    xTicksToDelay = 10U;
+    xTimerPeriodInTicks = 10U;
+    xClearCountOnExit = pdTRUE;
+    ulBitsToClearOnEntry = 0U;
+    ulBitsToClearOnExit = 0xFFFFFFFFU;
+    eAction = eSetValueWithOverwrite;
+    ulValue = 0x12345678U;
+    uxIndex = 1U;
+    ulBits = 0x0FU;
+    ulSize = 64U;
+    pvObject = &stub_clock;
+    pcName = "Queue";
+}
+
+
+static bench_time_t measure(bench_fn_t fn)
+{
+    bench_time_t time;
+
+    for (uint32_t i = 0U; i < cfg.warmup; i++)
+    {
+        fn();
+    }
+
+    for (uint32_t r = 0U; r < cfg.repetitions; r++)
+    {
+        uint64_t start = now_ns();
+
+        for (uint32_t i = 0U; i < cfg.calls; i++)
+        {
+            fn();
+        }
+
+        rep_time[r] = (double)(now_ns() - start) / (double)cfg.calls;
+    }
+
+    qsort(rep_time, cfg.repetitions, sizeof(rep_time[0]), compare_double);
+    uint32_t p99_index = (uint32_t)((cfg.repetitions * 99U + 99U) / 100U) - 1U;
+
+    time.median = rep_time[cfg.repetitions / 2U];
+    time.p99 = rep_time[p99_index];
+    time.min = rep_time[0];
+    return time;
+}
+
+
+static inline double net(double value, double base)
+{
+    return (value > base) ? (value - base) : 0.0;
+}
+
+
+static inline uint32_t code_bytes(const bench_t * bench)
+{
+    uint32_t size = (uint32_t)(bench->stop - bench->start);
+    uint32_t base = (uint32_t)(baseline.stop - baseline.start);
+    return (size > base) ? (size - base) : 0U;
+}
+
+
+/***
+ * Report.
+ */
+
+static const char * queue_names(void)
+{
+    return (configQUEUE_REGISTRY_SIZE == 0) ? "address" : "registry";
+}
+
+
+static void print_report(FILE * out)
+{
+    fprintf(out, "RTEdbg trace macro micro-benchmark - %s\n", RTE_BENCH_VARIANT);
+    fprintf(out, "  queue names: %s (registry size %u), helpers: %s, filter: 0x%08X, timestamp: %s\n",
+            queue_names(), (unsigned)configQUEUE_REGISTRY_SIZE,
+            RTE_BENCH_LTO ? "inline (LTO)" : "out-of-line", cfg.filter,
+            cfg.host_clock ? "host clock" : "stub");
+    fprintf(out, "  %u repetitions x %u calls, baseline (empty function): %.2f ns, %u bytes\n",
+            cfg.repetitions, cfg.calls, baseline_time.median,
+            (unsigned)(baseline.stop - baseline.start));
+    fprintf(out, "  %-42s %-8s %9s %9s %9s %6s\n", "Macro", "Group", "Median", "p99", "Min", "Bytes");
+
+    for (uint32_t i = 0U; i < BENCHES; i++)
+    {
+        fprintf(out, "  %-42s %-8s %9.2f %9.2f %9.2f %6u\n", benches[i].name, benches[i].group,
+                net(results[i].median, baseline_time.median),
+                net(results[i].p99, baseline_time.median),
+                net(results[i].min, baseline_time.median), code_bytes(&benches[i]));
+    }
+}
+
+
+static int write_json(const char * file_name)
+{
+    FILE * out = fopen(file_name, "w");
+
+    if (out == NULL)
+    {
+        fprintf(stderr, "Cannot create %s\n", file_name);
+        return -1;
+    }
+
+    fprintf(out, "{\n  \"benchmark\": \"rte_bench\",\n");
+    fprintf(out, "  \"config\": { \"variant\": \"%s\", \"queue_names\": \"%s\", "
+            "\"queue_registry_size\": %u, \"helpers\": \"%s\", \"freertos_version\": %u, "
+            "\"fmt_id_bits\": %u, \"filter\": \"0x%08X\", \"timestamp\": \"%s\", "
+            "\"repetitions\": %u, \"calls\": %u, \"warmup\": %u, \"buffer_words\": %u, "
+            "\"compiler\": \"%s\" },\n",
+            RTE_BENCH_VARIANT, queue_names(), (unsigned)configQUEUE_REGISTRY_SIZE,
+            RTE_BENCH_LTO ? "inline" : "out-of-line", (unsigned)RTE_FREERTOS_VERSION,
+            (unsigned)RTE_FMT_ID_BITS, cfg.filter, cfg.host_clock ? "host" : "stub",
+            cfg.repetitions, cfg.calls, cfg.warmup, cfg.buffer_words, __VERSION__);
+    fprintf(out, "  \"baseline\": { \"ns_median\": %.3f, \"code_bytes\": %u },\n",
+            baseline_time.median, (unsigned)(baseline.stop - baseline.start));
+    fprintf(out, "  \"macros\": [\n");
+
+    for (uint32_t i = 0U; i < BENCHES; i++)
+    {
+        fprintf(out, "    { \"name\": \"%s\", \"group\": \"%s\", \"ns_median\": %.3f, "
+                "\"ns_p99\": %.3f, \"ns_min\": %.3f, \"code_bytes\": %u }%s\n",
+                benches[i].name, benches[i].group,
+                net(results[i].median, baseline_time.median),
+                net(results[i].p99, baseline_time.median),
+                net(results[i].min, baseline_time.median), code_bytes(&benches[i]),
+                (i + 1U < BENCHES) ? "," : "");
+    }
+
+    fprintf(out, "  ]\n}\n");
+    return (fclose(out) == 0) ? 0 : -1;
+}
+
+
+static void usage(const char * name)
+{
+    fprintf(stderr,
+        "Usage: %s [options]\n"
+        "  -r <n>     repetitions, 1..%u (default %u)\n"
+        "  -n <n>     calls per repetition (default %u)\n"
+        "  -w <n>     warmup calls per macro (default %u)\n"
+        "  -b <n>     circular buffer size [words] (default %u)\n"
+        "  -f <mask>  message filter, e.g. 0 - measure the disabled path (default 0x%08X)\n"
+        "  -c         timestamps from the host clock instead of the stub counter\n"
+        "  -o <file>  write the results in JSON format\n",
+        name, MAX_REPETITIONS, cfg.repetitions, cfg.calls, cfg.warmup, cfg.buffer_words,
+        cfg.filter);
+}
+
+
+int main(int argc, char * argv[])
+{
+    int opt;
+
+    while ((opt = getopt(argc, argv, "r:n:w:b:f:co:h")) != -1)
+    {
+        switch (opt)
+        {
+            case 'r': cfg.repetitions = (uint32_t)strtoul(optarg, NULL, 0); break;
+            case 'n': cfg.calls = (uint32_t)strtoul(optarg, NULL, 0); break;
+            case 'w': cfg.warmup = (uint32_t)strtoul(optarg, NULL, 0); break;
+            case 'b': cfg.buffer_words = (uint32_t)strtoul(optarg, NULL, 0); break;
+            case 'f': cfg.filter = (uint32_t)strtoul(optarg, NULL, 0); break;
+            case 'c': cfg.host_clock = 1; break;
+            case 'o': cfg.report_file = optarg; break;
+            default:
+                usage(argv[0]);
+                return 2;
+        }
+    }
+
+    if ((cfg.repetitions == 0U) || (cfg.repetitions > MAX_REPETITIONS) || (cfg.calls == 0U)
+        || (cfg.buffer_words < 64U))
+    {
+        usage(argv[0]);
+        return 2;
+    }
+
+    if (!cfg.host_clock)
+    {
+        rte_host_set_timestamp_source(stub_timestamp, RTE_TIMESTAMP_FREQUENCY);
+    }
+
+    if (rte_host_init(cfg.buffer_words, RTE_MODE_CIRCULAR) != 0)
+    {
+        fprintf(stderr, "Out of memory\n");
+        return 2;
+    }
+
+    setup_objects();
+    rte_set_filter(cfg.filter);
+    baseline_time = measure(baseline.fn);
+
+    for (uint32_t i = 0U; i < BENCHES; i++)
+    {
+        results[i] = measure(benches[i].fn);
+    }
+
+    print_report(stdout);
+    int rc = 0;
+
+    if ((cfg.report_file != NULL) && (write_json(cfg.report_file) != 0))
+    {
+        rc = 2;
+    }
+
+    rte_host_exit();
+    return rc;
+}
+
+/*==== End of file ====*/
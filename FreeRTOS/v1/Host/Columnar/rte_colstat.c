@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) Branko Premzel.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/*******************************************************************************
+ * @file    rte_colstat.c
+ * @author  Branko Premzel
+ * @brief   Per-object statistics of a columnar export file (written by
+ *          Scripts/rte_columns.py) - count, minimum, maximum and mean value
+ *          of the given messages for every object, e.g. the maximum number
+ *          of items of every queue:
+ *              rte_colstat RTOS_trace.col -m MSG2_RTOS_QUEUE_SEND
+ *
+ * The table has the same format as the statistics written by rte_columns.py
+ * (computed from the decoded messages), so the two can be compared. The
+ * scan time is printed after the table.
+ *
+ * Usage: rte_colstat <columnar file> -m <message> [-m <message> ...] [-o <file>]
+ *
+ * Exit code: 0 - OK, 1 - no values of the messages, 2 - file or argument error.
+ ******************************************************************************/
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "rte_columns.h"
+
+#define MAX_MESSAGES        64U
+
+static rte_columns_t file;
+static uint8_t selected[RTE_COL_MESSAGES];
+
+
+static double elapsed_ms(const struct timespec * start)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return ((double)(now.tv_sec - start->tv_sec) * 1e3) + ((double)(now.tv_nsec - start->tv_nsec) * 1e-6);
+}
+
+
+static int compare_objects(const void * a, const void * b)
+{
+    uint32_t ia = *(const uint32_t *)a;
+    uint32_t ib = *(const uint32_t *)b;
+
+    /* Rows without an object last */
+    if ((ia == file.objects) || (ib == file.objects))
+    {
+        return (ia == ib) ? 0 : ((ia == file.objects) ? 1 : -1);
+    }
+
+    return strcmp(file.object_names[ia], file.object_names[ib]);
+}
+
+
+static void print_stats(FILE * out, const rte_col_stats_t * stats)
+{
+    uint32_t * order = malloc((file.objects + 1U) * sizeof(uint32_t));
+    uint32_t n = 0U;
+
+    if (order == NULL)
+    {
+        fprintf(out, "Out of memory\n");
+        return;
+    }
+
+    for (uint32_t i = 0U; i <= file.objects; i++)
+    {
+        if (stats[i].count != 0U)
+        {
+            order[n++] = i;
+        }
+    }
+
+    qsort(order, n, sizeof(uint32_t), compare_objects);
+    fprintf(out, "%-24s %10s %14s %14s %14s\n", "Object", "Count", "Min", "Max", "Mean");
+
+    for (uint32_t k = 0U; k < n; k++)
+    {
+        const rte_col_stats_t * s = &stats[order[k]];
+        fprintf(out, "%-24s %10llu %14.3f %14.3f %14.3f\n",
+                (order[k] == file.objects) ? "-" : file.object_names[order[k]],
+                (unsigned long long)s->count, s->min, s->max, s->sum / (double)s->count);
+    }
+
+    free(order);
+}
+
+
+int main(int argc, char * argv[])
+{
+    const char * names[MAX_MESSAGES];
+    const char * file_name = NULL;
+    const char * output = NULL;
+    uint32_t messages = 0U;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "-m") == 0) && ((i + 1) < argc) && (messages < MAX_MESSAGES))
+        {
+            names[messages++] = argv[++i];
+        }
+        else if ((strcmp(argv[i], "-o") == 0) && ((i + 1) < argc))
+        {
+            output = argv[++i];
+        }
+        else if ((argv[i][0] != '-') && (file_name == NULL))
+        {
+            file_name = argv[i];
+        }
+        else
+        {
+            file_name = NULL;
+            break;
+        }
+    }
+
+    if ((file_name == NULL) || (messages == 0U))
+    {
+        printf("Usage: %s <columnar file> -m <message> [-m <message> ...] [-o <file>]\n", argv[0]);
+        return 2;
+    }
+
+    int rc = rte_columns_open(&file, file_name);
+
+    if (rc != 0)
+    {
+        printf("%s: %s\n", file_name, (rc == -1) ? strerror(errno) : "not a columnar export file");
+        return 2;
+    }
+
+    /* Messages not in the file have no rows */
+    for (uint32_t i = 0U; i < messages; i++)
+    {
+        int32_t index = rte_columns_find_message(&file, names[i]);
+
+        if (index >= 0)
+        {
+            selected[index] = 1U;
+        }
+    }
+
+    rte_col_stats_t * stats = calloc(file.objects + 1U, sizeof(rte_col_stats_t));
+
+    if (stats == NULL)
+    {
+        printf("Out of memory\n");
+        rte_columns_close(&file);
+        return 2;
+    }
+
+    struct timespec start;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    uint64_t rows = 0U;
+    uint64_t values = 0U;
+    rte_col_group_t group;
+
+    for (uint32_t g = 0U; g < file.groups; g++)
+    {
+        if (rte_columns_group(&file, g, &group) != 0)
+        {
+            printf("%s: row group %u is damaged\n", file_name, g);
+            free(stats);
+            rte_columns_close(&file);
+            return 2;
+        }
+
+        rte_columns_aggregate(&group, selected, file.objects, stats);
+        rows += group.rows;
+    }
+
+    double ms = elapsed_ms(&start);
+
+    for (uint32_t i = 0U; i <= file.objects; i++)
+    {
+        values += stats[i].count;
+    }
+
+    FILE * out = (output != NULL) ? fopen(output, "w") : stdout;
+
+    if (out == NULL)
+    {
+        printf("Cannot write %s\n", output);
+        free(stats);
+        rte_columns_close(&file);
+        return 2;
+    }
+
+    print_stats(out, stats);
+
+    if (out != stdout)
+    {
+        fclose(out);
+    }
+
+    printf("rte_colstat: %llu rows, %u row groups scanned in %.3f ms, %llu values\n",
+           (unsigned long long)rows, file.groups, ms, (unsigned long long)values);
+    free(stats);
+    rte_columns_close(&file);
+    return (values != 0U) ? 0 : 1;
+}
+
+/*==== End of file ====*/
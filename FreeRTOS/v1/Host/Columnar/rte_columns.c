@@ -0,0 +1,326 @@
+/*
+ * Copyright (c) Branko Premzel.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/*******************************************************************************
+ * @file    rte_columns.c
+ * @author  Branko Premzel
+ * @brief   Reader of the columnar export files - see "rte_columns.h".
+ *
+ * @note    The file is little-endian, so a little-endian host is required.
+ *          All columns start at 8 byte aligned file offsets, so they are
+ *          used as arrays directly from the mapped file.
+ ******************************************************************************/
+
+#include <errno.h>
+#include <fcntl.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "rte_columns.h"
+
+#define RTE_COL_MAGIC           "RTECOLS"   // + terminating zero - 8 bytes
+#define RTE_COL_VERSION         1U
+#define RTE_COL_HEADER_SIZE     32U
+#define RTE_COL_GROUP_HEADER    16U
+
+static uint32_t rd32(const uint8_t * p)
+{
+    uint32_t value;
+    memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+
+static uint64_t rd64(const uint8_t * p)
+{
+    uint64_t value;
+    memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+
+/**
+ * @brief Read a dictionary (count u32, strings with u16 length) at *pos.
+ *        The strings are copied to *text (zero terminated).
+ * @return 0 - OK, -1 - the dictionary does not fit into the file.
+ */
+
+static int read_dictionary(const rte_columns_t * file, size_t * pos, uint32_t * count,
+                           const char *** names, char ** text)
+{
+    if ((*pos + 4U) > file->size)
+    {
+        return -1;
+    }
+
+    *count = rd32(file->data + *pos);
+    *pos += 4U;
+
+    if (*count > ((file->size - *pos) / 2U))
+    {
+        return -1;
+    }
+
+    *names = calloc(*count + 1U, sizeof(char *));
+
+    if (*names == NULL)
+    {
+        return -1;
+    }
+
+    for (uint32_t i = 0U; i < *count; i++)
+    {
+        if ((*pos + 2U) > file->size)
+        {
+            return -1;
+        }
+
+        uint16_t length;
+        memcpy(&length, file->data + *pos, sizeof(length));
+        *pos += 2U;
+
+        if ((*pos + length) > file->size)
+        {
+            return -1;
+        }
+
+        memcpy(*text, file->data + *pos, length);
+        (*text)[length] = '\0';
+        (*names)[i] = *text;
+        *text += length + 1U;
+        *pos += length;
+    }
+
+    return 0;
+}
+
+
+int rte_columns_open(rte_columns_t * file, const char * file_name)
+{
+    memset(file, 0, sizeof(*file));
+    int fd = open(file_name, O_RDONLY);
+
+    if (fd < 0)
+    {
+        return -1;
+    }
+
+    struct stat st;
+
+    if (fstat(fd, &st) != 0)
+    {
+        int error = errno;
+        close(fd);
+        errno = error;
+        return -1;
+    }
+
+    if (st.st_size < (off_t)RTE_COL_HEADER_SIZE)
+    {
+        close(fd);
+        return -2;
+    }
+
+    void * map = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+
+    if (map == MAP_FAILED)
+    {
+        return -1;
+    }
+
+    file->data = map;
+    file->size = (size_t)st.st_size;
+
+    const uint8_t * h = file->data;
+    uint64_t footer = rd64(h + 24U);
+
+    if ((memcmp(h, RTE_COL_MAGIC, 8U) != 0) || (rd32(h + 8U) != RTE_COL_VERSION)
+        || (footer > file->size) || ((footer % 8U) != 0U))
+    {
+        rte_columns_close(file);
+        return -2;
+    }
+
+    file->frequency = rd32(h + 12U);
+    file->groups = rd32(h + 16U);
+
+    if (file->groups > ((file->size - footer) / 8U))
+    {
+        rte_columns_close(file);
+        return -2;
+    }
+
+    file->offsets = (const uint64_t *)(file->data + footer);
+
+    /* The strings are never longer than the dictionaries in the file */
+    size_t pos = (size_t)footer + ((size_t)file->groups * 8U);
+    file->strings = malloc(file->size - pos + 1U);
+    char * text = file->strings;
+
+    if ((file->strings == NULL)
+        || (read_dictionary(file, &pos, &file->messages, &file->message_names, &text) != 0)
+        || (read_dictionary(file, &pos, &file->objects, &file->object_names, &text) != 0))
+    {
+        rte_columns_close(file);
+        return -2;
+    }
+
+    return 0;
+}
+
+
+void rte_columns_close(rte_columns_t * file)
+{
+    if (file->data != NULL)
+    {
+        (void)munmap((void *)file->data, file->size);
+    }
+
+    free(file->message_names);
+    free(file->object_names);
+    free(file->strings);
+    memset(file, 0, sizeof(*file));
+}
+
+
+int rte_columns_group(const rte_columns_t * file, uint32_t index, rte_col_group_t * group)
+{
+    if (index >= file->groups)
+    {
+        return -1;
+    }
+
+    uint64_t offset = file->offsets[index];
+
+    if (((offset % 8U) != 0U) || (offset > (file->size - RTE_COL_GROUP_HEADER)))
+    {
+        return -1;
+    }
+
+    const uint8_t * p = file->data + offset;
+    uint64_t rows = rd32(p);
+
+    /* value f64, object and arg0..3 u32, delta i32, msg u16, core u8 */
+    if ((rows * 35U) > (file->size - offset - RTE_COL_GROUP_HEADER))
+    {
+        return -1;
+    }
+
+    group->rows = (uint32_t)rows;
+    group->base = (int64_t)rd64(p + 8U);
+    p += RTE_COL_GROUP_HEADER;
+    group->value = (const double *)p;
+    p += rows * sizeof(double);
+    group->object = (const uint32_t *)p;
+    p += rows * sizeof(uint32_t);
+
+    for (uint32_t k = 0U; k < RTE_COL_ARGS; k++)
+    {
+        group->arg[k] = (const uint32_t *)p;
+        p += rows * sizeof(uint32_t);
+    }
+
+    group->delta = (const int32_t *)p;
+    p += rows * sizeof(int32_t);
+    group->msg = (const uint16_t *)p;
+    p += rows * sizeof(uint16_t);
+    group->core = p;
+    return 0;
+}
+
+
+int32_t rte_columns_find_message(const rte_columns_t * file, const char * name)
+{
+    for (uint32_t i = 0U; i < file->messages; i++)
+    {
+        if (strcmp(file->message_names[i], name) == 0)
+        {
+            return (int32_t)i;
+        }
+    }
+
+    return -1;
+}
+
+
+uint64_t rte_columns_rows(const rte_columns_t * file)
+{
+    uint64_t rows = 0U;
+    rte_col_group_t group;
+
+    for (uint32_t i = 0U; i < file->groups; i++)
+    {
+        if (rte_columns_group(file, i, &group) == 0)
+        {
+            rows += group.rows;
+        }
+    }
+
+    return rows;
+}
+
+
+void rte_columns_timestamps(const rte_col_group_t * group, int64_t * timestamps)
+{
+    int64_t t = group->base;
+
+    for (uint32_t i = 0U; i < group->rows; i++)
+    {
+        t += group->delta[i];
+        timestamps[i] = t;
+    }
+}
+
+
+void rte_columns_aggregate(const rte_col_group_t * group, const uint8_t * selected,
+                           uint32_t objects, rte_col_stats_t * stats)
+{
+    const uint16_t * msg = group->msg;
+    const uint32_t * object = group->object;
+    const double * value = group->value;
+
+    for (uint32_t i = 0U; i < group->rows; i++)
+    {
+        double v = value[i];
+
+        if (!selected[msg[i]] || isnan(v))
+        {
+            continue;
+        }
+
+        rte_col_stats_t * s = &stats[(object[i] < objects) ? object[i] : objects];
+
+        if (s->count == 0U)
+        {
+            s->min = v;
+            s->max = v;
+        }
+
+        s->min = (v < s->min) ? v : s->min;
+        s->max = (v > s->max) ? v : s->max;
+        s->sum += v;
+        s->count++;
+    }
+}
+
+
+uint32_t rte_columns_count(const rte_col_group_t * group, const uint8_t * selected)
+{
+    uint32_t count = 0U;
+
+    for (uint32_t i = 0U; i < group->rows; i++)
+    {
+        count += selected[group->msg[i]];
+    }
+
+    return count;
+}
+
+/*==== End of file ====*/
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) Branko Premzel.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/*******************************************************************************
+ * @file    rte_columns.h
+ * @author  Branko Premzel
+ * @brief   Reader of the columnar export files written by
+ *          Scripts/rte_columns.py (see the file layout there).
+ *
+ * The file is memory mapped and the columns of a row group are used in place
+ * - plain arrays of fixed size values. The scan functions are simple loops
+ * over the arrays (no function calls or data dependent branches in the inner
+ * loop where possible), so the compiler can vectorize them.
+ ******************************************************************************/
+
+#ifndef RTE_COLUMNS_H
+#define RTE_COLUMNS_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define RTE_COL_ARGS            4U          // Message data columns (arg0..arg3)
+#define RTE_COL_NO_OBJECT       0xFFFFFFFFUL
+#define RTE_COL_MESSAGES        65536U      // Size of the message selection arrays
+
+/* Columnar file - see rte_columns_open() */
+typedef struct
+{
+    const uint8_t * data;           // Memory mapped file
+    size_t size;                    // File size [bytes]
+    uint32_t frequency;             // Timestamp frequency [Hz]
+    uint32_t groups;                // Number of row groups
+    const uint64_t * offsets;       // File offsets of the row groups
+    uint32_t messages;              // Message dictionary size
+    const char ** message_names;
+    uint32_t objects;               // Object dictionary size
+    const char ** object_names;
+    char * strings;                 // Zero terminated copies of the dictionary strings
+} rte_columns_t;
+
+/* Columns of one row group (pointers into the mapped file) */
+typedef struct
+{
+    uint32_t rows;
+    int64_t base;                   // Timestamp of the first row [timestamp counts]
+    const double * value;           // First RTOS_TIMING float value, NaN if none
+    const uint32_t * object;        // Object dictionary index or RTE_COL_NO_OBJECT
+    const uint32_t * arg[RTE_COL_ARGS];
+    const int32_t * delta;          // Timestamp minus the previous timestamp
+    const uint16_t * msg;           // Message dictionary index
+    const uint8_t * core;           // CPU core
+} rte_col_group_t;
+
+/* Per-object aggregates - see rte_columns_aggregate() */
+typedef struct
+{
+    uint64_t count;
+    double min;
+    double max;
+    double sum;
+} rte_col_stats_t;
+
+
+/**
+ * @brief Map a columnar file and read its dictionaries.
+ * @return 0 - OK, -1 - file error (errno set), -2 - not a valid columnar file.
+ */
+int rte_columns_open(rte_columns_t * file, const char * file_name);
+
+/** @brief Unmap the file and release the dictionaries. */
+void rte_columns_close(rte_columns_t * file);
+
+/**
+ * @brief Get the columns of a row group.
+ * @return 0 - OK, -1 - bad group index or the group does not fit into the file.
+ */
+int rte_columns_group(const rte_columns_t * file, uint32_t index, rte_col_group_t * group);
+
+/** @brief Message dictionary index of a message name, -1 if it is not in the file. */
+int32_t rte_columns_find_message(const rte_columns_t * file, const char * name);
+
+/** @brief Total number of rows of all row groups. */
+uint64_t rte_columns_rows(const rte_columns_t * file);
+
+/** @brief Absolute timestamps of the rows of a group (prefix sum of the deltas). */
+void rte_columns_timestamps(const rte_col_group_t * group, int64_t * timestamps);
+
+/**
+ * @brief Add the values of the selected messages to the per-object aggregates.
+ *        Rows with a NaN value are skipped, rows without an object are added
+ *        to stats[objects].
+ * @param selected  RTE_COL_MESSAGES bytes - 1 if the message is selected.
+ * @param objects   Object dictionary size.
+ * @param stats     objects + 1 entries, zero initialized before the first call.
+ */
+void rte_columns_aggregate(const rte_col_group_t * group, const uint8_t * selected,
+                           uint32_t objects, rte_col_stats_t * stats);
+
+/** @brief Number of rows of the selected messages (RTE_COL_MESSAGES bytes) in a row group. */
+uint32_t rte_columns_count(const rte_col_group_t * group, const uint8_t * selected);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // RTE_COLUMNS_H
+
+/*==== End of file ====*/
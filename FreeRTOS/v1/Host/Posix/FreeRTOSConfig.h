@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) Branko Premzel.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/*******************************************************************************
+ * @file    FreeRTOSConfig.h
+ * @author  Branko Premzel
+ * @brief   FreeRTOS configuration of the POSIX port demo (rte_posix_demo)
+ *          and workload benchmark (rte_posix_bench). All trace macro groups
+ *          are enabled by default - RTE_TRACE_RTOS_IO (ENTER/RETURN macros)
+ *          with FreeRTOS v11 and later. The RTEdbg write path is the in-memory
+ *          host version (Backend/rtedbg.c).
+ * @note    RTE_FREERTOS_VERSION is set by CMake from the kernel task.h.
+ ******************************************************************************/
+
+#ifndef FREERTOS_CONFIG_H
+#define FREERTOS_CONFIG_H
+
+#define configUSE_PREEMPTION                    1
+#define configUSE_PORT_OPTIMISED_TASK_SELECTION 0
+#define configUSE_TICKLESS_IDLE                 0
+#define configTICK_RATE_HZ                      1000U
+#define configMAX_PRIORITIES                    7
+#define configMINIMAL_STACK_SIZE                4096U   // PTHREAD_STACK_MIN or more [words]
+#define configSTACK_DEPTH_TYPE                  uint32_t
+#define configMAX_TASK_NAME_LEN                 16
+#define configUSE_16_BIT_TICKS                  0
+#define configIDLE_SHOULD_YIELD                 1
+#define configUSE_TASK_NOTIFICATIONS            1
+#define configTASK_NOTIFICATION_ARRAY_ENTRIES   2
+#define configUSE_MUTEXES                       1
+#define configUSE_RECURSIVE_MUTEXES             1
+#define configUSE_COUNTING_SEMAPHORES           1
+#define configQUEUE_REGISTRY_SIZE               16
+#define configUSE_QUEUE_SETS                    0
+#define configUSE_TIME_SLICING                  1
+#define configUSE_NEWLIB_REENTRANT              0
+#define configUSE_EVENT_GROUPS                  1
+#define configUSE_STREAM_BUFFERS                1
+
+/* Memory allocation - heap_4 (vPortGetHeapStats() is available) */
+#define configSUPPORT_STATIC_ALLOCATION         0
+#define configSUPPORT_DYNAMIC_ALLOCATION        1
+#define configTOTAL_HEAP_SIZE                   ((size_t)(4U * 1024U * 1024U))
+#define configAPPLICATION_ALLOCATED_HEAP        0
+
+/* Hooks */
+#define configUSE_IDLE_HOOK                     0
+#define configUSE_TICK_HOOK                     0
+#define configCHECK_FOR_STACK_OVERFLOW          0
+#define configUSE_MALLOC_FAILED_HOOK            0
+#define configUSE_DAEMON_TASK_STARTUP_HOOK      0
+
+/* Run time and task statistics */
+#define configGENERATE_RUN_TIME_STATS           0
+#define configUSE_TRACE_FACILITY                1
+#define configUSE_STATS_FORMATTING_FUNCTIONS    0
+
+/* Software timers */
+#define configUSE_TIMERS                        1
+#define configTIMER_TASK_PRIORITY               (configMAX_PRIORITIES - 1)
+#define configTIMER_QUEUE_LENGTH                10
+#define configTIMER_TASK_STACK_DEPTH            (configMINIMAL_STACK_SIZE * 2U)
+
+/* Optional functions */
+#define INCLUDE_vTaskPrioritySet                1
+#define INCLUDE_uxTaskPriorityGet               1
+#define INCLUDE_vTaskDelete                     1
+#define INCLUDE_vTaskSuspend                    1
+#define INCLUDE_xResumeFromISR                  1
+#define INCLUDE_xTaskDelayUntil                 1
+#define INCLUDE_vTaskDelay                      1
+#define INCLUDE_xTaskGetSchedulerState          1
+#define INCLUDE_xTaskGetCurrentTaskHandle       1
+#define INCLUDE_uxTaskGetStackHighWaterMark     1
+#define INCLUDE_xTaskGetIdleTaskHandle          1
+#define INCLUDE_eTaskGetState                   1
+#define INCLUDE_xEventGroupSetBitFromISR        1
+#define INCLUDE_xTimerPendFunctionCall          1
+#define INCLUDE_xTaskAbortDelay                 1
+#define INCLUDE_xTaskGetHandle                  1
+#define INCLUDE_xSemaphoreGetMutexHolder        1
+
+void rte_posix_assert(const char * pcFile, unsigned long ulLine);
+#define configASSERT(x)     if ((x) == 0) { rte_posix_assert(__FILE__, __LINE__); }
+
+/* Enable FreeRTOS tracing for specific groups of functions. The workload
+ * benchmark builds (rte_posix_bench_xxx) override them on the command line. */
+#ifndef RTE_TRACE_RTOS_BASIC
+#define RTE_TRACE_RTOS_BASIC        1
+#endif
+#ifndef RTE_TRACE_RTOS_TASKS
+#define RTE_TRACE_RTOS_TASKS        1
+#endif
+#ifndef RTE_TRACE_RTOS_MALLOC
+#define RTE_TRACE_RTOS_MALLOC       1
+#endif
+#ifndef RTE_TRACE_RTOS_TIMER
+#define RTE_TRACE_RTOS_TIMER        1
+#endif
+#ifndef RTE_TRACE_RTOS_QUEUE
+#define RTE_TRACE_RTOS_QUEUE        1
+#endif
+#ifndef RTE_TRACE_RTOS_STREAMS
+#define RTE_TRACE_RTOS_STREAMS      1
+#endif
+#ifndef RTE_TRACE_RTOS_EXPERT
+#define RTE_TRACE_RTOS_EXPERT       1
+#endif
+#ifndef RTE_TRACE_RTOS_IO
+#define RTE_TRACE_RTOS_IO           1       // ENTER/RETURN macros (FreeRTOS v11 and later)
+#endif
+
+/* Port hooks - there are no interrupts and no cycle counter in the POSIX port */
+#define RTE_RTOS_GET_IRQ_NUMBER()   0U
+#define RTE_RTOS_CYCLE_COUNTER()    ((uint32_t)rte_host_timestamp())
+
+#ifndef RTE_FREERTOS_VERSION
+#error "RTE_FREERTOS_VERSION must be defined - it is set by CMake from the kernel version."
+#endif
+#include "rte_FreeRTOS_trace.h"         // RTEdbg FreeRTOS trace macros
+#if RTE_FREERTOS_VERSION >= 110000
+#include "rte_FreeRTOS_trace2.h"        // ENTER/RETURN trace macros (Expert)
+#endif
+
+#endif  // FREERTOS_CONFIG_H
+
+/*==== End of file ====*/
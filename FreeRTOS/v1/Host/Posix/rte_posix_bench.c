@@ -0,0 +1,458 @@
+/*
+ * Copyright (c) Branko Premzel.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/*******************************************************************************
+ * @file    rte_posix_bench.c
+ * @author  Branko Premzel
+ * @brief   End-to-end workload benchmark - trace overhead as a share of the
+ *          RTOS throughput (FreeRTOS POSIX port).
+ *
+ * The same workload is built once per trace configuration - see the
+ * rte_posix_bench_xxx targets in CMakeLists.txt (no tracing, one trace macro
+ * group at a time, all groups). Scripts/rte_workload_matrix.py runs them and
+ * prints the throughput loss matrix.
+ *
+ * Fixed rate part (real time, driven by the tick):
+ *  - the producer sends a burst of items to a queue every tick; the consumer
+ *    (higher priority) receives them and updates the statistics under a mutex
+ *    - send-to-receive latency of every item is measured,
+ *  - a periodic timer notifies a task that writes to a stream buffer, which is
+ *    read by another task.
+ * Saturating part: the lowest priority load task executes a fixed mix of
+ * kernel calls (queue, mutex, notification, event group, stream buffer,
+ * heap) in a loop, using all CPU time not used by the fixed rate part. The
+ * number of load operations per second is the throughput - the trace macro
+ * execution time reduces it.
+ *
+ * The statistics are collected after the warmup time during the measurement
+ * time. The trace data rate is the number of words written to the circular
+ * buffer during that time.
+ *
+ * Exit code: 0 - OK, 1 - the workload did not run, 2 - usage or setup error.
+ ******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "semphr.h"
+#include "event_groups.h"
+#include "stream_buffer.h"
+#include "timers.h"
+
+#ifndef RTE_BENCH_VARIANT
+#define RTE_BENCH_VARIANT   "default"
+#endif
+
+/* The ENTER/RETURN macros (RTE_TRACE_RTOS_IO) are only included for FreeRTOS v11 and later */
+#ifdef RTE_FREERTOS_TRACE2_H
+#define BENCH_TRACE_IO      RTE_TRACE_RTOS_IO
+#else
+#define BENCH_TRACE_IO      0
+#endif
+
+#define BENCH_STACK_SIZE    (configMINIMAL_STACK_SIZE * 2U)
+#define MAX_SAMPLES         (1024U * 1024U)     // Latency samples
+#define LOAD_OPS_PER_LOOP   12U                 // Kernel calls per load loop
+#define STREAM_CHUNK        16U                 // Bytes per stream buffer write
+
+typedef struct
+{
+    uint32_t measure_ms;
+    uint32_t warmup_ms;
+    uint32_t burst;             // Queue items per tick
+    uint32_t timer_period;      // [ticks]
+    uint32_t buffer_words;
+    const char * report_file;
+} config_t;
+
+static config_t cfg =
+{
+    .measure_ms = 2000U,
+    .warmup_ms = 200U,
+    .burst = 4U,
+    .timer_period = 2U,
+    .buffer_words = 1024U * 1024U,
+    .report_file = NULL,
+};
+
+typedef struct
+{
+    uint64_t load_ops;          // Kernel calls of the load task
+    uint64_t items;             // Queue items received
+    uint64_t timer_events;      // Stream buffer writes triggered by the timer
+    uint64_t stream_bytes;      // Bytes received from the stream buffer
+    uint64_t trace_words;       // Words written to the trace buffer
+    uint64_t time_ns;
+} counters_t;
+
+/* Only one task runs at a time in the POSIX port - plain variables are used */
+static volatile counters_t counters;
+static volatile int measuring;
+static uint32_t latency[MAX_SAMPLES];
+static volatile uint32_t samples;
+
+static QueueHandle_t data_queue;
+static QueueHandle_t load_queue;
+static SemaphoreHandle_t stats_mutex;
+static SemaphoreHandle_t load_mutex;
+static EventGroupHandle_t load_events;
+static StreamBufferHandle_t stream;
+static StreamBufferHandle_t load_stream;
+static TimerHandle_t periodic_timer;
+static TaskHandle_t stream_writer_task;
+
+
+void rte_posix_assert(const char * pcFile, unsigned long ulLine)
+{
+    fprintf(stderr, "configASSERT() failed: %s:%lu\n", pcFile, ulLine);
+    abort();
+}
+
+
+static inline uint64_t now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+
+static int compare_u32(const void * a, const void * b)
+{
+    uint32_t x = *(const uint32_t *)a;
+    uint32_t y = *(const uint32_t *)b;
+    return (x > y) - (x < y);
+}
+
+
+/***
+ * Fixed rate part.
+ */
+
+static void periodic_timer_callback(TimerHandle_t xTimer)
+{
+    (void)xTimer;
+    (void)xTaskNotifyGive(stream_writer_task);
+}
+
+
+static void producer(void * pvParameters)
+{
+    (void)pvParameters;
+    TickType_t xLastWakeTime = xTaskGetTickCount();
+
+    for (;;)
+    {
+        vTaskDelayUntil(&xLastWakeTime, 1U);
+
+        for (uint32_t i = 0U; i < cfg.burst; i++)
+        {
+            uint64_t sent = now_ns();
+            (void)xQueueSend(data_queue, &sent, portMAX_DELAY);
+        }
+    }
+}
+
+
+static void consumer(void * pvParameters)
+{
+    (void)pvParameters;
+    uint64_t sent;
+
+    for (;;)
+    {
+        if (xQueueReceive(data_queue, &sent, portMAX_DELAY) != pdPASS)
+        {
+            continue;
+        }
+
+        uint64_t delay = now_ns() - sent;
+        (void)xSemaphoreTake(stats_mutex, portMAX_DELAY);
+
+        if (measuring)
+        {
+            counters.items++;
+
+            if (samples < MAX_SAMPLES)
+            {
+                latency[samples++] = (delay > UINT32_MAX) ? UINT32_MAX : (uint32_t)delay;
+            }
+        }
+
+        (void)xSemaphoreGive(stats_mutex);
+    }
+}
+
+
+static void stream_writer(void * pvParameters)
+{
+    (void)pvParameters;
+    uint8_t chunk[STREAM_CHUNK] = { 0 };
+
+    for (;;)
+    {
+        (void)ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        (void)xStreamBufferSend(stream, chunk, sizeof(chunk), portMAX_DELAY);
+
+        if (measuring)
+        {
+            counters.timer_events++;
+        }
+    }
+}
+
+
+static void stream_reader(void * pvParameters)
+{
+    (void)pvParameters;
+    uint8_t chunk[STREAM_CHUNK];
+
+    for (;;)
+    {
+        size_t received = xStreamBufferReceive(stream, chunk, sizeof(chunk), portMAX_DELAY);
+
+        if (measuring)
+        {
+            counters.stream_bytes += received;
+        }
+    }
+}
+
+
+/***
+ * Saturating part - runs at the lowest priority above the idle task.
+ */
+
+static void load(void * pvParameters)
+{
+    (void)pvParameters;
+    TaskHandle_t self = xTaskGetCurrentTaskHandle();
+    uint8_t chunk[8] = { 0 };
+    uint32_t value = 0U;
+
+    for (;;)
+    {
+        (void)xQueueSend(load_queue, &value, 0U);
+        (void)xQueueReceive(load_queue, &value, 0U);
+        (void)xSemaphoreTake(load_mutex, 0U);
+        (void)xSemaphoreGive(load_mutex);
+        (void)xTaskNotifyGive(self);
+        (void)ulTaskNotifyTake(pdTRUE, 0U);
+        (void)xEventGroupSetBits(load_events, 1U);
+        (void)xEventGroupClearBits(load_events, 1U);
+        (void)xStreamBufferSend(load_stream, chunk, sizeof(chunk), 0U);
+        (void)xStreamBufferReceive(load_stream, chunk, sizeof(chunk), 0U);
+        void * p = pvPortMalloc(32U);
+        vPortFree(p);
+        value++;
+
+        if (measuring)
+        {
+            counters.load_ops += LOAD_OPS_PER_LOOP;
+        }
+    }
+}
+
+
+/***
+ * Report.
+ */
+
+static void print_report(FILE * out, int json, const counters_t * c)
+{
+    double seconds = (double)c->time_ns / 1e9;
+    double ops_rate = (double)c->load_ops / seconds;
+    double items_rate = (double)c->items / seconds;
+    double timer_rate = (double)c->timer_events / seconds;
+    double trace_rate = (double)c->trace_words * 4.0 / seconds;
+    uint32_t n = samples;
+    uint32_t p50 = (n != 0U) ? latency[(n - 1U) / 2U] : 0U;
+    uint32_t p90 = (n != 0U) ? latency[((uint64_t)n * 90U) / 100U] : 0U;
+    uint32_t p99 = (n != 0U) ? latency[((uint64_t)n * 99U) / 100U] : 0U;
+    uint32_t max = (n != 0U) ? latency[n - 1U] : 0U;
+
+    if (json)
+    {
+        fprintf(out, "{\n  \"benchmark\": \"rte_posix_bench\",\n  \"variant\": \"%s\",\n",
+                RTE_BENCH_VARIANT);
+        fprintf(out, "  \"groups\": { \"BASIC\": %u, \"TASKS\": %u, \"MALLOC\": %u, \"TIMER\": %u, "
+                "\"QUEUE\": %u, \"STREAMS\": %u, \"EXPERT\": %u, \"IO\": %u },\n",
+                RTE_TRACE_RTOS_BASIC, RTE_TRACE_RTOS_TASKS, RTE_TRACE_RTOS_MALLOC,
+                RTE_TRACE_RTOS_TIMER, RTE_TRACE_RTOS_QUEUE, RTE_TRACE_RTOS_STREAMS,
+                RTE_TRACE_RTOS_EXPERT, BENCH_TRACE_IO);
+        fprintf(out, "  \"config\": { \"measure_ms\": %u, \"warmup_ms\": %u, \"burst\": %u, "
+                "\"timer_period\": %u, \"tick_rate_hz\": %u, \"buffer_words\": %u, "
+                "\"freertos_version\": %u },\n", cfg.measure_ms, cfg.warmup_ms, cfg.burst,
+                cfg.timer_period, (unsigned)configTICK_RATE_HZ, cfg.buffer_words,
+                (unsigned)RTE_FREERTOS_VERSION);
+        fprintf(out, "  \"duration_s\": %.6f,\n", seconds);
+        fprintf(out, "  \"throughput_ops_per_s\": %.0f,\n", ops_rate);
+        fprintf(out, "  \"fixed_rate\": { \"items_per_s\": %.0f, \"timer_events_per_s\": %.0f, "
+                "\"stream_bytes\": %llu },\n", items_rate, timer_rate,
+                (unsigned long long)c->stream_bytes);
+        fprintf(out, "  \"latency_ns\": { \"count\": %u, \"p50\": %u, \"p90\": %u, \"p99\": %u, "
+                "\"max\": %u },\n", n, p50, p90, p99, max);
+        fprintf(out, "  \"trace\": { \"words\": %llu, \"bytes_per_s\": %.0f }\n}\n",
+                (unsigned long long)c->trace_words, trace_rate);
+        return;
+    }
+
+    fprintf(out, "RTEdbg FreeRTOS workload benchmark - %s\n", RTE_BENCH_VARIANT);
+    fprintf(out, "  groups: BASIC %u, TASKS %u, MALLOC %u, TIMER %u, QUEUE %u, STREAMS %u, EXPERT %u, "
+            "IO %u\n", RTE_TRACE_RTOS_BASIC, RTE_TRACE_RTOS_TASKS, RTE_TRACE_RTOS_MALLOC,
+            RTE_TRACE_RTOS_TIMER, RTE_TRACE_RTOS_QUEUE, RTE_TRACE_RTOS_STREAMS,
+            RTE_TRACE_RTOS_EXPERT, BENCH_TRACE_IO);
+    fprintf(out, "  duration: %.3f s, throughput: %.0f ops/s\n", seconds, ops_rate);
+    fprintf(out, "  fixed rate: %.0f items/s (target %u), %.0f timer events/s\n", items_rate,
+            cfg.burst * (unsigned)configTICK_RATE_HZ, timer_rate);
+    fprintf(out, "  queue latency [ns]: p50 %u, p90 %u, p99 %u, max %u (%u items)\n",
+            p50, p90, p99, max, n);
+    fprintf(out, "  trace data: %.0f bytes/s\n", trace_rate);
+}
+
+
+/* Runs at a high priority - controls the measurement and ends the program */
+static void control(void * pvParameters)
+{
+    (void)pvParameters;
+    counters_t result;
+
+    (void)xTimerStart(periodic_timer, 0U);
+    vTaskDelay(pdMS_TO_TICKS(cfg.warmup_ms));
+
+    uint64_t words = rte_host_words_written();
+    uint64_t start = now_ns();
+    measuring = 1;
+    vTaskDelay(pdMS_TO_TICKS(cfg.measure_ms));
+    measuring = 0;
+
+    vTaskSuspendAll();
+    memcpy(&result, (const void *)&counters, sizeof(result));
+    result.time_ns = now_ns() - start;
+    result.trace_words = rte_host_words_written() - words;
+    qsort(latency, samples, sizeof(latency[0]), compare_u32);
+
+    print_report(stdout, 0, &result);
+
+    if (cfg.report_file != NULL)
+    {
+        FILE * out = fopen(cfg.report_file, "w");
+
+        if (out == NULL)
+        {
+            fprintf(stderr, "Can't write %s\n", cfg.report_file);
+            exit(2);
+        }
+
+        print_report(out, 1, &result);
+        fclose(out);
+    }
+
+    exit(((result.load_ops != 0U) && (result.items != 0U)) ? 0 : 1);
+}
+
+
+/***
+ * Setup.
+ */
+
+static void usage(const char * name)
+{
+    fprintf(stderr,
+        "Usage: %s [options]\n"
+        "  -t <ms>     measurement time (default %u)\n"
+        "  -w <ms>     warmup time (default %u)\n"
+        "  -r <n>      queue items per tick (default %u)\n"
+        "  -p <ticks>  timer period (default %u)\n"
+        "  -b <n>      buffer size in 32-bit words (default %u)\n"
+        "  -o <file>   write the report in JSON format\n",
+        name, cfg.measure_ms, cfg.warmup_ms, cfg.burst, cfg.timer_period, cfg.buffer_words);
+}
+
+
+static int create_objects(void)
+{
+    data_queue = xQueueCreate(64U, sizeof(uint64_t));
+    load_queue = xQueueCreate(4U, sizeof(uint32_t));
+    stats_mutex = xSemaphoreCreateMutex();
+    load_mutex = xSemaphoreCreateMutex();
+    load_events = xEventGroupCreate();
+    stream = xStreamBufferCreate(8U * STREAM_CHUNK, 1U);
+    load_stream = xStreamBufferCreate(64U, 1U);
+    periodic_timer = xTimerCreate("Periodic", cfg.timer_period, pdTRUE, NULL, periodic_timer_callback);
+
+    if ((data_queue == NULL) || (load_queue == NULL) || (stats_mutex == NULL) || (load_mutex == NULL)
+        || (load_events == NULL) || (stream == NULL) || (load_stream == NULL) || (periodic_timer == NULL))
+    {
+        return -1;
+    }
+
+    vQueueAddToRegistry(data_queue, "DataQueue");
+    vQueueAddToRegistry(load_queue, "LoadQueue");
+    vQueueAddToRegistry(stats_mutex, "StatsMutex");
+    vQueueAddToRegistry(load_mutex, "LoadMutex");
+
+    if ((xTaskCreate(producer, "Producer", BENCH_STACK_SIZE, NULL, 3U, NULL) != pdPASS)
+        || (xTaskCreate(consumer, "Consumer", BENCH_STACK_SIZE, NULL, 4U, NULL) != pdPASS)
+        || (xTaskCreate(stream_writer, "StreamWr", BENCH_STACK_SIZE, NULL, 2U, &stream_writer_task)
+            != pdPASS)
+        || (xTaskCreate(stream_reader, "StreamRd", BENCH_STACK_SIZE, NULL, 2U, NULL) != pdPASS)
+        || (xTaskCreate(load, "Load", BENCH_STACK_SIZE, NULL, 1U, NULL) != pdPASS)
+        || (xTaskCreate(control, "Control", BENCH_STACK_SIZE, NULL, configMAX_PRIORITIES - 2U, NULL)
+            != pdPASS))
+    {
+        return -1;
+    }
+
+    return 0;
+}
+
+
+int main(int argc, char * argv[])
+{
+    int opt;
+
+    while ((opt = getopt(argc, argv, "t:w:r:p:b:o:h")) != -1)
+    {
+        switch (opt)
+        {
+            case 't': cfg.measure_ms = (uint32_t)strtoul(optarg, NULL, 0); break;
+            case 'w': cfg.warmup_ms = (uint32_t)strtoul(optarg, NULL, 0); break;
+            case 'r': cfg.burst = (uint32_t)strtoul(optarg, NULL, 0); break;
+            case 'p': cfg.timer_period = (uint32_t)strtoul(optarg, NULL, 0); break;
+            case 'b': cfg.buffer_words = (uint32_t)strtoul(optarg, NULL, 0); break;
+            case 'o': cfg.report_file = optarg; break;
+            default:
+                usage(argv[0]);
+                return 2;
+        }
+    }
+
+    if ((cfg.buffer_words < 64U) || (cfg.measure_ms == 0U) || (cfg.burst == 0U)
+        || (cfg.timer_period == 0U))
+    {
+        usage(argv[0]);
+        return 2;
+    }
+
+    /* Circular mode - the trace data rate does not depend on the buffer size */
+    if ((rte_host_init(cfg.buffer_words, RTE_MODE_CIRCULAR) != 0) || (create_objects() != 0))
+    {
+        fprintf(stderr, "Setup failed\n");
+        return 2;
+    }
+
+    vTaskStartScheduler();
+    fprintf(stderr, "The scheduler could not be started\n");
+    return 2;
+}
+
+/*==== End of file ====*/
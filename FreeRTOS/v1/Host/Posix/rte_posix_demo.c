@@ -0,0 +1,415 @@
+/*
+ * Copyright (c) Branko Premzel.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/*******************************************************************************
+ * @file    rte_posix_demo.c
+ * @author  Branko Premzel
+ * @brief   FreeRTOS POSIX port demo with the RTEdbg trace macros.
+ *
+ * The demo runs the real FreeRTOS kernel (POSIX port) with all trace macro
+ * groups enabled and the in-memory host version of the RTEdbg write path.
+ * The tasks use queues, semaphores, mutexes (with priority inheritance),
+ * recursive mutexes, event groups, task notifications, stream and message
+ * buffers, software timers, pended function calls and the heap, so that the
+ * trace macros of every group are executed. With FreeRTOS v11 and later, the
+ * ENTER/RETURN macros (RTE_TRACE_RTOS_IO, Expert/rte_FreeRTOS_trace2.h) are
+ * included too. The RETURN message of a kernel call is found from its ENTER
+ * message with the id ^ S pairing of the Expert format IDs.
+ *
+ * When the run time has elapsed, the buffer is written to a binary file
+ * (header + circular buffer, see Backend/rtedbg.h) that can be decoded with
+ * RTEmsg, and the buffer is checked for at least one message of every trace
+ * macro group.
+ *
+ * Exit code: 0 - messages of all groups found, 1 - check failed, 2 - usage or
+ * setup error.
+ ******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "semphr.h"
+#include "event_groups.h"
+#include "stream_buffer.h"
+#include "message_buffer.h"
+#include "timers.h"
+
+#define DEMO_STACK_SIZE     (configMINIMAL_STACK_SIZE * 2U)
+#define EVENT_DATA          (1UL << 0)
+#define EVENT_TIMER         (1UL << 1)
+
+typedef struct
+{
+    uint32_t run_time_ms;
+    uint32_t buffer_words;
+    uint32_t mode;
+    const char * dump_file;
+} config_t;
+
+static config_t cfg =
+{
+    .run_time_ms = 500U,
+    .buffer_words = 1024U * 1024U,
+    .mode = RTE_MODE_SINGLE_SHOT,
+    .dump_file = "rte_posix_demo.bin",
+};
+
+/* One message of every trace macro group that the demo must log */
+typedef struct
+{
+    uint32_t fmt_id;
+    uint32_t id_size;       // Number of format IDs used by the message (2^data words for MSG1..MSG4)
+    const char * group;
+    uint32_t found;
+} group_check_t;
+
+static group_check_t group_checks[] =
+{
+    { MSG1_RTOS_TASK_DELAY,         2U, "RTE_TRACE_RTOS_BASIC",   0U },
+    { MSG1_RTOS_TASK_CREATE,        2U, "RTE_TRACE_RTOS_TASKS",   0U },
+    { MSG2_RTOS_MALLOC,             4U, "RTE_TRACE_RTOS_MALLOC",  0U },
+    { MSG1_RTOS_TIMER_EXPIRED,      2U, "RTE_TRACE_RTOS_TIMER",   0U },
+    { MSG1_RTOS_CREATE_MUTEX,       2U, "RTE_TRACE_RTOS_QUEUE",   0U },
+    { MSG2_RTOS_STREAM_BUFFER_SEND, 4U, "RTE_TRACE_RTOS_STREAMS", 0U },
+    { MSG0_RTOS_STARTING_SCHEDULER, 1U, "RTE_TRACE_RTOS_EXPERT",  0U },
+#if defined(RTE_FREERTOS_TRACE2_H) && (RTE_TRACE_RTOS_IO == 1)
+    /* vTaskDelay() ENTER (MSG1) and RETURN (MSG0) - the pair shares a block of 2 * 2 IDs */
+    { MSG1_RTOS_TASK_DELAY_ENTER,           2U, "RTE_TRACE_RTOS_IO ENTER",  0U },
+    { MSG1_RTOS_TASK_DELAY_ENTER ^ 2U,      1U, "RTE_TRACE_RTOS_IO RETURN", 0U },
+    { MSG2_RTOS_EVENT_GROUP_SET_BITS_ENTER, 4U, "RTE_TRACE_RTOS_IO EVENT",  0U },
+#endif
+};
+
+#define GROUP_CHECKS        (sizeof(group_checks) / sizeof(group_checks[0]))
+
+static QueueHandle_t data_queue;
+static SemaphoreHandle_t mutex;
+static SemaphoreHandle_t recursive_mutex;
+static SemaphoreHandle_t binary_sem;
+static SemaphoreHandle_t counting_sem;
+static EventGroupHandle_t events;
+static StreamBufferHandle_t stream;
+static MessageBufferHandle_t messages;
+static TimerHandle_t periodic_timer;
+static TimerHandle_t one_shot_timer;
+static TaskHandle_t producer_task;
+static TaskHandle_t consumer_task;
+static TaskHandle_t low_task;
+static volatile uint32_t pended_calls;
+
+
+void rte_posix_assert(const char * pcFile, unsigned long ulLine)
+{
+    fprintf(stderr, "configASSERT() failed: %s:%lu\n", pcFile, ulLine);
+    abort();
+}
+
+
+/***
+ * Timers and pended functions.
+ */
+
+static void pended_function(void * pvParameter1, uint32_t ulParameter2)
+{
+    (void)pvParameter1;
+    pended_calls += ulParameter2;
+}
+
+
+static void periodic_timer_callback(TimerHandle_t xTimer)
+{
+    (void)xTimer;
+    (void)xSemaphoreGive(binary_sem);
+    (void)xSemaphoreGive(counting_sem);
+    (void)xEventGroupSetBits(events, EVENT_TIMER);
+}
+
+
+static void one_shot_timer_callback(TimerHandle_t xTimer)
+{
+    (void)xTimer;
+    (void)xTimerPendFunctionCall(pended_function, NULL, 1U, 0U);
+}
+
+
+/***
+ * Tasks.
+ */
+
+/* Sends data to the consumer through all communication objects */
+static void producer(void * pvParameters)
+{
+    (void)pvParameters;
+    uint32_t value = 0U;
+
+    for (;;)
+    {
+        value++;
+        (void)xQueueSend(data_queue, &value, pdMS_TO_TICKS(5));
+        (void)xStreamBufferSend(stream, &value, sizeof(value), 0U);
+        (void)xMessageBufferSend(messages, &value, sizeof(value), 0U);
+        (void)xTaskNotify(consumer_task, value, eSetValueWithOverwrite);
+        (void)xTaskNotifyGiveIndexed(consumer_task, 1U);
+        (void)xEventGroupSetBits(events, EVENT_DATA);
+
+        /* Priority inheritance - the low priority task may hold the mutex */
+        if (xSemaphoreTake(mutex, pdMS_TO_TICKS(2)) == pdPASS)
+        {
+            (void)xSemaphoreGive(mutex);
+        }
+
+        vTaskDelay(pdMS_TO_TICKS(1));
+    }
+}
+
+
+/* Receives the data and waits for the timer events */
+static void consumer(void * pvParameters)
+{
+    (void)pvParameters;
+    uint32_t value;
+    uint32_t notified;
+
+    for (;;)
+    {
+        (void)xQueueReceive(data_queue, &value, pdMS_TO_TICKS(10));
+        (void)xQueuePeek(data_queue, &value, 0U);
+        (void)xStreamBufferReceive(stream, &value, sizeof(value), 0U);
+        (void)xMessageBufferReceive(messages, &value, sizeof(value), 0U);
+        (void)xTaskNotifyWait(0U, UINT32_MAX, &notified, 0U);
+        (void)ulTaskNotifyTakeIndexed(1U, pdTRUE, 0U);
+        (void)xEventGroupWaitBits(events, EVENT_DATA | EVENT_TIMER, pdTRUE, pdFALSE, pdMS_TO_TICKS(2));
+        (void)xSemaphoreTake(binary_sem, 0U);
+        (void)xSemaphoreTake(counting_sem, 0U);
+    }
+}
+
+
+/* Holds the mutex for a while, uses the heap and changes its priority */
+static void low_priority(void * pvParameters)
+{
+    (void)pvParameters;
+    TickType_t xLastWakeTime = xTaskGetTickCount();
+
+    for (;;)
+    {
+        if (xSemaphoreTake(mutex, portMAX_DELAY) == pdPASS)
+        {
+            vTaskDelay(pdMS_TO_TICKS(2));
+            (void)xSemaphoreGive(mutex);
+        }
+
+        if (xSemaphoreTakeRecursive(recursive_mutex, 0U) == pdPASS)
+        {
+            (void)xSemaphoreTakeRecursive(recursive_mutex, 0U);
+            (void)xSemaphoreGiveRecursive(recursive_mutex);
+            (void)xSemaphoreGiveRecursive(recursive_mutex);
+        }
+
+        void * p_block = pvPortMalloc(64U + (xTaskGetTickCount() % 256U));
+        vPortFree(p_block);
+
+        vTaskPrioritySet(NULL, uxTaskPriorityGet(NULL) + 1U);
+        vTaskPrioritySet(NULL, uxTaskPriorityGet(NULL) - 1U);
+        (void)xTaskDelayUntil(&xLastWakeTime, pdMS_TO_TICKS(3));
+    }
+}
+
+
+static void short_lived(void * pvParameters)
+{
+    (void)pvParameters;
+    vTaskDelay(pdMS_TO_TICKS(1));
+    vTaskDelete(NULL);
+}
+
+
+/***
+ * Buffer check and dump.
+ */
+
+static void check_groups(void)
+{
+    const uint32_t words = (g_rtedbg.rte_cfg & RTE_CFG_SINGLE_SHOT) ? g_rtedbg.last_index
+                                                                      : g_rtedbg.buffer_size;
+
+    for (uint32_t i = 0U; i < words; i++)
+    {
+        uint32_t word = g_rtedbg.buffer[i];
+
+        if ((word == RTE_EMPTY_WORD) || ((word & 1U) == 0U))
+        {
+            continue;       // Not a FMT word
+        }
+
+        uint32_t id_field = word >> (32U - RTE_FMT_ID_BITS);
+
+        for (uint32_t k = 0U; k < GROUP_CHECKS; k++)
+        {
+            if ((id_field & ~(group_checks[k].id_size - 1U)) == group_checks[k].fmt_id)
+            {
+                group_checks[k].found++;
+            }
+        }
+    }
+}
+
+
+/* Runs at the highest priority - controls the demo and ends it */
+static void control(void * pvParameters)
+{
+    (void)pvParameters;
+    const TickType_t xEnd = xTaskGetTickCount() + pdMS_TO_TICKS(cfg.run_time_ms);
+    uint32_t failed = 0U;
+
+    (void)xTimerStart(periodic_timer, 0U);
+
+    while (xTaskGetTickCount() < xEnd)
+    {
+        vTaskDelay(pdMS_TO_TICKS(20));
+        vTaskSuspend(low_task);
+        (void)xTimerStart(one_shot_timer, 0U);
+        (void)xTimerChangePeriod(periodic_timer, pdMS_TO_TICKS(5), 0U);
+        (void)xTaskCreate(short_lived, "ShortLived", DEMO_STACK_SIZE, NULL, 2U, NULL);
+        vTaskResume(low_task);
+    }
+
+    (void)xTimerStop(periodic_timer, 0U);
+    vTaskSuspendAll();
+
+    check_groups();
+    printf("%u words logged, %u messages dropped, %u pended function calls\n",
+           (g_rtedbg.rte_cfg & RTE_CFG_SINGLE_SHOT) ? g_rtedbg.last_index : g_rtedbg.buffer_size,
+           rte_host_dropped(), pended_calls);
+
+    for (uint32_t k = 0U; k < GROUP_CHECKS; k++)
+    {
+        printf("  %-24s %8u\n", group_checks[k].group, group_checks[k].found);
+        failed |= (group_checks[k].found == 0U);
+    }
+
+    if (rte_host_dump(cfg.dump_file) != 0)
+    {
+        fprintf(stderr, "Can't write %s\n", cfg.dump_file);
+        exit(2);
+    }
+
+    printf("Buffer written to %s - %s\n", cfg.dump_file, (failed == 0U) ? "PASS" : "FAIL");
+    exit((failed == 0U) ? 0 : 1);
+}
+
+
+/***
+ * Setup.
+ */
+
+static void usage(const char * name)
+{
+    fprintf(stderr,
+        "Usage: %s [options]\n"
+        "  -t <ms>     run time (default %u)\n"
+        "  -b <n>      buffer size in 32-bit words (default %u)\n"
+        "  -m wrap|single  circular or single shot logging (default single)\n"
+        "  -d <file>   binary capture file (default %s)\n",
+        name, cfg.run_time_ms, cfg.buffer_words, cfg.dump_file);
+}
+
+
+static int create_objects(void)
+{
+    data_queue = xQueueCreate(8U, sizeof(uint32_t));
+    mutex = xSemaphoreCreateMutex();
+    recursive_mutex = xSemaphoreCreateRecursiveMutex();
+    binary_sem = xSemaphoreCreateBinary();
+    counting_sem = xSemaphoreCreateCounting(4U, 0U);
+    events = xEventGroupCreate();
+    stream = xStreamBufferCreate(64U, 1U);
+    messages = xMessageBufferCreate(64U);
+    periodic_timer = xTimerCreate("Periodic", pdMS_TO_TICKS(5), pdTRUE, NULL, periodic_timer_callback);
+    one_shot_timer = xTimerCreate("OneShot", pdMS_TO_TICKS(3), pdFALSE, NULL, one_shot_timer_callback);
+
+    if ((data_queue == NULL) || (mutex == NULL) || (recursive_mutex == NULL) || (binary_sem == NULL)
+        || (counting_sem == NULL) || (events == NULL) || (stream == NULL) || (messages == NULL)
+        || (periodic_timer == NULL) || (one_shot_timer == NULL))
+    {
+        return -1;
+    }
+
+    /* The trace macros identify queues and semaphores by their registry names */
+    vQueueAddToRegistry(data_queue, "DataQueue");
+    vQueueAddToRegistry(mutex, "Mutex");
+    vQueueAddToRegistry(recursive_mutex, "RecMutex");
+    vQueueAddToRegistry(binary_sem, "BinarySem");
+    vQueueAddToRegistry(counting_sem, "CountSem");
+
+    if ((xTaskCreate(producer, "Producer", DEMO_STACK_SIZE, NULL, 2U, &producer_task) != pdPASS)
+        || (xTaskCreate(consumer, "Consumer", DEMO_STACK_SIZE, NULL, 3U, &consumer_task) != pdPASS)
+        || (xTaskCreate(low_priority, "LowPrio", DEMO_STACK_SIZE, NULL, 1U, &low_task) != pdPASS)
+        || (xTaskCreate(control, "Control", DEMO_STACK_SIZE, NULL, configMAX_PRIORITIES - 2U, NULL)
+            != pdPASS))
+    {
+        return -1;
+    }
+
+    return 0;
+}
+
+
+int main(int argc, char * argv[])
+{
+    int opt;
+
+    while ((opt = getopt(argc, argv, "t:b:m:d:h")) != -1)
+    {
+        switch (opt)
+        {
+            case 't': cfg.run_time_ms = (uint32_t)strtoul(optarg, NULL, 0); break;
+            case 'b': cfg.buffer_words = (uint32_t)strtoul(optarg, NULL, 0); break;
+            case 'd': cfg.dump_file = optarg; break;
+            case 'm':
+                if (strcmp(optarg, "wrap") == 0)
+                {
+                    cfg.mode = RTE_MODE_CIRCULAR;
+                }
+                else if (strcmp(optarg, "single") == 0)
+                {
+                    cfg.mode = RTE_MODE_SINGLE_SHOT;
+                }
+                else
+                {
+                    usage(argv[0]);
+                    return 2;
+                }
+                break;
+            default:
+                usage(argv[0]);
+                return 2;
+        }
+    }
+
+    if ((cfg.buffer_words < 64U) || (cfg.run_time_ms == 0U))
+    {
+        usage(argv[0]);
+        return 2;
+    }
+
+    /* The backend must be ready before the first trace macro is executed */
+    if ((rte_host_init(cfg.buffer_words, cfg.mode) != 0) || (create_objects() != 0))
+    {
+        fprintf(stderr, "Setup failed\n");
+        return 2;
+    }
+
+    vTaskStartScheduler();
+    fprintf(stderr, "The scheduler could not be started\n");
+    return 2;
+}
+
+/*==== End of file ====*/
@@ -0,0 +1,272 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) Branko Premzel.
+#
+# SPDX-License-Identifier: MIT
+#
+
+"""
+@file    rte_bandwidth.py
+@author  Branko Premzel
+@brief   Trace bandwidth estimator - buffer usage per message and filter.
+
+Reads a binary capture (header and circular buffer - see Backend/rtedbg.h,
+e.g. rte_posix_demo -d or rte_stress -d) and reports for every format ID
+and every filter the number of messages, bytes, bytes per second and the
+share of all logged data. The format IDs are assigned from the format
+definition files in the same way as by rte_fmt_ids.py (values defined with
+#define - e.g. the generated rte_fmt_ids.h or the files updated by RTEmsg -
+are used as they are). The filter of every message is taken from the
+trace macro sources (RTE_MSGx(MSGx_NAME, F_FILTER, ...)).
+
+The history length is estimated for candidate buffer sizes and filter masks.
+For every combination, the messages enabled by the mask are passed through
+a simulated circular buffer of that size:
+ * average - buffer size divided by the average data rate,
+ * minimum - the shortest time span held by the buffer at any point of the
+   capture after it was filled for the first time (worst case stop moment).
+The minimum is not available if the capture contains less data than the
+buffer size. Long timestamp messages and messages with an unknown filter
+are counted for all masks.
+
+The capture is memory mapped (see rte_capture.py) and decoded in a single
+pass. The memory used does not depend on the capture size.
+
+Exit code: 0 - OK, 1 - no messages found, 2 - file or argument error.
+"""
+
+import argparse
+import collections
+import json
+import os
+import re
+import struct
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import rte_capture      # noqa: E402
+import rte_fmt_ids      # noqa: E402
+
+TRACE_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', '..')
+DEFAULT_SOURCES = [os.path.join(TRACE_DIR, 'rte_FreeRTOS_trace.h'),
+                   os.path.join(TRACE_DIR, 'rte_FreeRTOS_trace.c'),
+                   os.path.join(TRACE_DIR, 'Expert', 'rte_FreeRTOS_trace2.h')]
+
+RE_MSG_FILTER = re.compile(r'\b((?:EXT_)?MSG(?:\d+|N)\w*)\s*(?:\|[^,]*)?,\s*(F_\w+)')
+
+
+class MessageTable:
+    """Message name and filter number of every format ID."""
+
+    def __init__(self, fmt_files, sources, id_bits):
+        messages, filters, defined = rte_fmt_ids.parse(fmt_files)
+        ids = rte_fmt_ids.allocate(messages, defined, id_bits)
+        numbers = rte_fmt_ids.allocate_filters(filters, defined)
+        self.filter_numbers = {name: defined.get(name, numbers.get(name)) for name in filters}
+        self.filter_names = {v: k for k, v in self.filter_numbers.items()}
+        self.filter_names[0] = 'SYSTEM'
+        self.filter_names[-1] = 'UNKNOWN'
+
+        message_filter = {}
+        for name in sources:
+            try:
+                with open(name, encoding='utf-8', errors='replace') as f:
+                    for m in RE_MSG_FILTER.finditer(f.read()):
+                        message_filter.setdefault(m.group(1), m.group(2))
+            except OSError:
+                pass        # The Expert sources are optional
+
+        self.by_id = [None] * (1 << id_bits)
+        self.by_id[0] = self.by_id[1] = ('LONG_TIMESTAMP', 0)
+        for name, size in messages:
+            base = defined.get(name, ids.get(name))
+            if base is None:
+                continue
+            filter_no = self.filter_numbers.get(message_filter.get(name), -1)
+            for i in range(base, min(base + size, len(self.by_id))):
+                self.by_id[i] = (name, filter_no)
+
+    def lookup(self, id_field):
+        entry = self.by_id[id_field]
+        return entry if entry is not None else ('UNKNOWN_ID_%u' % id_field, -1)
+
+    def mask(self, text):
+        """Filter mask from a number or from filter names joined with '+' (e.g. BASIC+QUEUE)."""
+        try:
+            return int(text, 0)
+        except ValueError:
+            pass
+        mask = 0
+        for part in text.split('+'):
+            part = part.strip().upper()
+            for name in (part, 'F_RTOS_' + part, 'F_' + part):
+                if name in self.filter_numbers:
+                    mask |= 1 << self.filter_numbers[name]
+                    break
+            else:
+                raise ValueError('unknown filter: %s' % part)
+        return mask
+
+
+def records(f, cap):
+    """Yield (format ID field, size in words, unwrapped timestamp) of every complete message."""
+    for id_field, data, timestamp in rte_capture.messages(f, cap):
+        yield id_field, len(data) + 1, timestamp
+
+
+class History:
+    """Simulated circular buffer of one size for the messages enabled by one mask."""
+
+    def __init__(self, mask, size_bytes):
+        self.mask = mask
+        self.size = size_bytes
+        self.window = collections.deque()
+        self.used = 0
+        self.full = False
+        self.min_history = None
+
+    def add(self, timestamp, size):
+        self.window.append((timestamp, size))
+        self.used += size
+        while self.used > self.size:
+            self.used -= self.window.popleft()[1]
+            self.full = True
+        if self.full and self.window:
+            history = timestamp - self.window[0][0]
+            if self.min_history is None or history < self.min_history:
+                self.min_history = history
+
+
+def parse_size(text):
+    """Buffer size in bytes - a number with an optional K or M suffix."""
+    text = text.strip().upper()
+    scale = 1
+    if text.endswith('K'):
+        scale, text = 1024, text[:-1]
+    elif text.endswith('M'):
+        scale, text = 1024 * 1024, text[:-1]
+    return int(text, 0) * scale
+
+
+def parse_time(text):
+    """Time in seconds - a number with an optional h, min, s, ms or us suffix."""
+    text = text.strip().lower()
+    for suffix, scale in (('min', 60.0), ('ms', 1e-3), ('us', 1e-6), ('h', 3600.0), ('s', 1.0)):
+        if text.endswith(suffix):
+            return float(text[:-len(suffix)]) * scale
+    return float(text)
+
+
+def analyze(f, cap, table, masks, sizes):
+    """Single pass over the capture - message statistics and history windows."""
+    per_id = {}
+    histories = [History(m, s) for m in masks for s in sizes]
+    first = last = None
+    total = 0
+
+    for id_field, n_words, timestamp in records(f, cap):
+        name, filter_no = table.lookup(id_field)
+        stat = per_id.get(name)
+        if stat is None:
+            stat = per_id[name] = [filter_no, 0, 0]
+        size = n_words * 4
+        stat[1] += 1
+        stat[2] += size
+        total += size
+        if first is None:
+            first = timestamp
+        last = timestamp
+        bit = (1 << filter_no) if filter_no > 0 else 0
+        for h in histories:
+            if bit == 0 or (h.mask & bit):
+                h.add(timestamp, size)
+
+    duration = (last - first) / cap.frequency if first is not None and cap.frequency else 0.0
+    return per_id, histories, total, duration
+
+
+def main():
+    parser = argparse.ArgumentParser(description='RTEdbg trace bandwidth estimator.')
+    parser.add_argument('capture', help='binary capture file (header and circular buffer)')
+    parser.add_argument('fmt', nargs='+', help='format definition files or the generated rte_fmt_ids.h')
+    parser.add_argument('-s', '--source', action='append',
+                        help='trace macro source with the message filters (default: trace headers)')
+    parser.add_argument('-b', '--buffer', action='append',
+                        help='candidate buffer size in bytes, K or M suffix allowed (default: capture buffer)')
+    parser.add_argument('-m', '--mask', action='append',
+                        help='candidate filter mask - a number or names, e.g. BASIC+QUEUE (default: capture filter)')
+    parser.add_argument('-o', '--output', help='write the report in JSON format')
+    args = parser.parse_args()
+
+    try:
+        with open(args.capture, 'rb') as f:
+            cap = rte_capture.Capture(f)
+            table = MessageTable(args.fmt, args.source or DEFAULT_SOURCES, cap.id_bits)
+            masks = [table.mask(m) for m in args.mask] if args.mask else [cap.filter or cap.filter_copy]
+            sizes = [parse_size(s) for s in args.buffer] if args.buffer else [cap.size * 4]
+            per_id, histories, total, duration = analyze(f, cap, table, masks, sizes)
+    except (OSError, ValueError) as e:
+        print('rte_bandwidth: %s' % e, file=sys.stderr)
+        sys.exit(2)
+
+    if not per_id:
+        print('rte_bandwidth: no messages in %s' % args.capture, file=sys.stderr)
+        sys.exit(1)
+
+    def rate(size):
+        return size / duration if duration > 0 else 0.0
+
+    messages = []
+    filters = {}
+    for name, (filter_no, count, size) in per_id.items():
+        messages.append({'name': name, 'filter': table.filter_names.get(filter_no, '?'),
+                         'count': count, 'bytes': size, 'bytes_per_s': round(rate(size), 1),
+                         'share_pct': round(100.0 * size / total, 2)})
+        fs = filters.setdefault(filter_no, [0, 0])
+        fs[0] += count
+        fs[1] += size
+    messages.sort(key=lambda m: -m['bytes'])
+    filter_list = [{'filter': table.filter_names.get(n, '?'), 'number': n, 'count': c, 'bytes': s,
+                    'bytes_per_s': round(rate(s), 1), 'share_pct': round(100.0 * s / total, 2)}
+                   for n, (c, s) in sorted(filters.items(), key=lambda x: -x[1][1])]
+
+    history_list = []
+    for h in histories:
+        enabled = sum(s for n, (c, s) in filters.items() if n <= 0 or (h.mask & (1 << n)))
+        average = h.size / rate(enabled) if rate(enabled) > 0 else None
+        minimum = h.min_history / cap.frequency if h.min_history is not None and cap.frequency else None
+        history_list.append({'mask': '0x%08X' % h.mask, 'buffer_bytes': h.size,
+                             'bytes_per_s': round(rate(enabled), 1),
+                             'average_s': round(average, 6) if average is not None else None,
+                             'minimum_s': round(minimum, 6) if minimum is not None else None})
+
+    print('Capture: %s, %u words, %s mode, %u messages, %u bytes, %.6f s' % (
+        args.capture, cap.size, 'single shot' if cap.single_shot else 'circular',
+        sum(m['count'] for m in messages), total, duration))
+    print()
+    print('%-48s %-16s %9s %10s %12s %7s' % ('Message', 'Filter', 'Count', 'Bytes', 'Bytes/s', 'Share'))
+    for m in messages:
+        print('%-48s %-16s %9u %10u %12.0f %6.2f%%' % (m['name'], m['filter'], m['count'], m['bytes'],
+                                                      m['bytes_per_s'], m['share_pct']))
+    print()
+    print('%-16s %6s %9s %10s %12s %7s' % ('Filter', 'Number', 'Count', 'Bytes', 'Bytes/s', 'Share'))
+    for fl in filter_list:
+        print('%-16s %6d %9u %10u %12.0f %6.2f%%' % (fl['filter'], fl['number'], fl['count'], fl['bytes'],
+                                                    fl['bytes_per_s'], fl['share_pct']))
+    print()
+    print('%-12s %12s %12s %14s %14s' % ('Mask', 'Buffer [B]', 'Bytes/s', 'Average [s]', 'Minimum [s]'))
+    for hl in history_list:
+        print('%-12s %12u %12.0f %14s %14s' % (
+            hl['mask'], hl['buffer_bytes'], hl['bytes_per_s'],
+            '%.6f' % hl['average_s'] if hl['average_s'] is not None else '-',
+            '%.6f' % hl['minimum_s'] if hl['minimum_s'] is not None else 'not filled'))
+
+    if args.output:
+        with open(args.output, 'w', encoding='utf-8') as f:
+            json.dump({'capture': args.capture, 'buffer_words': cap.size, 'filter': cap.filter,
+                       'timestamp_frequency': cap.frequency, 'duration_s': duration, 'bytes': total,
+                       'messages': messages, 'filters': filter_list, 'history': history_list}, f, indent=2)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,82 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) Branko Premzel.
+#
+# SPDX-License-Identifier: MIT
+#
+
+"""
+@file    rte_bench_compare.py
+@author  Branko Premzel
+@brief   Compare two trace macro micro-benchmark results (rte_bench -o).
+
+The median time and the code size of every macro in the new result are
+compared with the old (reference) result, e.g. the same benchmark
+configuration built from two commits. A macro is reported as slower if
+its median time grew by more than the threshold [%] and by more than the
+absolute limit [ns] - short macros are within the timing noise otherwise.
+Any code size increase is reported.
+
+Exit code: 0 - no regression, 1 - a macro is slower or larger,
+2 - the files cannot be compared.
+"""
+
+import argparse
+import json
+import sys
+
+
+def load(file_name):
+    try:
+        with open(file_name, encoding='utf-8') as f:
+            result = json.load(f)
+        return result['config'], {m['name']: m for m in result['macros']}
+    except (OSError, ValueError, KeyError) as e:
+        sys.exit('rte_bench_compare: %s: %s' % (file_name, e))
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Compare two rte_bench JSON results.')
+    parser.add_argument('old', help='reference result')
+    parser.add_argument('new', help='new result')
+    parser.add_argument('--threshold', type=float, default=10.0,
+                        help='allowed median time increase [%%]')
+    parser.add_argument('--min-ns', type=float, default=1.0,
+                        help='ignore time increases smaller than this [ns]')
+    parser.add_argument('--all', action='store_true', help='list all macros, not only the changed ones')
+    args = parser.parse_args()
+
+    old_cfg, old = load(args.old)
+    new_cfg, new = load(args.new)
+
+    for key in ('queue_registry_size', 'helpers', 'filter', 'timestamp'):
+        if old_cfg.get(key) != new_cfg.get(key):
+            print('rte_bench_compare: different configuration - %s: %s / %s'
+                  % (key, old_cfg.get(key), new_cfg.get(key)), file=sys.stderr)
+            sys.exit(2)
+
+    regressions = 0
+    print('%-42s %9s %9s %7s %6s %6s' % ('Macro', 'Old [ns]', 'New [ns]', 'Change', 'Bytes', 'Old'))
+    for name in sorted(set(old) | set(new)):
+        if name not in old or name not in new:
+            print('%-42s %s' % (name, 'only in the new result' if name in new else 'only in the old result'))
+            continue
+        o, n = old[name], new[name]
+        delta = n['ns_median'] - o['ns_median']
+        change = 100.0 * delta / o['ns_median'] if o['ns_median'] > 0 else 0.0
+        slower = change > args.threshold and delta > args.min_ns
+        larger = n['code_bytes'] > o['code_bytes']
+        if slower or larger:
+            regressions += 1
+        if args.all or slower or larger or n['code_bytes'] < o['code_bytes'] or change < -args.threshold:
+            mark = '  <- slower' if slower else ''
+            mark += '  <- larger' if larger else ''
+            print('%-42s %9.2f %9.2f %+6.1f%% %6u %6u%s' % (name, o['ns_median'], n['ns_median'], change,
+                                                         n['code_bytes'], o['code_bytes'], mark))
+
+    print('%u macro(s) slower or larger' % regressions)
+    sys.exit(1 if regressions else 0)
+
+
+if __name__ == '__main__':
+    main()
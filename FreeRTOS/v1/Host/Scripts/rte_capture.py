@@ -0,0 +1,329 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) Branko Premzel.
+#
+# SPDX-License-Identifier: MIT
+#
+
+"""
+@file    rte_capture.py
+@author  Branko Premzel
+@brief   Reader of binary captures (header and circular buffer - see
+         Backend/rtedbg.h) shared by the host scripts.
+
+The capture file is memory mapped and the messages are returned in place:
+the data words of a message are a memoryview of the mapped buffer, so they
+are not copied (only a message split by the end of the circular buffer is
+copied to a list). The buffer word format:
+ * FMT word - format ID field (top id_bits bits), short timestamp and bit 0
+   set. It is the last word of a message.
+ * data words - data << 1 (bit 0 clear). The top bit of each data word is in
+   the format ID field or in the last data word - see rte_decode.py.
+ * 0xFFFFFFFF - empty (not written) word.
+The positions are word indexes in the reading order - from the oldest to the
+newest word (circular mode: from last_index to the end of the buffer, then
+from the start of the buffer to last_index).
+
+The message boundaries (FMT and empty words - the words with bit 0 set) and
+the FMT words with given format IDs are found with bulk operations on whole
+blocks of the buffer (bytes of one position in every word extracted with a
+strided slice, bytes.translate() and integer AND) instead of a loop over all
+words. Only the messages are processed in Python.
+
+The words are read in the host byte order, so a little-endian host is
+required (as the capture files are little-endian).
+
+Run as a script, it counts the messages with the given names with the bulk
+scan (--check - compare with the counts of all decoded messages).
+
+Exit code: 0 - OK, 1 - check failed, 2 - file or argument error.
+"""
+
+import argparse
+import collections
+import mmap
+import os
+import re
+import struct
+import sys
+import time
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import rte_fmt_ids      # noqa: E402
+
+HEADER_WORDS = 6
+CFG_SINGLE_SHOT = 1 << 8
+EMPTY_WORD = 0xFFFFFFFF
+LONG_TIMESTAMP_ID = 0
+BLOCK_WORDS = 1 << 20           # Words processed by one bulk operation
+ODD_BYTES = bytes(i & 1 for i in range(256))
+RE_FLAG = re.compile(b'\x01')
+
+
+class Capture:
+    """Header of a binary capture file."""
+
+    def __init__(self, f):
+        data = f.read(HEADER_WORDS * 4)
+        if len(data) != HEADER_WORDS * 4:
+            raise ValueError('file too short')
+        (self.last_index, self.filter, self.cfg, self.frequency,
+         self.filter_copy, self.size) = struct.unpack('<6I', data)
+        self.id_bits = self.cfg & 0xFF
+        self.single_shot = (self.cfg & CFG_SINGLE_SHOT) != 0
+        if not 8 <= self.id_bits <= 16 or self.last_index > self.size:
+            raise ValueError('not a capture file (bad header)')
+        self.tstamp_bits = 31 - self.id_bits
+        self.words = self.last_index if self.single_shot else self.size     # words in the reading order
+
+
+def is_long_timestamp(id_field, data):
+    return (id_field >> 1) == LONG_TIMESTAMP_ID and len(data) == 1
+
+
+def unwrap(previous, short, cap):
+    """
+    Unwrapped timestamp of a short timestamp value - the nearest value to the
+    previous timestamp (messages of interrupts and other cores can be
+    slightly out of order).
+    """
+    ts_mask = (1 << cap.tstamp_bits) - 1
+    delta = (short - previous) & ts_mask
+    return previous + (delta - (ts_mask + 1) if delta >= (1 << (cap.tstamp_bits - 1)) else delta)
+
+
+class TraceFile:
+    """Memory mapped capture. f - binary file, cap - its header (read from f if None)."""
+
+    def __init__(self, f, cap=None):
+        if sys.byteorder != 'little':
+            raise ValueError('a little-endian host is required')
+        if cap is None:
+            f.seek(0)
+            cap = Capture(f)
+        self.cap = cap
+        self.map = mmap.mmap(f.fileno(), 0, access=mmap.ACCESS_READ)
+        if len(self.map) < (HEADER_WORDS + cap.size) * 4:
+            self.map.close()
+            raise ValueError('file too short for the buffer size in the header')
+        self.buffer = memoryview(self.map)[HEADER_WORDS * 4:(HEADER_WORDS + cap.size) * 4]
+        self.words = self.buffer.cast('I')
+        self.offset = 0 if cap.single_shot else cap.last_index
+        self.synced = cap.single_shot or cap.last_index == 0
+
+    def close(self):
+        try:
+            self.words.release()
+            self.buffer.release()
+            self.map.close()
+        except BufferError:
+            pass        # Data words still in use - the map is closed when they are freed
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, *exc):
+        self.close()
+
+    def pieces(self, start, end):
+        """Yield (position, buffer index, length) of the physically contiguous parts of [start, end)."""
+        size = self.cap.size
+        while start < end:
+            index = self.offset + start
+            if index >= size:
+                index -= size
+            length = min(end - start, size - index)
+            yield start, index, length
+            start += length
+
+    def word(self, pos):
+        index = self.offset + pos
+        return self.words[index - self.cap.size if index >= self.cap.size else index]
+
+    def flagged(self, index, end, tables):
+        """
+        Yield the buffer indexes in [index, end) of the words whose bytes all
+        map to 1 in the translate tables ({byte number: 256-byte table}).
+        """
+        for first in range(index, end, BLOCK_WORDS):
+            count = min(BLOCK_WORDS, end - first)
+            data = self.buffer[first * 4:(first + count) * 4]
+            flags = None
+            for byte, table in tables.items():
+                value = int.from_bytes(data[byte::4].tobytes().translate(table), 'little')
+                flags = value if flags is None else flags & value
+            for m in RE_FLAG.finditer(flags.to_bytes(count, 'little')):
+                yield first + m.start()
+
+    def boundaries(self, start=0, end=None):
+        """Positions of the FMT and empty words (bit 0 set) in [start, end)."""
+        for pos, index, length in self.pieces(start, self.cap.words if end is None else end):
+            for i in self.flagged(index, index + length, {0: ODD_BYTES}):
+                yield pos + i - index
+
+    def messages(self, start=0, end=None, synced=None):
+        """
+        Yield (format ID field, data words, unwrapped timestamp) of every
+        complete message in [start, end). The data words are the buffer words
+        as they are (data << 1). The range must start at a message start, or synced must be False (default
+        at the buffer start: False if the oldest message may be partially
+        overwritten - everything up to the first FMT or empty word is
+        skipped). The first timestamp is the short timestamp value, unless
+        the first message is a long timestamp.
+        """
+        cap = self.cap
+        words = self.words
+        if synced is None:
+            synced = self.synced or start > 0
+        id_shift = 32 - cap.id_bits
+        ts_mask = (1 << cap.tstamp_bits) - 1
+        ts_half = 1 << (cap.tstamp_bits - 1)
+        timestamp = None
+        carry = []          # Start of a message split by the end of the buffer
+        for _, index, length in self.pieces(start, self.cap.words if end is None else end):
+            first = index
+            for i in self.flagged(index, index + length, {0: ODD_BYTES}):
+                word = words[i]
+                if word == EMPTY_WORD or not synced:
+                    synced = True
+                    first = i + 1
+                    carry = []
+                    continue
+                data = words[first:i]
+                if carry:
+                    data = carry + list(data)
+                    carry = []
+                first = i + 1
+                id_field = word >> id_shift
+                short = (word >> 1) & ts_mask
+                if (id_field >> 1) == LONG_TIMESTAMP_ID and len(data) == 1:
+                    long_part = (data[0] >> 1) | ((id_field & 1) << 31)
+                    timestamp = (long_part << cap.tstamp_bits) | short
+                elif timestamp is None:
+                    timestamp = short
+                else:
+                    delta = (short - timestamp) & ts_mask
+                    timestamp += delta - (ts_mask + 1) if delta >= ts_half else delta
+                yield id_field, data, timestamp
+            carry += words[first:index + length]
+
+    def find(self, id_fields, start=None, end=None):
+        """
+        Positions of the FMT words with the given format ID fields. Only the
+        words that pass the bulk tests (bit 0 and the top byte) are checked
+        one by one. The default start is the start of the first complete
+        message.
+        """
+        if start is None:
+            start = 0 if self.synced else next(self.boundaries(), self.cap.words) + 1
+        id_fields = set(id_fields)
+        shift = 32 - self.cap.id_bits
+        top = bytes(1 if any((i >> (self.cap.id_bits - 8)) == b for i in id_fields) else 0 for b in range(256))
+        tables = {0: ODD_BYTES, 3: top}
+        for pos, index, length in self.pieces(start, self.cap.words if end is None else end):
+            for i in self.flagged(index, index + length, tables):
+                word = self.words[i]
+                if word != EMPTY_WORD and word >> shift in id_fields:
+                    yield pos + i - index
+
+    def message_at(self, pos):
+        """(format ID field, data words) of the message with the FMT word at pos."""
+        first = pos
+        while first > 0 and not self.word(first - 1) & 1:
+            first -= 1
+        return self.word(pos) >> (32 - self.cap.id_bits), [self.word(p) for p in range(first, pos)]
+
+    def select(self, id_fields, start=None, end=None):
+        """
+        Yield (format ID field, data words, timestamp) of the messages with
+        the given format ID fields - only the messages found by find() are
+        read. The long timestamp messages are found too: after the first one,
+        a timestamp is the short timestamp placed in the period of the last
+        long timestamp (a message up to 1/64 of the period older than the
+        long timestamp - an interrupt or another core - is placed before
+        it), so the distance between the selected messages is not limited.
+        Before the first long timestamp, the timestamps are unwrapped as by
+        messages() - the selected messages must then be less than half of
+        the short timestamp period apart.
+        """
+        id_fields = set(id_fields)
+        long_ids = {LONG_TIMESTAMP_ID << 1, (LONG_TIMESTAMP_ID << 1) | 1}
+        ts_mask = (1 << self.cap.tstamp_bits) - 1
+        slack = (ts_mask + 1) >> 6
+        long_time = timestamp = None
+        for pos in self.find(id_fields | long_ids, start, end):
+            id_field, data = self.message_at(pos)
+            short = (self.word(pos) >> 1) & ts_mask
+            if is_long_timestamp(id_field, data):
+                long_part = (data[0] >> 1) | ((id_field & 1) << 31)
+                long_time = timestamp = (long_part << self.cap.tstamp_bits) | short
+                if id_field not in id_fields:
+                    continue
+            elif id_field not in id_fields:
+                continue        # Long timestamp ID of a message that is not a long timestamp
+            elif long_time is not None:
+                delta = (short - long_time) & ts_mask
+                timestamp = long_time + (delta - (ts_mask + 1) if delta > ts_mask - slack else delta)
+            elif timestamp is None:
+                timestamp = short
+            else:
+                timestamp = unwrap(timestamp, short, self.cap)
+            yield id_field, data, timestamp
+
+
+def messages(f, cap):
+    """Yield (format ID field, data words, unwrapped timestamp) of every complete message of a capture file."""
+    with TraceFile(f, cap) as trace:
+        yield from trace.messages()
+
+
+def message_ids(fmt_files, id_bits, names):
+    """Format ID fields of the messages (all IDs of a message block)."""
+    messages, _, defined = rte_fmt_ids.parse(fmt_files)
+    sizes = dict(messages)
+    ids = rte_fmt_ids.allocate(messages, defined, id_bits)
+    result = {}
+    for name in names:
+        base = defined.get(name, ids.get(name))
+        if base is None or name not in sizes:
+            raise ValueError('unknown message: %s' % name)
+        result[name] = range(base, base + sizes[name])
+    return result
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Count messages of a binary capture with the bulk format ID scan.')
+    parser.add_argument('capture', help='binary capture file (header and circular buffer)')
+    parser.add_argument('fmt', nargs='+', help='format definition files and the generated rte_fmt_ids.h')
+    parser.add_argument('-m', '--message', action='append', required=True,
+                        help='message name, e.g. MSG1_RTOS_TASK_SWITCHED_IN. Can be repeated')
+    parser.add_argument('--check', action='store_true', help='compare with the counts of all decoded messages')
+    args = parser.parse_args()
+
+    try:
+        with open(args.capture, 'rb') as f, TraceFile(f) as trace:
+            blocks = message_ids(args.fmt, trace.cap.id_bits, args.message)
+            started = time.time()
+            counts = {name: sum(1 for _ in trace.find(ids)) for name, ids in blocks.items()}
+            elapsed = time.time() - started
+            failed = 0
+            if args.check:
+                decoded = collections.Counter(id_field for id_field, _, _ in trace.messages())
+                for name, ids in blocks.items():
+                    expected = sum(decoded[i] for i in ids)
+                    if expected != counts[name]:
+                        print('%s: %u messages found by the scan, %u decoded' % (name, counts[name], expected))
+                        failed += 1
+    except (OSError, ValueError) as e:
+        print('rte_capture: %s' % e, file=sys.stderr)
+        sys.exit(2)
+
+    for name in args.message:
+        print('%-48s %10u' % (name, counts[name]))
+    print('rte_capture: %u words scanned in %.3f s%s' % (trace.cap.words, elapsed,
+                                                          ', check OK' if args.check and not failed else ''))
+    sys.exit(1 if failed else 0)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,275 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) Branko Premzel.
+#
+# SPDX-License-Identifier: MIT
+#
+
+"""
+@file    rte_columns.py
+@author  Branko Premzel
+@brief   Columnar export of the decoded messages of a binary capture for
+         offline analytics (read by Columnar/rte_columns.c).
+
+Every message (except the long timestamp messages) is a row. The rows are
+written in row groups of up to --rows rows, column by column:
+ * value  f64  - value of the first RTOS_TIMING float signal of the message
+                 (e.g. the number of items of Queue<name>_items), NaN if none,
+ * object u32  - object name (task, queue, ...) - index in the object
+                 dictionary, 0xFFFFFFFF if the message has no name,
+ * arg0..arg3 u32 - the first four 32-bit words of the message data
+                 (including the top bits and the extra bits of EXT_MSG),
+ * delta  i32  - timestamp minus the timestamp of the previous row of the
+                 group [timestamp counts] (the first row: 0),
+ * msg    u16  - message name - index in the message dictionary,
+ * core   u8   - CPU core (0 - the captures are single core).
+The object name is the first value of the message if it is a string
+(%[32s]s) in the format definition.
+
+File layout (little-endian, all parts aligned to 8 bytes):
+ * header - magic "RTECOLS\\0", version u32, timestamp frequency u32, number
+   of row groups u32, reserved u32, footer offset u64,
+ * row groups - rows u32, reserved u32, timestamp of the first row i64 and
+   the columns in the order above (zero padding to 8 bytes at the end),
+ * footer - file offset u64 of every row group, then the message and the
+   object dictionary: count u32 and count strings (length u16, UTF-8 text).
+A row group ends early when a timestamp delta does not fit into 32 bits.
+
+With -m the count, minimum, maximum and mean value of the given messages per
+object are written to --stats (default: standard output) - computed from the
+decoded messages, in the same format as rte_colstat prints them from the
+columnar file (e.g. the maximum number of items of every queue).
+
+Exit code: 0 - OK, 1 - no messages exported, 2 - file or argument error.
+"""
+
+import argparse
+import array
+import math
+import os
+import struct
+import sys
+import time
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import rte_capture      # noqa: E402
+import rte_decode       # noqa: E402
+import rte_timing       # noqa: E402
+
+MAGIC = b'RTECOLS\0'
+VERSION = 1
+HEADER = struct.Struct('<8sIIIIQ')
+GROUP_HEADER = struct.Struct('<IIq')
+DEFAULT_ROWS = 65536
+MAX_ROWS = 1 << 20
+ARGS = 4
+NO_OBJECT = 0xFFFFFFFF
+TIMING = 'RTOS_TIMING'
+NAN = float('nan')
+
+
+def object_field(msg):
+    """(start bit, bits) of the object name of a message or None - the first value if it is a string."""
+    for _, parts in msg.lines:
+        for p in parts:
+            if isinstance(p, rte_decode.Field) and p.source == 'bits':
+                return ((p.start or 0), p.bits) if p.type == 's' else None
+    return None
+
+
+def has_value(msg):
+    return msg.stores() or any(output == TIMING and parts and isinstance(parts[0], str) and parts[0].startswith('f ')
+                               for output, parts in msg.lines)
+
+
+def timing_value(decoder, id_field, data, t):
+    """Value of the first RTOS_TIMING float signal of a message, NaN if none."""
+    _, texts = decoder.decode(id_field, data, t, (TIMING,))
+    for line in texts.get(TIMING, ()):
+        kind, _, value = rte_timing.parse_line(line)
+        if kind == 'f' and value is not None and value != 'R':
+            return float(value)
+    return NAN
+
+
+class Dictionary:
+    """Strings indexed in the order of the first use."""
+
+    def __init__(self):
+        self.index = {}
+
+    def get(self, text):
+        i = self.index.get(text)
+        if i is None:
+            i = self.index[text] = len(self.index)
+        return i
+
+    def pack(self):
+        data = [struct.pack('<I', len(self.index))]
+        for text in self.index:
+            raw = text.encode('utf-8')[:0xFFFF]
+            data.append(struct.pack('<H', len(raw)) + raw)
+        return b''.join(data)
+
+
+class ColumnWriter:
+    """Writes the rows in row groups. The columns of the current group are kept in arrays."""
+
+    def __init__(self, f, frequency, rows):
+        self.f = f
+        self.frequency = frequency
+        self.max_rows = rows
+        self.messages = Dictionary()
+        self.objects = Dictionary()
+        self.offsets = []
+        self.rows = 0
+        f.write(HEADER.pack(MAGIC, VERSION, frequency, 0, 0, 0))
+        self.new_group()
+
+    def new_group(self):
+        self.value = array.array('d')
+        self.object = array.array('I')
+        self.args = [array.array('I') for _ in range(ARGS)]
+        self.delta = array.array('i')
+        self.msg = array.array('H')
+        self.core = array.array('B')
+        self.base = self.last = None
+
+    def row(self, t, msg, obj, args, value):
+        if self.base is not None and (len(self.msg) >= self.max_rows or not -(1 << 31) <= t - self.last < (1 << 31)):
+            self.flush()
+        if self.base is None:
+            self.base = self.last = t
+        self.value.append(value)
+        self.object.append(obj)
+        for column, arg in zip(self.args, args):
+            column.append(arg)
+        self.delta.append(t - self.last)
+        self.msg.append(msg)
+        self.core.append(0)
+        self.last = t
+
+    def flush(self):
+        rows = len(self.msg)
+        if not rows:
+            return
+        self.offsets.append(self.f.tell())
+        self.f.write(GROUP_HEADER.pack(rows, 0, self.base))
+        for column in [self.value, self.object] + self.args + [self.delta, self.msg, self.core]:
+            column.tofile(self.f)
+        self.f.write(bytes(-(rows * 3) % 8))        # u16 + u8 columns
+        self.rows += rows
+        self.new_group()
+
+    def close(self):
+        self.flush()
+        footer = self.f.tell()
+        self.f.write(array.array('Q', self.offsets).tobytes())
+        self.f.write(self.messages.pack())
+        self.f.write(self.objects.pack())
+        self.f.seek(0)
+        self.f.write(HEADER.pack(MAGIC, VERSION, self.frequency, len(self.offsets), 0, footer))
+
+
+class Exporter:
+    """Converts the messages to rows and collects the statistics of the selected messages."""
+
+    def __init__(self, writer, table, frequency, selected):
+        self.writer = writer
+        self.table = table
+        self.decoder = rte_decode.Decoder(table, frequency)
+        self.selected = set(selected)
+        self.stats = {}         # object name -> [count, min, max, sum]
+        self.kinds = {}         # message -> (dictionary index, object field, value decoded, selected)
+
+    def kind(self, msg):
+        kind = self.kinds.get(msg)
+        if kind is None:
+            kind = self.kinds[msg] = (self.writer.messages.get(msg.name), object_field(msg), has_value(msg),
+                                      msg.name in self.selected)
+        return kind
+
+    def message(self, id_field, data, t):
+        by_id = self.table.by_id
+        msg = by_id[id_field] if id_field < len(by_id) else None
+        if msg is None:
+            return
+        index, field, decoded, selected = self.kind(msg)
+        bits, _ = rte_decode.message_value(msg, id_field, data)
+        name = None
+        obj = NO_OBJECT
+        if field is not None:
+            name = rte_decode.as_string(bits >> field[0], field[1])
+            obj = self.writer.objects.get(name)
+        value = timing_value(self.decoder, id_field, data, t) if decoded else NAN
+        self.writer.row(t, index, obj, [(bits >> (32 * k)) & 0xFFFFFFFF for k in range(ARGS)], value)
+        if selected and not math.isnan(value):
+            s = self.stats.get(name)
+            if s is None:
+                self.stats[name] = [1, value, value, value]
+            else:
+                s[0] += 1
+                s[1] = min(s[1], value)
+                s[2] = max(s[2], value)
+                s[3] += value
+
+
+def format_stats(stats):
+    """Statistics table - the same format as printed by rte_colstat."""
+    lines = ['%-24s %10s %14s %14s %14s\n' % ('Object', 'Count', 'Min', 'Max', 'Mean')]
+    for name in sorted(stats, key=lambda n: (n is None, (n or '').encode('utf-8'))):
+        count, low, high, total = stats[name]
+        lines.append('%-24s %10u %14.3f %14.3f %14.3f\n' % ('-' if name is None else name, count, low, high,
+                                                          total / count))
+    return ''.join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Columnar export of the decoded messages of a binary capture.')
+    parser.add_argument('capture', help='binary capture file (header and circular buffer)')
+    parser.add_argument('fmt', nargs='+', help='format definition files and the generated rte_fmt_ids.h')
+    parser.add_argument('-o', '--output', default='RTOS_trace.col', help='output file (default: RTOS_trace.col)')
+    parser.add_argument('--rows', type=int, default=DEFAULT_ROWS,
+                        help='maximum number of rows of a row group (default: %u)' % DEFAULT_ROWS)
+    parser.add_argument('-m', '--message', action='append', default=[],
+                        help='statistics of the values of this message per object, '
+                             'e.g. MSG2_RTOS_QUEUE_SEND. Can be repeated')
+    parser.add_argument('--stats', help='statistics output file (default: standard output)')
+    args = parser.parse_args()
+
+    started = time.time()
+    try:
+        if not 1 <= args.rows <= MAX_ROWS:
+            raise ValueError('--rows must be 1 .. %u' % MAX_ROWS)
+        with open(args.capture, 'rb') as f:
+            cap = rte_capture.Capture(f)
+            table = rte_decode.FormatTable(args.fmt, cap.id_bits)
+            for name in args.message:
+                if name not in table.messages:
+                    raise ValueError('unknown message: %s' % name)
+            with open(args.output, 'wb', buffering=1 << 20) as out:
+                writer = ColumnWriter(out, cap.frequency, args.rows)
+                exporter = Exporter(writer, table, cap.frequency, args.message)
+                for id_field, data, t in rte_capture.messages(f, cap):
+                    if not rte_capture.is_long_timestamp(id_field, data):
+                        exporter.message(id_field, data, t)
+                writer.close()
+        if args.message:
+            text = format_stats(exporter.stats)
+            if args.stats:
+                with open(args.stats, 'w', encoding='utf-8', newline='\n') as out:
+                    out.write(text)
+            else:
+                sys.stdout.write(text)
+    except (OSError, ValueError) as e:
+        print('rte_columns: %s' % e, file=sys.stderr)
+        sys.exit(2)
+
+    print('rte_columns: %u rows, %u row groups, %u objects written to %s (%u bytes) in %.2f s' % (
+        writer.rows, len(writer.offsets), len(writer.objects.index), args.output, os.path.getsize(args.output),
+        time.time() - started))
+    sys.exit(0 if writer.rows else 1)
+
+
+if __name__ == '__main__':
+    main()
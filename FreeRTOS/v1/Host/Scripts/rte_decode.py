@@ -0,0 +1,333 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) Branko Premzel.
+#
+# SPDX-License-Identifier: MIT
+#
+
+"""
+@file    rte_decode.py
+@author  Branko Premzel
+@brief   Host decoder of the FreeRTOS trace messages - data words and the
+         format definitions (printf strings) of the messages.
+
+The host tools cannot run RTEmsg, so this module interprets the subset of the
+RTEmsg format definition syntax used by the FreeRTOS format files:
+ * // MSGx_NAME, // EXT_MSGx_y_NAME - message definitions,
+ * // >OUT "text" and // >>OUT "text" - format strings of output OUT,
+ * // MEMO(M_NAME) - memo values,
+ * // OUT_FILE(OUT, "file", "w", "header") - file name and header of output OUT,
+ * %[start:bitsT] and %[bitsT] - value of bits of the message (T: u - unsigned,
+   i - signed, f - float, s - string; default u), without [] - next 32 bits,
+ * %[M_NAME] - memo value, <M_NAME> after the value - store it to the memo,
+ * %[T] - time since the previous message with the same format ID [s],
+ * %[t-MSGx_NAME] - time since the last MSGx_NAME message [s],
+ * (*1000.), (+1), ... - scaling of the value,
+ * %{a|b|c}Y - text selected with the value,
+ * %N - message number, %t - time [ms], and the printf conversions
+   u, d, i, x, X, o, c, s, f, e and g with flags, width and precision
+   (ll - 64-bit value, e.g. %[0:64u]llu).
+
+The bit position of the values without an explicit start continues from the
+previous value of the same output in the same message. The data of EXT_MSGx_y
+messages is followed by the y extra bits from the format ID.
+"""
+
+import os
+import re
+import struct
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import rte_capture      # noqa: E402
+import rte_fmt_ids      # noqa: E402
+
+RE_MSG = re.compile(r'^//\s+((?:MSG(\d+)|MSGN|EXT_MSG(\d+)_(\d+))_\w+)')
+RE_OUTPUT = re.compile(r'^//\s+(>>?)(\w+)\s+"(.*)"\s*$')
+RE_MEMO = re.compile(r'^//\s+MEMO\(\s*(\w+)')
+RE_OUT_FILE = re.compile(r'^//\s+OUT_FILE\(\s*(\w+)\s*,\s*"([^"]*)"\s*,\s*"[^"]*"\s*(?:,\s*"(.*)")?\s*\)')
+RE_FIELD = re.compile(r'%(?:(%)|'
+                      r'(?:\[([^\]]*)\])?'          # value
+                      r'(?:<(\w+)>)?'               # memo store
+                      r'(?:\(([*/+-])([^)]*)\))?'   # scaling
+                      r'(?:\{([^}]*)\})?'           # selection list
+                      r'([-+ 0#]*\d*(?:\.\d+)?)'    # flags, width, precision
+                      r'(ll)?'                      # 64-bit value
+                      r'([udixXocsfegYNt]))')
+RE_BITS = re.compile(r'^(?:(\d+):)?(\d+)([uisf]?)$')
+ESCAPES = {'n': '\n', 't': '\t', 'r': '\r', '\\': '\\', '"': '"', "'": "'", '0': '\0'}
+
+
+def unescape(text):
+    return re.sub(r'\\(.)', lambda m: ESCAPES.get(m.group(1), m.group(1)), text)
+
+
+class Field:
+    """Compiled % specification of a format string."""
+
+    __slots__ = ('source', 'start', 'bits', 'type', 'name', 'store', 'op', 'operand',
+                 'select', 'spec', 'long', 'conv')
+
+    def __init__(self, m):
+        value, self.store, self.op, operand, select, self.spec, self.long, self.conv = m.groups()[1:]
+        self.start = None
+        self.bits = 32
+        self.type = 'u'
+        self.name = None
+        if not value:
+            self.source = {'N': 'number', 't': 'time'}.get(self.conv, 'bits')
+        elif value == 'T':
+            self.source = 'T'
+        elif value.startswith('t-'):
+            self.source, self.name = 't', value[2:]
+        elif RE_BITS.match(value):
+            start, bits, value_type = RE_BITS.match(value).groups()
+            self.source = 'bits'
+            self.start = int(start) if start is not None else None
+            self.bits = int(bits)
+            self.type = value_type or 'u'
+        else:
+            self.source, self.name = 'memo', value
+        self.operand = None
+        if self.op:
+            self.operand = float(operand) if re.search(r'[.eE]', operand) else int(operand)
+        self.select = select.split('|') if select is not None else None
+
+
+class Message:
+    """Format ID block, data size and format strings of one message."""
+
+    def __init__(self, name, match):
+        self.name = name
+        self.base = None
+        self.words = int(match.group(2)) if match.group(2) is not None else \
+            int(match.group(3)) if match.group(3) is not None else None
+        self.ext_bits = int(match.group(4)) if match.group(4) is not None else 0
+        self.lines = []         # (output, [text or Field])
+
+    def outputs(self):
+        return {output for output, _ in self.lines}
+
+    def stores(self):
+        """True if a format string stores a value to a memo."""
+        return any(isinstance(p, Field) and p.store for _, parts in self.lines for p in parts)
+
+
+def compile_format(text):
+    parts = []
+    pos = 0
+    for m in RE_FIELD.finditer(text):
+        if m.start() > pos:
+            parts.append(text[pos:m.start()])
+        parts.append('%' if m.group(1) else Field(m))
+        pos = m.end()
+    if pos < len(text):
+        parts.append(text[pos:])
+    return parts
+
+
+class FormatTable:
+    """Messages of the format definition files, indexed by the format ID field."""
+
+    def __init__(self, fmt_files, id_bits):
+        names, _, defined = rte_fmt_ids.parse(fmt_files)
+        ids = rte_fmt_ids.allocate(names, defined, id_bits)
+        self.messages = {}
+        self.memos = []
+        self.files = {}         # output -> (file name, header)
+        for file_name in fmt_files:
+            with open(file_name, encoding='utf-8', errors='replace') as f:
+                msg = None
+                for line in f:
+                    m = RE_MSG.match(line)
+                    if m:
+                        msg = self.messages.setdefault(m.group(1), Message(m.group(1), m))
+                        continue
+                    m = RE_OUTPUT.match(line)
+                    if m and msg is not None:
+                        msg.lines.append((m.group(2), compile_format(unescape(m.group(3)))))
+                        continue
+                    m = RE_MEMO.match(line)
+                    if m:
+                        self.memos.append(m.group(1))
+                        continue
+                    m = RE_OUT_FILE.match(line)
+                    if m:
+                        self.files[m.group(1)] = (m.group(2), unescape(m.group(3) or ''))
+
+        self.by_id = [None] * (1 << id_bits)
+        sizes = dict(names)
+        for name, msg in self.messages.items():
+            msg.base = defined.get(name, ids.get(name))
+            if msg.base is None:
+                continue
+            for i in range(msg.base, min(msg.base + sizes[name], len(self.by_id))):
+                self.by_id[i] = msg
+
+    def outputs(self):
+        found = set()
+        for msg in self.messages.values():
+            found |= msg.outputs()
+        return found
+
+
+def message_value(msg, id_field, data):
+    """Return the message data (data words and extra bits) as one integer and its size in bits."""
+    if msg.words is not None and msg.words <= 4:
+        top = id_field - msg.base
+        words = data
+    else:           # MSG5..MSG8, MSGN - the top bits are in the last data word
+        top = data[-1] >> 1 if data else 0
+        words = data[:-1]
+    value = 0
+    for k, word in enumerate(words):
+        value |= ((word >> 1) | (((top >> k) & 1) << 31)) << (32 * k)
+    bits = 32 * len(words)
+    if msg.ext_bits:
+        value |= ((id_field - msg.base) >> msg.words) << bits
+        bits += msg.ext_bits
+    return value, bits
+
+
+def as_string(value, bits=32):
+    """Text packed into an integer (first character in the lowest byte)."""
+    if not isinstance(value, int):
+        return str(value)
+    raw = (value & ((1 << bits) - 1)).to_bytes(max(1, (bits + 7) // 8), 'little')
+    return raw.split(b'\0', 1)[0].decode('latin-1')
+
+
+class Decoder:
+    """
+    Formats the messages of a capture. The memo values, the message numbers
+    and the times of the last messages are kept between the messages, so the
+    messages must be passed in the buffer order.
+    """
+
+    def __init__(self, table, frequency):
+        self.table = table
+        self.frequency = float(frequency) if frequency else 1.0
+        self.memos = {}
+        self.last_time = {}         # Format ID base -> timestamp
+        self.last_by_name = {}      # Message name -> timestamp
+        self.number = 0
+
+    def state(self):
+        """Copy of the state kept between the messages (see restore())."""
+        return {'number': self.number, 'memos': dict(self.memos), 'last_time': dict(self.last_time),
+                'last_by_name': dict(self.last_by_name)}
+
+    def restore(self, state):
+        self.number = state['number']
+        self.memos = dict(state['memos'])
+        self.last_time = dict(state['last_time'])
+        self.last_by_name = dict(state['last_by_name'])
+
+    def decode(self, id_field, data, timestamp, outputs):
+        """
+        Return (message, {output: [text of every format line]}) for the listed
+        outputs. The lines of other outputs are evaluated only for their memo
+        assignments.
+        """
+        msg = self.table.by_id[id_field] if id_field < len(self.table.by_id) else None
+        self.number += 1
+        if msg is None:
+            return None, {}
+        value, bits = message_value(msg, id_field, data)
+        result = {}
+        cursors = {}
+        for output, parts in msg.lines:
+            wanted = output in outputs
+            if not wanted and not any(isinstance(p, Field) and p.store for p in parts):
+                continue
+            pos = cursors.get(output, 0)
+            text = []
+            for part in parts:
+                if not isinstance(part, Field):
+                    text.append(part)
+                    continue
+                item, pos = self.field_value(part, msg, value, bits, pos, timestamp)
+                if part.store:
+                    self.memos[part.store] = item
+                if wanted:
+                    text.append(self.convert(part, item))
+            cursors[output] = pos
+            if wanted:
+                result.setdefault(output, []).append(''.join(text))
+        self.last_time[msg.base] = timestamp
+        self.last_by_name[msg.name] = timestamp
+        return msg, result
+
+    def field_value(self, field, msg, value, bits, pos, timestamp):
+        source = field.source
+        if source == 'bits':
+            start = field.start if field.start is not None else pos
+            raw = (value >> start) & ((1 << field.bits) - 1) if start < bits else 0
+            pos = start + field.bits
+            if field.type == 'i' and raw >> (field.bits - 1):
+                item = raw - (1 << field.bits)
+            elif field.type == 'f':
+                item = struct.unpack('<f', struct.pack('<I', raw & 0xFFFFFFFF))[0] if field.bits == 32 else \
+                    struct.unpack('<d', struct.pack('<Q', raw))[0]
+            elif field.type == 's':
+                item = as_string(raw, field.bits)
+            else:
+                item = raw
+        elif source == 'memo':
+            item = self.memos.get(field.name, 0)
+        elif source == 'T':
+            last = self.last_time.get(msg.base)
+            item = (timestamp - last) / self.frequency if last is not None else 0.0
+        elif source == 't':
+            last = self.last_by_name.get(field.name)
+            item = (timestamp - last) / self.frequency if last is not None else 0.0
+        elif source == 'number':
+            item = self.number
+        else:
+            item = timestamp * 1000.0 / self.frequency
+        if field.op and not isinstance(item, str):
+            if field.op == '*':
+                item = item * field.operand
+            elif field.op == '/':
+                item = item / field.operand if field.operand else 0.0
+            elif field.op == '+':
+                item = item + field.operand
+            else:
+                item = item - field.operand
+        return item, pos
+
+    @staticmethod
+    def convert(field, item):
+        conv = field.conv
+        if conv == 'Y':
+            index = int(item) if not isinstance(item, str) else -1
+            if field.select is not None and 0 <= index < len(field.select):
+                return field.select[index]
+            return str(item)
+        if conv == 's':
+            return ('%' + field.spec + 's') % as_string(item)
+        if isinstance(item, str):
+            return ('%' + field.spec + 's') % item
+        if conv in 'feg':
+            return ('%' + field.spec + conv) % float(item)
+        if conv == 't':
+            return ('%' + (field.spec or '.6') + 'f') % item
+        item = int(item)
+        size = 64 if field.long else 32
+        if conv in 'xXo' or conv == 'u':
+            item &= (1 << size) - 1
+            return ('%' + field.spec + ('d' if conv == 'u' else conv)) % item
+        if conv == 'c':
+            return chr(item & 0xFF)
+        if 1 << (size - 1) <= item < 1 << size:
+            item -= 1 << size
+        return ('%' + field.spec + 'd') % item
+
+
+def events(f, cap, table, outputs):
+    """Decode a capture - yield (timestamp, message, {output: [lines]}) for the listed outputs."""
+    decoder = Decoder(table, cap.frequency)
+    for id_field, data, timestamp in rte_capture.messages(f, cap):
+        msg, texts = decoder.decode(id_field, data, timestamp, outputs)
+        if texts:
+            yield timestamp, msg, texts
@@ -0,0 +1,284 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) Branko Premzel.
+#
+# SPDX-License-Identifier: MIT
+#
+
+"""
+@file    rte_fmt_ids.py
+@author  Branko Premzel
+@brief   Assign format IDs and filter numbers to the RTEdbg format definitions.
+
+On the target, the RTEmsg utility assigns the format IDs and filter numbers
+and writes the #define lines into the format definition files. The host build
+cannot run RTEmsg, so this script does the same job and writes all values
+into a single generated header (rte_fmt_ids.h) that the host version of
+"rtedbg.h" includes.
+
+Rules:
+ * A MSGn message (n = 0..4) occupies 2^n consecutive IDs, because the top bits
+   of the n data words are stored in the lowest bits of the format ID.
+ * MSG5..MSG8 and MSGN messages occupy 16 IDs.
+ * EXT_MSGx_y messages occupy 2^(x+y) IDs.
+ * Blocks are naturally aligned and allocated first-fit in declaration order.
+ * IDs 0 and 1 are reserved for the long timestamp message, the highest ID
+   is reserved for the empty buffer word (all bits set).
+ * Values already defined with #define in the format files (e.g. the Expert
+   definitions) are kept as they are and are not redefined.
+
+Dense ENTER/RETURN allocation (--pack-pairs, used for the Expert definitions):
+ * The two messages of an ENTER/RETURN pair share one naturally aligned block
+   of 2 * S IDs, where S is the size of the larger message. The larger message
+   is at the start of the block, the other one S IDs higher. The partner of a
+   message is therefore id ^ S - id ^ 1 for a pair of MSG0 messages.
+ * Pairs are allocated first, largest first, then the other messages. Smaller
+   blocks fill the gaps left by the larger ones, so the IDs stay dense.
+ * The #define values in the file are replaced with the new IDs. RTEmsg keeps
+   the defined values and allocates the other messages around them.
+ * --check-pairs only checks the existing values of a file.
+"""
+
+import argparse
+import re
+import sys
+
+RE_MSG = re.compile(r'^//\s+((?:MSG(\d+)|MSGN|EXT_MSG(\d+)_(\d+))_\w+)')
+RE_FILTER = re.compile(r'^//\s+FILTER\(\s*(\w+)\s*,')
+RE_DEFINE = re.compile(r'^#define\s+(\w+)\s+(\d+)U?\b')
+RE_PAIR = re.compile(r'^(?:MSG\d+|MSGN|EXT_MSG\d+_\d+)_(\w+)_(ENTER|RETURN)$')
+
+LONG_TIMESTAMP_IDS = 2      # IDs 0 and 1 (MSG1 size)
+FIRST_FILTER = 1            # Filter 0 is reserved for the RTEdbg system messages
+MAX_FILTERS = 32
+
+
+def message_size(match):
+    """Return the number of format IDs occupied by the message."""
+    if match.group(2) is not None:
+        words = int(match.group(2))
+        return 1 << words if words <= 4 else 16
+    if match.group(3) is not None:
+        return 1 << (int(match.group(3)) + int(match.group(4)))
+    return 16       # MSGN
+
+
+def parse(files):
+    """Collect message and filter declarations and existing #define values."""
+    messages = []
+    filters = []
+    defined = {}
+    for name in files:
+        with open(name, encoding='utf-8', errors='replace') as f:
+            for line in f:
+                m = RE_MSG.match(line)
+                if m:
+                    messages.append((m.group(1), message_size(m)))
+                    continue
+                m = RE_FILTER.match(line)
+                if m:
+                    filters.append(m.group(1))
+                    continue
+                m = RE_DEFINE.match(line)
+                if m:
+                    defined[m.group(1)] = int(m.group(2))
+    return messages, filters, defined
+
+
+def allocate(messages, defined, id_bits):
+    """First-fit allocation of naturally aligned ID blocks."""
+    top = 1 << id_bits
+    used = bytearray(top)
+    used[top - 1] = 1
+    for i in range(LONG_TIMESTAMP_IDS):
+        used[i] = 1
+
+    sizes = dict(messages)
+    for name, value in defined.items():
+        if name in sizes:
+            for i in range(value, min(value + sizes[name], top)):
+                used[i] = 1
+
+    ids = {}
+    for name, size in messages:
+        if name in defined or name in ids:
+            continue
+        for base in range(0, top, size):
+            if not any(used[base:base + size]):
+                break
+        else:
+            sys.exit("rte_fmt_ids: out of format IDs (RTE_FMT_ID_BITS = %u)" % id_bits)
+        used[base:base + size] = b'\x01' * size
+        ids[name] = base
+    return ids
+
+
+def allocate_filters(filters, defined):
+    taken = {v for k, v in defined.items() if k in filters}
+    numbers = {}
+    next_free = FIRST_FILTER
+    for name in filters:
+        if name in defined or name in numbers:
+            continue
+        while next_free in taken:
+            next_free += 1
+        if next_free >= MAX_FILTERS:
+            sys.exit("rte_fmt_ids: too many filters")
+        numbers[name] = next_free
+        taken.add(next_free)
+    return numbers
+
+
+def find_pairs(messages):
+    """Return a list of (ENTER name, RETURN name) tuples."""
+    found = {}
+    for name, _ in messages:
+        m = RE_PAIR.match(name)
+        if m:
+            found.setdefault(m.group(1), {})[m.group(2)] = name
+    return [(p['ENTER'], p['RETURN']) for p in found.values() if len(p) == 2]
+
+
+def allocate_pairs(messages, id_bits, first_id):
+    """Dense allocation with the ENTER/RETURN pairs at id ^ S - see the file header."""
+    top = 1 << id_bits
+    used = bytearray(top)
+    used[top - 1] = 1
+    used[:first_id] = b'\x01' * first_id
+    sizes = dict(messages)
+
+    units = []      # (alignment, [(name, offset in the block)])
+    paired = set()
+    for enter, ret in find_pairs(messages):
+        big, small = (enter, ret) if sizes[enter] >= sizes[ret] else (ret, enter)
+        units.append((2 * sizes[big], [(big, 0), (small, sizes[big])]))
+        paired.update((enter, ret))
+    for name, size in messages:
+        if name not in paired:
+            units.append((size, [(name, 0)]))
+    units.sort(key=lambda u: -u[0])     # Stable - declaration order for the same size
+
+    ids = {}
+    for alignment, parts in units:
+        for base in range(first_id - first_id % alignment, top, alignment):
+            if base >= first_id and not any(any(used[base + offset:base + offset + sizes[name]])
+                                             for name, offset in parts):
+                break
+        else:
+            sys.exit("rte_fmt_ids: out of format IDs (RTE_FMT_ID_BITS = %u)" % id_bits)
+        for name, offset in parts:
+            used[base + offset:base + offset + sizes[name]] = b'\x01' * sizes[name]
+            ids[name] = base + offset
+    return ids
+
+
+def check_pairs(messages, ids):
+    """Return the list of errors - overlapping or misaligned blocks and pairs not at id ^ S."""
+    sizes = dict(messages)
+    errors = []
+    owner = {}
+    for name, size in messages:
+        if name not in ids:
+            errors.append('%s: no ID' % name)
+            continue
+        if ids[name] % size:
+            errors.append('%s: ID %u is not aligned to %u' % (name, ids[name], size))
+        for i in range(ids[name], ids[name] + size):
+            if i in owner:
+                errors.append('%s: ID %u is also used by %s' % (name, i, owner[i]))
+            owner[i] = name
+    for enter, ret in find_pairs(messages):
+        if enter in ids and ret in ids:
+            s = max(sizes[enter], sizes[ret])
+            if ids[enter] ^ s != ids[ret]:
+                errors.append('%s (%u) / %s (%u): not a pair (id ^ %u)' % (enter, ids[enter], ret, ids[ret], s))
+    return errors
+
+
+def rewrite_defines(file_name, ids):
+    """Replace the #define values in a format definition file."""
+    with open(file_name, encoding='utf-8', newline='') as f:
+        text = f.read()
+
+    def replace(m):
+        return '#define %s %uU' % (m.group(1), ids[m.group(1)]) if m.group(1) in ids else m.group(0)
+
+    new_text = re.sub(r'^#define[ \t]+(\w+)[ \t]+\d+U?\b', replace, text, flags=re.M)
+    if new_text != text:
+        with open(file_name, 'w', encoding='utf-8', newline='') as f:
+            f.write(new_text)
+
+
+def pairs_main(args):
+    messages, _, defined = parse([args.file])
+    if args.check_pairs:
+        errors = check_pairs(messages, defined)
+        for e in errors:
+            print('rte_fmt_ids: %s' % e, file=sys.stderr)
+        sys.exit(1 if errors else 0)
+
+    first_id = args.first
+    if first_id is None:
+        values = [defined[name] for name, _ in messages if name in defined]
+        first_id = min(values) if values else LONG_TIMESTAMP_IDS
+    ids = allocate_pairs(messages, args.id_bits, first_id)
+    rewrite_defines(args.file, ids)
+    last = max(ids[name] + size for name, size in messages) - 1
+    print('rte_fmt_ids: %u messages, %u pairs, IDs %u..%u' % (len(messages), len(find_pairs(messages)),
+                                                              min(ids.values()), last))
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Assign RTEdbg format IDs and filter numbers.')
+    parser.add_argument('-o', '--output', help='generated header')
+    parser.add_argument('-b', '--id-bits', type=int, default=12, help='RTE_FMT_ID_BITS')
+    parser.add_argument('--pack-pairs', dest='file',
+                        help='renumber the #define values of a file densely with ENTER/RETURN pairs at id ^ S')
+    parser.add_argument('--check-pairs', metavar='FILE',
+                        help='check the ENTER/RETURN pairs and the blocks of a file')
+    parser.add_argument('--first', type=int, help='first ID for --pack-pairs (default: lowest defined ID)')
+    parser.add_argument('files', nargs='*', help='format definition files')
+    args = parser.parse_args()
+
+    if args.check_pairs:
+        args.file = args.check_pairs
+    if args.file:
+        pairs_main(args)
+        return
+    if not args.output or not args.files:
+        parser.error('the generated header (-o) and the format definition files are required')
+
+    messages, filters, defined = parse(args.files)
+    ids = allocate(messages, defined, args.id_bits)
+    filter_numbers = allocate_filters(filters, defined)
+
+    out = []
+    out.append('/* Generated by rte_fmt_ids.py - do not edit. */')
+    out.append('#ifndef RTE_FMT_IDS_H')
+    out.append('#define RTE_FMT_IDS_H')
+    out.append('')
+    out.append('/* Filter numbers */')
+    for name in filters:
+        if name in filter_numbers:
+            out.append('#define %-50s %uU' % (name, filter_numbers[name]))
+    out.append('')
+    out.append('/* Format IDs */')
+    for name, _ in messages:
+        if name in ids:
+            out.append('#define %-50s %uU' % (name, ids[name]))
+    out.append('')
+    out.append('#endif  // RTE_FMT_IDS_H')
+    text = '\n'.join(out) + '\n'
+
+    try:
+        with open(args.output, encoding='utf-8') as f:
+            if f.read() == text:
+                return
+    except OSError:
+        pass
+    with open(args.output, 'w', encoding='utf-8') as f:
+        f.write(text)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,560 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) Branko Premzel.
+#
+# SPDX-License-Identifier: MIT
+#
+
+"""
+@file    rte_fst.py
+@author  Branko Premzel
+@brief   RTOS timing signals of a binary capture written directly to a
+         GTKWave FST file (compressed alternative to RTOS_timing.vcd).
+
+The capture is decoded with the format definitions (see rte_decode.py) and
+all signals of the RTOS_TIMING lines are written to an FST file - the same
+signals as in RTOS_timing.vcd. FST stores the value changes of every signal
+separately and compressed, so the file is much smaller than the text VCD
+and GTKWave opens it without parsing the whole file.
+
+FST file layout (blocks: type byte, 64-bit big-endian length, data):
+ * header (0) - start/end time, counts of signals and blocks, timescale,
+ * value change blocks (1) - written every --block value changes, so the
+   memory used does not depend on the capture size. Values at the start of
+   the block, the zlib compressed changes of every signal, the offsets of
+   the signals and the zlib compressed time table,
+ * geometry (3) - size of every signal (0 - real, 0xFFFFFFFF - string),
+ * hierarchy (4) - gzip compressed scope and signal declarations.
+The signals are declared when they first appear, so the geometry and the
+hierarchy are written at the end, as by the GTKWave FST writer.
+
+--vcd also writes the same signals to a text VCD file. The sizes of both
+files are printed, and with --min-ratio the exit code is 1 if the VCD file
+is not at least that many times larger than the FST file. --dump converts an
+FST file written by this script back to VCD (to --vcd or stdout) - for
+installations without the GTKWave fst2vcd utility and for the tests: the
+dump of the FST file is identical to the VCD file written with --vcd.
+
+--gtkwave FST VCD checks the FST file with the GTKWave reader: fst2vcd
+(libfst) converts it to VCD, and the value changes of every signal must be
+the same as in the VCD file written with --vcd. The text of the two VCD
+files is different (signal codes, number formats, initial values), so the
+changes are compared per signal name - the last value at every time, without
+the changes to the same value and to the initial value (x, 0.0, '').
+
+Exit code: 0 - OK, 1 - no RTOS timing signals found, the files are different
+or the size ratio is too small, 2 - file or argument error, 77 - fst2vcd not
+found (--gtkwave, the test is skipped). In a CI build (environment variable CI
+set, e.g. CI=true) a missing fst2vcd is an error (exit code 1), so the FST
+files are always checked with libfst there.
+"""
+
+import argparse
+import gzip
+import os
+import shutil
+import struct
+import subprocess
+import sys
+import zlib
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import rte_capture      # noqa: E402
+import rte_decode       # noqa: E402
+import rte_timing       # noqa: E402
+
+BL_HDR = 0
+BL_VCDATA = 1
+BL_GEOM = 3
+BL_HIER = 4
+ST_VCD_SCOPE = 254
+ST_VCD_UPSCOPE = 255
+SCOPE_MODULE = 0
+VT_REAL = 3
+VT_WIRE = 16
+VT_STRING = 21
+VD_IMPLICIT = 0
+DOUBLE_ENDTEST = 2.7182818284590452354
+HDR_VERSION_SIZE = 128
+HDR_DATE_SIZE = 119
+HDR_SIZE = 329
+VARLEN = 0xFFFFFFFF
+RCV_STR = 'xzhuwl-?'
+DEFAULT_BLOCK = 1 << 20
+VAR_TYPES = {'b': VT_WIRE, 'f': VT_REAL, 's': VT_STRING}
+KINDS = {VT_WIRE: 'b', VT_REAL: 'f', VT_STRING: 's'}
+EXIT_SKIPPED = 77           # CTest SKIP_RETURN_CODE
+
+
+def varint(value):
+    out = bytearray()
+    while value > 0x7F:
+        out.append((value & 0x7F) | 0x80)
+        value >>= 7
+    out.append(value)
+    return out
+
+
+def read_varint(data, pos):
+    value = 0
+    shift = 0
+    while True:
+        byte = data[pos]
+        pos += 1
+        value |= (byte & 0x7F) << shift
+        if byte < 0x80:
+            return value, pos
+        shift += 7
+
+
+def compressed(data):
+    """zlib compressed data if it is shorter, otherwise the data as it is."""
+    packed = zlib.compress(bytes(data), 4)
+    return packed if len(packed) < len(data) else bytes(data)
+
+
+def block(block_type, payload):
+    return struct.pack('>BQ', block_type, len(payload) + 8) + payload
+
+
+class FstWriter:
+    """FST writer with the same interface as rte_timing.VcdWriter."""
+
+    def __init__(self, f, exponent, date='', version='', scope='RTOS', block_changes=DEFAULT_BLOCK):
+        self.f = f
+        self.exponent = exponent
+        self.date = date
+        self.version = version
+        self.scope = scope
+        self.block_changes = block_changes
+        self.signals = []           # (name, kind)
+        self.values = []            # current value of every signal
+        self.start_values = []      # values at the start of the block
+        self.chains = {}            # handle -> [encoded changes, time index of the last change]
+        self.times = []
+        self.changes = 0
+        self.blocks = 0
+        self.start_time = None
+        self.end_time = 0
+        self.f.write(b'\0' * (HDR_SIZE + 1))    # Written again when the file is closed
+
+    def declare(self, name, kind):
+        self.signals.append((name, kind))
+        initial = 'x' if kind == 'b' else 0.0 if kind == 'f' else ''
+        self.values.append(initial)
+        self.start_values.append(initial)
+        return len(self.signals)
+
+    def change(self, time, handle, value):
+        if not self.times or time != self.times[-1]:
+            if self.changes >= self.block_changes:
+                self.flush()
+            self.times.append(time)
+            if self.start_time is None:
+                self.start_time = time
+            self.end_time = time
+        index = len(self.times) - 1
+        chain = self.chains.get(handle)
+        if chain is None:
+            chain = self.chains[handle] = [bytearray(), 0]
+        delta = index - chain[1]
+        chain[1] = index
+        data = chain[0]
+        kind = self.signals[handle - 1][1]
+        if kind == 'b':
+            if value in ('0', '1'):
+                data += varint((delta << 2) | ((value == '1') << 1))
+            else:
+                data += varint((delta << 4) | (RCV_STR.index(value) << 1) | 1)
+        elif kind == 'f':
+            data += varint((delta << 1) | 1)
+            data += struct.pack('=d', value)
+        else:
+            text = value.encode('utf-8')
+            data += varint((delta << 1) | 1)
+            data += varint(len(text))
+            data += text
+        self.values[handle - 1] = value
+        self.changes += 1
+
+    def flush(self):
+        """Write the value changes collected so far as a value change block."""
+        if not self.times:
+            return
+        frame = bytearray()
+        for (_, kind), value in zip(self.signals, self.start_values):
+            if kind == 'b':
+                frame += value.encode('ascii')
+            elif kind == 'f':
+                frame += struct.pack('=d', value)
+        packed_frame = compressed(frame)
+
+        waves = bytearray(b'Z')
+        positions = []
+        memory = 0
+        for handle in range(1, len(self.signals) + 1):
+            chain = self.chains.get(handle)
+            if chain is None:
+                positions.append(0)
+                continue
+            positions.append(len(waves))
+            data = chain[0]
+            packed = compressed(data)
+            waves += varint(len(data) if len(packed) < len(data) else 0)
+            waves += packed
+            memory += len(data)
+
+        table = bytearray()
+        previous = 0
+        zeros = 0
+        for position in positions:
+            if position == 0:
+                zeros += 1
+                continue
+            if zeros:
+                table += varint(zeros << 1)
+                zeros = 0
+            table += varint(((position - previous) << 1) | 1)
+            previous = position
+        if zeros:
+            table += varint(zeros << 1)
+
+        time_table = bytearray()
+        previous = 0
+        for t in self.times:
+            time_table += varint(t - previous)
+            previous = t
+        packed_times = compressed(time_table)
+
+        payload = bytearray(struct.pack('>QQQ', self.times[0], self.times[-1], memory))
+        payload += varint(len(frame)) + varint(len(packed_frame)) + varint(len(self.signals))
+        payload += packed_frame
+        payload += varint(len(self.signals))
+        payload += waves
+        payload += table
+        payload += struct.pack('>Q', len(table))
+        payload += packed_times
+        payload += struct.pack('>QQQ', len(time_table), len(packed_times), len(self.times))
+        self.f.write(block(BL_VCDATA, payload))
+
+        self.blocks += 1
+        self.start_values = list(self.values)
+        self.chains = {}
+        self.times = []
+        self.changes = 0
+
+    def close(self):
+        self.flush()
+        geometry = bytearray()
+        for _, kind in self.signals:
+            geometry += varint(1 if kind == 'b' else 0 if kind == 'f' else VARLEN)
+        packed = compressed(geometry)
+        self.f.write(block(BL_GEOM, struct.pack('>QQ', len(geometry), len(self.signals)) + packed))
+
+        hierarchy = bytearray([ST_VCD_SCOPE, SCOPE_MODULE]) + self.scope.encode('utf-8') + b'\0\0'
+        for name, kind in self.signals:
+            hierarchy += bytes([VAR_TYPES[kind], VD_IMPLICIT]) + name.encode('utf-8') + b'\0'
+            hierarchy += varint(1 if kind == 'b' else 8 if kind == 'f' else 0) + varint(0)
+        hierarchy.append(ST_VCD_UPSCOPE)
+        self.f.write(block(BL_HIER, struct.pack('>Q', len(hierarchy)) + gzip.compress(bytes(hierarchy), 4)))
+
+        header = struct.pack('>QQ', self.start_time or 0, self.end_time)
+        header += struct.pack('=d', DOUBLE_ENDTEST)
+        header += struct.pack('>QQQQQ', 0, 1, len(self.signals), len(self.signals), self.blocks)
+        header += struct.pack('>b', self.exponent)
+        header += self.version.encode('utf-8')[:HDR_VERSION_SIZE - 1].ljust(HDR_VERSION_SIZE, b'\0')
+        header += self.date.encode('utf-8')[:HDR_DATE_SIZE - 1].ljust(HDR_DATE_SIZE, b'\0')
+        header += struct.pack('>Bq', 0, 0)
+        self.f.seek(0, os.SEEK_SET)
+        self.f.write(block(BL_HDR, header))
+        self.f.seek(0, os.SEEK_END)
+
+
+class FstReader:
+    """Reader of the FST files written by FstWriter (block types 0, 1, 3 and 4)."""
+
+    def __init__(self, f):
+        self.data = f.read()
+        self.blocks = []
+        pos = 0
+        while pos + 9 <= len(self.data):
+            block_type, length = struct.unpack_from('>BQ', self.data, pos)
+            if length < 8 or pos + 1 + length > len(self.data):
+                raise ValueError('damaged FST file (block at offset %u)' % pos)
+            self.blocks.append((block_type, pos + 9, pos + 1 + length))
+            pos += 1 + length
+        headers = [b for b in self.blocks if b[0] == BL_HDR]
+        if not headers:
+            raise ValueError('not an FST file')
+        start = headers[0][1]
+        self.exponent = struct.unpack_from('>b', self.data, start + 64)[0]
+        self.version = self.field(start + 65, HDR_VERSION_SIZE)
+        self.date = self.field(start + 65 + HDR_VERSION_SIZE, HDR_DATE_SIZE)
+        self.signals = self.hierarchy()
+
+    def field(self, pos, size):
+        return self.data[pos:pos + size].split(b'\0', 1)[0].decode('utf-8', 'replace')
+
+    def payload(self, block_type):
+        for b in self.blocks:
+            if b[0] == block_type:
+                return self.data[b[1]:b[2]]
+        raise ValueError('FST block %u not found' % block_type)
+
+    def hierarchy(self):
+        data = gzip.decompress(self.payload(BL_HIER)[8:])
+        signals = []
+        pos = 0
+        while pos < len(data):
+            tag = data[pos]
+            pos += 1
+            if tag == ST_VCD_SCOPE:
+                pos = data.index(b'\0', data.index(b'\0', pos + 1) + 1) + 1
+            elif tag == ST_VCD_UPSCOPE:
+                continue
+            else:
+                end = data.index(b'\0', pos + 1)
+                name = data[pos + 1:end].decode('utf-8', 'replace')
+                _, pos = read_varint(data, end + 1)
+                _, pos = read_varint(data, pos)
+                if tag not in KINDS:
+                    raise ValueError('unsupported FST signal type %u' % tag)
+                signals.append((name, KINDS[tag]))
+        return signals
+
+    def changes(self):
+        """Yield (time, handle, value) of all value changes, ordered by time and handle."""
+        for block_type, start, end in self.blocks:
+            if block_type == BL_VCDATA:
+                yield from self.block_changes(self.data[start:end])
+
+    def block_changes(self, data):
+        ulen, clen, items = struct.unpack_from('>QQQ', data, len(data) - 24)
+        times_raw = data[len(data) - 24 - clen:len(data) - 24]
+        times_raw = zlib.decompress(times_raw) if clen != ulen else times_raw
+        times = []
+        pos = 0
+        t = 0
+        for _ in range(items):
+            delta, pos = read_varint(times_raw, pos)
+            t += delta
+            times.append(t)
+
+        table_end = len(data) - 24 - clen - 8
+        table_len = struct.unpack_from('>Q', data, table_end)[0]
+        table = data[table_end - table_len:table_end]
+
+        pos = 24
+        frame_ulen, pos = read_varint(data, pos)
+        frame_clen, pos = read_varint(data, pos)
+        _, pos = read_varint(data, pos)
+        pos += frame_clen
+        handles, pos = read_varint(data, pos)
+        waves_start = pos
+        waves_end = table_end - table_len
+
+        positions = []
+        tpos = 0
+        previous = 0
+        while tpos < len(table):
+            value, tpos = read_varint(table, tpos)
+            if value & 1:
+                previous += value >> 1
+                positions.append(previous)
+            else:
+                positions += [0] * (value >> 1)
+        if len(positions) != handles:
+            raise ValueError('damaged FST value change block')
+
+        ends = sorted(p for p in positions if p) + [waves_end - waves_start]
+        changes = []
+        for handle, position in enumerate(positions, 1):
+            if not position:
+                continue
+            chain_end = ends[ends.index(position) + 1]
+            ulen, cpos = read_varint(data, waves_start + position)
+            raw = data[cpos:waves_start + chain_end]
+            raw = zlib.decompress(raw) if ulen else raw
+            kind = self.signals[handle - 1][1]
+            index = 0
+            p = 0
+            while p < len(raw):
+                code, p = read_varint(raw, p)
+                if kind == 'b':
+                    if code & 1:
+                        index += code >> 4
+                        value = RCV_STR[(code >> 1) & 7]
+                    else:
+                        index += code >> 2
+                        value = '1' if code & 2 else '0'
+                elif kind == 'f':
+                    index += code >> 1
+                    value = struct.unpack_from('=d', raw, p)[0]
+                    p += 8
+                else:
+                    index += code >> 1
+                    size, p = read_varint(raw, p)
+                    value = raw[p:p + size].decode('utf-8', 'replace')
+                    p += size
+                changes.append((times[index], handle, len(changes), value))
+        changes.sort()
+        for t, handle, _, value in changes:
+            yield t, handle, value
+
+
+def dump(fst_name, out):
+    with open(fst_name, 'rb') as f:
+        reader = FstReader(f)
+    writer = rte_timing.VcdWriter(out, reader.exponent, reader.date, reader.version)
+    for name, kind in reader.signals:
+        writer.declare(name, kind)
+    for t, handle, value in reader.changes():
+        writer.change(t, handle, value)
+    writer.close()
+
+
+def read_vcd(lines):
+    """Return {signal name: [(time, value)]} of a VCD file, normalized for comparison."""
+    names = {}
+    kinds = {}
+    changes = {}
+    time = 0
+    for line in lines:
+        line = line.strip()
+        if line.startswith('$var'):
+            fields = line.split()
+            names[fields[3]] = fields[4]
+            kinds[fields[4]] = 'f' if fields[1] == 'real' else 's' if fields[1] == 'string' else 'b'
+        elif line.startswith('#'):
+            time = int(line[1:])
+        elif not line or line.startswith('$'):
+            continue
+        elif line[0] in 'rsb':
+            text, code = line[1:].rsplit(' ', 1)
+            changes.setdefault(names[code], {})[time] = text
+        else:
+            changes.setdefault(names[line[1:]], {})[time] = line[0]
+
+    signals = {}
+    for name, kind in kinds.items():
+        previous = 'x' if kind == 'b' else 0.0 if kind == 'f' else ''
+        values = []
+        for t, text in sorted(changes.get(name, {}).items()):
+            value = float(text) if kind == 'f' else text
+            if value != previous:
+                values.append((t, value))
+                previous = value
+        signals[name] = values
+    return signals
+
+
+def gtkwave_check(fst_name, vcd_name, fst2vcd):
+    """Compare the fst2vcd conversion of an FST file with a VCD file - see the file header."""
+    program = fst2vcd or shutil.which('fst2vcd')
+    if not program:
+        if os.environ.get('CI', '').lower() not in ('', '0', 'false'):
+            print('rte_fst: fst2vcd (GTKWave) not found - required in the CI build', file=sys.stderr)
+            sys.exit(1)
+        print('rte_fst: fst2vcd (GTKWave) not found - check skipped')
+        sys.exit(EXIT_SKIPPED)
+    result = subprocess.run([program, fst_name], stdout=subprocess.PIPE, stderr=subprocess.PIPE,
+                            encoding='utf-8', errors='replace', check=False)
+    if result.returncode != 0:
+        print('rte_fst: %s %s failed: %s' % (program, fst_name, result.stderr.strip()), file=sys.stderr)
+        sys.exit(1)
+    gtkwave = read_vcd(result.stdout.splitlines())
+    with open(vcd_name, encoding='utf-8') as f:
+        expected = read_vcd(f)
+
+    errors = 0
+    for name in sorted(set(gtkwave) | set(expected)):
+        a = gtkwave.get(name)
+        b = expected.get(name)
+        if a == b:
+            continue
+        errors += 1
+        if a is None or b is None:
+            print('%s: only in %s' % (name, vcd_name if a is None else 'the fst2vcd output'))
+            continue
+        i = next((i for i, (x, y) in enumerate(zip(a, b)) if x != y), min(len(a), len(b)))
+        print('%s: change %u - fst2vcd %s, %s %s' % (name, i, a[i] if i < len(a) else 'end',
+                                                     vcd_name, b[i] if i < len(b) else 'end'))
+    changes = sum(len(v) for v in expected.values())
+    print('rte_fst: %u signals, %u value changes - %s' % (len(expected), changes,
+                                                          'same as fst2vcd' if not errors else 'DIFFERENT'))
+    sys.exit(1 if errors else 0)
+
+
+def main():
+    parser = argparse.ArgumentParser(description='RTOS timing signals of a capture written to a GTKWave FST file.')
+    parser.add_argument('capture', nargs='?', help='binary capture file (header and circular buffer)')
+    parser.add_argument('fmt', nargs='*', help='format definition files and the generated rte_fmt_ids.h')
+    parser.add_argument('-o', '--output', default='RTOS_timing.fst', help='FST file (default: RTOS_timing.fst)')
+    parser.add_argument('--vcd', help='also write the signals to this VCD file')
+    parser.add_argument('--block', type=int, default=DEFAULT_BLOCK,
+                        help='value changes per FST block (default: %u)' % DEFAULT_BLOCK)
+    parser.add_argument('--min-ratio', type=float,
+                        help='minimum VCD to FST file size ratio (with --vcd)')
+    parser.add_argument('--dump', metavar='FST', help='convert an FST file to VCD (written to --vcd or stdout)')
+    parser.add_argument('--gtkwave', nargs=2, metavar=('FST', 'VCD'),
+                        help='compare the fst2vcd (GTKWave) conversion of an FST file with a VCD file')
+    parser.add_argument('--fst2vcd', help='fst2vcd program for --gtkwave (default: search PATH)')
+    args = parser.parse_args()
+
+    if args.gtkwave:
+        try:
+            gtkwave_check(args.gtkwave[0], args.gtkwave[1], args.fst2vcd)
+        except (OSError, ValueError, KeyError, IndexError) as e:
+            print('rte_fst: %s' % e, file=sys.stderr)
+            sys.exit(2)
+
+    if args.dump:
+        try:
+            if args.vcd:
+                with open(args.vcd, 'w', encoding='utf-8', newline='\n') as out:
+                    dump(args.dump, out)
+            else:
+                dump(args.dump, sys.stdout)
+        except (OSError, ValueError, zlib.error) as e:
+            print('rte_fst: %s' % e, file=sys.stderr)
+            sys.exit(2)
+        return
+    if not args.capture or not args.fmt:
+        parser.error('the capture and the format definition files are required')
+
+    try:
+        with open(args.capture, 'rb') as f:
+            cap = rte_capture.Capture(f)
+            table = rte_decode.FormatTable(args.fmt, cap.id_bits)
+            exponent, _ = rte_timing.timescale(cap.frequency)
+            date, version = rte_timing.file_info(args.capture, 'rte_fst.py')
+            files = [open(args.output, 'wb')]
+            writers = [FstWriter(files[0], exponent, date, version, block_changes=max(1, args.block))]
+            if args.vcd:
+                files.append(open(args.vcd, 'w', encoding='utf-8', newline='\n'))
+                writers.append(rte_timing.VcdWriter(files[1], exponent, date, version,
+                                                    spool_dir=os.path.dirname(os.path.abspath(args.vcd))))
+            signals = rte_timing.export(f, cap, table, writers)
+            for out in files:
+                out.close()
+    except (OSError, ValueError) as e:
+        print('rte_fst: %s' % e, file=sys.stderr)
+        sys.exit(2)
+
+    if not signals[0].signals:
+        print('rte_fst: no RTOS timing signals in %s' % args.capture, file=sys.stderr)
+        sys.exit(1)
+    fst_size = os.path.getsize(args.output)
+    print('rte_fst: %u signals, %u value change blocks, %u bytes written to %s' % (
+        len(writers[0].signals), writers[0].blocks, fst_size, args.output))
+    if args.vcd:
+        ratio = os.path.getsize(args.vcd) / max(1, fst_size)
+        print('rte_fst: VCD %u bytes - %.1f times the FST size' % (os.path.getsize(args.vcd), ratio))
+        if args.min_ratio is not None and ratio < args.min_ratio:
+            print('rte_fst: the FST file is not %.1f times smaller than the VCD file' % args.min_ratio,
+                  file=sys.stderr)
+            sys.exit(1)
+
+
+if __name__ == '__main__':
+    main()
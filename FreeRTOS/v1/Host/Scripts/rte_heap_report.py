@@ -0,0 +1,171 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) Branko Premzel.
+#
+# SPDX-License-Identifier: MIT
+#
+
+"""
+@file    rte_heap_report.py
+@author  Branko Premzel
+@brief   Leak and fragmentation report from the heap profiler summaries.
+
+The heap profiler (RTE_TRACE_RTOS_HEAP_PROFILE) logs periodic summaries
+instead of every malloc/free call. RTEmsg writes them to RTOS_heap.csv:
+  S;time;live;peak;allocs;frees;failed;untracked    totals
+  H;time;c0;...;c15                                 size class histogram
+  F;time;free;largest;min_ever_free                 free space (optional)
+  A;time;site;live_count;live_bytes;allocs;age      allocation site
+The age is the age of the oldest live allocation of the site [ticks].
+
+A site is reported as a leak suspect if its live bytes grow over the
+summaries (positive trend, last value is the highest and higher than the
+first one). Sites with old live allocations are reported as long-lived.
+"""
+
+import argparse
+import subprocess
+import sys
+
+SIZE_CLASSES = 16
+
+
+def parse(file_name):
+    totals, histogram, free_space, sites = [], [0] * SIZE_CLASSES, [], {}
+    with open(file_name, encoding='utf-8', errors='replace') as f:
+        for line in f:
+            fields = line.strip().split(';')
+            if len(fields) < 3:
+                continue
+            try:
+                time = float(fields[1])
+                values = [int(v, 0) for v in fields[2:]]
+            except ValueError:
+                continue        # Header or damaged line
+            kind = fields[0]
+            if kind == 'S' and len(values) >= 6:
+                totals.append((time, values))
+            elif kind == 'H' and len(values) >= SIZE_CLASSES:
+                for i in range(SIZE_CLASSES):
+                    histogram[i] += values[i]
+            elif kind == 'F' and len(values) >= 3:
+                free_space.append((time, values))
+            elif kind == 'A' and len(values) >= 5:
+                sites.setdefault(values[0], []).append((time, values[1:]))
+    return totals, histogram, free_space, sites
+
+
+def trend(samples):
+    """Least squares slope of (time, value) samples [value per time unit]."""
+    n = len(samples)
+    if n < 2:
+        return 0.0
+    mean_t = sum(t for t, _ in samples) / n
+    mean_v = sum(v for _, v in samples) / n
+    den = sum((t - mean_t) ** 2 for t, _ in samples)
+    if den == 0:
+        return 0.0
+    return sum((t - mean_t) * (v - mean_v) for t, v in samples) / den
+
+
+def resolve(addresses, elf):
+    """Map return addresses to 'function file:line' with addr2line."""
+    if not elf or not addresses:
+        return {}
+    # The return address points after the call instruction
+    args = ['addr2line', '-f', '-C', '-e', elf] + ['0x%X' % max(a - 1, 0) for a in addresses]
+    try:
+        out = subprocess.run(args, capture_output=True, text=True, check=True).stdout.splitlines()
+    except (OSError, subprocess.CalledProcessError):
+        return {}
+    return {a: '%s %s' % (out[2 * i], out[2 * i + 1]) for i, a in enumerate(addresses) if 2 * i + 1 < len(out)}
+
+
+def class_range(i):
+    if i == 0:
+        return '0-15'
+    if i == SIZE_CLASSES - 1:
+        return '>=%u' % (1 << (i + 3))
+    return '%u-%u' % (1 << (i + 3), (1 << (i + 4)) - 1)
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Heap leak and fragmentation report.')
+    parser.add_argument('csv', help='RTOS_heap.csv written by RTEmsg')
+    parser.add_argument('--tick-hz', type=float, default=1000.0, help='configTICK_RATE_HZ')
+    parser.add_argument('--age', type=float, default=10.0,
+                        help='report sites with live allocations older than this [s]')
+    parser.add_argument('--min-samples', type=int, default=3,
+                        help='min. number of summaries for the leak trend')
+    parser.add_argument('--elf', help='firmware ELF file for addr2line')
+    args = parser.parse_args()
+
+    totals, histogram, free_space, sites = parse(args.csv)
+    if not totals:
+        sys.exit('rte_heap_report: no heap summaries in %s' % args.csv)
+
+    out = []
+    first_t, last_t = totals[0][0], totals[-1][0]
+    live, peak, allocs, frees, failed, untracked = totals[-1][1][:6]
+    out.append('Heap profiler report - %u summaries, time %.3f .. %.3f' % (len(totals), first_t, last_t))
+    out.append('  live %u bytes, peak %u bytes, %u allocations, %u frees, %u failed'
+               % (live, peak, allocs, frees, failed))
+    if untracked:
+        out.append('  WARNING: %u allocations were not tracked - increase RTE_RTOS_HEAP_ALLOCS.' % untracked)
+
+    total = sum(histogram)
+    out.append('')
+    out.append('Allocation size distribution [bytes]')
+    for i, count in enumerate(histogram):
+        if count:
+            bar = '#' * max(1, round(40 * count / total))
+            out.append('  %13s %9u %5.1f%% %s' % (class_range(i), count, 100.0 * count / total, bar))
+
+    if free_space:
+        out.append('')
+        out.append('Fragmentation (1 - largest free block / free space)')
+        worst = max(free_space, key=lambda s: 1.0 - s[1][1] / s[1][0] if s[1][0] else 0.0)
+        free, largest, min_free = free_space[-1][1][:3]
+        frag = 100.0 * (1.0 - largest / free) if free else 0.0
+        worst_frag = 100.0 * (1.0 - worst[1][1] / worst[1][0]) if worst[1][0] else 0.0
+        out.append('  last: free %u bytes, largest block %u bytes, fragmentation %.1f%%' % (free, largest, frag))
+        out.append('  worst: %.1f%% at %.3f, min. ever free %u bytes' % (worst_frag, worst[0], min_free))
+
+    names = resolve(sorted(a for a in sites if a), args.elf)
+    suspects, long_lived = [], []
+    for site, samples in sites.items():
+        series = [(t, v[1]) for t, v in samples]
+        last = samples[-1][1]
+        slope = trend(series)
+        if (len(series) >= args.min_samples and slope > 0 and series[-1][1] > series[0][1]
+                and series[-1][1] == max(v for _, v in series)):
+            suspects.append((slope, site, last))
+        if last[0] and last[3] / args.tick_hz >= args.age:
+            long_lived.append((last[3], site, last))
+
+    def site_name(site):
+        if site == 0:
+            return '(other sites)'
+        return '0x%08X %s' % (site, names.get(site, ''))
+
+    out.append('')
+    out.append('Leak suspects (live bytes growing)')
+    if not suspects:
+        out.append('  none')
+    for slope, site, last in sorted(suspects, reverse=True):
+        out.append('  %s: %u live allocations, %u bytes, growth %.1f bytes per time unit'
+                   % (site_name(site), last[0], last[1], slope))
+
+    out.append('')
+    out.append('Long-lived allocations (older than %.1f s)' % args.age)
+    if not long_lived:
+        out.append('  none')
+    for age, site, last in sorted(long_lived, reverse=True):
+        out.append('  %s: %u live allocations, %u bytes, oldest %.1f s'
+                   % (site_name(site), last[0], last[1], age / args.tick_hz))
+
+    print('\n'.join(out))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,480 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) Branko Premzel.
+#
+# SPDX-License-Identifier: MIT
+#
+
+"""
+@file    rte_index.py
+@author  Branko Premzel
+@brief   Indexed trace store - the messages of a binary capture in chunks
+         with a time index, summaries and decoder state checkpoints.
+
+Finding what happened at some time of a long capture normally means decoding
+everything from the beginning, because the memo values, the [T] times and
+the signal values depend on all previous messages. The index file stores:
+ * the messages in chunks of --chunk messages (format ID field, data words
+   and unwrapped timestamp, zlib compressed),
+ * for every chunk - the time range, the counts of the messages and the
+   names of the RTOS timing signals (objects) that change in the chunk,
+ * for every chunk - a checkpoint with the state before its first message:
+   decoder state (memos, message number, times of the last messages), the
+   values of all RTOS timing signals, the current task and the queue levels.
+ * the index table at the end of the file - one entry per chunk.
+A window is decoded from the checkpoint of the chunk found by a binary search
+of the index table (O(log n)), so only the chunks of the window are read.
+
+Commands:
+ * build capture fmt... -o trace.rtx - write the index file,
+ * info trace.rtx - list the chunks (--message, --object - only the chunks
+   with this message or with changes of the signals containing this text),
+ * window trace.rtx fmt... --start T --end T - write the RTOS timing signals
+   (--vcd) and log outputs (--log RTOS_MAIN=main.log) of a time window.
+   --check decodes the same window from the start of the capture and checks
+   that the outputs are identical.
+
+The times are capture times - timestamp / timestamp frequency, as %t in the
+logs, or times from the first message with a + prefix (e.g. +3h12min). The window contains the messages with a timestamp in the window (a
+message older than an earlier one - e.g. from an interrupt - gets the time
+of that message, as in RTOS_timing.vcd).
+
+Exit code: 0 - OK, 1 - check failed or nothing found, 2 - file or argument error.
+"""
+
+import argparse
+import bisect
+import hashlib
+import json
+import os
+import struct
+import sys
+import zlib
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import rte_bandwidth    # noqa: E402
+import rte_capture      # noqa: E402
+import rte_decode       # noqa: E402
+import rte_timing       # noqa: E402
+
+MAGIC = b'RTEINDEX'
+VERSION = 1
+HEADER = struct.Struct('<8sIIIIIIQ')    # magic, version, frequency, id_bits, chunk size, fmt CRC, chunks, table offset
+ENTRY = struct.Struct('<qqIQIII')       # first time, last time, messages, offset, sizes of records, checkpoint, summary
+RECORD = struct.Struct('<qHH')          # timestamp, format ID field, data words
+DEFAULT_CHUNK = 4096
+TASK_MEMO = 'M_LAST_TASK_NAME'
+QUEUE_SUFFIX = '_items'
+
+
+def fmt_crc(fmt_files):
+    """CRC of the format definitions - the index is valid only with the same files."""
+    crc = 0
+    for name in fmt_files:
+        with open(name, 'rb') as f:
+            crc = zlib.crc32(f.read(), crc)
+    return crc
+
+
+class StateWriter:
+    """
+    Waveform writer (see rte_timing.py) that keeps the current value of every
+    signal and the names of the signals changed since the last call of
+    changed_names().
+    """
+
+    def __init__(self):
+        self.signals = []       # (name, kind)
+        self.values = []
+        self.changed = set()
+
+    def declare(self, name, kind):
+        self.signals.append((name, kind))
+        self.values.append(None)
+        return len(self.signals)
+
+    def change(self, time, handle, value):
+        self.values[handle - 1] = value
+        self.changed.add(handle)
+
+    def close(self):
+        pass
+
+    def changed_names(self):
+        names = sorted(self.signals[h - 1][0] for h in self.changed)
+        self.changed = set()
+        return names
+
+
+def save_state(decoder, signals):
+    """Checkpoint - decoder and RTOS timing signal state."""
+    writer = signals.writer
+    task = decoder.memos.get(TASK_MEMO)
+    state = decoder.state()
+    state['last_time'] = {str(k): v for k, v in decoder.last_time.items()}
+    state.update({
+        'time': signals.time,
+        'signals': [[name, kind] for name, kind in writer.signals],
+        'values': writer.values,
+        'pulses': [[h, end] for h, end in signals.pulses.items()],
+        'task': rte_decode.as_string(task) if task is not None else None,
+        'queues': {name: value for (name, _), value in zip(writer.signals, writer.values)
+                   if name.endswith(QUEUE_SUFFIX) and value is not None},
+    })
+    return state
+
+
+def load_state(state, decoder, signals):
+    """Restore a checkpoint. The signals of the writer are declared in the saved order."""
+    decoder.restore(dict(state, last_time={int(k): v for k, v in state['last_time'].items()}))
+    signals.time = state['time']
+    for (name, kind), value in zip(state['signals'], state['values']):
+        handle = signals.writer.declare(name, kind)
+        signals.signals[name] = (handle, kind)
+        if value is not None:
+            signals.writer.change(-1, handle, value)
+    for handle, end in state['pulses']:
+        signals.pulses[handle] = end
+
+
+def build(f, cap, table, out, fmt_files, chunk_size):
+    """Write the index file of a capture. Return the number of chunks."""
+    _, scale = rte_timing.timescale(cap.frequency)
+    decoder = rte_decode.Decoder(table, cap.frequency)
+    signals = rte_timing.TimingSignals(StateWriter())
+    entries = []
+    out.write(HEADER.pack(MAGIC, VERSION, cap.frequency, cap.id_bits, chunk_size,
+                          fmt_crc(fmt_files), 0, 0))
+    chunk = []
+    checkpoint = None
+    counts = {}
+    first = last = None
+
+    def write_chunk():
+        records = zlib.compress(b''.join(chunk))
+        summary = zlib.compress(json.dumps({'messages': counts,
+                                            'objects': signals.writer.changed_names()}).encode())
+        offset = out.tell()
+        for blob in (records, checkpoint, summary):
+            out.write(blob)
+        entries.append(ENTRY.pack(first, last, len(chunk), offset, len(records), len(checkpoint), len(summary)))
+
+    for id_field, data, timestamp in rte_capture.messages(f, cap):
+        if not chunk:
+            checkpoint = zlib.compress(json.dumps(save_state(decoder, signals)).encode())
+            counts = {}
+            first = timestamp if last is None else max(timestamp, last)
+        last = timestamp if last is None else max(timestamp, last)
+        chunk.append(RECORD.pack(timestamp, id_field, len(data)) + struct.pack('<%uI' % len(data), *data))
+        msg, texts = decoder.decode(id_field, data, timestamp, {'RTOS_TIMING'})
+        name = msg.name if msg is not None else 'UNKNOWN_ID_%u' % id_field
+        counts[name] = counts.get(name, 0) + 1
+        for line in texts.get('RTOS_TIMING', ()):
+            signals.add(round(timestamp * scale), line)
+        if len(chunk) == chunk_size:
+            write_chunk()
+            chunk = []
+    if chunk:
+        write_chunk()
+
+    table_offset = out.tell()
+    out.write(b''.join(entries))
+    out.seek(0)
+    out.write(HEADER.pack(MAGIC, VERSION, cap.frequency, cap.id_bits, chunk_size,
+                          fmt_crc(fmt_files), len(entries), table_offset))
+    return len(entries)
+
+
+class TraceIndex:
+    """Reader of an index file."""
+
+    def __init__(self, f):
+        self.f = f
+        (magic, version, self.frequency, self.id_bits, self.chunk_size, self.crc,
+         count, table_offset) = HEADER.unpack(f.read(HEADER.size))
+        if magic != MAGIC or version != VERSION:
+            raise ValueError('not an index file')
+        f.seek(table_offset)
+        data = f.read(count * ENTRY.size)
+        if len(data) != count * ENTRY.size:
+            raise ValueError('index file truncated')
+        self.entries = [ENTRY.unpack_from(data, i * ENTRY.size) for i in range(count)]
+        self.last_times = [e[1] for e in self.entries]
+
+    def time(self, text):
+        """Capture time [s] from a time text. +time - time from the first message."""
+        if text.startswith('+'):
+            first = self.entries[0][0] / self.frequency if self.entries else 0.0
+            return first + rte_bandwidth.parse_time(text[1:])
+        return rte_bandwidth.parse_time(text)
+
+    def seek(self, timestamp):
+        """Index of the first chunk with messages at or after the timestamp."""
+        return bisect.bisect_left(self.last_times, timestamp)
+
+    def read(self, chunk):
+        """Return (records, checkpoint, summary) blobs of a chunk."""
+        _, _, _, offset, records, checkpoint, summary = self.entries[chunk]
+        self.f.seek(offset)
+        data = self.f.read(records + checkpoint + summary)
+        return data[:records], data[records:records + checkpoint], data[records + checkpoint:]
+
+    def checkpoint(self, chunk):
+        return json.loads(zlib.decompress(self.read(chunk)[1]))
+
+    def summary(self, chunk):
+        return json.loads(zlib.decompress(self.read(chunk)[2]))
+
+    def messages(self, chunk):
+        """Yield (format ID field, data words, timestamp) of the chunk messages."""
+        data = zlib.decompress(self.read(chunk)[0])
+        pos = 0
+        while pos < len(data):
+            timestamp, id_field, words = RECORD.unpack_from(data, pos)
+            pos += RECORD.size
+            yield id_field, list(struct.unpack_from('<%uI' % words, data, pos)), timestamp
+            pos += 4 * words
+
+    def messages_from(self, chunk):
+        """Yield the messages from the start of the chunk to the end of the capture."""
+        for number in range(chunk, len(self.entries)):
+            yield from self.messages(number)
+
+
+class WindowVcdWriter:
+    """
+    Waveform writer of a time window [start, end]. The changes before the
+    start only update the values written at the start ($dumpvars - only if
+    a signal has a value). A signal
+    declared in the window is added to the VCD file with its first change.
+    """
+
+    def __init__(self, f, exponent, date, version, start, end):
+        self.vcd = rte_timing.VcdWriter(f, exponent, date, version)
+        self.start = start
+        self.end = end
+        self.signals = []
+        self.values = []
+        self.handles = {}       # signal handle -> VCD handle
+        self.started = False
+
+    def declare(self, name, kind):
+        self.signals.append((name, kind))
+        self.values.append(None)
+        return len(self.signals)
+
+    def begin(self):
+        for handle, (name, kind) in enumerate(self.signals, 1):
+            self.handles[handle] = self.vcd.declare(name, kind)
+        if any(value is not None for value in self.values):
+            self.vcd.initial(self.start, self.values)
+        self.started = True
+
+    def change(self, time, handle, value):
+        if time < self.start:
+            self.values[handle - 1] = value
+            return
+        if time > self.end:
+            return
+        if not self.started:
+            self.begin()
+        if handle not in self.handles:
+            self.handles[handle] = self.vcd.declare(*self.signals[handle - 1])
+        self.vcd.change(time, self.handles[handle], value)
+
+    def close(self):
+        if not self.started:
+            self.begin()
+        self.vcd.close()
+
+
+class HashFile:
+    """Output file that also computes the hash of the written text (f None - hash only)."""
+
+    def __init__(self, f=None):
+        self.f = f
+        self.hash = hashlib.sha256()
+
+    def write(self, text):
+        self.hash.update(text.encode('utf-8'))
+        if self.f is not None:
+            self.f.write(text)
+
+
+def window(index, table, start, end, vcd, logs, from_start=False, date=''):
+    """
+    Decode the messages with timestamps in [start, end] (seconds). The RTOS
+    timing signals are written to vcd (HashFile or None), the log outputs to
+    logs ({output: HashFile}). The decoding starts at the checkpoint of the
+    first chunk of the window, or at the first chunk with from_start.
+    Return the number of decoded messages.
+    """
+    exponent, scale = rte_timing.timescale(index.frequency)
+    first_tick = start * index.frequency
+    last_tick = end * index.frequency
+    decoder = rte_decode.Decoder(table, index.frequency)
+    signals = None
+    if vcd is not None:
+        version = 'RTEdbg rte_index.py - %g s to %g s' % (start, end)
+        last_time = round(last_tick * scale) if last_tick != float('inf') else last_tick
+        writer = WindowVcdWriter(vcd, exponent, date, version, round(first_tick * scale), last_time)
+        signals = rte_timing.TimingSignals(writer)
+    chunk = 0 if from_start else min(index.seek(first_tick), len(index.entries) - 1)
+    if chunk > 0:
+        state = index.checkpoint(chunk)
+        load_state(state, decoder, signals or rte_timing.TimingSignals(StateWriter()))
+    outputs = set(logs) | {'RTOS_TIMING'}
+    latest = None
+    count = 0
+    for id_field, data, timestamp in index.messages_from(chunk):
+        latest = timestamp if latest is None else max(timestamp, latest)
+        if latest > last_tick:
+            break
+        _, texts = decoder.decode(id_field, data, timestamp, outputs)
+        if signals is not None:
+            for line in texts.get('RTOS_TIMING', ()):
+                signals.add(round(timestamp * scale), line)
+        if latest < first_tick:
+            continue
+        count += 1
+        for output, f in logs.items():
+            for line in texts.get(output, ()):
+                f.write(line)
+    if signals is not None:
+        signals.close()
+    return count
+
+
+def open_index(name, fmt_files):
+    f = open(name, 'rb')
+    index = TraceIndex(f)
+    if fmt_files and fmt_crc(fmt_files) != index.crc:
+        f.close()
+        raise ValueError('%s was built with other format definition files' % name)
+    return index
+
+
+def main_build(args):
+    with open(args.capture, 'rb') as f:
+        cap = rte_capture.Capture(f)
+        table = rte_decode.FormatTable(args.fmt, cap.id_bits)
+        with open(args.output, 'wb') as out:
+            chunks = build(f, cap, table, out, args.fmt, args.chunk)
+    print('%s: %u chunks, %u bytes' % (args.output, chunks, os.path.getsize(args.output)))
+    return 0 if chunks else 1
+
+
+def main_info(args):
+    index = open_index(args.index, None)
+    print('%u chunks of %u messages, timestamp frequency %u Hz' % (len(index.entries), index.chunk_size,
+                                                                   index.frequency))
+    if args.chunk is not None:
+        if not 0 <= args.chunk < len(index.entries):
+            raise ValueError('no chunk %u' % args.chunk)
+        state = index.checkpoint(args.chunk)
+        print('State at the start of chunk %u:' % args.chunk)
+        print('  current task: %s' % (state['task'] if state['task'] is not None else '-'))
+        for name, level in sorted(state['queues'].items()):
+            print('  %s: %.16g' % (name, level))
+        return 0
+    print('Chunk  Start [s]    End [s]      Messages  Task')
+    found = 0
+    for number, (first, last, count, *_) in enumerate(index.entries):
+        if args.message or args.object:
+            summary = index.summary(number)
+            if args.message and args.message not in summary['messages']:
+                continue
+            if args.object and not any(args.object in name for name in summary['objects']):
+                continue
+        task = index.checkpoint(number)['task']
+        print('%5u  %-11.6f  %-11.6f  %8u  %s' % (number, first / index.frequency, last / index.frequency,
+                                                  count, task if task is not None else '-'))
+        found += 1
+    return 0 if found else 1
+
+
+def main_window(args):
+    index = open_index(args.index, args.fmt)
+    table = rte_decode.FormatTable(args.fmt, index.id_bits)
+    start = index.time(args.start) if args.start else 0.0
+    end = index.time(args.end) if args.end else float('inf')
+    logs = {}
+    for item in args.log:
+        output, sep, name = item.partition('=')
+        if not sep or output not in table.outputs():
+            raise ValueError('bad --log %s - use OUTPUT=file with an output of the format definitions' % item)
+        logs[output] = name
+
+    files = []
+    try:
+        vcd = None
+        if args.vcd:
+            files.append(open(args.vcd, 'w', encoding='utf-8', newline='\n'))
+            vcd = HashFile(files[-1])
+        log_files = {}
+        for output, name in logs.items():
+            files.append(open(name, 'w', encoding='utf-8', newline='\n'))
+            log_files[output] = HashFile(files[-1])
+        date, _ = rte_timing.file_info(args.index, 'rte_index.py')
+        count = window(index, table, start, end, vcd, log_files, date=date)
+    finally:
+        for f in files:
+            f.close()
+    print('rte_index: %u messages in the window' % count)
+
+    if args.check:
+        ref_vcd = HashFile() if vcd is not None else None
+        ref_logs = {output: HashFile() for output in log_files}
+        window(index, table, start, end, ref_vcd, ref_logs, from_start=True, date=date)
+        pairs = [(args.vcd, vcd, ref_vcd)] if vcd is not None else []
+        pairs += [(logs[o], log_files[o], ref_logs[o]) for o in log_files]
+        failed = [name for name, a, b in pairs if a.hash.digest() != b.hash.digest()]
+        for name in failed:
+            print('%s: differs from the window decoded from the capture start' % name)
+        if failed:
+            return 1
+        print('rte_index: check OK')
+    return 0 if count else 1
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Indexed trace store with time seek.')
+    commands = parser.add_subparsers(dest='command', required=True)
+    p = commands.add_parser('build', help='write the index file of a binary capture')
+    p.add_argument('capture', help='binary capture file (header and circular buffer)')
+    p.add_argument('fmt', nargs='+', help='format definition files and the generated rte_fmt_ids.h')
+    p.add_argument('-o', '--output', default='trace.rtx', help='index file (default: trace.rtx)')
+    p.add_argument('--chunk', type=int, default=DEFAULT_CHUNK,
+                   help='messages per chunk (default: %u)' % DEFAULT_CHUNK)
+    p = commands.add_parser('info', help='list the chunks of an index file')
+    p.add_argument('index', help='index file')
+    p.add_argument('--message', help='only the chunks with this message (e.g. MSG1_RTOS_TASK_SWITCHED_IN)')
+    p.add_argument('--object', help='only the chunks with changes of the signals containing this text')
+    p.add_argument('--chunk', type=int, help='show the state (current task, queue levels) at the start of a chunk')
+    p = commands.add_parser('window', help='decode a time window')
+    p.add_argument('index', help='index file')
+    p.add_argument('fmt', nargs='+', help='format definition files and the generated rte_fmt_ids.h')
+    p.add_argument('--start', help='window start, h, min, s, ms and us suffixes allowed, +time - from the '
+                   'first message (default: capture start)')
+    p.add_argument('--end', help='window end (default: capture end)')
+    p.add_argument('--vcd', help='write the RTOS timing signals of the window to this VCD file')
+    p.add_argument('--log', action='append', default=[], metavar='OUTPUT=FILE',
+                   help='write an output (e.g. RTOS_MAIN) to a file. Can be repeated')
+    p.add_argument('--check', action='store_true', help='compare with the window decoded from the capture start')
+    args = parser.parse_args()
+
+    try:
+        if args.command == 'build':
+            if args.chunk < 1:
+                raise ValueError('bad chunk size')
+            sys.exit(main_build(args))
+        if args.command == 'info':
+            sys.exit(main_info(args))
+        sys.exit(main_window(args))
+    except (OSError, ValueError, zlib.error) as e:
+        print('rte_index: %s' % e, file=sys.stderr)
+        sys.exit(2)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,273 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) Branko Premzel.
+#
+# SPDX-License-Identifier: MIT
+#
+
+"""
+@file    rte_pdecode.py
+@author  Branko Premzel
+@brief   Parallel decoder - the log files and RTOS_timing.vcd of a binary
+         capture decoded on all CPU cores.
+
+The outputs of the format definitions (OUT_FILE - RTOS_main.log,
+RTOS_tasks.log, ... and RTOS_timing.vcd) are written to the output folder.
+The format strings are interpreted by rte_decode.py.
+
+The buffer is split into chunks of about --chunk words. A chunk starts after
+an FMT word, so it starts with a complete message. The formatted text of a
+message depends on the state left by the previous messages, so the chunks
+are decoded in two parallel passes:
+ 1. scan - every chunk is parsed without the previous state. The result is
+    the number of messages, the first and last timestamp (relative to the
+    first short timestamp until the first long timestamp message), the last
+    timestamp of every format ID and the last value stored to every memo.
+ 2. merge (sequential, per chunk) - the state at the start of every chunk:
+    timestamp offset, message number, [T] and [t-MSGx] times and memo values.
+ 3. decode - every chunk is formatted from its start state. The results are
+    written in the chunk order, and the RTOS_TIMING lines are converted to
+    value changes in the same order as by a single-threaded decoder.
+The output is byte-identical to the output of --jobs 1 (single-threaded
+decoding). The memo values must be stored from the message data - true for
+the FreeRTOS format definitions - otherwise the capture is decoded by a
+single process.
+
+Exit code: 0 - OK, 1 - no messages decoded, 2 - file or argument error.
+"""
+
+import argparse
+import collections
+import multiprocessing
+import os
+import sys
+import time
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import rte_capture      # noqa: E402
+import rte_decode       # noqa: E402
+import rte_timing       # noqa: E402
+
+DEFAULT_CHUNK = 1 << 18     # words
+TIMING = 'RTOS_TIMING'
+
+worker = None       # Capture, format table and capture file of a worker process
+
+
+class Worker:
+    def __init__(self, capture, fmt_files):
+        with open(capture, 'rb') as f:
+            self.trace = rte_capture.TraceFile(f)
+        self.cap = self.trace.cap
+        self.table = rte_decode.FormatTable(fmt_files, self.cap.id_bits)
+        self.stores = {msg.base for msg in self.table.messages.values() if msg.stores()}
+
+    def messages(self, start, end):
+        return self.trace.messages(start, end)
+
+
+def init_worker(capture, fmt_files):
+    global worker
+    worker = Worker(capture, fmt_files)
+
+
+def scan_chunk(task):
+    """
+    Pass 1 - return (messages, first timestamp, index of the first long
+    timestamp message, last timestamp, {format ID base: (index, timestamp)},
+    {memo: value}). The first timestamp is the short timestamp value (see
+    rte_capture.TraceFile.messages()).
+    """
+    start, end = task
+    decoder = rte_decode.Decoder(worker.table, worker.cap.frequency)
+    by_id = worker.table.by_id
+    count = 0
+    first = last = long_index = None
+    bases = {}
+    for id_field, data, timestamp in worker.messages(start, end):
+        if first is None:
+            first = timestamp
+        if long_index is None and rte_capture.is_long_timestamp(id_field, data):
+            long_index = count
+        msg = by_id[id_field] if id_field < len(by_id) else None
+        if msg is not None:
+            bases[msg.base] = (count, timestamp)
+            if msg.base in worker.stores:
+                decoder.decode(id_field, data, timestamp, ())
+        last = timestamp
+        count += 1
+    return count, first, long_index, last, bases, decoder.memos
+
+
+def merge(summaries, cap, table):
+    """Pass 2 - return (timestamp offset, decoder state) at the start of every chunk."""
+    starts = []
+    state = rte_decode.Decoder(table, cap.frequency).state()
+    previous = None
+    for count, first, long_index, last, bases, memos in summaries:
+        offset = 0
+        if count and long_index != 0 and previous is not None:
+            offset = rte_capture.unwrap(previous, first, cap) - first
+        starts.append((offset, state))
+        if not count:
+            continue
+        state = {key: dict(value) if isinstance(value, dict) else value for key, value in state.items()}
+        state['number'] += count
+        for base, (index, timestamp) in bases.items():
+            if long_index is None or index < long_index:
+                timestamp += offset
+            state['last_time'][base] = timestamp
+            state['last_by_name'][table.by_id[base].name] = timestamp
+        state['memos'].update(memos)
+        previous = last + offset if long_index is None else last
+    return starts
+
+
+def decode_chunk(task):
+    """
+    Pass 3 - return ({output: text}, [(timestamp, parsed RTOS_TIMING lines)])
+    of a chunk. The lines are parsed here to save time in the main process.
+    """
+    start, end, offset, long_index, state, outputs = task
+    decoder = rte_decode.Decoder(worker.table, worker.cap.frequency)
+    decoder.restore(state)
+    logs = collections.defaultdict(list)
+    timing = []
+    for index, (id_field, data, timestamp) in enumerate(worker.messages(start, end)):
+        if long_index is None or index < long_index:
+            timestamp += offset
+        _, texts = decoder.decode(id_field, data, timestamp, outputs)
+        for output, lines in texts.items():
+            if output == TIMING:
+                timing.append((timestamp, [rte_timing.parse_line(line) for line in lines]))
+            else:
+                logs[output] += lines
+    return {output: ''.join(lines) for output, lines in logs.items()}, timing
+
+
+def split(f, cap, chunk_words):
+    """Return the (start, end) word positions of the chunks. A chunk ends with an FMT or empty word."""
+    chunks = []
+    start = 0
+    with rte_capture.TraceFile(f, cap) as trace:
+        while cap.words - start > chunk_words:
+            pos = next(trace.boundaries(start + chunk_words), cap.words) + 1
+            if pos >= cap.words:
+                break
+            chunks.append((start, pos))
+            start = pos
+    chunks.append((start, cap.words))
+    return chunks
+
+
+class Outputs:
+    """Output files - the log texts are written as they are, RTOS_TIMING to VCD."""
+
+    def __init__(self, folder, names, table, capture, frequency):
+        self.files = {}
+        self.signals = None
+        for output in names:
+            file_name, header = table.files[output]
+            f = open(os.path.join(folder, file_name), 'w', encoding='utf-8', newline='\n')
+            self.files[output] = f
+            if output == TIMING:
+                exponent, self.scale = rte_timing.timescale(frequency)
+                date, version = rte_timing.file_info(capture, 'rte_pdecode.py')
+                self.signals = rte_timing.TimingSignals(rte_timing.VcdWriter(f, exponent, date, version,
+                                                                             spool_dir=folder))
+            else:
+                f.write(header)
+
+    def write(self, logs, timing):
+        for output, text in logs.items():
+            self.files[output].write(text)
+        for timestamp, lines in timing:
+            t = round(timestamp * self.scale)
+            for line in lines:
+                self.signals.change(t, *line)
+
+    def close(self):
+        if self.signals is not None:
+            self.signals.close()
+        for f in self.files.values():
+            f.close()
+
+
+def decode_serial(f, cap, table, outputs, out):
+    decoder = rte_decode.Decoder(table, cap.frequency)
+    count = 0
+    for id_field, data, timestamp in rte_capture.messages(f, cap):
+        _, texts = decoder.decode(id_field, data, timestamp, outputs)
+        timing = [(timestamp, [rte_timing.parse_line(line) for line in texts.pop(TIMING)])] \
+            if TIMING in texts else []
+        out.write({output: ''.join(lines) for output, lines in texts.items()}, timing)
+        count += 1
+    return count
+
+
+def decode_parallel(args, cap, table, outputs, out, jobs, chunks):
+    count = 0
+    with multiprocessing.Pool(jobs, init_worker, (args.capture, args.fmt)) as pool:
+        summaries = pool.map(scan_chunk, chunks)
+        starts = merge(summaries, cap, table)
+        pending = collections.deque()
+        for task, (offset, state), summary in zip(chunks, starts, summaries):
+            pending.append(pool.apply_async(decode_chunk, (task + (offset, summary[2], state, outputs),)))
+            count += summary[0]
+            if len(pending) >= 2 * jobs:        # Bounded memory - the results are written in order
+                out.write(*pending.popleft().get())
+        while pending:
+            out.write(*pending.popleft().get())
+    return count
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Parallel decoder of binary captures.')
+    parser.add_argument('capture', help='binary capture file (header and circular buffer)')
+    parser.add_argument('fmt', nargs='+', help='format definition files and the generated rte_fmt_ids.h')
+    parser.add_argument('-d', '--dir', default='.', help='output folder, created if needed (default: current folder)')
+    parser.add_argument('-O', '--output', action='append', default=[],
+                        help='decode only this output (e.g. RTOS_MAIN). Can be repeated')
+    parser.add_argument('-j', '--jobs', type=int, default=os.cpu_count() or 1,
+                        help='number of processes (default: number of CPU cores, 1 - single-threaded)')
+    parser.add_argument('--chunk', type=int, default=DEFAULT_CHUNK,
+                        help='chunk size in buffer words (default: %u)' % DEFAULT_CHUNK)
+    args = parser.parse_args()
+
+    started = time.time()
+    try:
+        if args.jobs < 1 or args.chunk < 16:
+            raise ValueError('bad --jobs or --chunk value')
+        with open(args.capture, 'rb') as f:
+            cap = rte_capture.Capture(f)
+            table = rte_decode.FormatTable(args.fmt, cap.id_bits)
+            names = args.output or sorted(table.files)
+            for output in names:
+                if output not in table.files:
+                    raise ValueError('no OUT_FILE definition for output %s' % output)
+            jobs = args.jobs
+            if any(isinstance(p, rte_decode.Field) and p.store and p.source != 'bits'
+                   for msg in table.messages.values() for _, parts in msg.lines for p in parts):
+                print('rte_pdecode: a memo value depends on the previous messages - single-threaded decoding')
+                jobs = 1
+            chunks = split(f, cap, args.chunk) if jobs > 1 else [(0, cap.words)]
+            os.makedirs(args.dir, exist_ok=True)
+            out = Outputs(args.dir, names, table, args.capture, cap.frequency)
+            try:
+                if len(chunks) > 1:
+                    count = decode_parallel(args, cap, table, set(names), out, min(jobs, len(chunks)), chunks)
+                else:
+                    count = decode_serial(f, cap, table, set(names), out)
+            finally:
+                out.close()
+    except (OSError, ValueError) as e:
+        print('rte_pdecode: %s' % e, file=sys.stderr)
+        sys.exit(2)
+
+    print('rte_pdecode: %u chunks, %u processes, %.2f s' % (len(chunks), min(jobs, len(chunks)),
+                                                         time.time() - started))
+    sys.exit(0 if count else 1)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,602 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) Branko Premzel.
+#
+# SPDX-License-Identifier: MIT
+#
+
+"""
+@file    rte_perfetto.py
+@author  Branko Premzel
+@brief   Perfetto trace exporter - the FreeRTOS events of a binary capture as
+         a thread timeline (Perfetto protobuf trace or Chrome JSON trace).
+
+The trace has one process (FreeRTOS) with the tracks:
+ * a thread per task - "Running" slices from the task switch-in to the next
+   switch-in, and instant events of the task notifications and queue sends
+   and receives,
+ * "<task> API" per task - the kernel API calls: slices from the ENTER to
+   the RETURN message of a pair (rte_FreeRTOS_trace2_fmt.h), nested as the
+   calls are. The API calls of interrupts go to the Interrupts track,
+ * Running task - the running task (CPU view),
+ * Interrupts - ISR slices (ISR enter/exit messages),
+ * counters - the float signals of the RTOS_TIMING lines with names that
+   match --counter (default: the queue levels, Queue<name>_items).
+Flow arrows connect a notification to the next switch-in of the notified
+task and a queue send to the receive of the item (first in, first out - the
+sends to the front of a queue are not followed).
+
+The events are written as they are decoded. The memory used depends only on
+the number of tasks, queues and open API calls, not on the capture length.
+The default format is the Perfetto protobuf trace (TracePacket stream with
+TrackDescriptor and TrackEvent packets, timestamps in ns). --json writes the
+Chrome JSON trace format instead. The files are complete traces - they open
+in the Perfetto UI (also a locally served one) or chrome://tracing (JSON)
+without network access.
+
+--check reads the written file and checks that every event refers to a
+declared track, the slices of every track are nested (every end has a
+begin) and every flow ends after it starts.
+
+Exit code: 0 - OK, 1 - no events exported or check failed, 2 - file or
+argument error.
+"""
+
+import argparse
+import collections
+import json
+import os
+import re
+import struct
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import rte_capture      # noqa: E402
+import rte_decode       # noqa: E402
+import rte_fmt_ids      # noqa: E402
+import rte_task_stats   # noqa: E402
+import rte_timing       # noqa: E402
+
+PID = 1
+SEQUENCE_ID = 1
+MAX_NESTING = 64            # Open API calls per track
+MAX_FLOWS = 256             # Unmatched flows per task or queue
+DEFAULT_COUNTER = r'^Queue\w+_items$'
+TIMING = 'RTOS_TIMING'
+RE_API = re.compile(r'(\w+) ENTER\b')
+
+SWITCHED_IN = rte_task_stats.SWITCHED_IN
+ISR_ENTER = ('MSG0_RTOS_ISR_ENTER', 'MSG1_RTOS_ISR_ENTER_IRQ')
+ISR_EXIT = ('MSG0_RTOS_ISR_EXIT', 'MSG0_RTOS_ISR_EXIT_TO_SCHEDULER', 'MSG1_RTOS_ISR_EXIT_IRQ')
+QUEUE_SEND = ('MSG2_RTOS_QUEUE_SEND', 'MSG2_RTOS_QUEUE_SEND_FROM_ISR')
+QUEUE_RECEIVE = ('MSG2_RTOS_QUEUE_RECEIVE', 'MSG2_RTOS_QUEUE_RECEIVE_FROM_ISR')
+
+# Perfetto protobuf field numbers (perfetto/protos/perfetto/trace)
+TRACE_PACKET = 1
+PACKET_TIMESTAMP = 8
+PACKET_SEQUENCE_ID = 10
+PACKET_TRACK_EVENT = 11
+PACKET_SEQUENCE_FLAGS = 13
+PACKET_TRACK_DESCRIPTOR = 60
+SEQ_INCREMENTAL_STATE_CLEARED = 1
+TRACK_UUID = 1
+TRACK_NAME = 2
+TRACK_PROCESS = 3
+TRACK_THREAD = 4
+TRACK_PARENT_UUID = 5
+TRACK_COUNTER = 8
+PROCESS_PID = 1
+PROCESS_NAME = 6
+THREAD_PID = 1
+THREAD_TID = 2
+THREAD_NAME = 5
+EVENT_TYPE = 9
+EVENT_TRACK_UUID = 11
+EVENT_NAME = 23
+EVENT_COUNTER_VALUE = 30
+EVENT_DOUBLE_COUNTER_VALUE = 44
+EVENT_FLOW_IDS = 47
+EVENT_TERMINATING_FLOW_IDS = 48
+TYPE_SLICE_BEGIN = 1
+TYPE_SLICE_END = 2
+TYPE_INSTANT = 3
+TYPE_COUNTER = 4
+
+
+def varint(value):
+    value &= (1 << 64) - 1
+    out = bytearray()
+    while value > 0x7F:
+        out.append((value & 0x7F) | 0x80)
+        value >>= 7
+    out.append(value)
+    return bytes(out)
+
+
+def field_varint(number, value):
+    return varint(number << 3) + varint(value)
+
+
+def field_bytes(number, data):
+    if isinstance(data, str):
+        data = data.encode('utf-8')
+    return varint((number << 3) | 2) + varint(len(data)) + data
+
+
+def field_fixed64(number, value):
+    return varint((number << 3) | 1) + struct.pack('<Q', value)
+
+
+def field_double(number, value):
+    return varint((number << 3) | 1) + struct.pack('<d', value)
+
+
+class ProtoWriter:
+    """Perfetto protobuf trace - one TracePacket per track or event."""
+
+    def __init__(self, f):
+        self.f = f
+        self.first = True
+
+    def packet(self, data):
+        if self.first:
+            data += field_varint(PACKET_SEQUENCE_FLAGS, SEQ_INCREMENTAL_STATE_CLEARED)
+            self.first = False
+        data += field_varint(PACKET_SEQUENCE_ID, SEQUENCE_ID)
+        self.f.write(field_bytes(TRACE_PACKET, data))
+
+    def process(self, uuid, name):
+        desc = field_bytes(TRACK_PROCESS, field_varint(PROCESS_PID, PID) + field_bytes(PROCESS_NAME, name))
+        self.packet(field_bytes(PACKET_TRACK_DESCRIPTOR, field_varint(TRACK_UUID, uuid) + desc))
+
+    def track(self, uuid, name, parent, tid=None, counter=False):
+        desc = field_varint(TRACK_UUID, uuid)
+        if tid is not None:         # A thread belongs to the process by its pid
+            desc += field_bytes(TRACK_THREAD, field_varint(THREAD_PID, PID) + field_varint(THREAD_TID, tid) +
+                                field_bytes(THREAD_NAME, name))
+        else:
+            desc += field_varint(TRACK_PARENT_UUID, parent) + field_bytes(TRACK_NAME, name)
+        if counter:
+            desc += field_bytes(TRACK_COUNTER, b'')
+        self.packet(field_bytes(PACKET_TRACK_DESCRIPTOR, desc))
+
+    def event(self, ts, track, kind, name=None, flows=(), terminating=(), value=None):
+        data = field_varint(EVENT_TYPE, kind) + field_varint(EVENT_TRACK_UUID, track)
+        if name is not None:
+            data += field_bytes(EVENT_NAME, name)
+        if value is not None:
+            data += field_varint(EVENT_COUNTER_VALUE, value) if isinstance(value, int) else \
+                field_double(EVENT_DOUBLE_COUNTER_VALUE, value)
+        for flow in flows:
+            data += field_fixed64(EVENT_FLOW_IDS, flow)
+        for flow in terminating:
+            data += field_fixed64(EVENT_TERMINATING_FLOW_IDS, flow)
+        self.packet(field_varint(PACKET_TIMESTAMP, ts) + field_bytes(PACKET_TRACK_EVENT, data))
+
+    def begin(self, ts, track, name, flows=(), terminating=()):
+        self.event(ts, track, TYPE_SLICE_BEGIN, name, flows, terminating)
+
+    def end(self, ts, track):
+        self.event(ts, track, TYPE_SLICE_END)
+
+    def instant(self, ts, track, name, flows=(), terminating=()):
+        self.event(ts, track, TYPE_INSTANT, name, flows, terminating)
+
+    def counter(self, ts, track, value):
+        self.event(ts, track, TYPE_COUNTER, value=value)
+
+    def close(self):
+        pass
+
+
+class JsonWriter:
+    """
+    Chrome JSON trace (traceEvents array). A track is a thread (tid) of the
+    process. The flow events bind to the enclosing slice of their thread.
+    """
+
+    def __init__(self, f):
+        self.f = f
+        self.tids = {}          # track -> tid
+        self.counters = {}      # track -> counter name
+        self.separator = ''
+        f.write('{"displayTimeUnit":"ns","traceEvents":[\n')
+
+    def write(self, event):
+        self.f.write(self.separator + json.dumps(event, separators=(',', ':')))
+        self.separator = ',\n'
+
+    def process(self, uuid, name):
+        self.write({'ph': 'M', 'pid': PID, 'name': 'process_name', 'args': {'name': name}})
+
+    def track(self, uuid, name, parent, tid=None, counter=False):
+        if counter:
+            self.counters[uuid] = name
+            return
+        self.tids[uuid] = tid = uuid if tid is None else tid
+        self.write({'ph': 'M', 'pid': PID, 'tid': tid, 'name': 'thread_name', 'args': {'name': name}})
+
+    def flows(self, ts, tid, flows, terminating):
+        for flow in flows:
+            self.write({'ph': 's', 'pid': PID, 'tid': tid, 'ts': ts, 'id': flow, 'name': 'flow', 'cat': 'flow'})
+        for flow in terminating:
+            self.write({'ph': 'f', 'bp': 'e', 'pid': PID, 'tid': tid, 'ts': ts, 'id': flow, 'name': 'flow',
+                        'cat': 'flow'})
+
+    def begin(self, ts, track, name, flows=(), terminating=()):
+        ts /= 1000
+        self.write({'ph': 'B', 'pid': PID, 'tid': self.tids[track], 'ts': ts, 'name': name})
+        self.flows(ts, self.tids[track], flows, terminating)
+
+    def end(self, ts, track):
+        self.write({'ph': 'E', 'pid': PID, 'tid': self.tids[track], 'ts': ts / 1000})
+
+    def instant(self, ts, track, name, flows=(), terminating=()):
+        ts /= 1000
+        self.write({'ph': 'i', 's': 't', 'pid': PID, 'tid': self.tids[track], 'ts': ts, 'name': name})
+        self.flows(ts, self.tids[track], flows, terminating)
+
+    def counter(self, ts, track, value):
+        self.write({'ph': 'C', 'pid': PID, 'ts': ts / 1000, 'name': self.counters[track], 'args': {'value': value}})
+
+    def close(self):
+        self.f.write('\n]}\n')
+
+
+class Exporter:
+    """Converts the messages to tracks and events of a writer. The times are in ns."""
+
+    def __init__(self, writer, table, frequency, counter_re):
+        self.writer = writer
+        self.table = table
+        self.scale = 1e9 / frequency
+        self.counter_re = counter_re
+        self.next_uuid = 1
+        self.next_flow = 1
+        self.process = self.new_track(None, 'FreeRTOS')
+        self.cpu = self.new_track('Running task')
+        self.isr = self.new_track('Interrupts')
+        self.threads = {}       # task name -> (thread track, API track or None)
+        self.counters = {}      # signal name -> counter track
+        self.stacks = collections.defaultdict(list)     # track -> open slices [pair name]
+        self.isr_depth = 0
+        self.current = None     # Name of the running task
+        self.notified = collections.defaultdict(lambda: collections.deque(maxlen=MAX_FLOWS))
+        self.queued = collections.defaultdict(lambda: collections.deque(maxlen=MAX_FLOWS))
+        self.events = 0
+        self.last = 0
+        self.decoder = rte_decode.Decoder(table, frequency)
+        self.handlers = self.message_handlers()
+
+    def new_track(self, name, process_name=None, tid=False, counter=False):
+        uuid = self.next_uuid
+        self.next_uuid += 1
+        if process_name is not None:
+            self.writer.process(uuid, process_name)
+        else:
+            self.writer.track(uuid, name, self.process, uuid if tid else None, counter)
+        return uuid
+
+    def message_handlers(self):
+        """Return {format ID field: (handler, message, API name or pair name)}."""
+        kinds = {SWITCHED_IN: (self.switch_in, None)}
+        kinds.update((name, (self.isr_enter, None)) for name in ISR_ENTER)
+        kinds.update((name, (self.isr_exit, None)) for name in ISR_EXIT)
+        kinds.update((name, (self.notify, None)) for name in rte_task_stats.NOTIFY)
+        kinds.update((name, (self.queue_send, None)) for name in QUEUE_SEND)
+        kinds.update((name, (self.queue_receive, None)) for name in QUEUE_RECEIVE)
+        for name, msg in self.table.messages.items():
+            m = rte_fmt_ids.RE_PAIR.match(name)
+            if name in kinds:
+                continue
+            if m and m.group(2) == 'ENTER':
+                api = RE_API.search(''.join(p for _, parts in msg.lines for p in parts if isinstance(p, str)))
+                kinds[name] = (self.api_enter, api.group(1) if api else m.group(1))
+            elif m:
+                kinds[name] = (self.api_return, m.group(1))
+            elif msg.stores() or any(output == TIMING and isinstance(parts[0], str) and parts[0].startswith('f ')
+                                     for output, parts in msg.lines if parts):
+                kinds[name] = (self.decode, None)
+        handlers = {}
+        for name, (handler, extra) in kinds.items():
+            msg = self.table.messages.get(name)
+            if msg is None or msg.base is None:
+                continue
+            for id_field in range(msg.base, len(self.table.by_id)):
+                if self.table.by_id[id_field] is not msg:
+                    break
+                handlers[id_field] = (handler, msg, extra)
+        return handlers
+
+    def thread(self, name, api=False):
+        tracks = self.threads.get(name)
+        if tracks is None:
+            tracks = self.threads[name] = [self.new_track(name, tid=True), None]
+        if api and tracks[1] is None:
+            tracks[1] = self.new_track('%s API' % name)
+        return tracks[1] if api else tracks[0]
+
+    def context(self):
+        """Track of the current context - the Interrupts track or the running task (None if not known)."""
+        if self.isr_depth:
+            return self.isr
+        return self.thread(self.current) if self.current is not None else None
+
+    def new_flow(self):
+        flow = self.next_flow
+        self.next_flow += 1
+        return flow
+
+    def message(self, id_field, data, t):
+        handler = self.handlers.get(id_field)
+        if handler is None:
+            return
+        function, msg, extra = handler
+        ts = max(0, round(t * self.scale))
+        self.last = max(self.last, ts)
+        function(ts, msg, id_field, data, t, extra)
+
+    def switch_in(self, ts, msg, id_field, data, t, extra):
+        name = rte_task_stats.task_name(msg, id_field, data)
+        if self.current is not None:
+            self.writer.end(ts, self.cpu)
+            self.writer.end(ts, self.thread(self.current))
+        self.current = name
+        self.writer.begin(ts, self.cpu, name)
+        flows = self.notified.pop(name, ())
+        self.writer.begin(ts, self.thread(name), 'Running', terminating=flows)
+        self.events += 2
+        self.decode(ts, msg, id_field, data, t, extra)
+
+    def isr_enter(self, ts, msg, id_field, data, t, extra):
+        value, _ = rte_decode.message_value(msg, id_field, data)
+        self.writer.begin(ts, self.isr, 'IRQ %u' % (value & 0xFFFF) if msg.words else 'ISR')
+        self.stacks[self.isr].append(None)
+        self.isr_depth += 1
+        self.events += 1
+
+    def isr_exit(self, ts, msg, id_field, data, t, extra):
+        stack = self.stacks[self.isr]
+        while stack:            # API calls not returned in the ISR are ended with it
+            self.writer.end(ts, self.isr)
+            self.events += 1
+            if stack.pop() is None:
+                break
+        self.isr_depth = max(0, self.isr_depth - 1)
+
+    def notify(self, ts, msg, id_field, data, t, extra):
+        track = self.context()
+        if track is None:
+            return
+        target = rte_task_stats.task_name(msg, id_field, data)
+        flow = self.new_flow()
+        self.writer.instant(ts, track, 'Notify %s' % target, flows=(flow,))
+        self.notified[target].append(flow)
+        self.events += 1
+
+    def queue_send(self, ts, msg, id_field, data, t, extra):
+        self.decode(ts, msg, id_field, data, t, extra)
+        track = self.context()
+        if track is None:
+            return
+        queue = rte_task_stats.task_name(msg, id_field, data)
+        flow = self.new_flow()
+        self.writer.instant(ts, track, 'Send %s' % queue, flows=(flow,))
+        self.queued[queue].append(flow)
+        self.events += 1
+
+    def queue_receive(self, ts, msg, id_field, data, t, extra):
+        self.decode(ts, msg, id_field, data, t, extra)
+        track = self.context()
+        if track is None:
+            return
+        queue = rte_task_stats.task_name(msg, id_field, data)
+        pending = self.queued.get(queue)
+        flows = (pending.popleft(),) if pending else ()
+        self.writer.instant(ts, track, 'Receive %s' % queue, terminating=flows)
+        self.events += 1
+
+    def api_track(self):
+        if self.isr_depth:
+            return self.isr
+        return self.thread(self.current, api=True) if self.current is not None else None
+
+    def api_enter(self, ts, msg, id_field, data, t, api):
+        track = self.api_track()
+        if track is None or len(self.stacks[track]) >= MAX_NESTING:
+            return
+        self.writer.begin(ts, track, api)
+        self.stacks[track].append(rte_fmt_ids.RE_PAIR.match(msg.name).group(1))
+        self.events += 1
+
+    def api_return(self, ts, msg, id_field, data, t, pair):
+        track = self.api_track()
+        stack = self.stacks.get(track)
+        if not stack or pair not in stack:
+            return          # The ENTER message is not in the capture
+        while True:
+            self.writer.end(ts, track)
+            self.events += 1
+            if stack.pop() == pair:
+                break
+
+    def decode(self, ts, msg, id_field, data, t, extra):
+        """Counter values of the RTOS_TIMING lines (and the memo values for the following messages)."""
+        _, texts = self.decoder.decode(id_field, data, t, (TIMING,))
+        for line in texts.get(TIMING, ()):
+            kind, name, value = rte_timing.parse_line(line)
+            if kind != 'f' or value is None or value == 'R' or not self.counter_re.search(name):
+                continue
+            track = self.counters.get(name)
+            if track is None:
+                track = self.counters[name] = self.new_track(name, counter=True)
+            self.writer.counter(ts, track, int(value) if float(value).is_integer() else value)
+            self.events += 1
+
+    def close(self):
+        """End the open slices at the last timestamp."""
+        for track, stack in self.stacks.items():
+            for _ in stack:
+                self.writer.end(self.last, track)
+        if self.current is not None:
+            self.writer.end(self.last, self.cpu)
+            self.writer.end(self.last, self.thread(self.current))
+        self.writer.close()
+
+
+def proto_fields(data):
+    """Yield (field number, wire type, value) of a protobuf message."""
+    pos = 0
+    while pos < len(data):
+        key, pos = read_varint(data, pos)
+        number, wire = key >> 3, key & 7
+        if wire == 0:
+            value, pos = read_varint(data, pos)
+        elif wire == 1:
+            value, pos = data[pos:pos + 8], pos + 8
+        elif wire == 2:
+            length, pos = read_varint(data, pos)
+            value, pos = data[pos:pos + length], pos + length
+        elif wire == 5:
+            value, pos = data[pos:pos + 4], pos + 4
+        else:
+            raise ValueError('unsupported wire type %u' % wire)
+        if pos > len(data):
+            raise ValueError('truncated field %u' % number)
+        yield number, wire, value
+
+
+def read_varint(data, pos):
+    value = shift = 0
+    while True:
+        if pos >= len(data):
+            raise ValueError('truncated varint')
+        byte = data[pos]
+        pos += 1
+        value |= (byte & 0x7F) << shift
+        shift += 7
+        if not byte & 0x80:
+            return value, pos
+
+
+class TraceChecker:
+    """Track, slice nesting and flow checks of the written events."""
+
+    def __init__(self):
+        self.tracks = set()
+        self.depth = collections.Counter()
+        self.flows = set()
+        self.events = 0
+
+    def event(self, track, kind, flows, terminating):
+        if track not in self.tracks:
+            raise ValueError('event on an undeclared track %s' % track)
+        if kind == 'E':
+            if not self.depth[track]:
+                raise ValueError('slice end without a begin on track %s' % track)
+            self.depth[track] -= 1
+        elif kind == 'B':
+            self.depth[track] += 1
+        self.flows.update(flows)
+        for flow in terminating:
+            if flow not in self.flows:
+                raise ValueError('flow %u ends before it starts' % flow)
+        self.events += 1
+
+
+def check_proto(name):
+    """Return the checked events of a protobuf trace. ValueError - check failed."""
+    checker = TraceChecker()
+    kinds = {TYPE_SLICE_BEGIN: 'B', TYPE_SLICE_END: 'E', TYPE_INSTANT: 'i', TYPE_COUNTER: 'C'}
+    with open(name, 'rb') as f:
+        data = f.read()
+    for number, wire, packet in proto_fields(data):
+        if number != TRACE_PACKET or wire != 2:
+            raise ValueError('not a TracePacket field')
+        for field, _, value in proto_fields(packet):
+            if field == PACKET_TRACK_DESCRIPTOR:
+                checker.tracks.update(v for n, _, v in proto_fields(value) if n == TRACK_UUID)
+            elif field == PACKET_TRACK_EVENT:
+                event = collections.defaultdict(list)
+                for n, _, v in proto_fields(value):
+                    event[n].append(struct.unpack('<Q', v)[0] if n in (EVENT_FLOW_IDS, EVENT_TERMINATING_FLOW_IDS)
+                                    else v)
+                checker.event(event[EVENT_TRACK_UUID][0], kinds.get(event[EVENT_TYPE][0]),
+                              event[EVENT_FLOW_IDS], event[EVENT_TERMINATING_FLOW_IDS])
+    return checker.events
+
+
+def check_json(name):
+    """Return the checked events of a JSON trace. ValueError - check failed."""
+    checker = TraceChecker()
+    counters = set()
+    with open(name, encoding='utf-8') as f:
+        try:
+            trace = json.load(f)
+        except json.JSONDecodeError as e:
+            raise ValueError(str(e))
+    for event in trace['traceEvents']:
+        ph = event['ph']
+        if ph == 'M':
+            if event['name'] == 'thread_name':
+                checker.tracks.add(event['tid'])
+        elif ph == 'C':
+            counters.add(event['name'])
+            checker.events += 1
+        elif ph in ('s', 'f'):
+            checker.event(event['tid'], ph, [event['id']] if ph == 's' else [], [event['id']] if ph == 'f' else [])
+        else:
+            checker.event(event['tid'], ph, (), ())
+    return checker.events
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Perfetto (protobuf or JSON) trace exporter.')
+    parser.add_argument('capture', help='binary capture file (header and circular buffer)')
+    parser.add_argument('fmt', nargs='+', help='format definition files and the generated rte_fmt_ids.h')
+    parser.add_argument('-o', '--output', help='output file (default: RTOS_trace.pftrace or RTOS_trace.json)')
+    parser.add_argument('--json', action='store_true', help='write the Chrome JSON trace format')
+    parser.add_argument('--counter', default=DEFAULT_COUNTER,
+                        help='regular expression of the RTOS_TIMING float signals written as counters '
+                             '(default: %s)' % DEFAULT_COUNTER.replace('%', '%%'))
+    parser.add_argument('--check', action='store_true', help='read and check the written file')
+    args = parser.parse_args()
+
+    output = args.output or ('RTOS_trace.json' if args.json else 'RTOS_trace.pftrace')
+    try:
+        counter_re = re.compile(args.counter)
+        with open(args.capture, 'rb') as f:
+            cap = rte_capture.Capture(f)
+            table = rte_decode.FormatTable(args.fmt, cap.id_bits)
+            if args.json:
+                out = open(output, 'w', encoding='utf-8', newline='\n', buffering=1 << 20)
+                writer = JsonWriter(out)
+            else:
+                out = open(output, 'wb', buffering=1 << 20)
+                writer = ProtoWriter(out)
+            with out:
+                exporter = Exporter(writer, table, cap.frequency, counter_re)
+                for id_field, data, t in rte_capture.messages(f, cap):
+                    exporter.message(id_field, data, t)
+                exporter.close()
+    except re.error as e:
+        print('rte_perfetto: --counter: %s' % e, file=sys.stderr)
+        sys.exit(2)
+    except (OSError, ValueError) as e:
+        print('rte_perfetto: %s' % e, file=sys.stderr)
+        sys.exit(2)
+
+    print('rte_perfetto: %u tasks, %u counters, %u events written to %s (%u bytes)' % (
+        len(exporter.threads), len(exporter.counters), exporter.events, output, os.path.getsize(output)))
+    if args.check:
+        try:
+            checked = (check_json if args.json else check_proto)(output)
+        except (KeyError, IndexError, ValueError) as e:
+            print('rte_perfetto: check failed - %s' % e)
+            sys.exit(1)
+        print('rte_perfetto: %u events checked' % checked)
+    sys.exit(0 if exporter.events else 1)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,316 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) Branko Premzel.
+#
+# SPDX-License-Identifier: MIT
+#
+
+"""
+@file    rte_query.py
+@author  Branko Premzel
+@brief   Query of a binary capture - filter and aggregate the messages with
+         given names without decoding the whole capture.
+
+Only the FMT words of the selected messages (-m, --since) are found by the
+bulk format ID scan of rte_capture.py, and only these messages are read.
+Every message is a row with the fields:
+ * time    - time [ms],
+ * message - message name,
+ * object  - object name (task, queue, ...) - the first value of the message
+             if it is a string (see rte_columns.py), empty if none,
+ * arg0 .. arg3 - the first four 32-bit words of the message data,
+ * value   - value of the first RTOS_TIMING float signal of the message
+             (e.g. the number of items of the queue), NaN if none,
+ * latency - time since the last --since message with the same object [us]
+             (e.g. from a task notification to the switch-in of the task).
+             Each --since message is used once. NaN if there is none.
+The rows are filtered with the -w predicates (FIELD OP VALUE, OP: = != < <=
+> >= and ~ - regular expression search) and the --start/--end time window,
+then listed or aggregated per object or message (-g: count, min., max. and
+mean of the -f field).
+
+The value is decoded from the format definitions only for the selected
+messages. If they use memo values (e.g. the name of the last task), the
+messages that store the memos are read and decoded too, and the messages of
+%[t-MSGx_NAME] times as well. --check runs the query over all messages of
+the capture, decoded one by one, and compares the results.
+
+Exit code: 0 - OK, 1 - no rows match or the check failed, 2 - file or
+argument error.
+"""
+
+import argparse
+import fnmatch
+import math
+import os
+import re
+import sys
+import time
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import rte_bandwidth    # noqa: E402
+import rte_capture      # noqa: E402
+import rte_columns      # noqa: E402
+import rte_decode       # noqa: E402
+
+FIELDS = ('time', 'message', 'object', 'arg0', 'arg1', 'arg2', 'arg3', 'value', 'latency')
+TEXT_FIELDS = ('message', 'object')
+GROUPS = ('object', 'message', 'all')
+RE_WHERE = re.compile(r'^\s*(\w+)\s*(=|==|!=|<=|>=|<|>|~)\s*(.*?)\s*$')
+DEFAULT_LIMIT = 50
+NAN = float('nan')
+OPERATORS = {
+    '=': lambda a, b: a == b,
+    '==': lambda a, b: a == b,
+    '!=': lambda a, b: a != b,
+    '<': lambda a, b: a < b,
+    '<=': lambda a, b: a <= b,
+    '>': lambda a, b: a > b,
+    '>=': lambda a, b: a >= b,
+}
+
+
+class Predicate:
+    """-w FIELD OP VALUE. The comparisons with NaN are false (except !=)."""
+
+    def __init__(self, text):
+        m = RE_WHERE.match(text)
+        if m is None or m.group(1) not in FIELDS:
+            raise ValueError('bad predicate "%s" - FIELD OP VALUE, FIELD: %s' % (text, ', '.join(FIELDS)))
+        self.field, self.op, operand = m.groups()
+        if self.op == '~':
+            self.test = re.compile(operand).search
+        elif self.field in TEXT_FIELDS:
+            self.operand = operand
+            self.test = lambda value: OPERATORS[self.op](value, self.operand)
+        else:
+            self.operand = float(operand)
+            self.test = lambda value: OPERATORS[self.op](value, self.operand)
+
+    def __call__(self, row):
+        value = row[self.field]
+        return self.test(str(value) if self.op == '~' else value)
+
+
+def block_ids(table, msg):
+    """Format ID fields of a message (all IDs of its block)."""
+    ids = []
+    for id_field in range(msg.base, len(table.by_id)):
+        if table.by_id[id_field] is not msg:
+            break
+        ids.append(id_field)
+    return ids
+
+
+def match_messages(table, patterns):
+    """Messages with the names that match the patterns (* and ? wildcards)."""
+    names = set()
+    for pattern in patterns:
+        found = [name for name, msg in table.messages.items()
+                 if msg.base is not None and fnmatch.fnmatchcase(name, pattern)]
+        if not found:
+            raise ValueError('no message matches %s' % pattern)
+        names.update(found)
+    return names
+
+
+class Query:
+    """Converts the messages to rows and selects the rows."""
+
+    def __init__(self, table, frequency, selected, since, wheres, window, decode_values):
+        self.table = table
+        self.frequency = float(frequency) if frequency else 1.0
+        self.selected = {table.messages[name] for name in selected}
+        self.since = {table.messages[name] for name in since}
+        self.wheres = wheres
+        self.window = window            # (first, last) timestamp or None
+        self.decode_values = decode_values
+        self.decoder = rte_decode.Decoder(table, frequency)
+        self.fields = {}                # message -> object field
+        self.last = {}                  # object -> timestamp of the last --since message
+        self.rows = []
+
+    def dependencies(self):
+        """Messages that must be decoded before the selected ones - memo stores and %[t-MSGx_NAME]."""
+        deps = set()
+        if not self.decode_values:
+            return deps
+        parts = [p for msg in self.selected for _, line in msg.lines for p in line if isinstance(p, rte_decode.Field)]
+        if any(p.source == 'memo' for p in parts):
+            deps.update(msg for msg in self.table.messages.values() if msg.base is not None and msg.stores())
+        deps.update(self.table.messages[p.name] for p in parts
+                    if p.source == 't' and p.name in self.table.messages
+                    and self.table.messages[p.name].base is not None)
+        return deps - self.selected
+
+    def scan_ids(self):
+        return {id_field for msg in self.selected | self.since | self.dependencies()
+                for id_field in block_ids(self.table, msg)}
+
+    def object_name(self, msg, id_field, data):
+        field = self.fields.get(msg, False)
+        if field is False:
+            field = self.fields[msg] = rte_columns.object_field(msg)
+        if field is None:
+            return '', None
+        bits, _ = rte_decode.message_value(msg, id_field, data)
+        return rte_decode.as_string(bits >> field[0], field[1]), bits
+
+    def message(self, id_field, data, t):
+        """Add the row of a message if it passes the predicates."""
+        by_id = self.table.by_id
+        msg = by_id[id_field] if id_field < len(by_id) else None
+        if msg is None:
+            return
+        if msg not in self.selected:
+            if msg in self.since:
+                self.last[self.object_name(msg, id_field, data)[0]] = t
+            if self.decode_values:
+                self.decoder.decode(id_field, data, t, ())
+            return
+        obj, bits = self.object_name(msg, id_field, data)
+        if bits is None:
+            bits, _ = rte_decode.message_value(msg, id_field, data)
+        value = rte_columns.timing_value(self.decoder, id_field, data, t) if self.decode_values else NAN
+        latency = NAN
+        if self.since:
+            since = self.last.pop(obj, None)
+            if since is not None:
+                latency = (t - since) * 1e6 / self.frequency
+            if msg in self.since:
+                self.last[obj] = t
+        if self.window is not None and not self.window[0] <= t <= self.window[1]:
+            return
+        row = {'time': t * 1e3 / self.frequency, 'message': msg.name, 'object': obj, 'value': value,
+               'latency': latency}
+        for k in range(rte_columns.ARGS):
+            row['arg%u' % k] = (bits >> (32 * k)) & 0xFFFFFFFF
+        if all(where(row) for where in self.wheres):
+            self.rows.append(row)
+
+
+def aggregate(rows, group, field):
+    """Return {group key: [count, min, max, sum, values]} of the rows."""
+    result = {}
+    for row in rows:
+        key = 'all' if group == 'all' else row[group]
+        s = result.setdefault(key, [0, None, None, 0.0, 0])
+        s[0] += 1
+        value = row[field]
+        if isinstance(value, (int, float)) and not math.isnan(value):
+            s[1] = value if s[1] is None else min(s[1], value)
+            s[2] = value if s[2] is None else max(s[2], value)
+            s[3] += value
+            s[4] += 1
+    return result
+
+
+def print_groups(rows, group, field):
+    print('%-24s %10s %14s %14s %14s' % (group.capitalize(), 'Count', 'Min', 'Max', 'Mean'))
+    stats = aggregate(rows, group, field)
+    for key in sorted(stats):
+        count, low, high, total, values = stats[key]
+        if values:
+            print('%-24s %10u %14.3f %14.3f %14.3f' % (key or '-', count, low, high, total / values))
+        else:
+            print('%-24s %10u %14s %14s %14s' % (key or '-', count, '-', '-', '-'))
+
+
+def print_rows(rows, limit):
+    print('%14s  %-40s %-16s %12s %12s' % ('Time [ms]', 'Message', 'Object', 'Value', 'Latency [us]'))
+    for row in rows[:limit]:
+        print('%14.6f  %-40s %-16s %12s %12s' % (
+            row['time'], row['message'], row['object'] or '-',
+            '-' if math.isnan(row['value']) else '%g' % row['value'],
+            '-' if math.isnan(row['latency']) else '%.3f' % row['latency']))
+    if len(rows) > limit:
+        print('... %u more rows' % (len(rows) - limit))
+
+
+def same_rows(a, b):
+    def key(row):
+        return tuple('nan' if isinstance(v, float) and math.isnan(v) else v for v in (row[f] for f in FIELDS))
+    return len(a) == len(b) and all(key(x) == key(y) for x, y in zip(a, b))
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Filter and aggregate the messages of a binary capture.')
+    parser.add_argument('capture', help='binary capture file (header and circular buffer)')
+    parser.add_argument('fmt', nargs='+', help='format definition files and the generated rte_fmt_ids.h')
+    parser.add_argument('-m', '--message', action='append', required=True,
+                        help='message name, * and ? wildcards allowed, e.g. MSG2_RTOS_QUEUE_SEND*. Can be repeated')
+    parser.add_argument('-w', '--where', action='append', default=[],
+                        help='predicate FIELD OP VALUE, e.g. object=Ctrl or value>=4. Can be repeated')
+    parser.add_argument('--since', action='append', default=[],
+                        help='latency from the last message with this name and the same object. Can be repeated')
+    parser.add_argument('--start', help='window start time, +time - from the first message (e.g. +2ms)')
+    parser.add_argument('--end', help='window end time, +time - from the first message')
+    parser.add_argument('-g', '--group-by', choices=GROUPS, help='aggregate the rows per object or message')
+    parser.add_argument('-f', '--field', choices=FIELDS[3:],
+                        help='aggregated field (default: latency with --since, otherwise value)')
+    parser.add_argument('--limit', type=int, default=DEFAULT_LIMIT,
+                        help='rows listed without --group-by (default: %u)' % DEFAULT_LIMIT)
+    parser.add_argument('--check', action='store_true', help='compare with the query over all decoded messages')
+    args = parser.parse_args()
+
+    field = args.field or ('latency' if args.since else 'value')
+    try:
+        wheres = [Predicate(text) for text in args.where]
+        with open(args.capture, 'rb') as f, rte_capture.TraceFile(f) as trace:
+            cap = trace.cap
+            table = rte_decode.FormatTable(args.fmt, cap.id_bits)
+            selected = match_messages(table, args.message)
+            since = match_messages(table, args.since)
+            window = None
+            if args.start or args.end:
+                first = next(trace.messages(), (None, None, 0))[2]
+                times = []
+                for text, default in ((args.start, -math.inf), (args.end, math.inf)):
+                    if not text:
+                        times.append(default)
+                        continue
+                    seconds = rte_bandwidth.parse_time(text[1:] if text.startswith('+') else text)
+                    times.append((first if text.startswith('+') else 0) + seconds * cap.frequency)
+                window = tuple(times)
+            decode_values = args.group_by is None or field == 'value' or any(w.field == 'value' for w in wheres)
+
+            def new_query():
+                return Query(table, cap.frequency, selected, since, wheres, window, decode_values)
+
+            started = time.time()
+            query = new_query()
+            read = 0
+            for id_field, data, t in trace.select(query.scan_ids()):
+                if window is not None and t > window[1] + ((1 << cap.tstamp_bits) >> 6):
+                    break       # Later than any message of the window
+                query.message(id_field, data, t)
+                read += 1
+            elapsed = time.time() - started
+
+            failed = False
+            if args.check:
+                started = time.time()
+                reference = new_query()
+                for id_field, data, t in trace.messages():
+                    reference.message(id_field, data, t)
+                check_time = time.time() - started
+                failed = not same_rows(query.rows, reference.rows)
+    except (OSError, re.error, ValueError) as e:
+        print('rte_query: %s' % e, file=sys.stderr)
+        sys.exit(2)
+
+    if args.group_by:
+        print_groups(query.rows, args.group_by, field)
+    else:
+        print_rows(query.rows, args.limit)
+    print('rte_query: %u rows, %u messages read in %.3f s' % (len(query.rows), read, elapsed))
+    if args.check:
+        if failed:
+            print('rte_query: check failed - %u rows over all decoded messages' % len(reference.rows))
+        else:
+            print('rte_query: check OK - %.3f s over all decoded messages' % check_time)
+    sys.exit(1 if failed or not query.rows else 0)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,297 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) Branko Premzel.
+#
+# SPDX-License-Identifier: MIT
+#
+
+"""
+@file    rte_regress.py
+@author  Branko Premzel
+@brief   Performance regression report - the timing distributions of two
+         captures (e.g. of two firmware versions) compared.
+
+The distributions of a capture (its profile) are collected in one pass:
+ * task <name> slice/execution/response - see rte_task_stats.py,
+ * notify <task> latency - time from the first notification of a task that
+   is not running to its next switch-in,
+ * queue <name> items - number of items after every queue send and receive
+   (the Queue<name>_items RTOS timing signal),
+ * api <name> duration - time from an ENTER message to the RETURN message of
+   the same kernel API (Expert/rte_FreeRTOS_trace2_fmt.h, see the
+   ENTER/RETURN pairs of rte_fmt_ids.py). A RETURN closes the last open
+   ENTER of the same API.
+The times are in ns, in the histograms of rte_task_stats.py.
+
+A metric of the new capture is a regression if its values are larger than
+in the baseline by the one-sided Mann-Whitney U test (normal approximation
+with the tie correction, the histogram buckets are the ranks) with p below
+--alpha, and its median or 99th percentile is more than --threshold larger.
+An improvement is the same in the other direction. Metrics with fewer than
+--min-count values in one of the captures are reported but not tested. The
+metrics are ranked by the relative change of the median or 99th percentile
+(the larger one), regressions first.
+
+A baseline can be a capture or a profile saved with --save (JSON), so a
+profile of a reference firmware can be kept for automated gating.
+
+Exit code: 0 - no regression, 1 - regression found, 2 - file or argument
+error.
+"""
+
+import argparse
+import collections
+import json
+import math
+import os
+import re
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import rte_capture      # noqa: E402
+import rte_decode       # noqa: E402
+import rte_fmt_ids      # noqa: E402
+import rte_task_stats   # noqa: E402
+import rte_timing       # noqa: E402
+
+FILE_VERSION = 1
+TIMING = 'RTOS_TIMING'
+RE_QUEUE = re.compile(r'^Queue(\w+)_items$')
+MAX_NESTING = 64            # Open ENTER messages per API
+DEFAULT_ALPHA = 0.01
+DEFAULT_THRESHOLD = 10.0    # [%]
+DEFAULT_MIN_COUNT = 10
+DEFAULT_IGNORE = r'^task IDLE '
+COUNT_METRICS = ('items',)  # Metrics not in ns
+
+
+class Profile:
+    """Distributions of the metrics of a capture - {metric name: histogram}."""
+
+    def __init__(self, table, frequency):
+        self.table = table
+        self.scale = 1e9 / frequency
+        self.timing = rte_task_stats.TaskTiming(frequency)
+        self.decoder = rte_decode.Decoder(table, frequency)
+        self.histograms = collections.defaultdict(rte_task_stats.Histogram)
+        self.notified = {}      # task name -> time of the first notification
+        self.open = collections.defaultdict(list)      # API name -> ENTER times
+        self.handlers = rte_task_stats.handlers(table)
+        for name, msg in table.messages.items():
+            if msg.base is None:
+                continue
+            m = rte_fmt_ids.RE_PAIR.match(name)
+            if m:
+                handler = ('enter' if m.group(2) == 'ENTER' else 'return', m.group(1))
+            elif any(output == TIMING and parts and isinstance(parts[0], str) and parts[0].startswith('f Queue')
+                     for output, parts in msg.lines):
+                handler = ('queue', None)
+            else:
+                continue
+            for id_field in range(msg.base, len(table.by_id)):
+                if table.by_id[id_field] is not msg:
+                    break
+                self.handlers.setdefault(id_field, handler + (msg,))
+
+    def message(self, id_field, data, t):
+        handler = self.handlers.get(id_field)
+        if handler is None:
+            return
+        kind = handler[0]
+        if kind == 'enter':
+            stack = self.open[handler[1]]
+            if len(stack) < MAX_NESTING:
+                stack.append(t)
+        elif kind == 'return':
+            stack = self.open[handler[1]]
+            if stack:
+                self.histograms['api %s duration' % handler[1]].add(round((t - stack.pop()) * self.scale))
+        elif kind == 'queue':
+            _, texts = self.decoder.decode(id_field, data, t, (TIMING,))
+            for line in texts.get(TIMING, ()):
+                _, name, value = rte_timing.parse_line(line)
+                m = RE_QUEUE.match(name or '')
+                if m and value is not None and value != 'R':
+                    self.histograms['queue %s items' % m.group(1)].add(max(0, int(float(value))))
+        else:
+            msg = handler[1]
+            if kind == 'switch':
+                name = rte_task_stats.task_name(msg, id_field, data)
+                notified = self.notified.pop(name, None)
+                if notified is not None:
+                    self.histograms['notify %s latency' % name].add(round((t - notified) * self.scale))
+            elif kind == 'notify':
+                name = rte_task_stats.task_name(msg, id_field, data)
+                current = self.timing.current
+                if (current is None or self.timing.tasks.get(name) is not current) and name not in self.notified:
+                    self.notified[name] = t
+            rte_task_stats.feed(self.timing, kind, msg, id_field, data, t)
+
+    def results(self):
+        result = {name: h for name, h in self.histograms.items() if h.count}
+        for task_name, task in self.timing.tasks.items():
+            for metric, h in task.histograms.items():
+                if h.count:
+                    result['task %s %s' % (task_name, metric)] = h
+        return result
+
+
+def read_profile(file_name, fmt_files):
+    """Profile of a capture or of a file saved with --save."""
+    with open(file_name, 'rb') as f:
+        if f.read(1) == b'{':
+            f.seek(0)
+            try:
+                data = json.load(f)
+            except (json.JSONDecodeError, UnicodeDecodeError) as e:
+                raise ValueError('%s: %s' % (file_name, e))
+            if data.get('version') != FILE_VERSION or data.get('sub_bits') != rte_task_stats.SUB_BITS:
+                raise ValueError('%s: not a profile file of this version' % file_name)
+            return {name: rte_task_stats.Histogram.from_json(h) for name, h in data['metrics'].items()}
+        f.seek(0)
+        cap = rte_capture.Capture(f)
+        table = rte_decode.FormatTable(fmt_files, cap.id_bits)
+        profile = Profile(table, cap.frequency)
+        for id_field, data, t in rte_capture.messages(f, cap):
+            profile.message(id_field, data, t)
+        return profile.results()
+
+
+def save(file_name, histograms, source):
+    data = {'version': FILE_VERSION, 'unit': 'ns', 'sub_bits': rte_task_stats.SUB_BITS, 'source': source,
+            'metrics': {name: h.to_json() for name, h in sorted(histograms.items())}}
+    with open(file_name, 'w', encoding='utf-8') as f:
+        json.dump(data, f, separators=(',', ':'))
+        f.write('\n')
+
+
+def mann_whitney(a, b):
+    """
+    Return the p-values of the one-sided Mann-Whitney U tests of two
+    histograms - (b larger than a, b smaller than a). The values of a bucket
+    are ties.
+    """
+    na, nb = a.count, b.count
+    n = na + nb
+    u = 0.0
+    below = 0               # Values of a in the lower buckets
+    ties = 0
+    for index in sorted(set(a.counts) | set(b.counts)):
+        ca = a.counts.get(index, 0)
+        cb = b.counts.get(index, 0)
+        u += cb * (below + 0.5 * ca)
+        below += ca
+        t = ca + cb
+        ties += t ** 3 - t
+    variance = na * nb / 12.0 * ((n + 1) - ties / (n * (n - 1)))
+    if variance <= 0:
+        return 1.0, 1.0
+    mean = na * nb / 2.0
+    sigma = math.sqrt(variance)
+    z_larger = (u - mean - 0.5) / sigma
+    z_smaller = (mean - u - 0.5) / sigma
+    return 0.5 * math.erfc(z_larger / math.sqrt(2)), 0.5 * math.erfc(z_smaller / math.sqrt(2))
+
+
+def relative(old, new):
+    return (new - old) / max(old, 1) * 100
+
+
+class Comparison:
+    """Result of one metric."""
+
+    def __init__(self, name, a, b, args):
+        self.name = name
+        self.a = a
+        self.b = b
+        self.p = None
+        self.change = 0.0
+        if a is None or b is None:
+            self.result = 'new' if a is None else 'missing'
+            return
+        self.change = max((relative(a.percentile(p), b.percentile(p)) for p in (50, 99)), key=abs)
+        if min(a.count, b.count) < args.min_count:
+            self.result = 'few values'
+            return
+        p_larger, p_smaller = mann_whitney(a, b)
+        changes = [relative(a.percentile(p), b.percentile(p)) for p in (50, 99)]
+        if p_larger < args.alpha and max(changes) > args.threshold:
+            self.result = 'REGRESSION'
+            self.p = p_larger
+            self.change = max(changes)
+        elif p_smaller < args.alpha and min(changes) < -args.threshold:
+            self.result = 'improved'
+            self.p = p_smaller
+            self.change = min(changes)
+        else:
+            self.result = 'same'
+            self.p = min(p_larger, p_smaller)
+
+    def rank(self):
+        return (self.result != 'REGRESSION', self.a is None or self.b is None, -self.change)
+
+
+def value_text(name, h, p):
+    if h is None:
+        return '-'
+    value = h.percentile(p)
+    return '%u' % value if name.rsplit(' ', 1)[-1] in COUNT_METRICS else '%.2f' % (value / 1000)
+
+
+def report(comparisons, baseline, new):
+    print('Regression report: %s -> %s (times in us)' % (baseline, new))
+    print('%4s  %-36s %8s %8s %10s %10s %10s %10s %8s %9s  %s' % (
+        'Rank', 'Metric', 'Count A', 'Count B', 'p50 A', 'p50 B', 'p99 A', 'p99 B', 'Change', 'p-value', 'Result'))
+    for rank, c in enumerate(comparisons, 1):
+        print('%4u  %-36s %8s %8s %10s %10s %10s %10s %7.1f%% %9s  %s' % (
+            rank, c.name, c.a.count if c.a else '-', c.b.count if c.b else '-',
+            value_text(c.name, c.a, 50), value_text(c.name, c.b, 50),
+            value_text(c.name, c.a, 99), value_text(c.name, c.b, 99),
+            c.change, '%.2g' % c.p if c.p is not None else '-', c.result))
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Performance regression report of two captures.')
+    parser.add_argument('baseline', help='baseline capture file or profile (--save)')
+    parser.add_argument('new', help='new capture file or profile')
+    parser.add_argument('fmt', nargs='*', help='format definition files and the generated rte_fmt_ids.h')
+    parser.add_argument('--alpha', type=float, default=DEFAULT_ALPHA,
+                        help='significance level of the test (default: %g)' % DEFAULT_ALPHA)
+    parser.add_argument('--threshold', type=float, default=DEFAULT_THRESHOLD,
+                        help='minimum change of the median or p99 [%%] (default: %g)' % DEFAULT_THRESHOLD)
+    parser.add_argument('--min-count', type=int, default=DEFAULT_MIN_COUNT,
+                        help='minimum number of values of a tested metric (default: %u)' % DEFAULT_MIN_COUNT)
+    parser.add_argument('--ignore', default=DEFAULT_IGNORE,
+                        help='regular expression of the metrics not reported (default: "%s")' % DEFAULT_IGNORE)
+    parser.add_argument('-o', '--save', help='write the profile of the new capture to this JSON file')
+    args = parser.parse_args()
+
+    try:
+        if not 0 < args.alpha < 1 or args.threshold < 0 or args.min_count < 2:
+            raise ValueError('bad --alpha, --threshold or --min-count value')
+        ignore = re.compile(args.ignore) if args.ignore else None
+        profiles = []
+        for file_name in (args.baseline, args.new):
+            profiles.append(read_profile(file_name, args.fmt))
+        if args.save:
+            save(args.save, profiles[1], os.path.basename(args.new))
+    except re.error as e:
+        print('rte_regress: --ignore: %s' % e, file=sys.stderr)
+        sys.exit(2)
+    except (OSError, ValueError, KeyError, TypeError) as e:
+        print('rte_regress: %s' % e, file=sys.stderr)
+        sys.exit(2)
+
+    baseline, new = profiles
+    names = sorted(name for name in set(baseline) | set(new) if ignore is None or not ignore.search(name))
+    comparisons = sorted((Comparison(name, baseline.get(name), new.get(name), args) for name in names),
+                         key=Comparison.rank)
+    report(comparisons, os.path.basename(args.baseline), os.path.basename(args.new))
+    regressions = sum(1 for c in comparisons if c.result == 'REGRESSION')
+    print('rte_regress: %u metrics, %u regressions, %u improved' % (
+        len(comparisons), regressions, sum(1 for c in comparisons if c.result == 'improved')))
+    sys.exit(1 if regressions else 0)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,339 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) Branko Premzel.
+#
+# SPDX-License-Identifier: MIT
+#
+
+"""
+@file    rte_task_stats.py
+@author  Branko Premzel
+@brief   Per-task slice, execution and response time percentiles of a binary
+         capture.
+
+The task timing is reconstructed from the context switch, delay, blocking
+and notification messages (single core trace):
+ * slice - time from a task switch-in to the next switch-in (as in
+   RTOS_tasks.log, the interrupts are included),
+ * activation - from the time a task is made ready to the time it blocks.
+   It starts with a notification of a task that waits for one (TaskNotify,
+   TaskNotifyFromISR, TaskNotifyGiveFromISR), a task moved to the ready list
+   or resumed. A task woken by a timeout, queue or other event without a
+   message that names it starts its activation at the switch-in. It ends with
+   TaskDelay, TaskDelayUntil, a notification wait or take block, blocking on
+   a queue, stream buffer or event group, or the task suspending itself,
+ * execution - run time of the task during an activation (up to the block
+   message),
+ * response - time from the start of the activation to the block message.
+The first activation of a task is skipped if the task state at its start is
+not known (the task was not seen blocked before).
+
+The values are added to HDR style histograms (log-linear buckets, relative
+error below 0.1 %) with a fixed number of buckets, so the memory used does
+not depend on the number of events. The values are in nanoseconds, so the
+histograms of captures with different timestamp frequencies can be merged.
+--save writes them to a JSON file and --merge adds saved files to the report
+(e.g. the results of many captures and devices - the tasks are merged by
+name). The reported percentile is the highest value of its histogram bucket
+(not above the maximum value).
+
+Exit code: 0 - OK, 1 - no task timing found, 2 - file or argument error.
+"""
+
+import argparse
+import json
+import math
+import os
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import rte_capture      # noqa: E402
+import rte_decode       # noqa: E402
+
+SUB_BITS = 11               # Buckets per power of two range: 1 << (SUB_BITS - 1)
+FILE_VERSION = 1
+METRICS = ('slice', 'execution', 'response')
+PERCENTILES = (50, 90, 99, 99.9)
+
+SWITCHED_IN = 'MSG1_RTOS_TASK_SWITCHED_IN'
+READY = ('MSG1_RTOS_MOVED_TASK_TO_READY_STATE', 'MSG1_RTOS_TASK_RESUME', 'MSG1_RTOS_TASK_RESUME_FROM_ISR')
+NOTIFY = ('MSG3_RTOS_TASK_NOTIFY1', 'MSG3_RTOS_TASK_NOTIFY2', 'MSG3_RTOS_TASK_NOTIFY_FROM_ISR1',
+          'MSG3_RTOS_TASK_NOTIFY_FROM_ISR2', 'MSG2_RTOS_TASK_NOTIFY_GIVE_FROM_ISR1',
+          'MSG1_RTOS_TASK_NOTIFY_GIVE_FROM_ISR2')
+NOTIFY_BLOCK = ('MSG3_RTOS_TASK_NOTIFY_TAKE_BLOCK1', 'MSG2_RTOS_TASK_NOTIFY_TAKE_BLOCK2',
+                'MSG4_RTOS_TASK_NOTIFY_WAIT_BLOCK1', 'MSG4_RTOS_TASK_NOTIFY_WAIT_BLOCK2')
+BLOCK = ('MSG1_RTOS_TASK_DELAY', 'MSG1_RTOS_TASK_DELAY_UNTIL', 'MSG1_RTOS_BLOCKING_ON_QUEUE_RECEIVE',
+         'MSG1_RTOS_BLOCKING_ON_QUEUE_PEEK', 'MSG2_RTOS_BLOCKING_ON_QUEUE_SEND',
+         'MSG1_RTOS_BLOCKING_ON_STREAM_BUFFER_SEND', 'MSG1_RTOS_BLOCKING_ON_STREAM_BUFFER_RECEIVE',
+         'MSG3_RTOS_EVENT_GROUP_SYNC_BLOCK', 'MSG2_RTOS_EVENT_GROUP_WAIT_BITS_BLOCK')
+SUSPEND = 'MSG1_RTOS_TASK_SUSPEND'
+
+
+class Histogram:
+    """
+    Log-linear histogram of non-negative integers. Values below 1 << SUB_BITS
+    have their own bucket, larger ones share a bucket with values that differ
+    only in the bits below the top SUB_BITS bits.
+    """
+
+    def __init__(self):
+        self.counts = {}        # bucket index -> count
+        self.count = 0
+        self.total = 0
+        self.min = None
+        self.max = None
+
+    @staticmethod
+    def bucket(value):
+        shift = value.bit_length() - SUB_BITS
+        if shift <= 0:
+            return value
+        return (shift << (SUB_BITS - 1)) + (value >> shift)
+
+    @staticmethod
+    def highest(index):
+        """Highest value of a bucket."""
+        shift = (index >> (SUB_BITS - 1)) - 1
+        if shift <= 0:
+            return index
+        return ((index - (shift << (SUB_BITS - 1))) << shift) + (1 << shift) - 1
+
+    def add(self, value, count=1):
+        index = self.bucket(value)
+        self.counts[index] = self.counts.get(index, 0) + count
+        self.count += count
+        self.total += value * count
+        self.min = value if self.min is None else min(self.min, value)
+        self.max = value if self.max is None else max(self.max, value)
+
+    def merge(self, other):
+        for index, count in other.counts.items():
+            self.counts[index] = self.counts.get(index, 0) + count
+        self.count += other.count
+        self.total += other.total
+        for value in (other.min, other.max):
+            if value is not None:
+                self.min = value if self.min is None else min(self.min, value)
+                self.max = value if self.max is None else max(self.max, value)
+
+    def percentile(self, p):
+        if not self.count:
+            return None
+        rank = max(1, math.ceil(round(p * self.count / 100, 6)))
+        seen = 0
+        for index in sorted(self.counts):
+            seen += self.counts[index]
+            if seen >= rank:
+                return max(self.min, min(self.max, self.highest(index)))
+        return self.max
+
+    def to_json(self):
+        return {'count': self.count, 'total': self.total, 'min': self.min, 'max': self.max,
+                'buckets': sorted(self.counts.items())}
+
+    @classmethod
+    def from_json(cls, data):
+        h = cls()
+        h.counts = {int(index): int(count) for index, count in data['buckets']}
+        h.count, h.total, h.min, h.max = data['count'], data['total'], data['min'], data['max']
+        return h
+
+
+class Task:
+    def __init__(self):
+        self.histograms = {metric: Histogram() for metric in METRICS}
+        self.ready = None           # Activation start time, None - not active
+        self.complete = False       # Activation start is known
+        self.executed = 0           # Run time of the activation
+        self.blocked = None         # Block reason: None (not known), 'notify' or 'other'
+
+
+class TaskTiming:
+    """Task states and histograms. The times are in timestamp counts, the histogram values in ns."""
+
+    def __init__(self, frequency):
+        self.scale = 1e9 / frequency
+        self.tasks = {}
+        self.current = None
+        self.switched_in = None     # Time of the last switch-in
+        self.running = None         # Start of the run time not yet added to the current activation
+
+    def task(self, name):
+        task = self.tasks.get(name)
+        if task is None:
+            task = self.tasks[name] = Task()
+        return task
+
+    def add(self, task, metric, time):
+        task.histograms[metric].add(round(time * self.scale))
+
+    def switch_in(self, name, t):
+        previous = self.current
+        if previous is not None:
+            self.add(previous, 'slice', t - self.switched_in)
+            if previous.ready is not None:
+                previous.executed += t - self.running
+        task = self.current = self.task(name)
+        if task.ready is None:
+            task.ready = t
+            task.complete = task.blocked is not None
+            task.executed = 0
+        self.switched_in = self.running = t
+
+    def block(self, task, reason, t):
+        if task is self.current and task.ready is not None:
+            if task.complete:
+                self.add(task, 'execution', task.executed + t - self.running)
+                self.add(task, 'response', t - task.ready)
+            task.ready = None
+        task.blocked = reason
+
+    def wake(self, name, notify, t):
+        task = self.task(name)
+        if task.ready is not None:
+            return
+        if notify and task.blocked != 'notify':
+            return          # The notification does not unblock the task
+        task.ready = t
+        task.complete = True
+        task.executed = 0
+        if task is self.current:
+            self.running = t        # Woken before it was switched out
+
+
+def task_name(msg, id_field, data):
+    return rte_decode.as_string(rte_decode.message_value(msg, id_field, data)[0])
+
+
+def handlers(table):
+    """Return {format ID field: (kind, message)} of the task timing messages."""
+    result = {}
+    kinds = [(SWITCHED_IN, 'switch')] + [(name, 'ready') for name in READY] + \
+        [(name, 'notify') for name in NOTIFY] + [(name, 'notify_block') for name in NOTIFY_BLOCK] + \
+        [(name, 'block') for name in BLOCK] + [(SUSPEND, 'suspend')]
+    for name, kind in kinds:
+        msg = table.messages.get(name)
+        if msg is None or msg.base is None:
+            continue
+        for id_field in range(msg.base, len(table.by_id)):
+            if table.by_id[id_field] is not msg:
+                break
+            result[id_field] = (kind, msg)
+    if SWITCHED_IN not in table.messages:
+        raise ValueError('%s not defined in the format files' % SWITCHED_IN)
+    return result
+
+
+def feed(timing, kind, msg, id_field, data, t):
+    """Pass a task timing message (kind - see handlers()) to timing."""
+    if kind == 'switch':
+        timing.switch_in(task_name(msg, id_field, data), t)
+    elif kind == 'ready' or kind == 'notify':
+        timing.wake(task_name(msg, id_field, data), kind == 'notify', t)
+    elif kind == 'notify_block':
+        timing.block(timing.task(task_name(msg, id_field, data)), 'notify', t)
+    elif kind == 'suspend':
+        task = timing.task(task_name(msg, id_field, data))
+        if task is timing.current:
+            timing.block(task, 'other', t)
+    elif timing.current is not None:
+        timing.block(timing.current, 'other', t)
+
+
+def collect(f, cap, table, timing):
+    """Feed the task timing messages of a capture to timing. Return the number of messages used."""
+    kinds = handlers(table)
+    used = 0
+    for id_field, data, t in rte_capture.messages(f, cap):
+        handler = kinds.get(id_field)
+        if handler is None:
+            continue
+        used += 1
+        feed(timing, handler[0], handler[1], id_field, data, t)
+    return used
+
+
+def save(file_name, histograms, sources):
+    data = {'version': FILE_VERSION, 'unit': 'ns', 'sub_bits': SUB_BITS, 'sources': sources,
+            'tasks': {name: {metric: h.to_json() for metric, h in metrics.items()}
+                      for name, metrics in sorted(histograms.items())}}
+    with open(file_name, 'w', encoding='utf-8') as f:
+        json.dump(data, f, separators=(',', ':'))
+        f.write('\n')
+
+
+def load(file_name, histograms, sources):
+    with open(file_name, encoding='utf-8') as f:
+        try:
+            data = json.load(f)
+        except json.JSONDecodeError as e:
+            raise ValueError('%s: %s' % (file_name, e))
+    if data.get('version') != FILE_VERSION or data.get('sub_bits') != SUB_BITS:
+        raise ValueError('%s: not a task statistics file of this version' % file_name)
+    sources += data['sources']
+    for name, metrics in data['tasks'].items():
+        target = histograms.setdefault(name, {metric: Histogram() for metric in METRICS})
+        for metric in METRICS:
+            target[metric].merge(Histogram.from_json(metrics[metric]))
+
+
+def report(histograms, sources):
+    print('Task timing of %s' % ', '.join(sources))
+    print('%-8s %-10s %10s' % ('Task', 'Metric', 'Count') +
+          ''.join('%10s' % ('p%g' % p) for p in PERCENTILES) + '%10s %10s' % ('Max', 'Mean') + '   [us]')
+    for name, metrics in sorted(histograms.items()):
+        for metric in METRICS:
+            h = metrics[metric]
+            if not h.count:
+                continue
+            values = [h.percentile(p) for p in PERCENTILES] + [h.max]
+            print('%-8s %-10s %10u' % (name, metric, h.count) +
+                  ''.join('%10.2f' % (v / 1000) for v in values) + ' %10.2f' % (h.total / h.count / 1000))
+            name = ''
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Per-task slice, execution and response time percentiles.')
+    parser.add_argument('capture', nargs='?', help='binary capture file (header and circular buffer)')
+    parser.add_argument('fmt', nargs='*', help='format definition files and the generated rte_fmt_ids.h')
+    parser.add_argument('-o', '--save', help='write the histograms to this JSON file')
+    parser.add_argument('-m', '--merge', action='append', default=[],
+                        help='add the histograms of a file written with --save. Can be repeated')
+    args = parser.parse_args()
+
+    histograms = {}
+    sources = []
+    try:
+        if args.capture is None and not args.merge:
+            raise ValueError('a capture file or --merge is required')
+        if args.capture is not None:
+            if not args.fmt:
+                raise ValueError('format definition files are required')
+            with open(args.capture, 'rb') as f:
+                cap = rte_capture.Capture(f)
+                table = rte_decode.FormatTable(args.fmt, cap.id_bits)
+                timing = TaskTiming(cap.frequency)
+                if not collect(f, cap, table, timing):
+                    print('rte_task_stats: no task switch, block or notification messages in %s' % args.capture,
+                          file=sys.stderr)
+            histograms = {name: task.histograms for name, task in timing.tasks.items()}
+            sources.append(os.path.basename(args.capture))
+        for file_name in args.merge:
+            load(file_name, histograms, sources)
+        if args.save:
+            save(args.save, histograms, sources)
+    except (OSError, ValueError, KeyError, TypeError) as e:
+        print('rte_task_stats: %s' % e, file=sys.stderr)
+        sys.exit(2)
+
+    histograms = {name: metrics for name, metrics in histograms.items()
+                  if any(h.count for h in metrics.values())}
+    if not histograms:
+        print('rte_task_stats: no task timing found', file=sys.stderr)
+        sys.exit(1)
+    report(histograms, sources)
+    sys.exit(0)
+
+
+if __name__ == '__main__':
+    main()
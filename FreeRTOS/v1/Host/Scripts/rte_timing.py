@@ -0,0 +1,337 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) Branko Premzel.
+#
+# SPDX-License-Identifier: MIT
+#
+
+"""
+@file    rte_timing.py
+@author  Branko Premzel
+@brief   RTOS timing signals - the RTOS_TIMING lines of the decoded messages
+         converted to value changes of waveform signals.
+
+Every RTOS_TIMING line of the format definitions has the form
+"x SignalName=value" (see RTOS_trace_customization_and_porting.adoc):
+ * x - signal type: b - binary, f - float or integer, s - string,
+ * value P - pulse (binary signal set to 1 and cleared one time unit later),
+ * value R - reset to 0, only if the signal already exists.
+
+A signal is declared when its first value is written, so only the objects
+that were active during the capture get signals. The value changes go to a
+waveform writer with the interface:
+ * declare(name, kind) - returns the handle of a new signal (kind b, f or s),
+ * change(time, handle, value) - value '0', '1' or 'x', a float or a string,
+ * close().
+The times passed to the writer never decrease.
+"""
+
+import collections
+import math
+import os
+import re
+import sys
+import tempfile
+import time as time_module
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import rte_decode       # noqa: E402
+
+TIMESCALES = {0: '1s', -3: '1ms', -6: '1us', -9: '1ns', -12: '1ps', -15: '1fs'}
+RE_SPACE = re.compile(r'\s')
+
+
+def timescale(frequency):
+    """
+    Return (exponent, units per timestamp tick). The coarsest time unit that
+    holds an integer number of ticks is used, otherwise 1 ps.
+    """
+    for exponent in (0, -3, -6, -9, -12, -15):
+        scale = 10 ** -exponent
+        if frequency and scale % frequency == 0:
+            return exponent, scale // frequency
+    return -12, 1e12 / frequency if frequency else 1
+
+
+def file_info(capture, tool):
+    """Date and version text of the waveform files - the capture time and name."""
+    date = time_module.asctime(time_module.localtime(os.path.getmtime(capture)))
+    return date, 'RTEdbg %s - %s' % (tool, os.path.basename(capture))
+
+
+def export(f, cap, table, writers):
+    """
+    Decode the capture and pass the RTOS timing signals to the writers.
+    Return the TimingSignals object of every writer (closed).
+    """
+    _, scale = timescale(cap.frequency)
+    signals = [TimingSignals(w) for w in writers]
+    for timestamp, _, texts in rte_decode.events(f, cap, table, {'RTOS_TIMING'}):
+        t = round(timestamp * scale)
+        for s in signals:
+            for line in texts['RTOS_TIMING']:
+                s.add(t, line)
+    for s in signals:
+        s.close()
+    return signals
+
+
+def parse_line(text):
+    """
+    Return (kind, name, value) of an RTOS_TIMING line, or (None, None, None)
+    if the line is not valid. The value of a float signal is converted to a
+    float (None - not a number), unless it is R.
+    """
+    kind, _, definition = text.partition(' ')
+    name, sep, value = definition.partition('=')
+    name = RE_SPACE.sub('_', name.strip())
+    if kind not in ('b', 'f', 's') or not sep or not name:
+        return None, None, None
+    if kind == 'f' and value != 'R':
+        try:
+            value = float(value)
+        except ValueError:
+            value = None
+        if value is not None and math.isnan(value):
+            value = None
+    return kind, name, value
+
+
+class TimingSignals:
+    """Value changes of the signals defined by the RTOS_TIMING lines."""
+
+    def __init__(self, writer):
+        self.writer = writer
+        self.signals = {}       # name -> (handle, kind)
+        self.pulses = collections.OrderedDict()     # handle -> time of the pulse end
+        self.time = 0
+
+    def add(self, time, text):
+        """Process one formatted RTOS_TIMING line at the time given in writer time units."""
+        self.change(time, *parse_line(text))
+
+    def change(self, time, kind, name, value):
+        """Process a line parsed by parse_line()."""
+        time = max(time, self.time)
+        self.end_pulses(time)
+        self.time = time
+        if kind is None:
+            return
+        signal = self.signals.get(name)
+        if value == 'R':
+            if signal is not None:
+                handle, kind = signal
+                self.pulses.pop(handle, None)
+                if kind != 's':
+                    self.writer.change(time, handle, '0' if kind == 'b' else 0.0)
+            return
+        if signal is None:
+            signal = self.signals[name] = (self.writer.declare(name, kind), kind)
+        handle, kind = signal
+
+        if kind == 'b':
+            self.pulses.pop(handle, None)
+            if value == 'P':
+                self.writer.change(time, handle, '1')
+                self.pulses[handle] = time + 1
+            else:
+                self.writer.change(time, handle, value if value in ('0', '1') else 'x')
+        elif kind == 'f':
+            if isinstance(value, float):
+                self.writer.change(time, handle, value)
+        else:
+            self.writer.change(time, handle, value)
+
+    def end_pulses(self, time):
+        while self.pulses:
+            handle, end = next(iter(self.pulses.items()))
+            if end > time:
+                break
+            del self.pulses[handle]
+            self.writer.change(end, handle, '0')
+
+    def close(self):
+        if self.pulses:
+            self.end_pulses(max(self.pulses.values()))
+        self.writer.close()
+
+
+def vcd_code(handle):
+    """VCD identifier code of a signal handle (1, 2, ...)."""
+    index = handle - 1
+    code = ''
+    while True:
+        code += chr(33 + index % 94)
+        index //= 94
+        if index == 0:
+            return code
+        index -= 1
+
+
+def vcd_value(kind, code, value):
+    if kind == 'b':
+        return '%s%s\n' % (value, code)
+    if kind == 'f':
+        return 'r%.16g %s\n' % (value, code)
+    return 's%s %s\n' % (RE_SPACE.sub('_', value), code)
+
+
+class VcdWriter:
+    """
+    Text VCD writer. The value changes are written to a temporary file (in
+    spool_dir, default: system temporary folder) in blocks of buffer_size
+    bytes, and the header with the declarations of all signals is written
+    when the writer is closed. The changes of the same time are sorted by
+    the signal handle.
+    """
+
+    VAR_TYPES = {'b': 'wire 1', 'f': 'real 64', 's': 'string 1'}
+
+    def __init__(self, f, exponent, date='', version='', scope='RTOS', spool_dir=None, buffer_size=1 << 20):
+        self.f = f
+        self.exponent = exponent
+        self.date = date
+        self.version = version
+        self.scope = scope
+        self.signals = []
+        self.codes = []
+        self.body = tempfile.TemporaryFile('w+', encoding='utf-8', newline='\n', dir=spool_dir,
+                                           buffering=buffer_size)
+        self.buffer_size = buffer_size
+        self.time = None
+        self.written_time = None
+        self.start_time = None
+        self.size = 0
+        self.pending = []
+
+    def declare(self, name, kind):
+        self.signals.append((name, kind))
+        self.codes.append(vcd_code(len(self.signals)))
+        return len(self.signals)
+
+    def initial(self, time, values):
+        """Values of the signals (None - no value yet) at the start of the file."""
+        lines = ['#%u\n$dumpvars\n' % time]
+        for handle, value in enumerate(values, 1):
+            if value is not None:
+                lines.append(vcd_value(self.signals[handle - 1][1], self.codes[handle - 1], value))
+        lines.append('$end\n')
+        self.write(''.join(lines))
+        self.time = self.written_time = self.start_time = time
+
+    def change(self, time, handle, value):
+        if time != self.time:
+            self.flush_time()
+            self.time = time
+            if self.start_time is None:
+                self.start_time = time
+        self.pending.append((handle, value))
+
+    def flush_time(self):
+        if not self.pending:
+            return
+        self.pending.sort(key=lambda c: c[0])
+        lines = ['#%u\n' % self.time] if self.time != self.written_time else []
+        for handle, value in self.pending:
+            lines.append(vcd_value(self.signals[handle - 1][1], self.codes[handle - 1], value))
+        self.write(''.join(lines))
+        self.written_time = self.time
+        self.pending = []
+
+    def write(self, text):
+        self.body.write(text)
+        self.size += len(text)
+
+    def header(self):
+        lines = ['$date %s $end\n' % self.date, '$version %s $end\n' % self.version,
+                 '$timescale %s $end\n' % TIMESCALES.get(self.exponent, '1ps'),
+                 '$scope module %s $end\n' % self.scope]
+        for handle, (name, kind) in enumerate(self.signals, 1):
+            lines.append('$var %s %s %s $end\n' % (self.VAR_TYPES[kind], vcd_code(handle), name))
+        lines += ['$upscope $end\n', '$enddefinitions $end\n']
+        return ''.join(lines)
+
+    def close(self):
+        self.flush_time()
+        self.f.write(self.header())
+        self.body.seek(0, os.SEEK_SET)
+        while True:
+            block = self.body.read(self.buffer_size)
+            if not block:
+                break
+            self.f.write(block)
+        self.body.close()
+
+
+class RotatingVcdWriter:
+    """
+    VCD writer for long captures. A new file is started when the current one
+    reaches max_bytes of value changes or covers max_time (0 - no limit); the
+    files are named <base>_000<ext>, <base>_001<ext>, ... (only <base><ext>
+    without limits). A file is never split within one time value.
+
+    Every file can be loaded on its own: it declares all signals known when
+    it is closed, and starts with the values of all signals at its start time
+    ($dumpvars). A file is written only when it is complete, so the finished
+    files can be opened while the capture is still being decoded. The memory
+    used does not depend on the capture length.
+    """
+
+    def __init__(self, path, exponent, date='', version='', max_bytes=0, max_time=0, buffer_size=1 << 20):
+        self.path = path
+        self.exponent = exponent
+        self.date = date
+        self.version = version
+        self.max_bytes = max_bytes
+        self.max_time = max_time
+        self.buffer_size = buffer_size
+        self.signals = []
+        self.values = []
+        self.writer = None
+        self.file = None
+        self.files = []
+
+    def file_name(self):
+        if not self.max_bytes and not self.max_time:
+            return self.path
+        base, ext = os.path.splitext(self.path)
+        return '%s_%03u%s' % (base, len(self.files), ext or '.vcd')
+
+    def start(self, time):
+        name = self.file_name()
+        self.files.append(name)
+        self.file = open(name, 'w', encoding='utf-8', newline='\n', buffering=self.buffer_size)
+        self.writer = VcdWriter(self.file, self.exponent, self.date, self.version,
+                                spool_dir=os.path.dirname(os.path.abspath(name)), buffer_size=self.buffer_size)
+        for signal, kind in self.signals:
+            self.writer.declare(signal, kind)
+        if len(self.files) > 1:
+            self.writer.initial(time, self.values)
+
+    def finish(self):
+        self.writer.close()
+        self.file.close()
+        self.writer = None
+
+    def declare(self, name, kind):
+        self.signals.append((name, kind))
+        self.values.append(None)
+        if self.writer is not None:
+            self.writer.declare(name, kind)
+        return len(self.signals)
+
+    def change(self, time, handle, value):
+        w = self.writer
+        if w is None:
+            self.start(time)
+        elif time != w.time and (self.max_bytes and w.size >= self.max_bytes
+                                 or self.max_time and time - w.start_time >= self.max_time):
+            self.finish()
+            self.start(time)
+        self.values[handle - 1] = value
+        self.writer.change(time, handle, value)
+
+    def close(self):
+        if self.writer is None:
+            self.start(0)
+        self.finish()
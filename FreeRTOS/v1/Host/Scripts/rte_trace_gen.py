@@ -0,0 +1,240 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) Branko Premzel.
+#
+# SPDX-License-Identifier: MIT
+#
+
+"""
+@file    rte_trace_gen.py
+@author  Branko Premzel
+@brief   Generate the packing macros and the format definitions of the packed
+         trace message data words from the event schema.
+
+Several FreeRTOS trace messages pack two or more values into one data word
+(e.g. the ticks to wait and the number of items of traceQUEUE_RECEIVE). The
+bit layout is described once in rte_FreeRTOS_trace_schema.json:
+ * layouts - fields packed from bit 0 up, with the number of bits and the
+   limit for larger values (saturate or mask),
+ * messages - the packed data word ("word") or words ("words", e.g. the
+   histograms) of the message, its layout and its format definition lines.
+All messages of rte_FreeRTOS_trace.h and rte_FreeRTOS_trace.c with a packed
+data word are listed. The other data words hold one value each.
+
+Generated from the schema:
+ * the packing header (rte_FreeRTOS_trace_pack.h) with one RTE_PACK_<layout>()
+   macro per layout - used by the trace macros in rte_FreeRTOS_trace.h,
+ * the format definition lines of the listed messages in the format files.
+   The placeholders in the format strings are replaced by the field sizes:
+     %[=field]     -> %[bits]        (next bits of the message)
+     %[=field:u]   -> %[bitsu]
+     %[@field:u]   -> %[position:bitsu]  (absolute bit position in the message)
+
+The sequential placeholders of each output must be in the packing order - in
+a message with several packed words, a placeholder refers to the field in the
+next packed word once the field of the current word has been used. The
+absolute placeholders can only be used in messages with one packed word. The
+fields of a layout must fit into one word. The files are only written if
+they change. With --check, nothing is written and the exit code is 1 if any
+generated file differs from the one in the source tree (out of date or
+edited by hand).
+
+Exit code: 0 - OK, 1 - files differ (--check), 2 - schema error.
+"""
+
+import argparse
+import json
+import os
+import re
+import sys
+
+RE_PLACEHOLDER = re.compile(r'%\[([=@])(\w+)(?::(\w))?\]')
+RE_MSG_WORDS = re.compile(r'^MSG(\d)_')
+LIMITS = ('saturate', 'mask')
+
+
+def fail(text):
+    print('rte_trace_gen: %s' % text, file=sys.stderr)
+    sys.exit(2)
+
+
+def check_schema(schema):
+    """Validate the layouts and compute the bit position of every field."""
+    for name, layout in schema['layouts'].items():
+        position = 0
+        for field in layout['fields']:
+            if field['limit'] not in LIMITS:
+                fail('%s.%s: unknown limit "%s"' % (name, field['name'], field['limit']))
+            if not 0 < field['bits'] <= 32:
+                fail('%s.%s: bad number of bits' % (name, field['name']))
+            field['position'] = position
+            position += field['bits']
+        if position > 32:
+            fail('%s: the fields need %u bits - more than one data word' % (name, position))
+
+    for msg in schema['messages']:
+        if msg['layout'] not in schema['layouts']:
+            fail('%s: unknown layout %s' % (msg['name'], msg['layout']))
+        msg['words'] = msg.get('words', [msg.get('word')])
+        m = RE_MSG_WORDS.match(msg['name'])
+        for word in msg['words']:
+            if m is None or not isinstance(word, int) or not 0 <= word < int(m.group(1)):
+                fail('%s: data word %s does not exist' % (msg['name'], word))
+        if msg['words'] != sorted(set(msg['words'])):
+            fail('%s: the packed words must be listed in ascending order' % msg['name'])
+
+
+def expand_format(msg, layout):
+    """Replace the field placeholders of the format lines with the field sizes."""
+    fields = {f['name']: f for f in layout['fields']}
+    last_position = {}
+    lines = []
+    for line in msg['format']:
+        output = line.split(' ', 1)[0]
+
+        def replace(m):
+            field = fields.get(m.group(2))
+            if field is None:
+                fail('%s: unknown field %s' % (msg['name'], m.group(2)))
+            value_type = m.group(3) or ''
+            if m.group(1) == '@':
+                if len(msg['words']) != 1:
+                    fail('%s: %%[@%s] in a message with several packed words' % (msg['name'], field['name']))
+                return '%%[%u:%u%s]' % (msg['words'][0] * 32 + field['position'], field['bits'], value_type)
+            # The field in the first packed word after the previous placeholder
+            previous = last_position.get(output, -1)
+            position = next((w * 32 + field['position'] for w in msg['words']
+                             if w * 32 + field['position'] > previous), None)
+            if position is None:
+                fail('%s: field %s is out of the packing order in %s' % (msg['name'], field['name'], output))
+            last_position[output] = position
+            return '%%[%u%s]' % (field['bits'], value_type)
+
+        lines.append('// ' + RE_PLACEHOLDER.sub(replace, line))
+    return lines
+
+
+def pack_macro(name, layout, messages):
+    """RTE_PACK_<layout>() macro with the layout description."""
+    parts = []
+    desc = []
+    for f in layout['fields']:
+        top = f['position'] + f['bits'] - 1
+        bits = 'bit %u' % top if f['bits'] == 1 else 'bits %u-%u' % (f['position'], top)
+        desc.append('%s (%s, %s)' % (f['name'], bits, 'saturated' if f['limit'] == 'saturate' else 'masked'))
+        max_value = '0x%XU' % ((1 << f['bits']) - 1)
+        value = 'RTE_PACK_%s((%s), %s)' % ('SAT' if f['limit'] == 'saturate' else 'MASK', f['name'], max_value)
+        if f['position']:
+            value = '(%s << %uU)' % (value, f['position'])
+        parts.append(value)
+
+    lines = ['/* %s' % layout['description'],
+             ' * %s' % ', '.join(desc),
+             ' * Used by: %s */' % ', '.join(messages),
+             '#define RTE_PACK_%s(%s) \\' % (name, ', '.join(f['name'] for f in layout['fields'])),
+             '    (%s)' % ' | '.join(parts)]
+    return lines
+
+
+def pack_header(schema, file_name):
+    users = {}
+    for msg in schema['messages']:
+        users.setdefault(msg['layout'], []).append(msg['name'])
+
+    out = ['/*',
+           ' * Copyright (c) Branko Premzel.',
+           ' *',
+           ' * SPDX-License-Identifier: MIT',
+           ' */',
+           '',
+           '/*******************************************************************************',
+           ' * @file    %s' % file_name,
+           ' * @author  Branko Premzel',
+           ' * @brief   Packing of several values into one data word - all packed data',
+           ' *          words of rte_FreeRTOS_trace.h and rte_FreeRTOS_trace.c. The',
+           ' *          Expert messages (rte_FreeRTOS_trace2.h) have no packed words.',
+           ' * @note    Generated by Host/Scripts/rte_trace_gen.py from',
+           ' *          rte_FreeRTOS_trace_schema.json - do not edit. The format',
+           ' *          definitions of the same messages are generated from the schema.',
+           ' ******************************************************************************/',
+           '',
+           '#ifndef RTE_FREERTOS_TRACE_PACK_H',
+           '#define RTE_FREERTOS_TRACE_PACK_H',
+           '',
+           '#define RTE_PACK_SAT(value, max)    (((value) > (max)) ? (uint32_t)(max) : (uint32_t)(value))',
+           '#define RTE_PACK_MASK(value, mask)  ((uint32_t)(value) & (uint32_t)(mask))',
+           '']
+    for name, layout in schema['layouts'].items():
+        out += pack_macro(name, layout, users.get(name, []))
+        out.append('')
+    out += ['#endif  // RTE_FREERTOS_TRACE_PACK_H', '', '/*==== End of file ====*/']
+    return '\n'.join(out) + '\n'
+
+
+def update_fmt(text, messages, schema):
+    """Replace the format lines after each '// MSGx_NAME' line of the listed messages."""
+    lines = text.split('\n')
+    for msg in messages:
+        try:
+            start = lines.index('// ' + msg['name']) + 1
+        except ValueError:
+            fail('%s: not found in %s' % (msg['name'], msg['fmt_file']))
+        end = start
+        while end < len(lines) and lines[end].startswith('// >'):
+            end += 1
+        lines[start:end] = expand_format(msg, schema['layouts'][msg['layout']])
+    return '\n'.join(lines)
+
+
+def main():
+    default_schema = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', '..',
+                                  'rte_FreeRTOS_trace_schema.json')
+    parser = argparse.ArgumentParser(description='Generate the packed data word macros and format definitions.')
+    parser.add_argument('schema', nargs='?', default=default_schema, help='event schema (JSON)')
+    parser.add_argument('--check', action='store_true',
+                        help='only check that the generated files are up to date')
+    args = parser.parse_args()
+
+    try:
+        with open(args.schema, encoding='utf-8') as f:
+            schema = json.load(f)
+    except (OSError, ValueError) as e:
+        fail('%s: %s' % (args.schema, e))
+    try:
+        check_schema(schema)
+    except (KeyError, TypeError) as e:
+        fail('schema error: %s' % e)
+
+    base = os.path.dirname(os.path.abspath(args.schema))
+    outputs = {os.path.join(base, schema['pack_header']): pack_header(schema, schema['pack_header'])}
+    by_file = {}
+    for msg in schema['messages']:
+        by_file.setdefault(msg['fmt_file'], []).append(msg)
+    for fmt_file, messages in by_file.items():
+        path = os.path.join(base, fmt_file)
+        try:
+            with open(path, encoding='utf-8', newline='') as f:
+                outputs[path] = update_fmt(f.read(), messages, schema)
+        except OSError as e:
+            fail(str(e))
+
+    differ = 0
+    for path, text in outputs.items():
+        try:
+            with open(path, encoding='utf-8', newline='') as f:
+                if f.read() == text:
+                    continue
+        except OSError:
+            pass
+        differ += 1
+        if args.check:
+            print('rte_trace_gen: %s is not up to date with the schema' % path, file=sys.stderr)
+        else:
+            with open(path, 'w', encoding='utf-8', newline='') as f:
+                f.write(text)
+            print('rte_trace_gen: %s updated' % path)
+    sys.exit(1 if args.check and differ else 0)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,316 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) Branko Premzel.
+#
+# SPDX-License-Identifier: MIT
+#
+
+"""
+@file    rte_tune.py
+@author  Branko Premzel
+@brief   Trace configuration tuner - trace macro groups and heap/ISR options
+         for a history length target.
+
+Reads a full-detail binary capture (all trace macro groups enabled, e.g.
+rte_posix_demo -d or a target capture) and the format definition files, and
+finds the configuration with the most detail that keeps at least the target
+history in a circular buffer of the given size. Example: at least 500 ms of
+BASIC and QUEUE history in 16 KB:
+
+    rte_tune.py capture.bin rte_fmt_ids.h rte_FreeRTOS_trace_fmt.h -t 500ms -b 16K -r BASIC+QUEUE
+
+The candidate configurations are simulated on the captured message stream:
+ * trace macro groups - RTE_TRACE_RTOS_xxx (the messages of a disabled
+   group are removed),
+ * heap profiler - RTE_TRACE_RTOS_HEAP_PROFILE with RTE_RTOS_HEAP_SUMMARY_PERIOD
+   (the malloc/free messages are replaced by a summary every N calls),
+ * ISR trace - RTE_RTOS_ISR_EVENTS 0 (ISR enter/exit messages removed, only
+   the per-IRQ counters are logged). If the ISR group is disabled and the
+   EXPERT group is enabled, the ISR enter/exit messages are logged by the
+   EXPERT group (MSG0).
+
+Candidates are ordered by detail: the number of enabled groups, then the
+malloc/free and ISR event messages before the summaries and counters, then
+the number of retained messages. The first candidate that meets the target
+is recommended. Its history is the minimum history (rte_bandwidth.py) - the
+shortest time span held by the buffer at any point of the capture. If the
+capture contains less data than the buffer, the buffer holds the whole
+capture and the average history is used instead. The result is printed as
+a FreeRTOSConfig.h fragment.
+
+Exit code: 0 - configuration found, 1 - no configuration meets the target
+(the most compact one is printed), 2 - file or argument error.
+"""
+
+import argparse
+import itertools
+import os
+import re
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import rte_bandwidth    # noqa: E402
+import rte_capture      # noqa: E402
+
+# Group name, filter, configuration macro
+GROUPS = [
+    ('BASIC',   'F_RTOS_BASIC',   'RTE_TRACE_RTOS_BASIC'),
+    ('TASKS',   'F_RTOS_TASKS',   'RTE_TRACE_RTOS_TASKS'),
+    ('MALLOC',  'F_RTOS_MALLOC',  'RTE_TRACE_RTOS_MALLOC'),
+    ('TIMER',   'F_RTOS_TIMER',   'RTE_TRACE_RTOS_TIMER'),
+    ('QUEUE',   'F_RTOS_QUEUE',   'RTE_TRACE_RTOS_QUEUE'),
+    ('STREAMS', 'F_RTOS_STREAMS', 'RTE_TRACE_RTOS_STREAMS'),
+    ('EXPERT',  'F_RTOS_EXPERT',  'RTE_TRACE_RTOS_EXPERT'),
+    ('ISR',     'F_RTOS_ISR',     'RTE_TRACE_RTOS_ISR_IRQ'),
+]
+
+HEAP_EVENTS = ('MSG2_RTOS_MALLOC', 'MSG2_RTOS_FREE')
+HEAP_SUMMARY = ('MSG5_RTOS_HEAP_SUMMARY', 'MSG8_RTOS_HEAP_SIZE_HISTOGRAM')
+HEAP_SITE = 'MSG5_RTOS_HEAP_SITE'
+ISR_EVENTS = ('MSG1_RTOS_ISR_ENTER_IRQ', 'MSG1_RTOS_ISR_EXIT_IRQ')
+ISR_EXPERT_BYTES = 4        # MSG0 - FMT word only
+
+KIND_NORMAL, KIND_HEAP, KIND_ISR = range(3)
+BATCH = 32                  # Candidates simulated in one pass over the capture
+
+
+def message_bytes(name):
+    """Size of a MSGn message in the buffer (data words, top bits word for n > 4, FMT word)."""
+    n = int(re.match(r'MSG(\d+)_', name).group(1))
+    return 4 * (n + 1 + (1 if n > 4 else 0))
+
+
+class Candidate:
+    """One configuration - enabled groups, heap summary period (0 - malloc/free
+    messages) and ISR events (True) or counters only (False)."""
+
+    def __init__(self, groups, heap_period, isr_events, bits):
+        self.groups = groups
+        self.heap_period = heap_period
+        self.isr_events = isr_events
+        self.mask = sum(bits[g] for g in groups)
+        self.isr_bit = bits.get('ISR', 0)
+        self.expert_bit = bits.get('EXPERT', 0)
+        self.heap_bit = bits.get('MALLOC', 0)
+        self.heap_calls = 0
+        self.history = None
+        self.bytes = 0
+        self.messages = 0
+
+    def detail(self):
+        return (len(self.groups), self.heap_period == 0, self.isr_events, -self.heap_period, self.messages)
+
+    def size(self, bit, kind, size):
+        """Size of a captured message in this configuration (0 - not logged)."""
+        if kind == KIND_ISR:
+            if self.mask & self.isr_bit:
+                return size if self.isr_events else 0
+            return ISR_EXPERT_BYTES if self.mask & self.expert_bit else 0
+        if bit != 0 and not self.mask & bit:
+            return 0
+        if kind == KIND_HEAP and self.heap_period:
+            return 0
+        return size
+
+    def heap_summary(self, summary_bytes):
+        """Count a malloc/free call - return the size of the summary logged after it."""
+        if self.heap_period == 0 or not self.mask & self.heap_bit:
+            return 0
+        self.heap_calls += 1
+        return summary_bytes if self.heap_calls % self.heap_period == 0 else 0
+
+
+def classify(table):
+    """Format ID -> (filter bit, message kind)."""
+    kinds = []
+    for id_field in range(len(table.by_id)):
+        name, filter_no = table.lookup(id_field)
+        bit = (1 << filter_no) if filter_no > 0 else 0
+        kind = KIND_HEAP if name in HEAP_EVENTS else KIND_ISR if name in ISR_EVENTS else KIND_NORMAL
+        kinds.append((bit, kind))
+    return kinds
+
+
+def first_pass(f, cap, kinds):
+    """Totals per (filter bit, kind) and the capture duration."""
+    totals = {}
+    first = last = None
+    for id_field, n_words, timestamp in rte_bandwidth.records(f, cap):
+        key = kinds[id_field]
+        t = totals.setdefault(key, [0, 0])
+        t[0] += 1
+        t[1] += n_words * 4
+        if first is None:
+            first = timestamp
+        last = timestamp
+    duration = (last - first) / cap.frequency if first is not None and cap.frequency else 0.0
+    return totals, duration
+
+
+def estimate(candidate, totals, summary_bytes, summary_messages):
+    """Bytes and messages of a candidate from the first pass totals."""
+    size = count = 0
+    for (bit, kind), (n, b) in totals.items():
+        per_message = candidate.size(bit, kind, b // n)
+        if per_message:
+            size += per_message * n
+            count += n
+        if kind == KIND_HEAP and candidate.heap_period and candidate.mask & candidate.heap_bit:
+            summaries = n // candidate.heap_period
+            size += summaries * summary_bytes
+            count += summaries * summary_messages
+    candidate.bytes = size
+    candidate.messages = count
+
+
+def simulate(f, cap, kinds, batch, buffer_bytes, summary_bytes):
+    """Pass the captured messages through a simulated buffer for every candidate."""
+    for c in batch:
+        c.history = rte_bandwidth.History(c.mask, buffer_bytes)
+        c.heap_calls = 0
+    for id_field, n_words, timestamp in rte_bandwidth.records(f, cap):
+        bit, kind = kinds[id_field]
+        size = n_words * 4
+        for c in batch:
+            s = c.size(bit, kind, size)
+            if s:
+                c.history.add(timestamp, s)
+            if kind == KIND_HEAP:
+                s = c.heap_summary(summary_bytes)
+                if s:
+                    c.history.add(timestamp, s)
+
+
+def fragment(c, args, present, buffer_bytes, history, average, rate):
+    lines = ['/* RTEdbg trace configuration - generated by rte_tune.py from %s'
+             % os.path.basename(args.capture),
+             ' * Target: %.6f s of history in %u bytes, required groups: %s' % (
+                 args.time, buffer_bytes, '+'.join(args.required) if args.required else '-'),
+             ' * Estimated history: %s, average %.6f s (%.0f bytes/s) */' % (
+                 'minimum %.6f s' % history if history is not None else 'capture shorter than the buffer',
+                 average, rate)]
+    for group, _, macro in GROUPS:
+        if group == 'MALLOC' and c.heap_period:
+            continue
+        note = '' if group in present else '      // not in the capture'
+        lines.append('#define %-36s %u%s' % (macro, 1 if group in c.groups else 0, note))
+    if 'MALLOC' in c.groups:
+        if c.heap_period:
+            lines.append('#define %-36s 1' % 'RTE_TRACE_RTOS_HEAP_PROFILE')
+            lines.append('#define %-36s %uU' % ('RTE_RTOS_HEAP_SUMMARY_PERIOD', c.heap_period))
+        else:
+            lines.append('#define %-36s 0' % 'RTE_TRACE_RTOS_HEAP_PROFILE')
+    if 'ISR' in c.groups:
+        lines.append('#define %-36s %u' % ('RTE_RTOS_ISR_EVENTS', 1 if c.isr_events else 0))
+    lines.append('/* RTEdbg buffer: RTE_BUFFER_SIZE %u (32-bit words), message filter 0x%08X */'
+                 % (buffer_bytes // 4, c.mask))
+    return '\n'.join(lines) + '\n'
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Tune the FreeRTOS trace configuration for a history target.')
+    parser.add_argument('capture', help='full-detail binary capture file')
+    parser.add_argument('fmt', nargs='+', help='format definition files or the generated rte_fmt_ids.h')
+    parser.add_argument('-t', '--time', required=True, type=rte_bandwidth.parse_time,
+                        help='required history, e.g. 500ms')
+    parser.add_argument('-b', '--buffer', required=True, help='buffer size in bytes, K or M suffix allowed')
+    parser.add_argument('-r', '--require', default='',
+                        help='groups that must stay enabled, e.g. BASIC+QUEUE')
+    parser.add_argument('-s', '--source', action='append',
+                        help='trace macro source with the message filters (default: trace headers)')
+    parser.add_argument('--heap-periods', default='16,64,256',
+                        help='heap summary periods to try (RTE_RTOS_HEAP_SUMMARY_PERIOD)')
+    parser.add_argument('--heap-sites', type=int, default=4,
+                        help='heap allocation sites logged with every summary')
+    parser.add_argument('-o', '--output', help='write the FreeRTOSConfig.h fragment to a file')
+    args = parser.parse_args()
+
+    try:
+        buffer_bytes = rte_bandwidth.parse_size(args.buffer)
+        heap_periods = [int(p, 0) for p in args.heap_periods.split(',') if p.strip()]
+        args.required = [g.strip().upper() for g in args.require.split('+') if g.strip()]
+        for g in args.required:
+            if g not in [name for name, _, _ in GROUPS]:
+                raise ValueError('unknown group: %s' % g)
+        with open(args.capture, 'rb') as f:
+            cap = rte_capture.Capture(f)
+            table = rte_bandwidth.MessageTable(args.fmt, args.source or rte_bandwidth.DEFAULT_SOURCES,
+                                               cap.id_bits)
+            kinds = classify(table)
+            totals, duration = first_pass(f, cap, kinds)
+            if not totals:
+                raise ValueError('no messages in the capture')
+
+            bits = {g: 1 << table.filter_numbers[flt] for g, flt, _ in GROUPS if flt in table.filter_numbers}
+            present = {g for g in bits if any(bit == bits[g] for bit, _ in totals)}
+            for g in args.required:
+                if g not in present:
+                    raise ValueError('required group %s is not in the capture' % g)
+            heap_events = any(kind == KIND_HEAP for _, kind in totals)
+            isr_events = any(kind == KIND_ISR for _, kind in totals)
+            summary_bytes = (sum(message_bytes(n) for n in HEAP_SUMMARY)
+                             + args.heap_sites * message_bytes(HEAP_SITE))
+
+            optional = sorted(present - set(args.required))
+            candidates = []
+            for k in range(len(optional) + 1):
+                for subset in itertools.combinations(optional, k):
+                    groups = set(args.required) | set(subset)
+                    heaps = [0] + heap_periods if 'MALLOC' in groups and heap_events else [0]
+                    isrs = [True, False] if 'ISR' in groups and isr_events else [True]
+                    for heap_period in heaps:
+                        for isr in isrs:
+                            c = Candidate(groups, heap_period, isr, bits)
+                            estimate(c, totals, summary_bytes, len(HEAP_SUMMARY) + args.heap_sites)
+                            candidates.append(c)
+            candidates.sort(key=lambda c: c.detail(), reverse=True)
+
+            # The minimum history can't be longer than the average history -
+            # only the candidates that meet the target on average are simulated.
+            def average(c):
+                return buffer_bytes * duration / c.bytes if c.bytes else float('inf')
+
+            def history(c):
+                if c.history.full:
+                    return c.history.min_history / cap.frequency
+                return None
+
+            possible = [c for c in candidates if average(c) >= args.time]
+            chosen = None
+            for i in range(0, len(possible), BATCH):
+                batch = possible[i:i + BATCH]
+                simulate(f, cap, kinds, batch, buffer_bytes, summary_bytes)
+                for c in batch:
+                    h = history(c)
+                    if (h if h is not None else average(c)) >= args.time:
+                        chosen = c
+                        break
+                if chosen:
+                    break
+
+            found = chosen is not None
+            if not found:
+                chosen = min(candidates, key=lambda c: (len(c.groups), c.bytes))
+                simulate(f, cap, kinds, [chosen], buffer_bytes, summary_bytes)
+    except (OSError, ValueError) as e:
+        print('rte_tune: %s' % e, file=sys.stderr)
+        sys.exit(2)
+
+    rate = chosen.bytes / duration if duration > 0 else 0.0
+    print('Capture: %s, %.6f s, groups in the capture: %s' % (args.capture, duration, '+'.join(
+        g for g, _, _ in GROUPS if g in present)))
+    print('%u candidate configurations, %u meet the target on average' % (len(candidates), len(possible)))
+    if not found:
+        print('No configuration meets the target - the most compact one:', file=sys.stderr)
+
+    text = fragment(chosen, args, present, buffer_bytes, history(chosen), average(chosen), rate)
+    if args.output:
+        with open(args.output, 'w', encoding='utf-8') as f:
+            f.write(text)
+    print()
+    print(text, end='')
+    sys.exit(0 if found else 1)
+
+
+if __name__ == '__main__':
+    main()
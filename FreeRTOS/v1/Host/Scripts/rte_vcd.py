@@ -0,0 +1,120 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) Branko Premzel.
+#
+# SPDX-License-Identifier: MIT
+#
+
+"""
+@file    rte_vcd.py
+@author  Branko Premzel
+@brief   Streaming RTOS timeline exporter - the RTOS timing signals of a
+         binary capture written to VCD files rotated at a size or time limit.
+
+The capture is decoded in a single pass with the format definitions (see
+rte_decode.py) and the signals of the RTOS_TIMING lines are written as by
+RTEmsg to RTOS_timing.vcd. It is intended for long (soak test) captures:
+ * the signals are declared when they first appear - no pass to collect the
+   declarations is needed,
+ * the value changes are written in large blocks to a spool file next to
+   the output file and the header is added when the file is complete,
+ * with --max-size or --max-time, a new file is started at the limit. Every
+   file can be loaded on its own - it declares all signals and starts with
+   the values of all signals at its start time.
+The memory used does not depend on the capture length.
+
+--check reads the written files and checks that each one is a complete VCD
+file: all signals of the value changes are declared and the time does not
+decrease.
+
+Exit code: 0 - OK, 1 - no RTOS timing signals found or check failed,
+2 - file or argument error.
+"""
+
+import argparse
+import os
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import rte_bandwidth    # noqa: E402
+import rte_capture      # noqa: E402
+import rte_decode       # noqa: E402
+import rte_timing       # noqa: E402
+
+
+def check_vcd(name):
+    """Return an error text or None if the file is a complete VCD file."""
+    codes = set()
+    last_time = None
+    in_header = True
+    with open(name, encoding='utf-8') as f:
+        for number, line in enumerate(f, 1):
+            if in_header:
+                words = line.split()
+                if words[:1] == ['$var'] and len(words) >= 6:
+                    codes.add(words[3])
+                elif words[:1] == ['$enddefinitions']:
+                    in_header = False
+                continue
+            if line.startswith('#'):
+                t = int(line[1:])
+                if last_time is not None and t < last_time:
+                    return 'line %u: time decreases' % number
+                last_time = t
+                continue
+            if line[:1] in ('r', 's'):
+                code = line.split()[-1]
+            elif line[:1] in ('0', '1', 'x', 'z'):
+                code = line[1:].strip()
+            else:
+                continue        # $dumpvars, $end
+            if code not in codes:
+                return 'line %u: signal %s not declared' % (number, code)
+    if in_header:
+        return '$enddefinitions not found'
+    return None
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Streaming RTOS timeline (VCD) exporter.')
+    parser.add_argument('capture', help='binary capture file (header and circular buffer)')
+    parser.add_argument('fmt', nargs='+', help='format definition files and the generated rte_fmt_ids.h')
+    parser.add_argument('-o', '--output', default='RTOS_timing.vcd',
+                        help='VCD file; with limits, _000, _001, ... is added to the name (default: RTOS_timing.vcd)')
+    parser.add_argument('--max-size', help='start a new file after this many bytes, K and M suffixes allowed')
+    parser.add_argument('--max-time', help='start a new file after this time, h, min, s, ms and us suffixes allowed')
+    parser.add_argument('--buffer', default='1M', help='write block size (default: 1M)')
+    parser.add_argument('--check', action='store_true', help='check the written files')
+    args = parser.parse_args()
+
+    try:
+        max_bytes = rte_bandwidth.parse_size(args.max_size) if args.max_size else 0
+        max_seconds = rte_bandwidth.parse_time(args.max_time) if args.max_time else 0.0
+        buffer_size = max(4096, rte_bandwidth.parse_size(args.buffer))
+        with open(args.capture, 'rb') as f:
+            cap = rte_capture.Capture(f)
+            table = rte_decode.FormatTable(args.fmt, cap.id_bits)
+            exponent, _ = rte_timing.timescale(cap.frequency)
+            max_time = round(max_seconds * 10 ** -exponent)
+            date, version = rte_timing.file_info(args.capture, 'rte_vcd.py')
+            writer = rte_timing.RotatingVcdWriter(args.output, exponent, date, version,
+                                                  max_bytes, max_time, buffer_size)
+            signals = rte_timing.export(f, cap, table, [writer])[0]
+    except (OSError, ValueError) as e:
+        print('rte_vcd: %s' % e, file=sys.stderr)
+        sys.exit(2)
+
+    failed = 0
+    for name in writer.files:
+        error = check_vcd(name) if args.check else None
+        print('%s: %u bytes%s' % (name, os.path.getsize(name), ' - ' + error if error else ''))
+        failed += error is not None
+    if not signals.signals:
+        print('rte_vcd: no RTOS timing signals in %s' % args.capture, file=sys.stderr)
+        sys.exit(1)
+    print('rte_vcd: %u signals, %u files' % (len(signals.signals), len(writer.files)))
+    sys.exit(1 if failed else 0)
+
+
+if __name__ == '__main__':
+    main()
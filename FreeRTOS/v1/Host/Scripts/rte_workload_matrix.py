@@ -0,0 +1,86 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) Branko Premzel.
+#
+# SPDX-License-Identifier: MIT
+#
+
+"""
+@file    rte_workload_matrix.py
+@author  Branko Premzel
+@brief   Throughput loss matrix of the workload benchmark (rte_posix_bench).
+
+Runs the rte_posix_bench_xxx executables (one per trace configuration)
+several times and takes the run with the median throughput of every
+configuration. The throughput loss and the latency increase are relative
+to the configuration without tracing (variant "none"). The trace data rate
+shows how much buffer space or link bandwidth each group needs for the
+same workload.
+"""
+
+import argparse
+import json
+import os
+import subprocess
+import sys
+import tempfile
+
+
+def run(executable, args, repeats):
+    results = []
+    for _ in range(repeats):
+        with tempfile.TemporaryDirectory() as tmp:
+            report = os.path.join(tmp, 'report.json')
+            cmd = [executable, '-t', str(args.time), '-w', str(args.warmup), '-o', report]
+            proc = subprocess.run(cmd, stdout=subprocess.DEVNULL, check=False)
+            if proc.returncode != 0:
+                sys.exit('rte_workload_matrix: %s failed (exit code %d)' % (executable, proc.returncode))
+            with open(report, encoding='utf-8') as f:
+                results.append(json.load(f))
+    results.sort(key=lambda r: r['throughput_ops_per_s'])
+    return results[len(results) // 2]
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Workload benchmark throughput loss matrix.')
+    parser.add_argument('executables', nargs='+', help='rte_posix_bench_xxx executables')
+    parser.add_argument('-t', '--time', type=int, default=2000, help='measurement time [ms]')
+    parser.add_argument('-w', '--warmup', type=int, default=200, help='warmup time [ms]')
+    parser.add_argument('-n', '--repeats', type=int, default=3, help='runs per configuration')
+    parser.add_argument('-o', '--output', help='write all results and the matrix in JSON format')
+    args = parser.parse_args()
+
+    results = [run(e, args, max(1, args.repeats)) for e in args.executables]
+    base = next((r for r in results if r['variant'] == 'none'), None)
+    if base is None:
+        sys.exit('rte_workload_matrix: the configuration without tracing (rte_posix_bench_none) is required')
+
+    matrix = []
+    for r in results:
+        ops = r['throughput_ops_per_s']
+        loss = 100.0 * (1.0 - ops / base['throughput_ops_per_s']) if base['throughput_ops_per_s'] else 0.0
+        matrix.append({
+            'variant': r['variant'],
+            'throughput_ops_per_s': ops,
+            'throughput_loss_pct': round(loss, 2),
+            'items_per_s': r['fixed_rate']['items_per_s'],
+            'latency_p50_ns': r['latency_ns']['p50'],
+            'latency_p99_ns': r['latency_ns']['p99'],
+            'latency_p50_increase_ns': r['latency_ns']['p50'] - base['latency_ns']['p50'],
+            'trace_bytes_per_s': r['trace']['bytes_per_s'],
+        })
+
+    print('%-8s %12s %8s %10s %10s %10s %14s' % ('Groups', 'Ops/s', 'Loss', 'Items/s', 'p50 [ns]',
+                                                 'p99 [ns]', 'Trace [B/s]'))
+    for m in matrix:
+        print('%-8s %12.0f %7.1f%% %10.0f %10u %10u %14.0f' % (
+            m['variant'], m['throughput_ops_per_s'], m['throughput_loss_pct'], m['items_per_s'],
+            m['latency_p50_ns'], m['latency_p99_ns'], m['trace_bytes_per_s']))
+
+    if args.output:
+        with open(args.output, 'w', encoding='utf-8') as f:
+            json.dump({'benchmark': 'rte_workload_matrix', 'matrix': matrix, 'runs': results}, f, indent=2)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) Branko Premzel.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/*******************************************************************************
+ * @file    FreeRTOS.h
+ * @author  Branko Premzel
+ * @brief   FreeRTOS kernel stand-in (simulator) - basic types and the default
+ *          (empty) definitions of the trace macros used by the simulator.
+ * @note    Only what the trace macros and "rte_FreeRTOS_trace.c" need is
+ *          provided. This is not a FreeRTOS port.
+ ******************************************************************************/
+
+#ifndef INC_FREERTOS_H
+#define INC_FREERTOS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef long            BaseType_t;
+typedef unsigned long   UBaseType_t;
+typedef uint32_t        TickType_t;
+typedef uintptr_t       StackType_t;
+
+#define pdFALSE         ((BaseType_t)0)
+#define pdTRUE          ((BaseType_t)1)
+#define pdFAIL          pdFALSE
+#define pdPASS          pdTRUE
+#define errQUEUE_FULL   ((BaseType_t)0)
+
+#define portMAX_DELAY   ((TickType_t)0xFFFFFFFFUL)
+#define portSTACK_GROWTH    (-1)
+
+#include "FreeRTOSConfig.h"
+
+/* Heap (portable.h) - the simulator heap is a wrapper around malloc() like heap_3 */
+typedef struct xHeapStats
+{
+    size_t xAvailableHeapSpaceInBytes;
+    size_t xSizeOfLargestFreeBlockInBytes;
+    size_t xSizeOfSmallestFreeBlockInBytes;
+    size_t xNumberOfFreeBlocks;
+    size_t xMinimumEverFreeBytesRemaining;
+    size_t xNumberOfSuccessfulAllocations;
+    size_t xNumberOfSuccessfulFrees;
+} HeapStats_t;
+
+void * pvPortMalloc(size_t xWantedSize);
+void vPortFree(void * pv);
+void vPortGetHeapStats(HeapStats_t * pxHeapStats);
+
+/* Default definitions of the trace macros used by the simulator. */
+#ifndef traceTASK_SWITCHED_IN
+#define traceTASK_SWITCHED_IN()
+#endif
+#ifndef traceTASK_SWITCHED_OUT
+#define traceTASK_SWITCHED_OUT()
+#endif
+#ifndef traceTASK_CREATE
+#define traceTASK_CREATE(pxNewTCB)
+#endif
+#ifndef traceTASK_DELETE
+#define traceTASK_DELETE(pxTaskToDelete)
+#endif
+#ifndef traceTASK_INCREMENT_TICK
+#define traceTASK_INCREMENT_TICK(xTickCount)
+#endif
+#ifndef traceINCREASE_TICK_COUNT
+#define traceINCREASE_TICK_COUNT(x)
+#endif
+#ifndef traceLOW_POWER_IDLE_BEGIN
+#define traceLOW_POWER_IDLE_BEGIN()
+#endif
+#ifndef traceLOW_POWER_IDLE_END
+#define traceLOW_POWER_IDLE_END()
+#endif
+#ifndef traceTASK_DELAY
+#define traceTASK_DELAY()
+#endif
+#ifndef traceQUEUE_SEND
+#define traceQUEUE_SEND(pxQueue)
+#endif
+#ifndef traceQUEUE_SEND_FROM_ISR
+#define traceQUEUE_SEND_FROM_ISR(pxQueue)
+#endif
+#ifndef traceQUEUE_SEND_FROM_ISR_FAILED
+#define traceQUEUE_SEND_FROM_ISR_FAILED(pxQueue)
+#endif
+#ifndef traceQUEUE_GIVE_FROM_ISR
+#define traceQUEUE_GIVE_FROM_ISR(pxQueue)    traceQUEUE_SEND_FROM_ISR(pxQueue)    // As in FreeRTOS v11
+#endif
+#ifndef traceQUEUE_SEND_FAILED
+#define traceQUEUE_SEND_FAILED(pxQueue)
+#endif
+#ifndef traceQUEUE_RECEIVE
+#define traceQUEUE_RECEIVE(pxQueue)
+#endif
+#ifndef traceQUEUE_RECEIVE_FAILED
+#define traceQUEUE_RECEIVE_FAILED(pxQueue)
+#endif
+#ifndef traceQUEUE_RECEIVE_FROM_ISR
+#define traceQUEUE_RECEIVE_FROM_ISR(pxQueue)
+#endif
+#ifndef traceCREATE_MUTEX_FAILED
+#define traceCREATE_MUTEX_FAILED()
+#endif
+#ifndef traceTASK_NOTIFY
+#define traceTASK_NOTIFY(uxIndexToNotify)
+#endif
+#ifndef traceTASK_NOTIFY_FROM_ISR
+#define traceTASK_NOTIFY_FROM_ISR(uxIndexToNotify)
+#endif
+#ifndef traceTASK_NOTIFY_WAIT_BLOCK
+#define traceTASK_NOTIFY_WAIT_BLOCK(uxIndexToWait)
+#endif
+#ifndef traceTASK_NOTIFY_WAIT
+#define traceTASK_NOTIFY_WAIT(uxIndexToWait)
+#endif
+#ifndef traceISR_ENTER
+#define traceISR_ENTER()
+#endif
+#ifndef traceISR_EXIT
+#define traceISR_EXIT()
+#endif
+#ifndef traceISR_EXIT_TO_SCHEDULER
+#define traceISR_EXIT_TO_SCHEDULER()
+#endif
+#ifndef traceMALLOC
+#define traceMALLOC(pvAddress, uiSize)
+#endif
+#ifndef traceFREE
+#define traceFREE(pvAddress, uiSize)
+#endif
+#ifndef traceTIMER_COMMAND_SEND
+#define traceTIMER_COMMAND_SEND(pxTimer, xCommandID, xOptionalValue, xStatus)
+#endif
+
+#endif  // INC_FREERTOS_H
+
+/*==== End of file ====*/
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) Branko Premzel.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/*******************************************************************************
+ * @file    FreeRTOSConfig.h
+ * @author  Branko Premzel
+ * @brief   Configuration of the FreeRTOS kernel stand-in (simulator) used to
+ *          exercise the trace macros on a Linux host without the kernel.
+ *          The trace configuration (RTE_TRACE_RTOS_xxx) can be overridden
+ *          with compiler command line definitions.
+ ******************************************************************************/
+
+#ifndef FREERTOS_CONFIG_H
+#define FREERTOS_CONFIG_H
+
+#define configMAX_TASK_NAME_LEN         16
+#define configUSE_TIMERS                1
+#define configUSE_STREAM_BUFFERS        1
+#define configCPU_CLOCK_HZ              RTE_TIMESTAMP_FREQUENCY
+#define configTICK_RATE_HZ              1000U
+#define configTOTAL_HEAP_SIZE           (256U * 1024U)
+#define configRECORD_STACK_HIGH_ADDRESS 1
+#define configUSE_TICKLESS_IDLE         1
+
+#ifndef configQUEUE_REGISTRY_SIZE
+#define configQUEUE_REGISTRY_SIZE       8
+#endif
+
+/* Enable FreeRTOS tracing for specific groups of functions */
+#ifndef RTE_TRACE_RTOS_BASIC
+#define RTE_TRACE_RTOS_BASIC        1
+#endif
+#ifndef RTE_TRACE_RTOS_TASKS
+#define RTE_TRACE_RTOS_TASKS        1
+#endif
+#ifndef RTE_TRACE_RTOS_MALLOC
+#define RTE_TRACE_RTOS_MALLOC       1
+#endif
+#ifndef RTE_TRACE_RTOS_TIMER
+#define RTE_TRACE_RTOS_TIMER        1
+#endif
+#ifndef RTE_TRACE_RTOS_QUEUE
+#define RTE_TRACE_RTOS_QUEUE        1
+#endif
+#ifndef RTE_TRACE_RTOS_STREAMS
+#define RTE_TRACE_RTOS_STREAMS      1
+#endif
+#ifndef RTE_TRACE_RTOS_EXPERT
+#define RTE_TRACE_RTOS_EXPERT       1
+#endif
+
+#ifndef RTE_TRACE_RTOS_ISR_IRQ
+#define RTE_TRACE_RTOS_ISR_IRQ      1
+#endif
+#ifndef RTE_TRACE_RTOS_HEAP_PROFILE
+#define RTE_TRACE_RTOS_HEAP_PROFILE 1
+#endif
+#ifndef RTE_RTOS_HEAP_FRAGMENTATION
+#define RTE_RTOS_HEAP_FRAGMENTATION 1
+#endif
+#ifndef RTE_TRACE_RTOS_STACK_MONITOR
+#define RTE_TRACE_RTOS_STACK_MONITOR 1
+#endif
+#ifndef RTE_TRACE_RTOS_QUEUE_LATENCY
+#define RTE_TRACE_RTOS_QUEUE_LATENCY 1
+#endif
+#ifndef RTE_TRACE_RTOS_SNAPSHOT
+#define RTE_TRACE_RTOS_SNAPSHOT     1
+#endif
+#ifndef RTE_TRACE_RTOS_TICKLESS_COMP
+#define RTE_TRACE_RTOS_TICKLESS_COMP 1
+#endif
+#ifndef RTE_TRACE_RTOS_OVERHEAD
+#define RTE_TRACE_RTOS_OVERHEAD     0   // Instrumented build - the rte_sim_overhead library
+#endif
+
+/* Port hooks - see "rte_sim.h" */
+unsigned rte_sim_irq_number(void);
+#define RTE_RTOS_GET_IRQ_NUMBER()   rte_sim_irq_number()
+#define RTE_RTOS_CYCLE_COUNTER()    ((uint32_t)rte_host_timestamp())
+#define RTE_RTOS_TIMESTAMP_ADVANCE(counts)  rte_host_timestamp_advance(counts)
+
+/* Stand-in for the CPU cycle counter in the trace overhead measurement [ns] */
+uint32_t rte_sim_cycle_counter(void);
+#define RTE_RTOS_OVERHEAD_COUNTER() rte_sim_cycle_counter()
+
+/* RTE_SIM_SLEEP_TIMER == 1 - the sleep time is measured by a simulated low power
+ * timer instead of being calculated from the stepped ticks. */
+#if defined RTE_SIM_SLEEP_TIMER && (RTE_SIM_SLEEP_TIMER == 1)
+uint32_t rte_sim_sleep_time(void);
+#define RTE_RTOS_SLEEP_TIME()       rte_sim_sleep_time()
+#endif
+
+#define RTE_FREERTOS_VERSION 110200     // The simulator mimics FreeRTOS V11.2.0
+#include "rte_FreeRTOS_trace.h"         // RTEdbg FreeRTOS trace macros
+
+#endif  // FREERTOS_CONFIG_H
+
+/*==== End of file ====*/
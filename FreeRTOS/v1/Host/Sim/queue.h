@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) Branko Premzel.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/*******************************************************************************
+ * @file    queue.h
+ * @author  Branko Premzel
+ * @brief   FreeRTOS kernel stand-in (simulator) - queues and queue registry.
+ ******************************************************************************/
+
+#ifndef QUEUE_H
+#define QUEUE_H
+
+#include "FreeRTOS.h"
+
+#define queueSEND_TO_BACK       ((BaseType_t)0)
+#define queueSEND_TO_FRONT      ((BaseType_t)1)
+#define queueOVERWRITE          ((BaseType_t)2)
+
+#define queueQUEUE_TYPE_BASE    ((uint8_t)0U)
+#define queueQUEUE_TYPE_MUTEX   ((uint8_t)1U)
+
+/* Simulated queue - only the members used by the trace macros. */
+typedef struct QueueDefinition
+{
+    volatile UBaseType_t uxMessagesWaiting;
+    UBaseType_t uxLength;
+    uint8_t ucQueueType;
+} Queue_t;
+
+typedef struct QueueDefinition * QueueHandle_t;
+
+#if ( configQUEUE_REGISTRY_SIZE > 0 )
+void vQueueAddToRegistry(QueueHandle_t xQueue, const char * pcQueueName);
+const char * pcQueueGetName(QueueHandle_t xQueue);
+#endif
+
+UBaseType_t uxQueueMessagesWaitingFromISR(const QueueHandle_t xQueue);
+
+#endif  // QUEUE_H
+
+/*==== End of file ====*/
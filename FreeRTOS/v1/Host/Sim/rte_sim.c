@@ -0,0 +1,580 @@
+/*
+ * Copyright (c) Branko Premzel.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/*******************************************************************************
+ * @file    rte_sim.c
+ * @author  Branko Premzel
+ * @brief   FreeRTOS kernel stand-in (simulator) for the host build.
+ *          See "rte_sim.h" for the description.
+ ******************************************************************************/
+
+#define _GNU_SOURCE
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "rte_sim.h"
+
+#if ( configRECORD_STACK_HIGH_ADDRESS != 1 )
+#error "The simulated task stacks need configRECORD_STACK_HIGH_ADDRESS == 1."
+#endif
+
+_Thread_local TCB_t * volatile pxCurrentTCB;
+static _Thread_local TCB_t * sim_deleted_tcb;   // Self-deleted task - released after the switch-out
+
+#define SIM_MAX_ISR_NESTING     8U
+static _Thread_local unsigned sim_irq[SIM_MAX_ISR_NESTING + 1U];   // [0] - thread mode
+static _Thread_local volatile unsigned sim_isr_depth;
+
+#if ( configQUEUE_REGISTRY_SIZE > 0 )
+typedef struct QUEUE_REGISTRY_ITEM
+{
+    const char * pcQueueName;
+    QueueHandle_t xHandle;
+} QueueRegistryItem_t;
+
+static QueueRegistryItem_t xQueueRegistry[configQUEUE_REGISTRY_SIZE];
+#endif
+
+
+/***
+ * Kernel objects.
+ */
+
+static void sim_task_init(TCB_t * pxNewTCB, const char * pcName, UBaseType_t uxPriority)
+{
+    pxNewTCB->uxPriority = uxPriority;
+
+    if (pcName != NULL)
+    {
+        strncpy(pxNewTCB->pcTaskName, pcName, configMAX_TASK_NAME_LEN - 1U);
+    }
+
+    traceTASK_CREATE(pxNewTCB);
+}
+
+
+TaskHandle_t rte_sim_task_create(const char * pcName, UBaseType_t uxPriority)
+{
+    TCB_t * pxNewTCB = calloc(1U, sizeof(TCB_t));
+
+    if (pxNewTCB != NULL)
+    {
+        sim_task_init(pxNewTCB, pcName, uxPriority);
+    }
+
+    return pxNewTCB;
+}
+
+
+TaskHandle_t rte_sim_task_create_static(const char * pcName, UBaseType_t uxPriority,
+                                        StaticTask_t * pxTaskBuffer)
+{
+    TCB_t * pxNewTCB = pxTaskBuffer;
+
+    (void)memset(pxNewTCB, 0, sizeof(TCB_t));
+    pxNewTCB->ucStaticallyAllocated = pdTRUE;
+    sim_task_init(pxNewTCB, pcName, uxPriority);
+    return pxNewTCB;
+}
+
+
+QueueHandle_t rte_sim_queue_create(const char * pcName, UBaseType_t uxQueueLength)
+{
+    Queue_t * pxNewQueue = calloc(1U, sizeof(Queue_t));
+
+    if (pxNewQueue != NULL)
+    {
+        pxNewQueue->uxLength = uxQueueLength;
+        pxNewQueue->ucQueueType = queueQUEUE_TYPE_BASE;
+#if ( configQUEUE_REGISTRY_SIZE > 0 )
+        if (pcName != NULL)
+        {
+            vQueueAddToRegistry(pxNewQueue, pcName);
+        }
+#else
+        (void)pcName;
+#endif
+    }
+
+    return pxNewQueue;
+}
+
+
+TimerHandle_t rte_sim_timer_create(const char * pcTimerName, TickType_t xTimerPeriodInTicks)
+{
+    Timer_t * pxNewTimer = calloc(1U, sizeof(Timer_t));
+
+    if (pxNewTimer != NULL)
+    {
+        pxNewTimer->pcTimerName = pcTimerName;
+        pxNewTimer->xTimerPeriodInTicks = xTimerPeriodInTicks;
+    }
+
+    return pxNewTimer;
+}
+
+
+static void sim_task_free(TCB_t * pxTCB)
+{
+    if (pxTCB->ucStaticallyAllocated == pdFALSE)
+    {
+        free(pxTCB);
+    }
+}
+
+
+void rte_sim_task_switch(TaskHandle_t xTask)
+{
+    if (pxCurrentTCB != NULL)
+    {
+        traceTASK_SWITCHED_OUT();
+    }
+
+    if (sim_deleted_tcb != NULL)
+    {
+        sim_task_free(sim_deleted_tcb);
+        sim_deleted_tcb = NULL;
+    }
+
+    pxCurrentTCB = xTask;
+    traceTASK_SWITCHED_IN();
+}
+
+
+void rte_sim_task_delete(TaskHandle_t xTaskToDelete)
+{
+    TCB_t * pxTCB = (xTaskToDelete != NULL) ? xTaskToDelete : pxCurrentTCB;
+
+    traceTASK_DELETE(pxTCB);
+
+    if (pxTCB == pxCurrentTCB)
+    {
+        sim_deleted_tcb = pxTCB;    // Still running - switched out by the caller
+    }
+    else
+    {
+        sim_task_free(pxTCB);
+    }
+}
+
+
+void rte_sim_task_stack(TaskHandle_t xTask, StackType_t * puxStackBuffer, uint32_t ulStackDepth)
+{
+    (void)memset(puxStackBuffer, 0xA5, (size_t)ulStackDepth * sizeof(StackType_t));  // tskSTACK_FILL_BYTE
+    xTask->pxStack = puxStackBuffer;
+    xTask->pxTopOfStack = &puxStackBuffer[ulStackDepth - 1U];
+    xTask->pxEndOfStack = &puxStackBuffer[ulStackDepth - 1U];
+}
+
+
+void rte_sim_task_stack_use(TaskHandle_t xTask, uint32_t ulUsedWords, uint32_t ulSpWords)
+{
+    StackType_t * pxTop = xTask->pxEndOfStack;
+
+    for (uint32_t i = 0U; i < ulUsedWords; i++)
+    {
+        *(pxTop - i) = 0U;
+    }
+
+    xTask->pxTopOfStack = pxTop - ulSpWords;
+}
+
+
+void rte_sim_isr_enter(unsigned irq)
+{
+    unsigned depth = sim_isr_depth;
+
+    if (depth < SIM_MAX_ISR_NESTING)
+    {
+        sim_irq[depth + 1U] = irq;
+        sim_isr_depth = depth + 1U;
+    }
+
+    traceISR_ENTER();
+}
+
+
+void rte_sim_isr_exit(BaseType_t xSwitchRequired)
+{
+    if (xSwitchRequired != pdFALSE)
+    {
+        traceISR_EXIT_TO_SCHEDULER();
+    }
+    else
+    {
+        traceISR_EXIT();
+    }
+
+    if (sim_isr_depth != 0U)
+    {
+        sim_isr_depth--;
+    }
+}
+
+
+unsigned rte_sim_irq_number(void)
+{
+    return sim_irq[sim_isr_depth];
+}
+
+
+/* Simulated tick - derived from the timestamp source */
+TickType_t xTaskGetTickCount(void)
+{
+    return (TickType_t)(rte_host_timestamp() / (RTE_TIMESTAMP_FREQUENCY / configTICK_RATE_HZ));
+}
+
+
+TickType_t xTaskGetTickCountFromISR(void)
+{
+    return xTaskGetTickCount();
+}
+
+
+void rte_sim_tick(void)
+{
+    const TickType_t xConstTickCount = xTaskGetTickCount();
+
+    traceTASK_INCREMENT_TICK(xConstTickCount);
+    (void)xConstTickCount;
+}
+
+
+uint32_t rte_sim_cycle_counter(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec);
+}
+
+
+/* Tickless idle - the tick count is derived from the timestamp, so the
+ * timestamp compensation steps the tick count too. */
+static uint32_t sim_sleep_time;
+
+uint32_t rte_sim_sleep_time(void)
+{
+    return sim_sleep_time;
+}
+
+
+static void vTaskStepTick(TickType_t xTicksToJump)
+{
+    traceINCREASE_TICK_COUNT(xTicksToJump);
+}
+
+
+void rte_sim_tickless_idle(TickType_t xCompleteTickPeriods, uint32_t ulSleepTime)
+{
+    traceLOW_POWER_IDLE_BEGIN();
+    sim_sleep_time = ulSleepTime;
+
+    if ((xCompleteTickPeriods != 0U) || (ulSleepTime != 0U))
+    {
+        vTaskStepTick(xCompleteTickPeriods);    // Called with 0 after a sleep shorter than one tick
+    }
+
+    traceLOW_POWER_IDLE_END();
+}
+
+
+/* The simulator does not schedule - the heap is protected with a mutex instead */
+static pthread_mutex_t sim_heap_mutex = PTHREAD_RECURSIVE_MUTEX_INITIALIZER_NP;
+static size_t sim_heap_free = configTOTAL_HEAP_SIZE;
+static size_t sim_heap_min_free = configTOTAL_HEAP_SIZE;
+
+void vTaskSuspendAll(void)
+{
+    pthread_mutex_lock(&sim_heap_mutex);
+}
+
+
+BaseType_t xTaskResumeAll(void)
+{
+    pthread_mutex_unlock(&sim_heap_mutex);
+    return pdFALSE;
+}
+
+
+/* Same as heap_3 - malloc() with the scheduler suspended. The size of each
+ * block is stored in front of it to simulate the free heap space. */
+void * pvPortMalloc(size_t xWantedSize)
+{
+    void * pvReturn = NULL;
+
+    vTaskSuspendAll();
+    {
+        if (xWantedSize <= sim_heap_free)
+        {
+            size_t * p_block = malloc(sizeof(size_t) + xWantedSize);
+
+            if (p_block != NULL)
+            {
+                *p_block = xWantedSize;
+                sim_heap_free -= xWantedSize;
+                sim_heap_min_free = (sim_heap_free < sim_heap_min_free) ? sim_heap_free : sim_heap_min_free;
+                pvReturn = p_block + 1;
+            }
+        }
+
+        traceMALLOC(pvReturn, xWantedSize);
+    }
+    (void)xTaskResumeAll();
+
+    return pvReturn;
+}
+
+
+void vPortFree(void * pv)
+{
+    if (pv != NULL)
+    {
+        size_t * p_block = (size_t *)pv - 1;
+
+        vTaskSuspendAll();
+        {
+            sim_heap_free += *p_block;
+            free(p_block);
+            traceFREE(pv, 0);
+        }
+        (void)xTaskResumeAll();
+    }
+}
+
+
+/* The simulated heap is not fragmented - the largest free block is the free space */
+void vPortGetHeapStats(HeapStats_t * pxHeapStats)
+{
+    vTaskSuspendAll();
+    memset(pxHeapStats, 0, sizeof(*pxHeapStats));
+    pxHeapStats->xAvailableHeapSpaceInBytes = sim_heap_free;
+    pxHeapStats->xSizeOfLargestFreeBlockInBytes = sim_heap_free;
+    pxHeapStats->xMinimumEverFreeBytesRemaining = sim_heap_min_free;
+    (void)xTaskResumeAll();
+}
+
+
+char * pcTaskGetName(TaskHandle_t xTaskToQuery)
+{
+    TCB_t * pxTCB = (xTaskToQuery != NULL) ? xTaskToQuery : pxCurrentTCB;
+    return &(pxTCB->pcTaskName[0]);
+}
+
+
+#if ( configQUEUE_REGISTRY_SIZE > 0 )
+/* Same as in the kernel - the first free slot is used, no locking (objects
+ * are created before the producer threads are started). */
+void vQueueAddToRegistry(QueueHandle_t xQueue, const char * pcQueueName)
+{
+    for (UBaseType_t ux = 0U; ux < (UBaseType_t)configQUEUE_REGISTRY_SIZE; ux++)
+    {
+        if (xQueueRegistry[ux].pcQueueName == NULL)
+        {
+            xQueueRegistry[ux].pcQueueName = pcQueueName;
+            xQueueRegistry[ux].xHandle = xQueue;
+            break;
+        }
+    }
+}
+
+
+/* Linear search of the registry - the same as in the kernel. */
+const char * pcQueueGetName(QueueHandle_t xQueue)
+{
+    const char * pcReturn = NULL;
+
+    for (UBaseType_t ux = 0U; ux < (UBaseType_t)configQUEUE_REGISTRY_SIZE; ux++)
+    {
+        if (xQueueRegistry[ux].xHandle == xQueue)
+        {
+            pcReturn = xQueueRegistry[ux].pcQueueName;
+            break;
+        }
+    }
+
+    return pcReturn;
+}
+#endif  // configQUEUE_REGISTRY_SIZE > 0
+
+
+const char * pcTimerGetName(TimerHandle_t xTimer)
+{
+    return xTimer->pcTimerName;
+}
+
+
+/***
+ * Kernel functions with trace macro calls.
+ */
+
+void rte_sim_task_delay(TickType_t xTicksToDelay)
+{
+    traceTASK_DELAY();
+}
+
+
+BaseType_t rte_sim_queue_send(QueueHandle_t xQueue)
+{
+    Queue_t * const pxQueue = xQueue;
+    const BaseType_t xCopyPosition = queueSEND_TO_BACK;
+
+    traceQUEUE_SEND(pxQueue);
+    (void)xCopyPosition;
+    return pdPASS;
+}
+
+
+BaseType_t rte_sim_queue_send_from_isr(QueueHandle_t xQueue)
+{
+    Queue_t * const pxQueue = xQueue;
+    const BaseType_t xCopyPosition = queueSEND_TO_BACK;
+
+    traceQUEUE_SEND_FROM_ISR(pxQueue);
+    (void)xCopyPosition;
+    return pdPASS;
+}
+
+
+BaseType_t rte_sim_queue_generic_send_from_isr(QueueHandle_t xQueue, BaseType_t xCopyPosition)
+{
+    Queue_t * const pxQueue = xQueue;
+
+    if ((pxQueue->uxMessagesWaiting < pxQueue->uxLength) || (xCopyPosition == queueOVERWRITE))
+    {
+        traceQUEUE_SEND_FROM_ISR(pxQueue);
+
+        if ((xCopyPosition != queueOVERWRITE) || (pxQueue->uxMessagesWaiting == 0U))
+        {
+            pxQueue->uxMessagesWaiting++;
+        }
+
+        return pdPASS;
+    }
+
+    traceQUEUE_SEND_FROM_ISR_FAILED(pxQueue);
+    return errQUEUE_FULL;
+}
+
+
+BaseType_t rte_sim_queue_give_from_isr(QueueHandle_t xQueue)
+{
+    Queue_t * const pxQueue = xQueue;
+
+    if (pxQueue->uxMessagesWaiting < pxQueue->uxLength)
+    {
+        traceQUEUE_GIVE_FROM_ISR(pxQueue);
+        pxQueue->uxMessagesWaiting++;
+        return pdPASS;
+    }
+
+    traceQUEUE_SEND_FROM_ISR_FAILED(pxQueue);
+    return errQUEUE_FULL;
+}
+
+
+BaseType_t rte_sim_queue_generic_send(QueueHandle_t xQueue, BaseType_t xCopyPosition)
+{
+    Queue_t * const pxQueue = xQueue;
+    const TickType_t xTicksToWait = 0U;
+
+    if ((pxQueue->uxMessagesWaiting < pxQueue->uxLength) || (xCopyPosition == queueOVERWRITE))
+    {
+        traceQUEUE_SEND(pxQueue);
+
+        if ((xCopyPosition != queueOVERWRITE) || (pxQueue->uxMessagesWaiting == 0U))
+        {
+            pxQueue->uxMessagesWaiting++;
+        }
+
+        return pdPASS;
+    }
+
+    traceQUEUE_SEND_FAILED(pxQueue);
+    (void)xTicksToWait;
+    return pdFAIL;
+}
+
+
+BaseType_t rte_sim_queue_receive(QueueHandle_t xQueue, TickType_t xTicksToWait)
+{
+    Queue_t * const pxQueue = xQueue;
+
+    if (pxQueue->uxMessagesWaiting > 0U)
+    {
+        traceQUEUE_RECEIVE(pxQueue);
+        pxQueue->uxMessagesWaiting--;
+        return pdPASS;
+    }
+
+    traceQUEUE_RECEIVE_FAILED(pxQueue);
+    (void)xTicksToWait;
+    return pdFAIL;
+}
+
+
+BaseType_t rte_sim_queue_receive_from_isr(QueueHandle_t xQueue)
+{
+    Queue_t * const pxQueue = xQueue;
+
+    if (pxQueue->uxMessagesWaiting > 0U)
+    {
+        traceQUEUE_RECEIVE_FROM_ISR(pxQueue);
+        pxQueue->uxMessagesWaiting--;
+        return pdPASS;
+    }
+
+    return pdFAIL;
+}
+
+
+UBaseType_t uxQueueMessagesWaitingFromISR(const QueueHandle_t xQueue)
+{
+    return xQueue->uxMessagesWaiting;
+}
+
+
+BaseType_t rte_sim_task_notify(TaskHandle_t xTaskToNotify, UBaseType_t uxIndexToNotify,
+                               uint32_t ulValue, eNotifyAction eAction)
+{
+    traceTASK_NOTIFY(uxIndexToNotify);
+    return pdPASS;
+}
+
+
+BaseType_t rte_sim_task_notify_from_isr(TaskHandle_t xTaskToNotify, UBaseType_t uxIndexToNotify,
+                                        uint32_t ulValue, eNotifyAction eAction)
+{
+    traceTASK_NOTIFY_FROM_ISR(uxIndexToNotify);
+    return pdPASS;
+}
+
+
+BaseType_t rte_sim_task_notify_wait(UBaseType_t uxIndexToWait, uint32_t ulBitsToClearOnEntry,
+                                    uint32_t ulBitsToClearOnExit, TickType_t xTicksToWait)
+{
+    traceTASK_NOTIFY_WAIT(uxIndexToWait);
+    return pdTRUE;
+}
+
+
+void rte_sim_task_notify_wait_block(UBaseType_t uxIndexToWait, uint32_t ulBitsToClearOnEntry,
+                                    uint32_t ulBitsToClearOnExit, TickType_t xTicksToWait)
+{
+    traceTASK_NOTIFY_WAIT_BLOCK(uxIndexToWait);
+}
+
+
+BaseType_t rte_sim_timer_command_send(TimerHandle_t xTimer, BaseType_t xCommandID,
+                                      TickType_t xOptionalValue)
+{
+    BaseType_t xReturn = pdPASS;
+
+    traceTIMER_COMMAND_SEND(xTimer, xCommandID, xOptionalValue, xReturn);
+    return xReturn;
+}
+
+/*==== End of file ====*/
@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) Branko Premzel.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/*******************************************************************************
+ * @file    rte_sim.h
+ * @author  Branko Premzel
+ * @brief   FreeRTOS kernel stand-in (simulator) for the host build.
+ *
+ * @note    The simulator does not schedule anything. It provides the kernel
+ *          objects and the kernel functions that contain the trace macro
+ *          calls, with the same local variable names as the FreeRTOS kernel,
+ *          so that the macros from "rte_FreeRTOS_trace.h" expand exactly as
+ *          they do in the kernel. Host threads stand in for cores and POSIX
+ *          signal handlers for interrupts.
+ *          The simulator does not model queue or notification contents - the
+ *          caller sets the traced values.
+ ******************************************************************************/
+
+#ifndef RTE_SIM_H
+#define RTE_SIM_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "timers.h"
+
+
+/***
+ * Kernel objects. Objects are created before the producer threads are
+ * started. Only tasks can be deleted. The task create functions call
+ * traceTASK_CREATE() as the kernel does.
+ */
+
+TaskHandle_t rte_sim_task_create(const char * pcName, UBaseType_t uxPriority);
+
+/** @brief Create a task in the given TCB buffer - as xTaskCreateStatic(), the
+ *         buffer can be reused for a new task after the task is deleted. */
+TaskHandle_t rte_sim_task_create_static(const char * pcName, UBaseType_t uxPriority,
+                                        StaticTask_t * pxTaskBuffer);
+QueueHandle_t rte_sim_queue_create(const char * pcName, UBaseType_t uxQueueLength);
+TimerHandle_t rte_sim_timer_create(const char * pcTimerName, TickType_t xTimerPeriodInTicks);
+
+/** @brief Switch the task running on the calling thread (core). */
+void rte_sim_task_switch(TaskHandle_t xTask);
+
+/** @brief Delete a task. NULL - the running task deletes itself. Its TCB is
+ *         released (if not static) after the next switch-out, as by the idle
+ *         task of the kernel. */
+void rte_sim_task_delete(TaskHandle_t xTaskToDelete);
+
+
+/***
+ * Simulated task stacks. A task created by rte_sim_task_create() has no stack
+ * (pxStack == NULL). rte_sim_task_stack() assigns a buffer and fills it with
+ * the fill pattern, as the kernel does. rte_sim_task_stack_use() writes to the
+ * top ulUsedWords words of the stack and sets the saved stack pointer
+ * ulSpWords words below the top of the stack.
+ */
+
+void rte_sim_task_stack(TaskHandle_t xTask, StackType_t * puxStackBuffer, uint32_t ulStackDepth);
+void rte_sim_task_stack_use(TaskHandle_t xTask, uint32_t ulUsedWords, uint32_t ulSpWords);
+
+
+/***
+ * Simulated interrupts. An ISR (e.g. a signal handler) calls rte_sim_isr_enter()
+ * at the start and rte_sim_isr_exit() at the end. The exception number is
+ * returned by the RTE_RTOS_GET_IRQ_NUMBER() port hook - 0 in thread mode.
+ */
+
+void rte_sim_isr_enter(unsigned irq);
+void rte_sim_isr_exit(BaseType_t xSwitchRequired);
+unsigned rte_sim_irq_number(void);
+
+
+/***
+ * Simulated tickless idle. The timestamp source set with
+ * rte_host_set_timestamp_source() stands in for a timestamp counter that stops
+ * during the sleep - the caller does not advance it for the time slept.
+ * rte_sim_tickless_idle() calls the trace macros in the same order as the idle
+ * task, vPortSuppressTicksAndSleep() and vTaskStepTick(). ulSleepTime is the
+ * time the timestamp counter was stopped [timestamp periods], as measured by
+ * a low power timer. It is returned by rte_sim_sleep_time() - the
+ * RTE_RTOS_SLEEP_TIME() port hook if RTE_SIM_SLEEP_TIMER is 1.
+ * xCompleteTickPeriods == 0 and ulSleepTime == 0 stands in for an aborted
+ * sleep (eAbortSleep) - vTaskStepTick() is not called.
+ */
+
+void rte_sim_tickless_idle(TickType_t xCompleteTickPeriods, uint32_t ulSleepTime);
+uint32_t rte_sim_sleep_time(void);
+
+
+/** @brief Free running 32-bit counter [ns] - the CPU cycle counter stand-in
+ *         for the trace overhead measurement (RTE_RTOS_OVERHEAD_COUNTER). */
+uint32_t rte_sim_cycle_counter(void);
+
+
+/***
+ * Kernel functions with trace macro calls.
+ */
+
+/** @brief Simulated tick interrupt - calls traceTASK_INCREMENT_TICK(). */
+void rte_sim_tick(void);
+
+void rte_sim_task_delay(TickType_t xTicksToDelay);
+BaseType_t rte_sim_queue_send(QueueHandle_t xQueue);
+BaseType_t rte_sim_queue_send_from_isr(QueueHandle_t xQueue);
+
+/* Unlike rte_sim_queue_send(), these functions update the number of items in
+ * the queue as the kernel does. A queue must be used by one thread only. */
+BaseType_t rte_sim_queue_generic_send(QueueHandle_t xQueue, BaseType_t xCopyPosition);
+BaseType_t rte_sim_queue_generic_send_from_isr(QueueHandle_t xQueue, BaseType_t xCopyPosition);
+BaseType_t rte_sim_queue_give_from_isr(QueueHandle_t xQueue);
+BaseType_t rte_sim_queue_receive(QueueHandle_t xQueue, TickType_t xTicksToWait);
+BaseType_t rte_sim_queue_receive_from_isr(QueueHandle_t xQueue);
+BaseType_t rte_sim_task_notify(TaskHandle_t xTaskToNotify, UBaseType_t uxIndexToNotify,
+                               uint32_t ulValue, eNotifyAction eAction);
+BaseType_t rte_sim_task_notify_from_isr(TaskHandle_t xTaskToNotify, UBaseType_t uxIndexToNotify,
+                                        uint32_t ulValue, eNotifyAction eAction);
+BaseType_t rte_sim_task_notify_wait(UBaseType_t uxIndexToWait, uint32_t ulBitsToClearOnEntry,
+                                    uint32_t ulBitsToClearOnExit, TickType_t xTicksToWait);
+
+/* No notification is pending - the calling task blocks. The caller switches
+ * to another task and calls rte_sim_task_notify_wait() when the task runs again. */
+void rte_sim_task_notify_wait_block(UBaseType_t uxIndexToWait, uint32_t ulBitsToClearOnEntry,
+                                    uint32_t ulBitsToClearOnExit, TickType_t xTicksToWait);
+BaseType_t rte_sim_timer_command_send(TimerHandle_t xTimer, BaseType_t xCommandID,
+                                      TickType_t xOptionalValue);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // RTE_SIM_H
+
+/*==== End of file ====*/
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) Branko Premzel.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/*******************************************************************************
+ * @file    task.h
+ * @author  Branko Premzel
+ * @brief   FreeRTOS kernel stand-in (simulator) - tasks.
+ ******************************************************************************/
+
+#ifndef INC_TASK_H
+#define INC_TASK_H
+
+#include "FreeRTOS.h"
+
+#define tskKERNEL_VERSION_MAJOR     11
+#define tskKERNEL_VERSION_MINOR     2
+#define tskKERNEL_VERSION_BUILD     0
+
+typedef enum
+{
+    eNoAction = 0,
+    eSetBits,
+    eIncrement,
+    eSetValueWithOverwrite,
+    eSetValueWithoutOverwrite
+} eNotifyAction;
+
+/* Interrupts are simulated with signals - the simulator does not mask them.
+ * Code that runs in a simulated ISR and in the interrupted thread must not
+ * share data that needs a critical section. */
+#define taskENTER_CRITICAL_FROM_ISR()       ((UBaseType_t)0U)
+#define taskEXIT_CRITICAL_FROM_ISR(x)       ((void)(x))
+#define taskENTER_CRITICAL()
+#define taskEXIT_CRITICAL()
+
+/* Simulated task control block. As in the kernel, the first member is the
+ * saved stack pointer. */
+typedef struct tskTaskControlBlock
+{
+    volatile StackType_t * pxTopOfStack;
+    UBaseType_t uxPriority;
+    StackType_t * pxStack;
+    char pcTaskName[configMAX_TASK_NAME_LEN];
+#if ( configRECORD_STACK_HIGH_ADDRESS == 1 )
+    StackType_t * pxEndOfStack;
+#endif
+    uint8_t ucStaticallyAllocated;  // pdTRUE - the TCB memory is not released
+} TCB_t;
+
+typedef struct tskTaskControlBlock * TaskHandle_t;
+
+/* The simulator uses the TCB itself as the static TCB buffer. */
+typedef TCB_t StaticTask_t;
+
+/* Each simulated core (thread) has its own currently running task. */
+extern _Thread_local TCB_t * volatile pxCurrentTCB;
+
+char * pcTaskGetName(TaskHandle_t xTaskToQuery);
+TickType_t xTaskGetTickCount(void);
+TickType_t xTaskGetTickCountFromISR(void);
+void vTaskSuspendAll(void);
+BaseType_t xTaskResumeAll(void);
+
+#endif  // INC_TASK_H
+
+/*==== End of file ====*/
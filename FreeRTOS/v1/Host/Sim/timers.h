@@ -0,0 +1,30 @@
+/*
+ * Copyright (c) Branko Premzel.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/*******************************************************************************
+ * @file    timers.h
+ * @author  Branko Premzel
+ * @brief   FreeRTOS kernel stand-in (simulator) - software timers.
+ ******************************************************************************/
+
+#ifndef TIMERS_H
+#define TIMERS_H
+
+#include "FreeRTOS.h"
+
+typedef struct tmrTimerControl
+{
+    const char * pcTimerName;
+    TickType_t xTimerPeriodInTicks;
+} Timer_t;
+
+typedef struct tmrTimerControl * TimerHandle_t;
+
+const char * pcTimerGetName(TimerHandle_t xTimer);
+
+#endif  // TIMERS_H
+
+/*==== End of file ====*/
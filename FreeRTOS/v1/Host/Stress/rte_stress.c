@@ -0,0 +1,1036 @@
+/*
+ * Copyright (c) Branko Premzel.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/*******************************************************************************
+ * @file    rte_stress.c
+ * @author  Branko Premzel
+ * @brief   Multi-producer stress test and benchmark of the trace write path.
+ *
+ * Every "core" is a thread that executes the FreeRTOS trace macros in a loop.
+ * Two POSIX timers per core deliver signals to the core thread and stand in
+ * for interrupts with two priority levels - the higher level interrupts the
+ * lower one, but not vice versa. Interrupt handlers use the _FROM_ISR macros.
+ * All producers write into the same circular buffer.
+ *
+ * Every record carries the producer number and the producer's sequence number
+ * (in a value field of the traced event). After all producers have stopped,
+ * the buffer is decoded and checked:
+ *  - corrupted: wrong number of data words, unknown format ID or a value that
+ *    does not match the producer (e.g. two records that overlap),
+ *  - lost:      a record missing between retained records of a producer,
+ *  - overwritten (circular mode) or dropped (single shot mode): normal loss
+ *    of the oldest records or of the records refused by the back end when
+ *    the buffer is full. A missing record in single shot mode that the back
+ *    end did not refuse is lost.
+ *  - stalled:   (circular mode) a record during whose write the other
+ *    producers wrote a whole buffer of words - the host thread was preempted
+ *    for longer than one buffer wrap. Such a record can be overwritten while
+ *    it is being written, and it can overwrite newer records, as on a target
+ *    with a too small buffer. Up to STALL_DAMAGE_MAX lost and corrupted
+ *    records per stalled record are reported, but they do not fail the test.
+ *
+ * The record mix of each producer depends only on the seed, so the number and
+ * type of records is the same on every run. Timing results and interleaving
+ * of the producers depend on the host.
+ *
+ * Exit code: 0 - no corrupted or lost records, 1 - check failed, 2 - usage or
+ * setup error.
+ ******************************************************************************/
+
+#define _GNU_SOURCE
+#include <errno.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "rte_sim.h"
+
+#ifndef sigev_notify_thread_id
+#define sigev_notify_thread_id _sigev_un._tid
+#endif
+
+#define MAX_CORES           64U
+#define ISR_LEVELS          2U
+#define MAX_PRODUCERS       (MAX_CORES * (1U + ISR_LEVELS))
+#define SEQ_BITS            24U
+#define SEQ_MASK            ((1UL << SEQ_BITS) - 1U)
+#define ISR_RECORDS_MAX     4U      // Max. records logged by one interrupt
+#define STALL_DAMAGE_MAX    8U      // Max. lost + corrupted per stalled record (itself and 3 overwritten)
+
+/* Log-linear latency histogram [ns] - 8 sub-buckets per power of two */
+#define HIST_LINEAR         16U
+#define HIST_SUB_BITS       3U
+#define HIST_BUCKETS        (HIST_LINEAR + (64U - 4U) * (1U << HIST_SUB_BITS))
+
+
+typedef enum
+{
+    REC_TASK_DELAY = 0,
+    REC_QUEUE_SEND,
+    REC_TASK_NOTIFY,
+    REC_NOTIFY_WAIT,
+    REC_TIMER_COMMAND,
+    REC_QUEUE_SEND_FROM_ISR,
+    REC_NOTIFY_FROM_ISR,
+    REC_TYPES
+} record_type_t;
+
+typedef struct
+{
+    const char * name;
+    uint32_t fmt_id;
+    uint32_t id_size;       // Number of format IDs occupied by the message
+    uint32_t data_words;    // Number of data words in the circular buffer
+} record_info_t;
+
+static const record_info_t record_info[REC_TYPES] =
+{
+    { "TASK_DELAY",          MSG1_RTOS_TASK_DELAY,              2U, 1U },
+    { "QUEUE_SEND",          MSG2_RTOS_QUEUE_SEND,              4U, 2U },
+    { "TASK_NOTIFY",         MSG3_RTOS_TASK_NOTIFY1,            8U, 3U },
+    { "TASK_NOTIFY_WAIT",    MSG4_RTOS_TASK_NOTIFY_WAIT1,      16U, 4U },
+    { "TIMER_COMMAND_SEND",  EXT_MSG3_1_RTOS_TIMER_COMMAND_SEND, 16U, 3U },
+    { "QUEUE_SEND_FROM_ISR", MSG2_RTOS_QUEUE_SEND_FROM_ISR,     4U, 2U },
+    { "NOTIFY_FROM_ISR",     MSG3_RTOS_TASK_NOTIFY_FROM_ISR1,   8U, 3U },
+};
+
+typedef struct
+{
+    uint64_t count[HIST_BUCKETS];
+    uint64_t total;
+    uint64_t max;
+} histogram_t;
+
+typedef struct
+{
+    uint32_t number;            // Producer number (part of every record)
+    uint32_t is_isr;
+    uint64_t rng;               // Record mix generator state
+    uint32_t next_seq;          // Number of records emitted
+    uint32_t name;              // Packed task name
+    uint32_t queue_name;        // Packed queue name (registry or hex address)
+    uint32_t timer_name;        // Packed timer name
+    TaskHandle_t task;
+    QueueHandle_t queue;
+    TimerHandle_t timer;
+    uint64_t type_count[REC_TYPES];
+    histogram_t latency;
+    uint32_t stalled;           // Records written during a whole buffer wrap
+    char task_name[8];
+    char queue_name_str[8];
+    char timer_name_str[8];
+
+    /* Decoder results */
+    uint32_t retained;
+    uint32_t first_seq;
+    uint32_t last_seq;
+    uint32_t lost;
+} producer_t;
+
+typedef struct
+{
+    uint32_t cores;
+    uint32_t isr_rate;          // Interrupts per second per level and core
+    uint32_t records;           // Records per task producer
+    uint32_t buffer_words;
+    uint32_t mode;
+    uint64_t seed;
+    const char * report_file;
+    const char * dump_file;
+} config_t;
+
+typedef struct
+{
+    pthread_t thread;
+    uint32_t index;
+    timer_t timer[ISR_LEVELS];
+    uint32_t timers_created;
+    atomic_int ready;
+} core_t;
+
+static config_t cfg =
+{
+    .cores = 4U,
+    .isr_rate = 20000U,
+    .records = 200000U,
+    .buffer_words = 1U << 16,
+    .mode = RTE_MODE_CIRCULAR,
+    .seed = 1U,
+    .report_file = NULL,
+    .dump_file = NULL,
+};
+
+static producer_t producers[MAX_PRODUCERS];
+static core_t cores[MAX_CORES];
+static uint32_t producer_count;
+static _Thread_local uint32_t current_core;
+static atomic_uint_fast64_t words_logged;  // Words written by all producers (FMT and data words)
+
+/* Decoder results */
+static uint64_t rec_long_timestamp;
+static uint64_t rec_corrupted;
+static uint64_t rec_partial;
+static uint64_t rec_decoded;
+
+
+/* xorshift64* - deterministic record mix */
+static uint64_t rng_next(uint64_t * state)
+{
+    uint64_t x = *state;
+    x ^= x >> 12U;
+    x ^= x << 25U;
+    x ^= x >> 27U;
+    *state = x;
+    return x * 0x2545F4914F6CDD1DULL;
+}
+
+
+static inline uint64_t now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+
+static inline uint32_t hist_bucket(uint64_t value)
+{
+    if (value < HIST_LINEAR)
+    {
+        return (uint32_t)value;
+    }
+
+    uint32_t msb = 63U - (uint32_t)__builtin_clzll(value);
+    uint32_t sub = (uint32_t)(value >> (msb - HIST_SUB_BITS)) & ((1U << HIST_SUB_BITS) - 1U);
+    return HIST_LINEAR + (msb - 4U) * (1U << HIST_SUB_BITS) + sub;
+}
+
+
+/* Upper bound of the values in a bucket */
+static uint64_t hist_bucket_limit(uint32_t bucket)
+{
+    if (bucket < HIST_LINEAR)
+    {
+        return bucket;
+    }
+
+    uint32_t msb = (bucket - HIST_LINEAR) / (1U << HIST_SUB_BITS) + 4U;
+    uint64_t sub = (bucket - HIST_LINEAR) % (1U << HIST_SUB_BITS);
+    return (1ULL << msb) + ((sub + 1U) << (msb - HIST_SUB_BITS)) - 1U;
+}
+
+
+static inline void hist_add(histogram_t * hist, uint64_t value)
+{
+    hist->count[hist_bucket(value)]++;
+    hist->total++;
+
+    if (value > hist->max)
+    {
+        hist->max = value;
+    }
+}
+
+
+static void hist_merge(histogram_t * dst, const histogram_t * src)
+{
+    for (uint32_t i = 0U; i < HIST_BUCKETS; i++)
+    {
+        dst->count[i] += src->count[i];
+    }
+
+    dst->total += src->total;
+
+    if (src->max > dst->max)
+    {
+        dst->max = src->max;
+    }
+}
+
+
+static uint64_t hist_percentile(const histogram_t * hist, double percentile)
+{
+    uint64_t rank = (uint64_t)((double)hist->total * percentile / 100.0);
+    uint64_t sum = 0U;
+
+    for (uint32_t i = 0U; i < HIST_BUCKETS; i++)
+    {
+        sum += hist->count[i];
+
+        if ((sum > rank) && (hist->count[i] != 0U))
+        {
+            uint64_t limit = hist_bucket_limit(i);
+            return (limit < hist->max) ? limit : hist->max;
+        }
+    }
+
+    return hist->max;
+}
+
+
+/**
+ * @brief Log one record. The value contains the producer number in the top
+ *        bits and the sequence number in the lower SEQ_BITS bits.
+ */
+
+static void log_record(producer_t * p, record_type_t type)
+{
+    uint32_t value = (p->number << SEQ_BITS) | (p->next_seq & SEQ_MASK);
+    uint32_t words = record_info[type].data_words + 1U;
+    uint_fast64_t words_before = atomic_load_explicit(&words_logged, memory_order_relaxed);
+    uint64_t start = now_ns();
+
+    switch (type)
+    {
+        case REC_TASK_DELAY:
+            rte_sim_task_delay(value);
+            break;
+
+        case REC_QUEUE_SEND:
+            p->queue->uxMessagesWaiting = value;
+            (void)rte_sim_queue_send(p->queue);
+            break;
+
+        case REC_TASK_NOTIFY:
+            (void)rte_sim_task_notify(p->task, 0U, value, eSetBits);
+            break;
+
+        case REC_NOTIFY_WAIT:
+            (void)rte_sim_task_notify_wait(0U, value, ~value, 10U);
+            break;
+
+        case REC_TIMER_COMMAND:
+            (void)rte_sim_timer_command_send(p->timer, 1, value);
+            break;
+
+        case REC_QUEUE_SEND_FROM_ISR:
+            p->queue->uxMessagesWaiting = value;
+            (void)rte_sim_queue_send_from_isr(p->queue);
+            break;
+
+        case REC_NOTIFY_FROM_ISR:
+        default:
+            (void)rte_sim_task_notify_from_isr(p->task, 0U, value, eSetBits);
+            break;
+    }
+
+    hist_add(&p->latency, now_ns() - start);
+
+    if ((cfg.mode == RTE_MODE_CIRCULAR)
+        && ((atomic_load_explicit(&words_logged, memory_order_relaxed) - words_before + words) >= cfg.buffer_words))
+    {
+        p->stalled++;
+    }
+
+    atomic_fetch_add_explicit(&words_logged, words, memory_order_relaxed);
+    p->type_count[type]++;
+    p->next_seq++;
+}
+
+
+static void isr_handler(int sig)
+{
+    int saved_errno = errno;
+    uint32_t level = (uint32_t)(sig - SIGRTMIN);
+    producer_t * p = &producers[cfg.cores * (1U + level) + current_core];
+    uint32_t records = 1U + (uint32_t)(rng_next(&p->rng) % ISR_RECORDS_MAX);
+
+    while (records-- != 0U)
+    {
+        log_record(p, (rng_next(&p->rng) & 1U) ? REC_QUEUE_SEND_FROM_ISR : REC_NOTIFY_FROM_ISR);
+    }
+
+    errno = saved_errno;
+}
+
+
+static int start_core_timers(core_t * core)
+{
+    long period_ns = (cfg.isr_rate != 0U) ? (long)(1000000000UL / cfg.isr_rate) : 0;
+
+    for (uint32_t level = 0U; (level < ISR_LEVELS) && (period_ns > 0); level++)
+    {
+        struct sigevent sev;
+        memset(&sev, 0, sizeof(sev));
+        sev.sigev_notify = SIGEV_THREAD_ID;
+        sev.sigev_signo = SIGRTMIN + (int)level;
+        sev.sigev_notify_thread_id = gettid();
+
+        if (timer_create(CLOCK_MONOTONIC, &sev, &core->timer[level]) != 0)
+        {
+            return -1;
+        }
+
+        core->timers_created++;
+
+        /* Different phase for the two levels so that they do overlap sometimes */
+        struct itimerspec its;
+        its.it_interval.tv_sec = period_ns / 1000000000L;
+        its.it_interval.tv_nsec = period_ns % 1000000000L;
+        its.it_value.tv_sec = 0;
+        its.it_value.tv_nsec = period_ns / (long)(level + 2U) + 1;
+
+        if (timer_settime(core->timer[level], 0, &its, NULL) != 0)
+        {
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+
+static void stop_core_timers(core_t * core)
+{
+    for (uint32_t level = 0U; level < core->timers_created; level++)
+    {
+        timer_delete(core->timer[level]);
+    }
+
+    core->timers_created = 0U;
+}
+
+
+/* Interrupt signals are blocked in all threads except while a core is running */
+static void isr_signals(int how)
+{
+    sigset_t set;
+    sigemptyset(&set);
+
+    for (uint32_t level = 0U; level < ISR_LEVELS; level++)
+    {
+        sigaddset(&set, SIGRTMIN + (int)level);
+    }
+
+    pthread_sigmask(how, &set, NULL);
+}
+
+
+static void * core_thread(void * arg)
+{
+    core_t * core = arg;
+    producer_t * p = &producers[core->index];
+
+    current_core = core->index;
+    rte_sim_task_switch(p->task);
+
+    if (start_core_timers(core) != 0)
+    {
+        perror("timer_create");
+        stop_core_timers(core);
+        atomic_store(&core->ready, -1);
+        return NULL;
+    }
+
+    atomic_store(&core->ready, 1);
+    isr_signals(SIG_UNBLOCK);
+
+    /* The mix is weighted towards the short messages */
+    static const record_type_t mix[8] =
+    {
+        REC_TASK_DELAY, REC_TASK_DELAY, REC_QUEUE_SEND, REC_QUEUE_SEND,
+        REC_TASK_NOTIFY, REC_TASK_NOTIFY, REC_NOTIFY_WAIT, REC_TIMER_COMMAND
+    };
+
+    for (uint32_t i = 0U; i < cfg.records; i++)
+    {
+        log_record(p, mix[rng_next(&p->rng) & 7U]);
+    }
+
+    /* Signals still pending when the thread exits are discarded */
+    isr_signals(SIG_BLOCK);
+    stop_core_timers(core);
+    return NULL;
+}
+
+
+static int install_isr_handlers(void)
+{
+    for (uint32_t level = 0U; level < ISR_LEVELS; level++)
+    {
+        struct sigaction sa;
+        memset(&sa, 0, sizeof(sa));
+        sa.sa_handler = isr_handler;
+        sa.sa_flags = SA_RESTART;
+        sigemptyset(&sa.sa_mask);
+
+        /* A higher level interrupt can't be interrupted by the lower ones */
+        for (uint32_t lower = 0U; lower < level; lower++)
+        {
+            sigaddset(&sa.sa_mask, SIGRTMIN + (int)lower);
+        }
+
+        if (sigaction(SIGRTMIN + (int)level, &sa, NULL) != 0)
+        {
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+
+static int create_producers(void)
+{
+    producer_count = cfg.cores * (1U + ISR_LEVELS);
+
+    for (uint32_t i = 0U; i < producer_count; i++)
+    {
+        producer_t * p = &producers[i];
+        uint32_t level = i / cfg.cores;     // 0 - task, 1.. - interrupt level
+        uint32_t core = i % cfg.cores;
+        static const char prefix[1U + ISR_LEVELS] = { 'T', 'I', 'J' };
+
+        p->number = i;
+        p->is_isr = (level != 0U);
+        p->rng = cfg.seed * 0x9E3779B97F4A7C15ULL + i + 1U;
+        snprintf(p->task_name, sizeof(p->task_name), "%c%03u", prefix[level], core);
+        snprintf(p->queue_name_str, sizeof(p->queue_name_str), "Q%c%02u", prefix[level], core);
+        snprintf(p->timer_name_str, sizeof(p->timer_name_str), "M%03u", core);
+
+        p->task = rte_sim_task_create(p->task_name, 1U);
+        p->queue = rte_sim_queue_create(p->queue_name_str, 8U);
+        p->timer = rte_sim_timer_create(p->timer_name_str, 100U);
+
+        if ((p->task == NULL) || (p->queue == NULL) || (p->timer == NULL))
+        {
+            return -1;
+        }
+
+        /* Expected names - queues not in the registry are logged by address */
+        p->name = rtos_get_task_name(p->task);
+        p->queue_name = RTE_GET_QUEUE_NAME(p->queue);
+        p->timer_name = rtos_get_timer_name(p->timer);
+    }
+
+    return 0;
+}
+
+
+/***
+ * Decoding and verification of the circular buffer contents.
+ */
+
+static int find_record_type(uint32_t id_field)
+{
+    for (uint32_t t = 0U; t < REC_TYPES; t++)
+    {
+        if ((id_field & ~(record_info[t].id_size - 1U)) == record_info[t].fmt_id)
+        {
+            return (int)t;
+        }
+    }
+
+    return -1;
+}
+
+
+static void check_record(uint32_t id_field, const uint32_t * words, uint32_t n_words)
+{
+    if ((id_field & ~1U) == RTE_LONG_TIMESTAMP_ID)
+    {
+        rec_long_timestamp++;
+
+        if (n_words != 1U)
+        {
+            rec_corrupted++;
+        }
+
+        return;
+    }
+
+    if ((id_field & ~1U) == MSG1_RTOS_TASK_SWITCHED_IN || (id_field & ~1U) == MSG1_RTOS_TASK_SWITCHED_OUT
+        || (id_field & ~1U) == MSG1_RTOS_TASK_CREATE)
+    {
+        return;     // Logged once by every core (task) at the start
+    }
+
+    int type = find_record_type(id_field);
+
+    if ((type < 0) || (n_words != record_info[type].data_words))
+    {
+        rec_corrupted++;
+        return;
+    }
+
+    /* Restore the top bits of the data words */
+    uint32_t data[4];
+
+    for (uint32_t i = 0U; i < n_words; i++)
+    {
+        data[i] = (words[i] >> 1U) | (((id_field >> i) & 1U) << 31U);
+    }
+
+    uint32_t value;
+    uint32_t name_ok = 1U;
+    producer_t * p;
+
+    switch (type)
+    {
+        case REC_TASK_DELAY:
+            value = data[0];
+            break;
+
+        case REC_QUEUE_SEND:
+        case REC_QUEUE_SEND_FROM_ISR:
+            value = data[1];
+            break;
+
+        case REC_NOTIFY_WAIT:
+            value = data[2];
+            name_ok = (data[3] == ~value);
+            break;
+
+        default:
+            value = data[2];
+            break;
+    }
+
+    uint32_t number = value >> SEQ_BITS;
+
+    if (!name_ok || (number >= producer_count))
+    {
+        rec_corrupted++;
+        return;
+    }
+
+    p = &producers[number];
+
+    switch (type)
+    {
+        case REC_QUEUE_SEND:
+        case REC_QUEUE_SEND_FROM_ISR:
+            name_ok = (data[0] == p->queue_name);
+            break;
+
+        case REC_TIMER_COMMAND:
+            name_ok = (data[0] == p->timer_name) && (data[1] == 1U) && ((id_field & 8U) != 0U);
+            break;
+
+        case REC_TASK_NOTIFY:
+        case REC_NOTIFY_FROM_ISR:
+        case REC_NOTIFY_WAIT:
+            name_ok = (data[0] == p->name);
+            break;
+
+        default:
+            break;
+    }
+
+    if (!name_ok)
+    {
+        rec_corrupted++;
+        return;
+    }
+
+    /* Sequence numbers of a producer must increase in buffer order */
+    uint32_t seq = value & SEQ_MASK;
+
+    if (p->retained == 0U)
+    {
+        p->first_seq = seq;
+    }
+    else
+    {
+        uint32_t delta = (seq - p->last_seq) & SEQ_MASK;
+
+        if ((delta == 0U) || (delta > (SEQ_MASK / 2U)))
+        {
+            rec_corrupted++;        // Duplicate or out of order
+            return;
+        }
+
+        p->lost += delta - 1U;
+    }
+
+    p->last_seq = seq;
+    p->retained++;
+    rec_decoded++;
+}
+
+
+/**
+ * @brief Decode the buffer from the oldest to the newest word. In the circular
+ *        mode the oldest record may be partially overwritten - everything up
+ *        to the first FMT word is skipped.
+ */
+
+static void decode_buffer(void)
+{
+    const uint32_t size = g_rtedbg.buffer_size;
+    const uint32_t last = g_rtedbg.last_index;
+    uint32_t start = (cfg.mode == RTE_MODE_CIRCULAR) ? last : 0U;
+    uint32_t words[16];
+    uint32_t n_words = 0U;
+    int synced = (start == 0U);
+
+    for (uint32_t i = 0U; i < size; i++)
+    {
+        uint32_t index = (start + i) % size;
+
+        if ((cfg.mode != RTE_MODE_CIRCULAR) && (index >= last))
+        {
+            break;
+        }
+
+        uint32_t word = g_rtedbg.buffer[index];
+
+        if (word == RTE_EMPTY_WORD)
+        {
+            if (n_words != 0U)
+            {
+                rec_corrupted++;    // Data words without a FMT word
+            }
+
+            n_words = 0U;
+            continue;
+        }
+
+        if ((word & 1U) == 0U)
+        {
+            if (n_words < (sizeof(words) / sizeof(words[0])))
+            {
+                words[n_words] = word;
+            }
+
+            n_words++;
+            continue;
+        }
+
+        if (!synced)
+        {
+            rec_partial++;
+            synced = 1;
+        }
+        else
+        {
+            check_record(word >> (32U - RTE_FMT_ID_BITS), words, n_words);
+        }
+
+        n_words = 0U;
+    }
+}
+
+
+/***
+ * Report.
+ */
+
+/**
+ * @brief Count the records missing from the buffer.
+ *
+ * Circular mode - the oldest records are overwritten, none may be missing
+ * after the first retained record of a producer. Single shot mode - the
+ * records that do not fit into the buffer are dropped by the back end. A later
+ * shorter record may still fit, so the missing records of a producer do not
+ * have to be the newest ones, but every one of them must have been refused by
+ * the back end (its counter includes the refused long timestamp messages).
+ *
+ * @param overwritten  Number of overwritten records (circular mode).
+ * @param dropped      Number of dropped records (single shot mode).
+ * @return Number of lost records - missing but neither overwritten nor dropped.
+ */
+
+static uint64_t count_missing(uint64_t * overwritten, uint64_t * dropped)
+{
+    uint64_t gaps = 0U;
+    uint64_t missing_old = 0U;
+    uint64_t missing_new = 0U;
+
+    for (uint32_t i = 0U; i < producer_count; i++)
+    {
+        const producer_t * p = &producers[i];
+        gaps += p->lost;
+
+        if (p->retained == 0U)
+        {
+            missing_old += p->next_seq;
+        }
+        else
+        {
+            missing_old += p->first_seq;
+            missing_new += (p->next_seq - 1U - p->last_seq) & SEQ_MASK;
+        }
+    }
+
+    if (cfg.mode == RTE_MODE_CIRCULAR)
+    {
+        *overwritten = missing_old;
+        *dropped = 0U;
+        return gaps + missing_new;
+    }
+
+    uint64_t missing = missing_old + gaps + missing_new;
+    uint64_t refused = rte_host_dropped();
+    *overwritten = 0U;
+    *dropped = (missing < refused) ? missing : refused;
+    return missing - *dropped;
+}
+
+/** @brief Number of records written while the buffer wrapped (circular mode). */
+
+static uint64_t count_stalled(void)
+{
+    uint64_t stalled = 0U;
+
+    for (uint32_t i = 0U; i < producer_count; i++)
+    {
+        stalled += producers[i].stalled;
+    }
+
+    return stalled;
+}
+
+
+/** @brief No lost or corrupted records except those explained by the stalled records. */
+
+static int result_ok(void)
+{
+    uint64_t overwritten;
+    uint64_t dropped;
+    uint64_t errors = count_missing(&overwritten, &dropped) + rec_corrupted;
+
+    return errors <= (STALL_DAMAGE_MAX * count_stalled());
+}
+
+
+static void print_report(FILE * out, int json, double seconds)
+{
+    histogram_t task_hist;
+    histogram_t isr_hist;
+    uint64_t emitted = 0U;
+    uint64_t emitted_isr = 0U;
+    uint64_t retained = 0U;
+    uint64_t overwritten;
+    uint64_t dropped;
+    uint64_t lost = count_missing(&overwritten, &dropped);
+    uint64_t type_count[REC_TYPES] = { 0U };
+
+    memset(&task_hist, 0, sizeof(task_hist));
+    memset(&isr_hist, 0, sizeof(isr_hist));
+
+    for (uint32_t i = 0U; i < producer_count; i++)
+    {
+        const producer_t * p = &producers[i];
+        hist_merge(p->is_isr ? &isr_hist : &task_hist, &p->latency);
+        emitted += p->next_seq;
+        emitted_isr += p->is_isr ? p->next_seq : 0U;
+        retained += p->retained;
+
+        for (uint32_t t = 0U; t < REC_TYPES; t++)
+        {
+            type_count[t] += p->type_count[t];
+        }
+    }
+
+    double rate = (seconds > 0.0) ? (double)emitted / seconds : 0.0;
+    static const double pct[] = { 50.0, 90.0, 99.0, 99.9 };
+    const histogram_t * hists[2] = { &task_hist, &isr_hist };
+    static const char * const hist_names[2] = { "task", "isr" };
+    const char * mode = (cfg.mode == RTE_MODE_CIRCULAR) ? "circular" : "single_shot";
+
+    if (json)
+    {
+        fprintf(out, "{\n  \"config\": { \"cores\": %u, \"isr_levels\": %u, \"isr_rate_hz\": %u, "
+                "\"records_per_task\": %u, \"buffer_words\": %u, \"mode\": \"%s\", \"seed\": %llu },\n",
+                cfg.cores, ISR_LEVELS, cfg.isr_rate, cfg.records, cfg.buffer_words, mode,
+                (unsigned long long)cfg.seed);
+        fprintf(out, "  \"duration_s\": %.6f,\n  \"throughput_rec_per_s\": %.0f,\n", seconds, rate);
+        fprintf(out, "  \"records\": { \"emitted\": %llu, \"emitted_isr\": %llu, \"retained\": %llu, "
+                "\"overwritten\": %llu, \"dropped\": %llu, \"lost\": %llu, \"corrupted\": %llu, "
+                "\"partial\": %llu, \"long_timestamps\": %llu, \"backend_dropped\": %u, \"stalled\": %llu },\n",
+                (unsigned long long)emitted, (unsigned long long)emitted_isr,
+                (unsigned long long)retained, (unsigned long long)overwritten,
+                (unsigned long long)dropped, (unsigned long long)lost,
+                (unsigned long long)rec_corrupted, (unsigned long long)rec_partial,
+                (unsigned long long)rec_long_timestamp, rte_host_dropped(),
+                (unsigned long long)count_stalled());
+        fprintf(out, "  \"mix\": {");
+
+        for (uint32_t t = 0U; t < REC_TYPES; t++)
+        {
+            fprintf(out, "%s \"%s\": %llu", (t == 0U) ? "" : ",", record_info[t].name,
+                    (unsigned long long)type_count[t]);
+        }
+
+        fprintf(out, " },\n  \"latency_ns\": {\n");
+
+        for (uint32_t h = 0U; h < 2U; h++)
+        {
+            fprintf(out, "    \"%s\": { \"count\": %llu, \"p50\": %llu, \"p90\": %llu, "
+                    "\"p99\": %llu, \"p99_9\": %llu, \"max\": %llu }%s\n",
+                    hist_names[h], (unsigned long long)hists[h]->total,
+                    (unsigned long long)hist_percentile(hists[h], pct[0]),
+                    (unsigned long long)hist_percentile(hists[h], pct[1]),
+                    (unsigned long long)hist_percentile(hists[h], pct[2]),
+                    (unsigned long long)hist_percentile(hists[h], pct[3]),
+                    (unsigned long long)hists[h]->max, (h == 0U) ? "," : "");
+        }
+
+        fprintf(out, "  },\n  \"result\": \"%s\"\n}\n",
+                ((lost == 0U) && (rec_corrupted == 0U)) ? "pass" : result_ok() ? "pass_stalled" : "fail");
+        return;
+    }
+
+    fprintf(out, "RTEdbg trace write path stress test\n");
+    fprintf(out, "  cores: %u, ISR levels: %u at %u Hz, records/task: %u, buffer: %u words, "
+            "mode: %s, seed: %llu\n", cfg.cores, ISR_LEVELS, cfg.isr_rate, cfg.records,
+            cfg.buffer_words, mode, (unsigned long long)cfg.seed);
+    fprintf(out, "  duration: %.3f s, throughput: %.0f records/s\n", seconds, rate);
+    fprintf(out, "  records emitted: %llu (ISR: %llu), retained: %llu, overwritten: %llu, "
+            "dropped: %llu\n", (unsigned long long)emitted, (unsigned long long)emitted_isr,
+            (unsigned long long)retained, (unsigned long long)overwritten,
+            (unsigned long long)dropped);
+    fprintf(out, "  lost: %llu, corrupted: %llu, partial (oldest): %llu, long timestamps: %llu, stalled: %llu\n",
+            (unsigned long long)lost, (unsigned long long)rec_corrupted,
+            (unsigned long long)rec_partial, (unsigned long long)rec_long_timestamp,
+            (unsigned long long)count_stalled());
+
+    for (uint32_t h = 0U; h < 2U; h++)
+    {
+        fprintf(out, "  %-4s latency [ns]: p50 %llu, p90 %llu, p99 %llu, p99.9 %llu, max %llu "
+                "(%llu records)\n", hist_names[h],
+                (unsigned long long)hist_percentile(hists[h], pct[0]),
+                (unsigned long long)hist_percentile(hists[h], pct[1]),
+                (unsigned long long)hist_percentile(hists[h], pct[2]),
+                (unsigned long long)hist_percentile(hists[h], pct[3]),
+                (unsigned long long)hists[h]->max, (unsigned long long)hists[h]->total);
+    }
+
+    fprintf(out, "  result: %s\n", ((lost == 0U) && (rec_corrupted == 0U)) ? "PASS"
+            : result_ok() ? "PASS (damage of the stalled records)" : "FAIL");
+}
+
+
+static void usage(const char * name)
+{
+    fprintf(stderr,
+        "Usage: %s [options]\n"
+        "  -c <n>     number of cores (threads), 1..%u (default %u)\n"
+        "  -i <Hz>    interrupt rate per level and core, 0 - no interrupts (default %u)\n"
+        "  -n <n>     records per task (default %u)\n"
+        "  -b <n>     circular buffer size [words] (default %u)\n"
+        "  -m <mode>  wrap | single (default wrap)\n"
+        "  -s <n>     seed of the record mix (default %llu)\n"
+        "  -o <file>  write the report in JSON format\n"
+        "  -d <file>  write the buffer contents (binary capture)\n",
+        name, MAX_CORES, cfg.cores, cfg.isr_rate, cfg.records, cfg.buffer_words,
+        (unsigned long long)cfg.seed);
+}
+
+
+int main(int argc, char * argv[])
+{
+    int opt;
+
+    while ((opt = getopt(argc, argv, "c:i:n:b:m:s:o:d:h")) != -1)
+    {
+        switch (opt)
+        {
+            case 'c': cfg.cores = (uint32_t)strtoul(optarg, NULL, 0); break;
+            case 'i': cfg.isr_rate = (uint32_t)strtoul(optarg, NULL, 0); break;
+            case 'n': cfg.records = (uint32_t)strtoul(optarg, NULL, 0); break;
+            case 'b': cfg.buffer_words = (uint32_t)strtoul(optarg, NULL, 0); break;
+            case 's': cfg.seed = strtoull(optarg, NULL, 0); break;
+            case 'o': cfg.report_file = optarg; break;
+            case 'd': cfg.dump_file = optarg; break;
+            case 'm':
+                if (strcmp(optarg, "wrap") == 0)
+                {
+                    cfg.mode = RTE_MODE_CIRCULAR;
+                }
+                else if (strcmp(optarg, "single") == 0)
+                {
+                    cfg.mode = RTE_MODE_SINGLE_SHOT;
+                }
+                else
+                {
+                    usage(argv[0]);
+                    return 2;
+                }
+                break;
+            default:
+                usage(argv[0]);
+                return 2;
+        }
+    }
+
+    if ((cfg.cores == 0U) || (cfg.cores > MAX_CORES) || (cfg.buffer_words < 64U)
+        || (cfg.records == 0U) || (cfg.records > SEQ_MASK))
+    {
+        usage(argv[0]);
+        return 2;
+    }
+
+    if ((rte_host_init(cfg.buffer_words, cfg.mode) != 0) || (create_producers() != 0)
+        || (install_isr_handlers() != 0))
+    {
+        fprintf(stderr, "Setup failed\n");
+        return 2;
+    }
+
+    isr_signals(SIG_BLOCK);        // Inherited by the core threads
+    uint64_t start = now_ns();
+
+    for (uint32_t i = 0U; i < cfg.cores; i++)
+    {
+        cores[i].index = i;
+
+        if (pthread_create(&cores[i].thread, NULL, core_thread, &cores[i]) != 0)
+        {
+            fprintf(stderr, "pthread_create failed\n");
+            return 2;
+        }
+    }
+
+    int failed = 0;
+
+    for (uint32_t i = 0U; i < cfg.cores; i++)
+    {
+        pthread_join(cores[i].thread, NULL);
+        failed |= (atomic_load(&cores[i].ready) < 0);
+    }
+
+    double seconds = (double)(now_ns() - start) / 1e9;
+
+    if (failed)
+    {
+        return 2;
+    }
+
+    decode_buffer();
+    print_report(stdout, 0, seconds);
+
+    if (cfg.report_file != NULL)
+    {
+        FILE * out = fopen(cfg.report_file, "w");
+
+        if (out == NULL)
+        {
+            perror(cfg.report_file);
+            return 2;
+        }
+
+        print_report(out, 1, seconds);
+        fclose(out);
+    }
+
+    if ((cfg.dump_file != NULL) && (rte_host_dump(cfg.dump_file) != 0))
+    {
+        perror(cfg.dump_file);
+        return 2;
+    }
+
+    int ok = result_ok();
+    rte_host_exit();
+    return ok ? 0 : 1;
+}
+
+/*==== End of file ====*/
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) Branko Premzel.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/*******************************************************************************
+ * @file    rte_expert_pairs.c
+ * @author  Branko Premzel
+ * @brief   Test of the ENTER/RETURN pairing of the Expert format IDs
+ *          (rte_FreeRTOS_trace2_fmt.h, rte_fmt_ids.py --pack-pairs).
+ *
+ * The partner of a message is id ^ S, where S is the number of IDs of the
+ * larger message of the pair. The ID field of a logged message also holds
+ * the top bits of the data words - the partner is found from it with
+ * (field & ~(size - 1)) ^ S. All pairs are checked by the expert_id_pairs
+ * test, this one checks the relation from C for pairs of different sizes.
+ *
+ * Exit code: 0 - all values are as expected, 1 - check failed.
+ ******************************************************************************/
+
+#include <stdio.h>
+#include <stdint.h>
+#include "rte_FreeRTOS_trace2_fmt.h"
+
+typedef struct
+{
+    const char * name;
+    uint32_t enter;
+    uint32_t enter_ids;         // Number of IDs of the ENTER message (2^n for MSGn)
+    uint32_t ret;
+    uint32_t ret_ids;
+} pair_t;
+
+static const pair_t pairs[] =
+{
+    { "xEventGroupCreateStatic", MSG1_RTOS_EVENT_GROUP_CREATE_STATIC_ENTER, 2U,
+      MSG1_RTOS_EVENT_GROUP_CREATE_STATIC_RETURN, 2U },
+    { "xEventGroupCreate", MSG0_RTOS_EVENT_GROUP_CREATE_ENTER, 1U, MSG1_RTOS_EVENT_GROUP_CREATE_RETURN, 2U },
+    { "vTaskDelay", MSG1_RTOS_TASK_DELAY_ENTER, 2U, MSG0_RTOS_TASK_DELAY_RETURN, 1U },
+    { "xTaskDelayUntil", MSG2_RTOS_TASK_DELAY_UNTIL_ENTER, 4U, MSG1_RTOS_TASK_DELAY_UNTIL_RETURN, 2U },
+    { "xQueueGenericSend", MSG4_RTOS_QUEUE_GENERIC_SEND_ENTER, 16U, MSG1_RTOS_QUEUE_GENERIC_SEND_RETURN, 2U },
+    { "xTaskCreate", MSG6_RTOS_TASK_CREATE_ENTER, 16U, MSG1_RTOS_TASK_CREATE_RETURN, 2U },
+};
+
+static uint32_t errors;
+
+
+/** @brief Partner of the message with the given ID field (with the top bits of the data words). */
+
+static uint32_t partner(uint32_t id_field, uint32_t ids, uint32_t pair_size)
+{
+    return (id_field & ~(ids - 1U)) ^ pair_size;
+}
+
+
+static void check_side(const char * name, const char * side, uint32_t id, uint32_t ids, uint32_t other,
+                       uint32_t pair_size)
+{
+    for (uint32_t top_bits = 0U; top_bits < ids; top_bits++)
+    {
+        if (partner(id + top_bits, ids, pair_size) != other)
+        {
+            printf("%s %s: ID field %u -> %u, expected %u\n", name, side, id + top_bits,
+                   partner(id + top_bits, ids, pair_size), other);
+            errors++;
+        }
+    }
+}
+
+
+int main(void)
+{
+    for (uint32_t i = 0U; i < (sizeof(pairs) / sizeof(pairs[0])); i++)
+    {
+        const pair_t * p = &pairs[i];
+        uint32_t pair_size = (p->enter_ids > p->ret_ids) ? p->enter_ids : p->ret_ids;
+
+        if (((p->enter % p->enter_ids) != 0U) || ((p->ret % p->ret_ids) != 0U))
+        {
+            printf("%s: IDs %u / %u not aligned to the message size\n", p->name, p->enter, p->ret);
+            errors++;
+        }
+
+        check_side(p->name, "ENTER", p->enter, p->enter_ids, p->ret, pair_size);
+        check_side(p->name, "RETURN", p->ret, p->ret_ids, p->enter, pair_size);
+    }
+
+    printf("%u pairs: %s\n", (unsigned)(sizeof(pairs) / sizeof(pairs[0])), (errors == 0U) ? "OK" : "FAILED");
+    return (errors == 0U) ? 0 : 1;
+}
+
+/*==== End of file ====*/
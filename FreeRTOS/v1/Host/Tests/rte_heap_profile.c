@@ -0,0 +1,323 @@
+/*
+ * Copyright (c) Branko Premzel.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/*******************************************************************************
+ * @file    rte_heap_profile.c
+ * @author  Branko Premzel
+ * @brief   Test of the heap profiler (RTE_TRACE_RTOS_HEAP_PROFILE) with the
+ *          simulated pvPortMalloc() and vPortFree().
+ *
+ * The timestamp source (also the tick count of the simulator) is a counter
+ * advanced by the test (1 MHz - 1 us per count). Three allocation sites:
+ *  - Leak - one 100 byte block per second, never freed,
+ *  - Temp - 32 blocks of 40 bytes per second, freed at once,
+ *  - Bulk - 150 blocks of 32 bytes. Together with the Leak blocks they do not
+ *    fit into the table of live allocations (RTE_RTOS_HEAP_ALLOCS = 128).
+ *    The blocks that are not tracked are charged to the other sites entry
+ *    (site address 0), so all the live counters must return to 0 after the
+ *    blocks are freed.
+ * The summaries are logged only by rtos_heap_profile_poll() - never from the
+ * heap functions (with the scheduler suspended).
+ *
+ * Usage: rte_heap_profile [capture file]
+ *
+ * The capture file is decoded by the heap_profile_decode test and the
+ * RTOS_heap.csv file is checked with Scripts/rte_heap_report.py.
+ *
+ * Exit code: 0 - all values are as expected, 1 - check failed, 2 - setup error.
+ ******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "rte_sim.h"
+
+#define BUFFER_WORDS        65536U
+#define ROUNDS              10U
+#define LEAK_SIZE           100U
+#define TEMP_BLOCKS         32U
+#define TEMP_SIZE           40U
+#define BULK_BLOCKS         150U
+#define BULK_SIZE           32U
+#define BULK_UNTRACKED      (BULK_BLOCKS + ROUNDS - RTE_RTOS_HEAP_ALLOCS)
+#define BULK_TRACKED        (BULK_BLOCKS - BULK_UNTRACKED)
+
+#if RTE_TRACE_RTOS_HEAP_PROFILE != 1
+#error "The test requires RTE_TRACE_RTOS_HEAP_PROFILE = 1."
+#endif
+
+#if (RTE_RTOS_HEAP_ALLOCS != 128U) || (RTE_RTOS_HEAP_SUMMARY_PERIOD != 64U)
+#error "The test requires the default RTE_RTOS_HEAP_ALLOCS and RTE_RTOS_HEAP_SUMMARY_PERIOD."
+#endif
+
+typedef struct
+{
+    uint32_t live;
+    uint32_t peak;
+    uint32_t allocs;
+    uint32_t frees;
+    uint32_t failed;
+    uint32_t untracked;
+} summary_t;
+
+typedef struct
+{
+    uint32_t site;
+    uint32_t live_count;
+    uint32_t live_bytes;
+    uint32_t allocs;
+} site_t;
+
+static uint64_t sim_clock;
+static uint32_t errors;
+static void * bulk[BULK_BLOCKS];
+static summary_t summary;       // The last summary
+static uint32_t summaries;
+static site_t sites[8];         // Sites of the last summary
+static uint32_t site_count;
+
+
+static uint64_t sim_timestamp(void)
+{
+    return sim_clock;
+}
+
+
+/* Allocation sites - the return address of pvPortMalloc() identifies them */
+static __attribute__((noinline)) void * leak_alloc(void)
+{
+    return pvPortMalloc(LEAK_SIZE);
+}
+
+
+static __attribute__((noinline)) void * temp_alloc(void)
+{
+    return pvPortMalloc(TEMP_SIZE);
+}
+
+
+static __attribute__((noinline)) void * bulk_alloc(void)
+{
+    return pvPortMalloc(BULK_SIZE);
+}
+
+
+/**
+ * @brief Decode the buffer (single shot mode) and keep the values of the last
+ *        summary and its allocation sites. MSG5 data: five data words and the
+ *        word with their top bits.
+ */
+
+static void decode(void)
+{
+    uint32_t words[6];
+    uint32_t n_words = 0U;
+
+    summaries = 0U;
+
+    for (uint32_t i = 0U; i < g_rtedbg.last_index; i++)
+    {
+        uint32_t word = g_rtedbg.buffer[i];
+
+        if ((word & 1U) == 0U)
+        {
+            if (n_words < (sizeof(words) / sizeof(words[0])))
+            {
+                words[n_words] = word >> 1U;
+            }
+
+            n_words++;
+            continue;
+        }
+
+        uint32_t id_field = word >> (32U - RTE_FMT_ID_BITS);
+        uint32_t value[5];
+
+        if (n_words == 6U)
+        {
+            for (uint32_t k = 0U; k < 5U; k++)
+            {
+                value[k] = words[k] | (((words[5] >> k) & 1U) << 31U);
+            }
+
+            if (id_field == MSG5_RTOS_HEAP_SUMMARY)
+            {
+                summary.live = value[0];
+                summary.peak = value[1];
+                summary.allocs = value[2];
+                summary.frees = value[3];
+                summary.failed = value[4] & 0xFFFFU;
+                summary.untracked = value[4] >> 16U;
+                summaries++;
+                site_count = 0U;
+            }
+            else if ((id_field == MSG5_RTOS_HEAP_SITE) && (site_count < (sizeof(sites) / sizeof(sites[0]))))
+            {
+                sites[site_count].site = value[0];
+                sites[site_count].live_count = value[1];
+                sites[site_count].live_bytes = value[2];
+                sites[site_count].allocs = value[3];
+                site_count++;
+            }
+        }
+
+        n_words = 0U;
+    }
+}
+
+
+/** @brief Check the site with the given number of allocations (site 0 - the other sites). */
+
+static void check_site(const char * name, uint32_t site, uint32_t allocs, uint32_t live_count, uint32_t live_bytes)
+{
+    for (uint32_t i = 0U; i < site_count; i++)
+    {
+        const site_t * p = &sites[i];
+
+        if ((site == 0U) ? (p->site == 0U) : ((p->site != 0U) && (p->allocs == allocs)))
+        {
+            int ok = (p->allocs == allocs) && (p->live_count == live_count) && (p->live_bytes == live_bytes);
+            printf("  %-6s %u allocations, %u live, %u bytes%s\n", name, p->allocs, p->live_count,
+                   p->live_bytes, ok ? "" : "  <- error");
+            errors += ok ? 0U : 1U;
+            return;
+        }
+    }
+
+    printf("  %-6s not logged\n", name);
+    errors++;
+}
+
+
+static void run_sequence(void)
+{
+    TaskHandle_t task = rte_sim_task_create("Main", 1U);
+    rte_sim_task_switch(task);
+
+    for (uint32_t round = 1U; round <= ROUNDS; round++)
+    {
+        sim_clock = (uint64_t)round * 1000000U;
+        (void)leak_alloc();
+
+        for (uint32_t i = 0U; i < TEMP_BLOCKS; i++)
+        {
+            vPortFree(temp_alloc());
+        }
+
+        if (round == 1U)
+        {
+            /* More than RTE_RTOS_HEAP_SUMMARY_PERIOD operations - no summary yet */
+            decode();
+
+            if (summaries != 0U)
+            {
+                printf("A summary was logged by the heap functions\n");
+                errors++;
+            }
+        }
+
+        rtos_heap_profile_poll();
+    }
+
+    if (pvPortMalloc(configTOTAL_HEAP_SIZE + 1U) != NULL)
+    {
+        printf("The allocation larger than the heap did not fail\n");
+        errors++;
+    }
+
+    sim_clock = 11000000U;
+
+    for (uint32_t i = 0U; i < BULK_BLOCKS; i++)
+    {
+        bulk[i] = bulk_alloc();
+    }
+
+    rtos_heap_profile_poll();
+    decode();
+    printf("Summary %u - table full:\n", summaries);
+    check_site("Bulk", 1U, BULK_TRACKED, BULK_TRACKED, BULK_TRACKED * BULK_SIZE);
+    check_site("Other", 0U, BULK_UNTRACKED, BULK_UNTRACKED, BULK_UNTRACKED * BULK_SIZE);
+
+    sim_clock = 12000000U;
+
+    for (uint32_t i = 0U; i < BULK_BLOCKS; i++)
+    {
+        vPortFree(bulk[i]);
+    }
+
+    rtos_heap_profile_poll();
+}
+
+
+static void check(void)
+{
+    const summary_t expected =
+    {
+        ROUNDS * LEAK_SIZE, (ROUNDS * LEAK_SIZE) + (BULK_BLOCKS * BULK_SIZE),
+        ROUNDS * (1U + TEMP_BLOCKS) + BULK_BLOCKS, (ROUNDS * TEMP_BLOCKS) + BULK_BLOCKS, 1U, BULK_UNTRACKED
+    };
+
+    decode();
+    printf("Summary %u - all bulk blocks freed:\n", summaries);
+    check_site("Leak", 1U, ROUNDS, ROUNDS, ROUNDS * LEAK_SIZE);
+    check_site("Bulk", 1U, BULK_TRACKED, 0U, 0U);
+    check_site("Other", 0U, BULK_UNTRACKED, 0U, 0U);
+
+    int ok = (summary.live == expected.live) && (summary.peak == expected.peak)
+          && (summary.allocs == expected.allocs) && (summary.frees == expected.frees)
+          && (summary.failed == expected.failed) && (summary.untracked == expected.untracked);
+    printf("  live %u, peak %u, %u allocs, %u frees, %u failed, %u untracked%s\n", summary.live,
+           summary.peak, summary.allocs, summary.frees, summary.failed, summary.untracked,
+           ok ? "" : "  <- error");
+    errors += ok ? 0U : 1U;
+
+    if (summaries != (ROUNDS + 2U))
+    {
+        printf("%u summaries, expected %u\n", summaries, ROUNDS + 2U);
+        errors++;
+    }
+}
+
+
+int main(int argc, char * argv[])
+{
+    if (argc > 2)
+    {
+        printf("Usage: %s [capture file]\n", argv[0]);
+        return 2;
+    }
+
+    rte_host_set_timestamp_source(sim_timestamp, 1000000U);
+
+    if (rte_host_init(BUFFER_WORDS, RTE_MODE_SINGLE_SHOT) != 0)
+    {
+        printf("Out of memory\n");
+        return 2;
+    }
+
+    run_sequence();
+
+    if (rte_host_dropped() != 0U)
+    {
+        printf("%u messages dropped - the buffer is too small\n", rte_host_dropped());
+        rte_host_exit();
+        return 2;
+    }
+
+    check();
+
+    if ((argc == 2) && (rte_host_dump(argv[1]) != 0))
+    {
+        printf("Cannot write %s\n", argv[1]);
+        rte_host_exit();
+        return 2;
+    }
+
+    rte_host_exit();
+    printf("%s\n", (errors == 0U) ? "OK" : "FAILED");
+    return (errors == 0U) ? 0 : 1;
+}
+
+/*==== End of file ====*/
@@ -0,0 +1,309 @@
+/*
+ * Copyright (c) Branko Premzel.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/*******************************************************************************
+ * @file    rte_isr_stats.c
+ * @author  Branko Premzel
+ * @brief   Test of the IRQ-aware ISR trace and the per-IRQ counters
+ *          (RTE_TRACE_RTOS_ISR_IRQ).
+ *
+ * The timestamp source (also the cycle counter and the tick count of the
+ * simulator) is a counter advanced by the test (1 MHz - 1 us per count).
+ *  - IRQ 20 is interrupted by the nested IRQ 30 ten times. The execution time
+ *    of IRQ 20 must not include the time of IRQ 30 and the nesting levels of
+ *    the ISR enter messages must be 0 and 1.
+ *  - An interrupt after the end of the counting period must not log the
+ *    counters - they are logged only by rtos_isr_stats_poll() from a task,
+ *    and only after RTE_RTOS_ISR_STATS_PERIOD ticks.
+ *  - The second period is longer than 2^32 cycles - the logged period length
+ *    must not be the wrapped 32-bit cycle counter difference.
+ *
+ * Usage: rte_isr_stats [capture file]
+ *
+ * The capture file is decoded by the isr_stats_log test.
+ *
+ * Exit code: 0 - all values are as expected, 1 - check failed, 2 - setup error.
+ ******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "rte_sim.h"
+
+#define BUFFER_WORDS        65536U
+#define NESTED              10U         // IRQ 20 interrupted by IRQ 30
+#define OUTER_IRQ           20U
+#define INNER_IRQ           30U
+#define FIRST_PERIOD        1001000ULL  // [us]
+#define SECOND_PERIOD       ((1ULL << 32U) + 3000000ULL)
+
+#if RTE_TRACE_RTOS_ISR_IRQ != 1
+#error "The test requires RTE_TRACE_RTOS_ISR_IRQ = 1."
+#endif
+
+typedef struct
+{
+    uint32_t irq;
+    uint32_t load;          // [per mille]
+    uint32_t count;
+    uint32_t cycles;
+    uint32_t max_cycles;
+} irq_stats_t;
+
+static const irq_stats_t expected_stats[] =
+{
+    { OUTER_IRQ, 70U, NESTED + 1U, 70045U + 500U, 7009U },  // First period
+    { INNER_IRQ, 29U, NESTED, 30000U, 3000U },
+    { OUTER_IRQ, 0U, 1U, 500U, 500U },                      // Second period
+};
+
+#define EXPECTED_STATS      (sizeof(expected_stats) / sizeof(expected_stats[0]))
+
+static uint64_t sim_clock;
+static uint32_t errors;
+static uint64_t periods[4];
+static uint32_t period_count;
+static irq_stats_t stats[8];
+static uint32_t stats_count;
+static uint32_t enter_count;
+
+
+static uint64_t sim_timestamp(void)
+{
+    return sim_clock;
+}
+
+
+/** @brief Advance the clock to the given time [us]. */
+
+static void at(uint64_t time)
+{
+    sim_clock = time;
+}
+
+
+/**
+ * @brief Decode the buffer (single shot mode) up to the given index and
+ *        collect the ISR statistics and the ISR enter messages.
+ */
+
+static void decode(uint32_t limit)
+{
+    uint32_t words[4];
+    uint32_t n_words = 0U;
+
+    period_count = 0U;
+    stats_count = 0U;
+    enter_count = 0U;
+
+    for (uint32_t i = 0U; i < limit; i++)
+    {
+        uint32_t word = g_rtedbg.buffer[i];
+
+        if ((word & 1U) == 0U)
+        {
+            if (n_words < (sizeof(words) / sizeof(words[0])))
+            {
+                words[n_words] = word >> 1U;
+            }
+
+            n_words++;
+            continue;
+        }
+
+        uint32_t id_field = word >> (32U - RTE_FMT_ID_BITS);
+        uint32_t value[4];
+
+        for (uint32_t k = 0U; k < 4U; k++)
+        {
+            value[k] = words[k] | (((id_field >> k) & 1U) << 31U);
+        }
+
+        if (((id_field & ~3U) == MSG2_RTOS_ISR_STATS_PERIOD) && (n_words == 2U))
+        {
+            if (period_count < (sizeof(periods) / sizeof(periods[0])))
+            {
+                periods[period_count] = value[0] | ((uint64_t)value[1] << 32U);
+            }
+
+            period_count++;
+        }
+        else if (((id_field & ~15U) == MSG4_RTOS_ISR_STATS) && (n_words == 4U))
+        {
+            if (stats_count < (sizeof(stats) / sizeof(stats[0])))
+            {
+                irq_stats_t * p = &stats[stats_count];
+                p->irq = value[0] & 0xFFFFU;
+                p->load = value[0] >> 16U;
+                p->count = value[1];
+                p->cycles = value[2];
+                p->max_cycles = value[3];
+            }
+
+            stats_count++;
+        }
+        else if (((id_field & ~1U) == MSG1_RTOS_ISR_ENTER_IRQ) && (n_words == 1U))
+        {
+            uint32_t irq = value[0] & 0xFFFFU;
+            uint32_t level = value[0] >> 16U;
+
+            if (level != ((irq == INNER_IRQ) ? 1U : 0U))
+            {
+                printf("IRQ %u entered at nesting level %u\n", irq, level);
+                errors++;
+            }
+
+            enter_count++;
+        }
+
+        n_words = 0U;
+    }
+}
+
+
+static void run_sequence(void)
+{
+    TaskHandle_t task = rte_sim_task_create("Main", 1U);
+    rte_sim_task_switch(task);
+
+    for (uint32_t i = 0U; i < NESTED; i++)
+    {
+        const uint64_t base = (uint64_t)(i + 1U) * 50000U;
+
+        at(base);
+        rte_sim_isr_enter(OUTER_IRQ);
+        at(base + 2000U);
+        rte_sim_isr_enter(INNER_IRQ);
+        at(base + 5000U);
+        rte_sim_isr_exit(pdFALSE);
+        at(base + 10000U + i);
+        rte_sim_isr_exit(pdTRUE);
+    }
+
+    at(500000U);
+    rtos_isr_stats_poll();      // Half of the period - no dump
+
+    /* Interrupt after the end of the period */
+    at(FIRST_PERIOD - 800U);
+    rte_sim_isr_enter(OUTER_IRQ);
+    at(FIRST_PERIOD - 300U);
+    rte_sim_isr_exit(pdFALSE);
+    decode(g_rtedbg.last_index);
+
+    if (period_count != 0U)
+    {
+        printf("The counters were logged before the poll\n");
+        errors++;
+    }
+
+    at(FIRST_PERIOD);
+    rtos_isr_stats_poll();
+
+    at(FIRST_PERIOD + SECOND_PERIOD - 1000U);
+    rte_sim_isr_enter(OUTER_IRQ);
+    at(FIRST_PERIOD + SECOND_PERIOD - 500U);
+    rte_sim_isr_exit(pdFALSE);
+    at(FIRST_PERIOD + SECOND_PERIOD);
+    rtos_isr_stats_poll();
+}
+
+
+static void check(void)
+{
+    static const uint64_t expected_periods[] = { FIRST_PERIOD, SECOND_PERIOD };
+
+    decode(g_rtedbg.last_index);
+
+    if (enter_count != ((2U * NESTED) + 2U))
+    {
+        printf("%u ISR enter messages, expected %u\n", enter_count, (2U * NESTED) + 2U);
+        errors++;
+    }
+
+    if (period_count != 2U)
+    {
+        printf("%u counter dumps, expected 2\n", period_count);
+        errors++;
+        return;
+    }
+
+    for (uint32_t i = 0U; i < 2U; i++)
+    {
+        printf("Period %u: %llu cycles\n", i + 1U, (unsigned long long)periods[i]);
+
+        if (periods[i] != expected_periods[i])
+        {
+            printf("  expected %llu\n", (unsigned long long)expected_periods[i]);
+            errors++;
+        }
+    }
+
+    if (stats_count != EXPECTED_STATS)
+    {
+        printf("%u IRQ counter messages, expected %u\n", stats_count, (unsigned)EXPECTED_STATS);
+        errors++;
+        return;
+    }
+
+    printf("%5s %6s %8s %10s %10s\n", "IRQ", "Load", "Count", "Cycles", "Max");
+
+    for (uint32_t i = 0U; i < EXPECTED_STATS; i++)
+    {
+        const irq_stats_t * p = &stats[i];
+        const irq_stats_t * e = &expected_stats[i];
+        int ok = (p->irq == e->irq) && (p->load == e->load) && (p->count == e->count)
+              && (p->cycles == e->cycles) && (p->max_cycles == e->max_cycles);
+
+        printf("%5u %6u %8u %10u %10u%s\n", p->irq, p->load, p->count, p->cycles, p->max_cycles,
+               ok ? "" : "  <- error");
+
+        if (!ok)
+        {
+            errors++;
+        }
+    }
+}
+
+
+int main(int argc, char * argv[])
+{
+    if (argc > 2)
+    {
+        printf("Usage: %s [capture file]\n", argv[0]);
+        return 2;
+    }
+
+    rte_host_set_timestamp_source(sim_timestamp, 1000000U);
+
+    if (rte_host_init(BUFFER_WORDS, RTE_MODE_SINGLE_SHOT) != 0)
+    {
+        printf("Out of memory\n");
+        return 2;
+    }
+
+    run_sequence();
+
+    if (rte_host_dropped() != 0U)
+    {
+        printf("%u messages dropped - the buffer is too small\n", rte_host_dropped());
+        rte_host_exit();
+        return 2;
+    }
+
+    check();
+
+    if ((argc == 2) && (rte_host_dump(argv[1]) != 0))
+    {
+        printf("Cannot write %s\n", argv[1]);
+        rte_host_exit();
+        return 2;
+    }
+
+    rte_host_exit();
+    printf("%s\n", (errors == 0U) ? "OK" : "FAILED");
+    return (errors == 0U) ? 0 : 1;
+}
+
+/*==== End of file ====*/
@@ -0,0 +1,217 @@
+/*
+ * Copyright (c) Branko Premzel.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/*******************************************************************************
+ * @file    rte_overhead.c
+ * @author  Branko Premzel
+ * @brief   Test of the trace overhead self-measurement (RTE_TRACE_RTOS_OVERHEAD).
+ *
+ * The simulated kernel functions are called a known number of times with the
+ * instrumented build of the trace macros. The application logs a message with
+ * the same ID as one of the trace macros - the RTE_MSGx() macros of the
+ * application must not be measured. The queue latency statistics (RTE_RTOS_MSG5()
+ * and RTE_RTOS_MSG8()) are logged every RTE_RTOS_QUEUE_LATENCY_PERIOD received
+ * items and by rtos_queue_latency_dump(). The table is then logged with
+ * rtos_overhead_dump(), the buffer is decoded and the number of measured
+ * messages of every checked message ID is compared with the number of calls.
+ * Message ID 0 is measured with direct rtos_overhead_add() calls.
+ * The table is printed - the times are in ns (clock_gettime() stand-in for
+ * the CPU cycle counter) and depend on the host.
+ *
+ * Exit code: 0 - all counts are as expected, 1 - check failed, 2 - setup error.
+ ******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "rte_sim.h"
+
+#define BUFFER_WORDS        (1024U * 1024U)
+#define CALLS               2000U
+#define LATENCY_LOGS        ((CALLS / RTE_RTOS_QUEUE_LATENCY_PERIOD) + 1U)
+
+#if RTE_TRACE_RTOS_OVERHEAD != 1
+#error "The test requires the instrumented build (RTE_TRACE_RTOS_OVERHEAD = 1)."
+#endif
+
+#if (RTE_TRACE_RTOS_QUEUE_LATENCY != 1) || (RTE_RTOS_QUEUE_LATENCY_PERIOD == 0)
+#error "The test requires RTE_TRACE_RTOS_QUEUE_LATENCY = 1 and a periodic latency log."
+#endif
+
+#define CHECKED(fmt_id, calls) { (fmt_id), #fmt_id, (calls), 0U, 0U, 0U }
+
+typedef struct
+{
+    uint32_t fmt_id;
+    const char * name;
+    uint32_t expected;      // Number of calls
+    uint32_t count;         // Values from the dump
+    uint32_t average;
+    uint32_t max;
+} checked_t;
+
+static checked_t checked[] =
+{
+    CHECKED(MSG1_RTOS_TASK_SWITCHED_IN, CALLS),
+    CHECKED(MSG1_RTOS_TASK_SWITCHED_OUT, CALLS),
+    CHECKED(MSG1_RTOS_TASK_DELAY, CALLS),
+    CHECKED(MSG1_RTOS_TASK_INCREMENT_TICK, CALLS),
+    CHECKED(MSG2_RTOS_QUEUE_SEND, CALLS),
+    CHECKED(MSG2_RTOS_QUEUE_RECEIVE, CALLS),
+    CHECKED(MSG3_RTOS_TASK_NOTIFY1, CALLS),
+    CHECKED(EXT_MSG3_1_RTOS_TIMER_COMMAND_SEND, CALLS),
+    CHECKED(MSG5_RTOS_QUEUE_LATENCY_STATS, LATENCY_LOGS),
+    CHECKED(MSG8_RTOS_QUEUE_LATENCY_HISTOGRAM, LATENCY_LOGS),
+    CHECKED(0U, CALLS),     // Message ID 0 is valid - added directly
+};
+
+#define CHECKED_IDS         (sizeof(checked) / sizeof(checked[0]))
+
+
+static checked_t * find_checked(uint32_t fmt_id)
+{
+    for (uint32_t i = 0U; i < CHECKED_IDS; i++)
+    {
+        if (checked[i].fmt_id == fmt_id)
+        {
+            return &checked[i];
+        }
+    }
+
+    return NULL;
+}
+
+
+static void run_workload(void)
+{
+    TaskHandle_t task_a = rte_sim_task_create("TaskA", 1U);
+    TaskHandle_t task_b = rte_sim_task_create("TaskB", 2U);
+    QueueHandle_t queue = rte_sim_queue_create("Queue", 4U);
+    TimerHandle_t timer = rte_sim_timer_create("Timer", 10U);
+
+    rte_sim_task_switch(task_a);
+    (void)rtos_queue_latency_enable(queue);
+    rtos_overhead_reset();      // The task and object setup is not counted
+
+    for (uint32_t i = 0U; i < CALLS; i++)
+    {
+        rte_sim_task_switch(((i & 1U) == 0U) ? task_b : task_a);
+        rte_sim_task_delay(1U);
+        RTE_MSG1(MSG1_RTOS_TASK_DELAY, F_RTOS_TASKS, i);     // Application message - not measured
+        rte_sim_tick();
+        (void)rte_sim_queue_generic_send(queue, queueSEND_TO_BACK);
+        (void)rte_sim_queue_receive(queue, 0U);
+        (void)rte_sim_task_notify(task_b, 0U, i, eSetValueWithOverwrite);
+        (void)rte_sim_timer_command_send(timer, 1, 0U);
+        rtos_overhead_add(0U, 0U);
+    }
+
+    rtos_queue_latency_dump();
+    rtos_overhead_dump();
+}
+
+
+/**
+ * @brief Decode the buffer (single shot mode) and collect the overhead table.
+ * @return Number of table messages (MSG3_RTOS_OVERHEAD_TABLE)
+ */
+
+static uint32_t decode_table(void)
+{
+    uint32_t words[8];
+    uint32_t n_words = 0U;
+    uint32_t tables = 0U;
+
+    for (uint32_t i = 0U; i < g_rtedbg.last_index; i++)
+    {
+        uint32_t word = g_rtedbg.buffer[i];
+
+        if ((word & 1U) == 0U)
+        {
+            if (n_words < (sizeof(words) / sizeof(words[0])))
+            {
+                words[n_words] = word >> 1U;
+            }
+
+            n_words++;
+            continue;
+        }
+
+        uint32_t id_field = word >> (32U - RTE_FMT_ID_BITS);
+
+        if ((id_field & ~7U) == MSG3_RTOS_OVERHEAD_TABLE)
+        {
+            tables++;
+        }
+        else if (((id_field & ~15U) == MSG4_RTOS_OVERHEAD) && (n_words == 4U))
+        {
+            uint32_t value[4];
+
+            for (uint32_t k = 0U; k < 4U; k++)
+            {
+                value[k] = words[k] | (((id_field >> k) & 1U) << 31U);
+            }
+
+            checked_t * p_checked = find_checked(value[0]);
+
+            if (p_checked != NULL)
+            {
+                p_checked->count = value[1];
+                p_checked->average = value[2];
+                p_checked->max = value[3];
+            }
+        }
+
+        n_words = 0U;
+    }
+
+    return tables;
+}
+
+
+int main(void)
+{
+    uint32_t errors = 0U;
+
+    if (rte_host_init(BUFFER_WORDS, RTE_MODE_SINGLE_SHOT) != 0)
+    {
+        printf("Out of memory\n");
+        return 2;
+    }
+
+    run_workload();
+
+    if (rte_host_dropped() != 0U)
+    {
+        printf("%u messages dropped - the buffer is too small\n", rte_host_dropped());
+        rte_host_exit();
+        return 2;
+    }
+
+    if (decode_table() != 1U)
+    {
+        printf("Overhead table header not found\n");
+        errors++;
+    }
+
+    printf("%-40s %8s %10s %10s\n", "Message", "Count", "Avg [ns]", "Max [ns]");
+
+    for (uint32_t i = 0U; i < CHECKED_IDS; i++)
+    {
+        printf("%-40s %8u %10u %10u%s\n", checked[i].name, checked[i].count, checked[i].average,
+               checked[i].max, (checked[i].count == checked[i].expected) ? "" : "  <- count error");
+
+        if (checked[i].count != checked[i].expected)
+        {
+            errors++;
+        }
+    }
+
+    rte_host_exit();
+    printf("%s\n", (errors == 0U) ? "PASS" : "FAIL");
+    return (errors == 0U) ? 0 : 1;
+}
+
+/*==== End of file ====*/
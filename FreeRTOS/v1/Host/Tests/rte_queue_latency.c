@@ -0,0 +1,351 @@
+/*
+ * Copyright (c) Branko Premzel.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/*******************************************************************************
+ * @file    rte_queue_latency.c
+ * @author  Branko Premzel
+ * @brief   Test of the queue item latency tracking (RTE_TRACE_RTOS_QUEUE_LATENCY).
+ *
+ * The timestamp source (also the cycle counter and the tick count of the
+ * simulator) is a counter advanced by the test (1 MHz - 1 us per count).
+ * The items are sent from a simulated ISR and received by a task:
+ *  - items sent to the back and to the front - an item sent to the front by
+ *    an ISR is received first,
+ *  - xQueueGiveFromISR() (no xCopyPosition) - the item is sent to the back,
+ *  - an overwrite of the item in a queue with one item,
+ *  - more items than RTE_RTOS_QUEUE_LATENCY_DEPTH - the items that do not fit
+ *    into the ring are untracked, and the tracking starts again after they are
+ *    received,
+ *  - an item that waits longer than 2^32 cycles - the latency must saturate
+ *    and must not be the wrapped cycle counter difference.
+ *
+ * Usage: rte_queue_latency [capture file]
+ *
+ * The capture file is decoded by the queue_latency_decode test and the
+ * RTOS_queue_latency.log file is checked by the queue_latency_log test.
+ *
+ * Exit code: 0 - all values are as expected, 1 - check failed, 2 - setup error.
+ ******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "rte_sim.h"
+
+#define BUFFER_WORDS        16384U
+#define QUEUE_IRQ           25U
+#define OVERFLOW_ITEMS      (RTE_RTOS_QUEUE_LATENCY_DEPTH + 4U)
+#define LONG_WAIT           ((1ULL << 32U) + 5000U)     // [us]
+
+#if RTE_TRACE_RTOS_QUEUE_LATENCY != 1
+#error "The test requires RTE_TRACE_RTOS_QUEUE_LATENCY = 1."
+#endif
+
+#if (RTE_RTOS_QUEUE_LATENCY_DEPTH != 16U) || (RTE_RTOS_QUEUE_LATENCY_EVENTS != 1)
+#error "The test requires the default RTE_RTOS_QUEUE_LATENCY_DEPTH and RTE_RTOS_QUEUE_LATENCY_EVENTS."
+#endif
+
+typedef struct
+{
+    const char * queue;
+    uint32_t seq;               // Send sequence number
+    uint32_t latency;           // [cycles]
+} latency_event_t;
+
+typedef struct
+{
+    uint32_t name;              // Queue name
+    uint32_t seq;
+    uint32_t latency;
+} logged_event_t;
+
+typedef struct
+{
+    uint32_t name;              // Queue name
+    uint32_t received;
+    uint32_t average;
+    uint32_t max;
+    uint32_t overwritten;
+    uint32_t untracked;
+} latency_stats_t;
+
+static uint64_t sim_clock;
+static uint32_t errors;
+static QueueHandle_t queue;         // Length 32
+static QueueHandle_t mailbox;       // Length 1
+
+static latency_event_t expected_events[64];
+static uint32_t expected_count;
+static logged_event_t events[64];
+static uint32_t event_count;
+static latency_stats_t stats[4];
+static uint32_t stats_count;
+
+
+static uint64_t sim_timestamp(void)
+{
+    return sim_clock;
+}
+
+
+static void send_from_isr(QueueHandle_t xQueue, BaseType_t xCopyPosition, uint64_t time)
+{
+    sim_clock = time;
+    rte_sim_isr_enter(QUEUE_IRQ);
+
+    if (rte_sim_queue_generic_send_from_isr(xQueue, xCopyPosition) != pdPASS)
+    {
+        printf("Send at %llu us failed\n", (unsigned long long)time);
+        errors++;
+    }
+
+    rte_sim_isr_exit(pdFALSE);
+}
+
+
+/** @brief Receive an item. seq and latency - the expected latency event
+ *         (latency 0 - the item is not tracked). */
+
+static void receive(QueueHandle_t xQueue, const char * name, uint32_t seq, uint32_t latency)
+{
+    if (rte_sim_queue_receive(xQueue, 0U) != pdPASS)
+    {
+        printf("Receive from %s failed\n", name);
+        errors++;
+    }
+
+    if ((latency != 0U) && (expected_count < (sizeof(expected_events) / sizeof(expected_events[0]))))
+    {
+        expected_events[expected_count++] = (latency_event_t){ name, seq, latency };
+    }
+}
+
+
+/**
+ * @brief Decode the buffer (single shot mode) and collect the latency events
+ *        and statistics. MSG5 data: five data words and the word with their
+ *        top bits.
+ */
+
+static void decode(void)
+{
+    uint32_t words[8];
+    uint32_t n_words = 0U;
+
+    event_count = 0U;
+    stats_count = 0U;
+
+    for (uint32_t i = 0U; i < g_rtedbg.last_index; i++)
+    {
+        uint32_t word = g_rtedbg.buffer[i];
+
+        if ((word & 1U) == 0U)
+        {
+            if (n_words < (sizeof(words) / sizeof(words[0])))
+            {
+                words[n_words] = word >> 1U;
+            }
+
+            n_words++;
+            continue;
+        }
+
+        uint32_t id_field = word >> (32U - RTE_FMT_ID_BITS);
+        uint32_t value[5];
+
+        if (((id_field & ~7U) == MSG3_RTOS_QUEUE_LATENCY) && (n_words == 3U)
+            && (event_count < (sizeof(events) / sizeof(events[0]))))
+        {
+            for (uint32_t k = 0U; k < 3U; k++)
+            {
+                value[k] = words[k] | (((id_field >> k) & 1U) << 31U);
+            }
+
+            events[event_count++] = (logged_event_t){ value[0], value[1], value[2] };
+        }
+        else if ((id_field == MSG5_RTOS_QUEUE_LATENCY_STATS) && (n_words == 6U)
+                 && (stats_count < (sizeof(stats) / sizeof(stats[0]))))
+        {
+            for (uint32_t k = 0U; k < 5U; k++)
+            {
+                value[k] = words[k] | (((words[5] >> k) & 1U) << 31U);
+            }
+
+            stats[stats_count++] = (latency_stats_t){ value[0], value[1], value[2], value[3],
+                                                      value[4] & 0xFFFFU, value[4] >> 16U };
+        }
+
+        n_words = 0U;
+    }
+}
+
+
+static void run_sequence(void)
+{
+    TaskHandle_t task = rte_sim_task_create("Recv", 1U);
+    rte_sim_task_switch(task);
+
+    queue = rte_sim_queue_create("Lat", 32U);
+    mailbox = rte_sim_queue_create("One", 1U);
+
+    if ((rtos_queue_latency_enable(queue) != 1U) || (rtos_queue_latency_enable(mailbox) != 1U))
+    {
+        printf("Latency tracking not enabled\n");
+        errors++;
+    }
+
+    /* Back - first in, first out */
+    send_from_isr(queue, queueSEND_TO_BACK, 1000U);             // #0
+    send_from_isr(queue, queueSEND_TO_BACK, 2000U);             // #1
+    sim_clock = 5000U;
+    receive(queue, "Lat", 0U, 4000U);
+    receive(queue, "Lat", 1U, 3000U);
+
+    /* Front - received before the item sent earlier */
+    send_from_isr(queue, queueSEND_TO_BACK, 10000U);            // #2
+    send_from_isr(queue, queueSEND_TO_FRONT, 11000U);           // #3
+    sim_clock = 15000U;
+    receive(queue, "Lat", 3U, 4000U);
+    receive(queue, "Lat", 2U, 5000U);
+
+    /* xQueueGiveFromISR() - to the back */
+    send_from_isr(queue, queueSEND_TO_BACK, 16000U);            // #4
+    sim_clock = 17000U;
+    rte_sim_isr_enter(QUEUE_IRQ);
+    (void)rte_sim_queue_give_from_isr(queue);                   // #5
+    rte_sim_isr_exit(pdFALSE);
+    sim_clock = 18000U;
+    receive(queue, "Lat", 4U, 2000U);
+    receive(queue, "Lat", 5U, 1000U);
+
+    /* Overwrite - the latency of the new item */
+    send_from_isr(mailbox, queueSEND_TO_BACK, 20000U);          // #0
+    send_from_isr(mailbox, queueOVERWRITE, 21000U);             // #1
+    sim_clock = 25000U;
+    receive(mailbox, "One", 1U, 4000U);
+
+    /* Ring overflow - the last 4 items are not tracked */
+    for (uint32_t i = 0U; i < OVERFLOW_ITEMS; i++)
+    {
+        send_from_isr(queue, queueSEND_TO_BACK, 30000U + (i * 100U));   // #6 - #25
+    }
+
+    sim_clock = 40000U;
+
+    for (uint32_t i = 0U; i < OVERFLOW_ITEMS; i++)
+    {
+        receive(queue, "Lat", 6U + i, (i < RTE_RTOS_QUEUE_LATENCY_DEPTH) ? (10000U - (i * 100U)) : 0U);
+    }
+
+    send_from_isr(queue, queueSEND_TO_BACK, 41000U);            // #26 - tracked again
+    sim_clock = 41500U;
+    receive(queue, "Lat", 26U, 500U);
+
+    /* Longer than 2^32 cycles */
+    send_from_isr(queue, queueSEND_TO_BACK, 100000U);           // #27
+    sim_clock = 100000U + LONG_WAIT;
+    receive(queue, "Lat", 27U, UINT32_MAX);
+
+    rtos_queue_latency_dump();
+}
+
+
+static void check(void)
+{
+    const uint64_t total = 19000U + 148000U + 500U + LONG_WAIT;
+    static const char * const stats_queue[] = { "Lat", "One" };
+    const latency_stats_t expected_stats[] =
+    {
+        { string_to_uint32("Lat"), 24U, (uint32_t)(total / 24U), UINT32_MAX, 0U, 4U },
+        { string_to_uint32("One"), 1U, 4000U, 4000U, 1U, 0U },
+    };
+
+    decode();
+
+    if (event_count != expected_count)
+    {
+        printf("%u latency events, expected %u\n", event_count, expected_count);
+        errors++;
+    }
+
+    for (uint32_t i = 0U; (i < event_count) && (i < expected_count); i++)
+    {
+        const logged_event_t * p = &events[i];
+        const latency_event_t * e = &expected_events[i];
+        int ok = (p->name == string_to_uint32(e->queue))
+              && (p->seq == e->seq) && (p->latency == e->latency);
+
+        if (!ok)
+        {
+            printf("Event %u: item #%u, %u cycles - expected Queue%s item #%u, %u cycles\n",
+                   i, p->seq, p->latency, e->queue, e->seq, e->latency);
+            errors++;
+        }
+    }
+
+    if (stats_count != 2U)
+    {
+        printf("%u statistics messages, expected 2\n", stats_count);
+        errors++;
+        return;
+    }
+
+    printf("%-6s %8s %10s %10s %11s %9s\n", "Queue", "Items", "Average", "Max", "Overwritten", "Untracked");
+
+    for (uint32_t i = 0U; i < 2U; i++)
+    {
+        const latency_stats_t * p = &stats[i];
+        const latency_stats_t * e = &expected_stats[i];
+        int ok = (p->name == e->name) && (p->received == e->received)
+              && (p->average == e->average) && (p->max == e->max) && (p->overwritten == e->overwritten)
+              && (p->untracked == e->untracked);
+
+        printf("%-6s %8u %10u %10u %11u %9u%s\n", stats_queue[i], p->received, p->average, p->max,
+               p->overwritten, p->untracked, ok ? "" : "  <- error");
+        errors += ok ? 0U : 1U;
+    }
+}
+
+
+int main(int argc, char * argv[])
+{
+    if (argc > 2)
+    {
+        printf("Usage: %s [capture file]\n", argv[0]);
+        return 2;
+    }
+
+    rte_host_set_timestamp_source(sim_timestamp, 1000000U);
+
+    if (rte_host_init(BUFFER_WORDS, RTE_MODE_SINGLE_SHOT) != 0)
+    {
+        printf("Out of memory\n");
+        return 2;
+    }
+
+    run_sequence();
+
+    if (rte_host_dropped() != 0U)
+    {
+        printf("%u messages dropped - the buffer is too small\n", rte_host_dropped());
+        rte_host_exit();
+        return 2;
+    }
+
+    check();
+
+    if ((argc == 2) && (rte_host_dump(argv[1]) != 0))
+    {
+        printf("Cannot write %s\n", argv[1]);
+        rte_host_exit();
+        return 2;
+    }
+
+    rte_host_exit();
+    printf("%s\n", (errors == 0U) ? "OK" : "FAILED");
+    return (errors == 0U) ? 0 : 1;
+}
+
+/*==== End of file ====*/
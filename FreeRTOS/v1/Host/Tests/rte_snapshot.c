@@ -0,0 +1,296 @@
+/*
+ * Copyright (c) Branko Premzel.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/*******************************************************************************
+ * @file    rte_snapshot.c
+ * @author  Branko Premzel
+ * @brief   Test of the error-triggered snapshot (RTE_TRACE_RTOS_SNAPSHOT).
+ *
+ * The simulator is built with RTE_TRACE_RTOS_BASIC = 0 - the queue send errors
+ * are not logged, but they must still trigger the snapshot.
+ *  - A failed queue send triggers the armed snapshot. The post-trigger window
+ *    is counted down by the tick interrupts and by the ticks stepped after a
+ *    tickless idle sleep. Logging stops when the window ends.
+ *  - No messages are logged while the buffer is frozen.
+ *  - The trigger table is changed at run time - re-arming restores logging,
+ *    the queue error no longer triggers and a failed configASSERT() does.
+ *    A tickless idle sleep longer than the window freezes the buffer at once.
+ *  - Disarming restores logging. The failed assertion is still logged.
+ *
+ * Usage: rte_snapshot [capture file]
+ *
+ * The capture file is decoded by the snapshot_decode test and the
+ * RTOS_errors.log file is checked by the snapshot_log test.
+ *
+ * Exit code: 0 - all values are as expected, 1 - check failed, 2 - setup error.
+ ******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "rte_sim.h"
+
+#define BUFFER_WORDS        4096U
+#define TICK_PERIOD         (RTE_TIMESTAMP_FREQUENCY / configTICK_RATE_HZ)  // [timestamp periods]
+
+#if (RTE_TRACE_RTOS_SNAPSHOT != 1) || (RTE_TRACE_RTOS_BASIC != 0)
+#error "The test requires RTE_TRACE_RTOS_SNAPSHOT = 1 and RTE_TRACE_RTOS_BASIC = 0."
+#endif
+
+typedef struct
+{
+    uint32_t fmt_id;
+    uint32_t value[2];
+} snapshot_event_t;
+
+static uint64_t sim_clock;
+static uint32_t errors;
+static QueueHandle_t queue;         // Length 1
+
+static snapshot_event_t expected_events[16];
+static uint32_t expected_count;
+
+
+static uint64_t sim_timestamp(void)
+{
+    return sim_clock;
+}
+
+
+static void expect(uint32_t fmt_id, uint32_t value0, uint32_t value1)
+{
+    if (expected_count < (sizeof(expected_events) / sizeof(expected_events[0])))
+    {
+        expected_events[expected_count++] = (snapshot_event_t){ fmt_id, { value0, value1 } };
+    }
+}
+
+
+static void check_state(const char * step, uint32_t state, uint32_t countdown)
+{
+    if ((g_rtos_snapshot.state != state)
+        || ((state == RTE_RTOS_SNAPSHOT_TRIGGERED) && (g_rtos_snapshot.countdown != countdown)))
+    {
+        printf("%s: state %u, countdown %u - expected %u, %u\n", step, g_rtos_snapshot.state,
+               g_rtos_snapshot.countdown, state, countdown);
+        errors++;
+    }
+}
+
+
+static void ticks(uint32_t count)
+{
+    for (uint32_t i = 0U; i < count; i++)
+    {
+        sim_clock += TICK_PERIOD;
+        rte_sim_tick();
+    }
+}
+
+
+static void run_sequence(void)
+{
+    TaskHandle_t task = rte_sim_task_create("Main", 1U);
+    rte_sim_task_switch(task);
+    queue = rte_sim_queue_create("Q", 1U);
+    ticks(3U);
+
+    /* Queue error of a disabled group - countdown by ticks and a tickless sleep */
+    if (rtos_snapshot_trigger_add(MSG2_RTOS_QUEUE_SEND_FAILED) != 1U)
+    {
+        printf("Trigger not added\n");
+        errors++;
+    }
+
+    rtos_snapshot_arm(5U);
+    expect(MSG1_RTOS_SNAPSHOT_ARM, 5U, 0U);
+    (void)rte_sim_queue_generic_send(queue, queueSEND_TO_BACK);
+    check_state("Send", RTE_RTOS_SNAPSHOT_ARMED, 0U);
+    (void)rte_sim_queue_generic_send(queue, queueSEND_TO_BACK);  // Queue full
+    expect(MSG2_RTOS_SNAPSHOT_TRIGGER, MSG2_RTOS_QUEUE_SEND_FAILED, 5U);
+    check_state("Send failed", RTE_RTOS_SNAPSHOT_TRIGGERED, 5U);
+    ticks(2U);
+    check_state("Two ticks", RTE_RTOS_SNAPSHOT_TRIGGERED, 3U);
+    rte_sim_tickless_idle(2U, 0U);
+    check_state("Tickless idle", RTE_RTOS_SNAPSHOT_TRIGGERED, 1U);
+    ticks(1U);
+    expect(MSG2_RTOS_SNAPSHOT_FREEZE, MSG2_RTOS_QUEUE_SEND_FAILED, 5U);
+    check_state("Window end", RTE_RTOS_SNAPSHOT_FROZEN, 0U);
+
+    /* Frozen - nothing is logged */
+    uint32_t frozen_index = g_rtedbg.last_index;
+    ticks(2U);
+    (void)rte_sim_queue_generic_send(queue, queueSEND_TO_BACK);
+    rte_sim_tickless_idle(3U, 0U);
+
+    if ((rte_get_filter() != 0U) || (g_rtedbg.last_index != frozen_index))
+    {
+        printf("Frozen: filter 0x%08X, %u words logged\n", rte_get_filter(), g_rtedbg.last_index - frozen_index);
+        errors++;
+    }
+
+    /* New trigger table - the assertion triggers, the queue error does not */
+    rtos_snapshot_trigger_clear();
+    (void)rtos_snapshot_trigger_add(MSG1_RTOS_ASSERT_FAILED);
+    rtos_snapshot_arm(3U);
+    expect(MSG1_RTOS_SNAPSHOT_ARM, 3U, 0U);
+
+    if (rte_get_filter() != 0xFFFFFFFFUL)
+    {
+        printf("Re-armed: filter 0x%08X not restored\n", rte_get_filter());
+        errors++;
+    }
+
+    (void)rte_sim_queue_generic_send(queue, queueSEND_TO_BACK);
+    check_state("Send failed - not a trigger", RTE_RTOS_SNAPSHOT_ARMED, 0U);
+    ticks(1U);
+    configASSERT(sim_clock == 0U);
+    expect(MSG1_RTOS_ASSERT_FAILED, 0U, 0U);
+    expect(MSG2_RTOS_SNAPSHOT_TRIGGER, MSG1_RTOS_ASSERT_FAILED, 3U);
+    check_state("Assertion", RTE_RTOS_SNAPSHOT_TRIGGERED, 3U);
+    rte_sim_tickless_idle(10U, 0U);                             // Longer than the window
+    expect(MSG2_RTOS_SNAPSHOT_FREEZE, MSG1_RTOS_ASSERT_FAILED, 10U);
+    check_state("Long tickless idle", RTE_RTOS_SNAPSHOT_FROZEN, 0U);
+
+    /* Disarmed - logging restored, the assertion does not trigger */
+    rtos_snapshot_disarm();
+    configASSERT(sim_clock == 0U);
+    expect(MSG1_RTOS_ASSERT_FAILED, 0U, 0U);
+    check_state("Disarmed", RTE_RTOS_SNAPSHOT_DISARMED, 0U);
+}
+
+
+/**
+ * @brief Decode the buffer (single shot mode) and compare the snapshot and
+ *        assertion messages with the expected ones. The address logged by
+ *        rtos_assert_failed() is not checked.
+ */
+
+static void check(void)
+{
+    uint32_t words[4];
+    uint32_t n_words = 0U;
+    uint32_t found = 0U;
+
+    for (uint32_t i = 0U; i < g_rtedbg.last_index; i++)
+    {
+        uint32_t word = g_rtedbg.buffer[i];
+
+        if ((word & 1U) == 0U)
+        {
+            if (n_words < (sizeof(words) / sizeof(words[0])))
+            {
+                words[n_words] = word >> 1U;
+            }
+
+            n_words++;
+            continue;
+        }
+
+        uint32_t id_field = word >> (32U - RTE_FMT_ID_BITS);
+        uint32_t fmt_id = 0U;
+
+        if ((id_field & ~1U) == MSG1_RTOS_SNAPSHOT_ARM)
+        {
+            fmt_id = MSG1_RTOS_SNAPSHOT_ARM;
+        }
+        else if ((id_field & ~1U) == MSG1_RTOS_ASSERT_FAILED)
+        {
+            fmt_id = MSG1_RTOS_ASSERT_FAILED;
+        }
+        else if ((id_field & ~3U) == MSG2_RTOS_SNAPSHOT_TRIGGER)
+        {
+            fmt_id = MSG2_RTOS_SNAPSHOT_TRIGGER;
+        }
+        else if ((id_field & ~3U) == MSG2_RTOS_SNAPSHOT_FREEZE)
+        {
+            fmt_id = MSG2_RTOS_SNAPSHOT_FREEZE;
+        }
+        else if (((id_field & ~3U) == MSG2_RTOS_QUEUE_SEND_FAILED) && (n_words == 2U))
+        {
+            printf("Queue send failed logged - the group is disabled\n");
+            errors++;
+        }
+
+        uint32_t n = n_words;
+        n_words = 0U;
+
+        if (fmt_id == 0U)
+        {
+            continue;
+        }
+
+        uint32_t value[2] = { 0U, 0U };
+
+        for (uint32_t k = 0U; (k < n) && (k < 2U); k++)
+        {
+            value[k] = words[k] | (((id_field >> k) & 1U) << 31U);
+        }
+
+        if (fmt_id == MSG1_RTOS_ASSERT_FAILED)
+        {
+            value[0] = 0U;
+        }
+
+        const snapshot_event_t * e = (found < expected_count) ? &expected_events[found] : NULL;
+
+        if ((e == NULL) || (e->fmt_id != fmt_id) || (e->value[0] != value[0]) || (e->value[1] != value[1]))
+        {
+            printf("Message %u: ID %u (%u, %u) - expected ID %u (%u, %u)\n", found, fmt_id, value[0], value[1],
+                   (e != NULL) ? e->fmt_id : 0U, (e != NULL) ? e->value[0] : 0U, (e != NULL) ? e->value[1] : 0U);
+            errors++;
+        }
+
+        found++;
+    }
+
+    if (found != expected_count)
+    {
+        printf("%u snapshot messages, expected %u\n", found, expected_count);
+        errors++;
+    }
+}
+
+
+int main(int argc, char * argv[])
+{
+    if (argc > 2)
+    {
+        printf("Usage: %s [capture file]\n", argv[0]);
+        return 2;
+    }
+
+    rte_host_set_timestamp_source(sim_timestamp, RTE_TIMESTAMP_FREQUENCY);
+
+    if (rte_host_init(BUFFER_WORDS, RTE_MODE_SINGLE_SHOT) != 0)
+    {
+        printf("Out of memory\n");
+        return 2;
+    }
+
+    run_sequence();
+
+    if (rte_host_dropped() != 0U)
+    {
+        printf("%u messages dropped - the buffer is too small\n", rte_host_dropped());
+        rte_host_exit();
+        return 2;
+    }
+
+    check();
+
+    if ((argc == 2) && (rte_host_dump(argv[1]) != 0))
+    {
+        printf("Cannot write %s\n", argv[1]);
+        rte_host_exit();
+        return 2;
+    }
+
+    rte_host_exit();
+    printf("%s\n", (errors == 0U) ? "OK" : "FAILED");
+    return (errors == 0U) ? 0 : 1;
+}
+
+/*==== End of file ====*/
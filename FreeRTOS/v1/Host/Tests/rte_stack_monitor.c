@@ -0,0 +1,302 @@
+/*
+ * Copyright (c) Branko Premzel.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/*******************************************************************************
+ * @file    rte_stack_monitor.c
+ * @author  Branko Premzel
+ * @brief   Test of the stack high-water mark monitor
+ *          (RTE_TRACE_RTOS_STACK_MONITOR) with the simulated task stacks.
+ *
+ * Tasks Idle and Ctrl take turns. rte_sim_task_stack_use() sets the used part
+ * of the stack and the saved stack pointer before the task is switched out.
+ *  - The saved stack pointer is checked at every switch-out - a deeper stack
+ *    pointer is logged at once.
+ *  - Stack used by a function that returned before the switch-out is found
+ *    only by the fill pattern scan at every RTE_RTOS_STACK_SCAN_PERIOD-th
+ *    switch-out of the task.
+ *  - A message is logged only when the high-water mark changes. The low stack
+ *    warning is logged once per task.
+ *  - Task Wrk1 deletes itself after a low stack warning and Wrk2 is created in
+ *    the same static TCB. Wrk2 must not inherit the high-water mark and the
+ *    warning of Wrk1 and the switch-out of the deleted task must not log.
+ *  - Self-deleting tasks must not fill the task table - a task created after
+ *    2 * RTE_RTOS_STACK_TASKS of them must still be monitored.
+ *  - rtos_stack_report() logs all live monitored tasks.
+ *
+ * Usage: rte_stack_monitor [capture file]
+ *
+ * The capture file is decoded by the stack_monitor_decode test and the
+ * RTOS_stack.log and RTOS_timing.vcd files are checked by the stack_log and
+ * stack_vcd tests.
+ *
+ * Exit code: 0 - all values are as expected, 1 - check failed, 2 - setup error.
+ ******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "rte_sim.h"
+
+#define BUFFER_WORDS        16384U
+#define STACK_WORDS         128U
+#define TMP_TASKS           (2U * RTE_RTOS_STACK_TASKS)
+#define W                   ((uint32_t)sizeof(StackType_t))
+#define STACK_SIZE          (STACK_WORDS * W)       // [bytes]
+#define FREE(words)         ((words) * W)           // Free stack [bytes]
+
+#if RTE_TRACE_RTOS_STACK_MONITOR != 1
+#error "The test requires RTE_TRACE_RTOS_STACK_MONITOR = 1."
+#endif
+
+#if (RTE_RTOS_STACK_SCAN_PERIOD != 16U) || (RTE_RTOS_STACK_WARNING != 64U)
+#error "The test requires the default RTE_RTOS_STACK_SCAN_PERIOD and RTE_RTOS_STACK_WARNING."
+#endif
+
+typedef struct
+{
+    char type;              // 'S' - high-water mark, 'L' - low stack warning
+    const char * name;
+    uint32_t min_free;      // [bytes]
+} stack_event_t;
+
+static uint32_t errors;
+static uint32_t checked_index;      // Start of the messages not checked yet
+static TaskHandle_t idle;
+static TaskHandle_t ctrl;
+static StackType_t idle_stack[STACK_WORDS];
+static StackType_t ctrl_stack[STACK_WORDS];
+static StackType_t worker_stack[STACK_WORDS];
+static StackType_t tmp_stack[STACK_WORDS];
+static StaticTask_t worker_tcb;
+static StaticTask_t tmp_tcb[TMP_TASKS];
+
+
+/**
+ * @brief Decode the messages logged since the last check (single shot mode)
+ *        and compare the stack messages with the expected ones - in any order.
+ */
+
+static void expect(const char * step, const stack_event_t * expected, uint32_t count)
+{
+    uint32_t words[4];
+    uint32_t n_words = 0U;
+    uint32_t matched = 0U;      // Bit mask of the matched expected events
+    uint32_t logged = 0U;
+
+    for (uint32_t i = checked_index; i < g_rtedbg.last_index; i++)
+    {
+        uint32_t word = g_rtedbg.buffer[i];
+
+        if ((word & 1U) == 0U)
+        {
+            if (n_words < (sizeof(words) / sizeof(words[0])))
+            {
+                words[n_words] = word >> 1U;
+            }
+
+            n_words++;
+            continue;
+        }
+
+        uint32_t id_field = word >> (32U - RTE_FMT_ID_BITS);
+        uint32_t value[4];
+        char type = 0;
+
+        for (uint32_t k = 0U; k < 4U; k++)
+        {
+            value[k] = words[k] | (((id_field >> k) & 1U) << 31U);
+        }
+
+        if (((id_field & ~7U) == MSG3_RTOS_TASK_STACK) && (n_words == 3U))
+        {
+            type = 'S';
+
+            if (value[2] != STACK_SIZE)
+            {
+                printf("  stack size %u, expected %u\n", value[2], STACK_SIZE);
+                errors++;
+            }
+        }
+        else if (((id_field & ~3U) == MSG2_RTOS_TASK_STACK_LOW) && (n_words == 2U))
+        {
+            type = 'L';
+        }
+
+        n_words = 0U;
+
+        if (type == 0)
+        {
+            continue;
+        }
+
+        logged++;
+        uint32_t k = 0U;
+
+        for (; k < count; k++)
+        {
+            if (((matched & (1UL << k)) == 0U) && (expected[k].type == type)
+                && (string_to_uint32(expected[k].name) == value[0]) && (expected[k].min_free == value[1]))
+            {
+                matched |= 1UL << k;
+                break;
+            }
+        }
+
+        if (k == count)
+        {
+            printf("  %s: unexpected %s message of task %.4s - %u bytes free\n", step,
+                   (type == 'S') ? "stack" : "stack low", (const char *)&value[0], value[1]);
+            errors++;
+        }
+    }
+
+    for (uint32_t k = 0U; k < count; k++)
+    {
+        if ((matched & (1UL << k)) == 0U)
+        {
+            printf("  %s: %s message of task %s - %u bytes free not logged\n", step,
+                   (expected[k].type == 'S') ? "stack" : "stack low", expected[k].name, expected[k].min_free);
+            errors++;
+        }
+    }
+
+    printf("%-28s %u messages\n", step, logged);
+    checked_index = g_rtedbg.last_index;
+}
+
+
+/** @brief Run the task, set its stack usage and switch back to Idle. */
+
+static void run(TaskHandle_t task, uint32_t used_words, uint32_t sp_words)
+{
+    rte_sim_task_switch(task);
+    rte_sim_task_stack_use(task, used_words, sp_words);
+    rte_sim_task_switch(idle);
+}
+
+
+static void run_sequence(void)
+{
+    idle = rte_sim_task_create("Idle", 0U);
+    ctrl = rte_sim_task_create("Ctrl", 2U);
+    rte_sim_task_stack(idle, idle_stack, STACK_WORDS);
+    rte_sim_task_stack(ctrl, ctrl_stack, STACK_WORDS);
+    rte_sim_task_switch(idle);
+
+    /* The fill pattern is scanned at the first switch-out */
+    run(ctrl, 20U, 10U);
+    const stack_event_t first[] = { { 'S', "Idle", FREE(STACK_WORDS - 1U) }, { 'S', "Ctrl", FREE(STACK_WORDS - 20U) } };
+    expect("First switch-out", first, 2U);
+
+    /* Deeper saved stack pointer - logged at once */
+    run(ctrl, 60U, 60U);
+    const stack_event_t sp_check[] = { { 'S', "Ctrl", FREE(STACK_WORDS - 1U - 60U) } };
+    expect("Stack pointer check", sp_check, 1U);
+
+    for (uint32_t i = 0U; i < 5U; i++)
+    {
+        run(ctrl, 60U, 10U);
+    }
+
+    expect("No change", NULL, 0U);
+
+    /* 100 words used by a function that returned - found by the 16th switch-out */
+    for (uint32_t i = 0U; i < 9U; i++)
+    {
+        run(ctrl, 100U, 10U);
+    }
+
+    expect("Before the scan", NULL, 0U);
+    run(ctrl, 100U, 10U);
+    const stack_event_t scan[] = { { 'S', "Ctrl", FREE(STACK_WORDS - 100U) } };
+    expect("Fill pattern scan", scan, 1U);
+
+    /* Low stack warning, then the task deletes itself */
+    TaskHandle_t worker = rte_sim_task_create_static("Wrk1", 1U, &worker_tcb);
+    rte_sim_task_stack(worker, worker_stack, STACK_WORDS);
+    run(worker, STACK_WORDS - 4U, STACK_WORDS - 4U);
+    const stack_event_t low[] = { { 'S', "Wrk1", FREE(3U) }, { 'L', "Wrk1", FREE(3U) } };
+    expect("Low stack", low, 2U);
+
+    rte_sim_task_switch(worker);
+    rte_sim_task_delete(NULL);
+    rte_sim_task_switch(idle);
+    expect("Self-delete", NULL, 0U);
+
+    /* New task in the same TCB - a new high-water mark and warning */
+    worker = rte_sim_task_create_static("Wrk2", 1U, &worker_tcb);
+    rte_sim_task_stack(worker, worker_stack, STACK_WORDS);
+    run(worker, 20U, 10U);
+    const stack_event_t reuse[] = { { 'S', "Wrk2", FREE(STACK_WORDS - 20U) } };
+    expect("TCB reuse", reuse, 1U);
+    run(worker, STACK_WORDS - 4U, STACK_WORDS - 4U);
+    const stack_event_t reuse_low[] = { { 'S', "Wrk2", FREE(3U) }, { 'L', "Wrk2", FREE(3U) } };
+    expect("TCB reuse - low stack", reuse_low, 2U);
+
+    /* Self-deleting tasks must not fill the task table */
+    for (uint32_t i = 0U; i < TMP_TASKS; i++)
+    {
+        TaskHandle_t tmp = rte_sim_task_create_static("Tmp", 1U, &tmp_tcb[i]);
+        rte_sim_task_stack(tmp, tmp_stack, STACK_WORDS);
+        rte_sim_task_switch(tmp);
+        rte_sim_task_delete(NULL);
+        rte_sim_task_switch(idle);
+    }
+
+    expect("Self-deleting tasks", NULL, 0U);
+
+    TaskHandle_t last = rte_sim_task_create("Last", 1U);
+    rte_sim_task_stack(last, tmp_stack, STACK_WORDS);
+    run(last, 20U, 10U);
+    const stack_event_t after[] = { { 'S', "Last", FREE(STACK_WORDS - 20U) } };
+    expect("Task created after them", after, 1U);
+
+    /* The report - all live tasks, in the order of the task table */
+    rtos_stack_report();
+    const stack_event_t report[] =
+    {
+        { 'S', "Idle", FREE(STACK_WORDS - 1U) }, { 'S', "Ctrl", FREE(STACK_WORDS - 100U) },
+        { 'S', "Wrk2", FREE(3U) }, { 'S', "Last", FREE(STACK_WORDS - 20U) }
+    };
+    expect("Report", report, 4U);
+}
+
+
+int main(int argc, char * argv[])
+{
+    if (argc > 2)
+    {
+        printf("Usage: %s [capture file]\n", argv[0]);
+        return 2;
+    }
+
+    if (rte_host_init(BUFFER_WORDS, RTE_MODE_SINGLE_SHOT) != 0)
+    {
+        printf("Out of memory\n");
+        return 2;
+    }
+
+    run_sequence();
+
+    if (rte_host_dropped() != 0U)
+    {
+        printf("%u messages dropped - the buffer is too small\n", rte_host_dropped());
+        rte_host_exit();
+        return 2;
+    }
+
+    if ((argc == 2) && (rte_host_dump(argv[1]) != 0))
+    {
+        printf("Cannot write %s\n", argv[1]);
+        rte_host_exit();
+        return 2;
+    }
+
+    rte_host_exit();
+    printf("%s\n", (errors == 0U) ? "OK" : "FAILED");
+    return (errors == 0U) ? 0 : 1;
+}
+
+/*==== End of file ====*/
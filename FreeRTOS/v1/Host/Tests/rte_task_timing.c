@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) Branko Premzel.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/*******************************************************************************
+ * @file    rte_task_timing.c
+ * @author  Branko Premzel
+ * @brief   Capture with a known task schedule for the per-task timing report
+ *          (Scripts/rte_task_stats.py).
+ *
+ * The timestamp source is a counter advanced by the test (1 MHz - 1 us per
+ * count). Every 1000 us cycle:
+ *  - an interrupt notifies task Ctrl, which runs for 100..190 us and blocks
+ *    in a notification wait,
+ *  - task Work runs next. It is preempted by Ctrl (second interrupt, 50 us)
+ *    and blocks with a task delay after 500 us of execution (including the
+ *    interrupt) - 551 us after it was switched in,
+ *  - the IDLE task runs for the rest of the cycle.
+ * All tasks block once before the first cycle, so every activation of the
+ * capture is complete: Ctrl - 2 * CYCLES, Work - CYCLES activations.
+ *
+ * Usage: rte_task_timing <capture file> [work time]
+ *
+ * The work time argument changes the 500 us of Work execution
+ * (WORK_TIME_MIN..WORK_TIME_MAX us). The regression report test
+ * (Scripts/rte_regress.py) compares the default capture with a slower Work.
+ *
+ * Exit code: 0 - capture written, 2 - setup error.
+ ******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "rte_sim.h"
+
+#define BUFFER_WORDS        65536U
+#define CYCLES              200U
+#define CYCLE_TIME          1000U       // [us]
+#define WORK_TIME           500U        // Default Work execution time [us]
+#define WORK_TIME_MIN       500U        // Work must still run when Ctrl preempts it
+#define WORK_TIME_MAX       750U        // Work must block before the next cycle
+#define CTRL_IRQ            25U
+
+static uint64_t sim_clock;
+static TaskHandle_t idle, ctrl, work;
+static uint32_t work_time = WORK_TIME;
+
+
+static uint64_t sim_timestamp(void)
+{
+    return sim_clock;
+}
+
+
+/** @brief Advance the clock to the given time [us]. */
+
+static void at(uint64_t time)
+{
+    sim_clock = time;
+}
+
+
+static void notify_ctrl(uint64_t time)
+{
+    at(time - 1U);
+    rte_sim_isr_enter(CTRL_IRQ);
+    at(time);
+    (void)rte_sim_task_notify_from_isr(ctrl, 0U, 1U, eSetBits);
+    at(time + 1U);
+    rte_sim_isr_exit(pdTRUE);
+}
+
+
+static void run_schedule(void)
+{
+    /* Initial state - Ctrl waits for a notification, Work is delayed */
+    rte_sim_task_switch(ctrl);
+    at(10U);
+    rte_sim_task_notify_wait_block(0U, 0U, 1U, portMAX_DELAY);
+    rte_sim_task_switch(work);
+    at(20U);
+    rte_sim_task_delay(1U);
+    rte_sim_task_switch(idle);
+
+    for (uint32_t cycle = 0U; cycle < CYCLES; cycle++)
+    {
+        const uint64_t base = (uint64_t)(cycle + 1U) * CYCLE_TIME;
+        const uint64_t ctrl_time = 100U + ((cycle % 10U) * 10U);
+
+        /* Ctrl - ready at base + 2, switched in at base + 5 */
+        notify_ctrl(base + 2U);
+        at(base + 5U);
+        rte_sim_task_switch(ctrl);
+        (void)rte_sim_task_notify_wait(0U, 0U, 1U, portMAX_DELAY);
+        at(base + 5U + ctrl_time);
+        rte_sim_task_notify_wait_block(0U, 0U, 1U, portMAX_DELAY);
+
+        /* Work - preempted by Ctrl from base + 603 to base + 654 */
+        const uint64_t work_start = base + 6U + ctrl_time;
+        at(work_start);
+        rte_sim_task_switch(work);
+        notify_ctrl(base + 600U);
+        at(base + 603U);
+        rte_sim_task_switch(ctrl);
+        (void)rte_sim_task_notify_wait(0U, 0U, 1U, portMAX_DELAY);
+        at(base + 653U);
+        rte_sim_task_notify_wait_block(0U, 0U, 1U, portMAX_DELAY);
+        at(base + 654U);
+        rte_sim_task_switch(work);
+        at(base + 654U + (work_time - (base + 603U - work_start)));
+        rte_sim_task_delay(1U);
+
+        at(sim_clock + 1U);
+        rte_sim_task_switch(idle);
+    }
+}
+
+
+int main(int argc, char * argv[])
+{
+    if ((argc != 2) && (argc != 3))
+    {
+        printf("Usage: %s <capture file> [work time]\n", argv[0]);
+        return 2;
+    }
+
+    if (argc == 3)
+    {
+        work_time = (uint32_t)strtoul(argv[2], NULL, 10);
+
+        if ((work_time < WORK_TIME_MIN) || (work_time > WORK_TIME_MAX))
+        {
+            printf("The work time must be %u..%u us\n", WORK_TIME_MIN, WORK_TIME_MAX);
+            return 2;
+        }
+    }
+
+    rte_host_set_timestamp_source(sim_timestamp, 1000000U);
+
+    if (rte_host_init(BUFFER_WORDS, RTE_MODE_SINGLE_SHOT) != 0)
+    {
+        printf("Out of memory\n");
+        return 2;
+    }
+
+    idle = rte_sim_task_create("IDLE", 0U);
+    ctrl = rte_sim_task_create("Ctrl", 2U);
+    work = rte_sim_task_create("Work", 1U);
+    run_schedule();
+
+    if (rte_host_dropped() != 0U)
+    {
+        printf("%u messages dropped - the buffer is too small\n", rte_host_dropped());
+        rte_host_exit();
+        return 2;
+    }
+
+    if (rte_host_dump(argv[1]) != 0)
+    {
+        printf("Cannot write %s\n", argv[1]);
+        rte_host_exit();
+        return 2;
+    }
+
+    printf("%u cycles, %llu words written to %s\n", CYCLES,
+           (unsigned long long)rte_host_words_written(), argv[1]);
+    rte_host_exit();
+    return 0;
+}
+
+/*==== End of file ====*/
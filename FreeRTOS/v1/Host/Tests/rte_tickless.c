@@ -0,0 +1,279 @@
+/*
+ * Copyright (c) Branko Premzel.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/*******************************************************************************
+ * @file    rte_tickless.c
+ * @author  Branko Premzel
+ * @brief   Timestamp continuity test of the tickless idle compensation
+ *          (RTE_TRACE_RTOS_TICKLESS_COMP).
+ *
+ * The timestamp source is a counter that is advanced by the test only while
+ * the simulated core is awake - it stops during the sleep as the timestamp
+ * counter of most cores does. Awake periods with tick interrupts alternate
+ * with tickless idle sleeps of different lengths, sleeps that end between two
+ * ticks and aborted sleeps. The test calculates the expected (real) time of
+ * every logged tick and low power idle message. The buffer is then decoded and
+ * the timestamps are compared with the expected ones.
+ *
+ * The sleep time is calculated from the stepped ticks (the default) or taken
+ * from the simulated low power timer if the simulator is built with
+ * RTE_SIM_SLEEP_TIMER = 1. The test is run with a timestamp frequency that is
+ * a multiple of the tick rate and with one that is not (conversion remainder).
+ *
+ * Exit code: 0 - all timestamps are as expected, 1 - check failed, 2 - setup
+ * error.
+ ******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "rte_sim.h"
+
+#define BUFFER_WORDS        65536U
+#define CYCLES              400U        // Awake period + sleep
+#define MAX_EVENTS          (CYCLES * 8U)
+#define AWAKE_BEFORE_SLEEP  17U         // Time from the idle task to the sleep [timestamp periods]
+
+#ifndef RTE_SIM_SLEEP_TIMER
+#define RTE_SIM_SLEEP_TIMER 0
+#endif
+
+typedef struct
+{
+    uint32_t fmt_id;
+    uint64_t timestamp;
+} event_t;
+
+static uint64_t sim_clock;              // Timestamp counter - stopped during the sleep
+static uint64_t sim_slept;              // Expected compensation [timestamp periods]
+static event_t expected[MAX_EVENTS];
+static uint32_t expected_count;
+static uint32_t errors;
+
+
+static uint64_t sim_timestamp(void)
+{
+    return sim_clock;
+}
+
+
+static void expect(uint32_t fmt_id)
+{
+    if (expected_count < MAX_EVENTS)
+    {
+        expected[expected_count].fmt_id = fmt_id;
+        expected[expected_count].timestamp = sim_clock + sim_slept;
+        expected_count++;
+    }
+}
+
+
+static int is_checked(uint32_t fmt_id)
+{
+    return (fmt_id == MSG1_RTOS_TASK_INCREMENT_TICK) || (fmt_id == MSG1_RTOS_INCREASE_TICK_COUNT)
+        || (fmt_id == MSG0_RTOS_LOW_POWER_IDLE_BEGIN) || (fmt_id == MSG0_RTOS_LOW_POWER_IDLE_END);
+}
+
+
+/**
+ * @brief Run the awake/sleep sequence and record the expected timestamps.
+ *
+ * @param frequency  Timestamp frequency [Hz]
+ */
+
+static void run_sequence(uint32_t frequency)
+{
+    const uint32_t tick_period = frequency / configTICK_RATE_HZ;   // Awake tick period (rounded)
+#if RTE_SIM_SLEEP_TIMER == 0
+    uint32_t sleep_ticks = 0U;
+#endif
+
+    for (uint32_t cycle = 0U; cycle < CYCLES; cycle++)
+    {
+        for (uint32_t i = 0U; i <= (cycle % 5U); i++)
+        {
+            sim_clock += tick_period;
+            expect(MSG1_RTOS_TASK_INCREMENT_TICK);
+            rte_sim_tick();
+        }
+
+        sim_clock += AWAKE_BEFORE_SLEEP;
+        expect(MSG0_RTOS_LOW_POWER_IDLE_BEGIN);
+
+        if ((cycle % 10U) == 9U)
+        {
+            rte_sim_tickless_idle(0U, 0U);      // Aborted sleep
+            expect(MSG0_RTOS_LOW_POWER_IDLE_END);
+            continue;
+        }
+
+        /* Every 8th sleep ends before the first tick - it is caused by an interrupt */
+        uint32_t ticks = ((cycle % 8U) == 7U) ? 0U : (1U + ((cycle * 7U) % 60U));
+        uint32_t partial = (cycle * 37U) % tick_period;
+        uint32_t lp_time = (uint32_t)(((uint64_t)ticks * frequency) / configTICK_RATE_HZ) + partial;
+
+#if RTE_SIM_SLEEP_TIMER == 1
+        sim_slept += lp_time;
+#else
+        sleep_ticks += ticks;
+        sim_slept = ((uint64_t)sleep_ticks * frequency) / configTICK_RATE_HZ;
+#endif
+        expect(MSG1_RTOS_INCREASE_TICK_COUNT);
+        rte_sim_tickless_idle(ticks, lp_time);
+        expect(MSG0_RTOS_LOW_POWER_IDLE_END);
+    }
+}
+
+
+/**
+ * @brief Decode the buffer (single shot mode) and compare the timestamps of
+ *        the checked messages with the expected ones.
+ */
+
+static void check_buffer(uint32_t frequency)
+{
+    const uint32_t mask = (1UL << RTE_TSTAMP_BITS) - 1U;
+    uint64_t long_timestamp = 0U;
+    uint64_t previous = 0U;
+    uint32_t index = 0U;
+    uint32_t data = 0U;
+    uint32_t n_words = 0U;
+
+    for (uint32_t i = 0U; i < g_rtedbg.last_index; i++)
+    {
+        uint32_t word = g_rtedbg.buffer[i];
+
+        if ((word & 1U) == 0U)
+        {
+            if (n_words == 0U)
+            {
+                data = word >> 1U;
+            }
+
+            n_words++;
+            continue;
+        }
+
+        uint32_t id_field = word >> (32U - RTE_FMT_ID_BITS);
+        uint64_t timestamp = (long_timestamp << RTE_TSTAMP_BITS) | ((word >> 1U) & mask);
+        n_words = 0U;
+
+        if ((id_field & ~1U) == RTE_LONG_TIMESTAMP_ID)
+        {
+            long_timestamp = data | ((id_field & 1U) << 31U);
+            continue;
+        }
+
+        uint32_t fmt_id = is_checked(id_field & ~1U) ? (id_field & ~1U) : id_field;
+
+        if (!is_checked(fmt_id))
+        {
+            continue;
+        }
+
+        if (timestamp < previous)
+        {
+            printf("%u Hz: message %u - timestamp %llu is smaller than the previous one (%llu)\n",
+                   frequency, index, (unsigned long long)timestamp, (unsigned long long)previous);
+            errors++;
+        }
+
+        previous = timestamp;
+
+        if (index >= expected_count)
+        {
+            printf("%u Hz: more messages than expected\n", frequency);
+            errors++;
+            return;
+        }
+
+        if ((fmt_id != expected[index].fmt_id) || (timestamp != expected[index].timestamp))
+        {
+            printf("%u Hz: message %u - ID %u, timestamp %llu (expected ID %u, timestamp %llu)\n",
+                   frequency, index, fmt_id, (unsigned long long)timestamp,
+                   expected[index].fmt_id, (unsigned long long)expected[index].timestamp);
+            errors++;
+        }
+
+        index++;
+    }
+
+    if (index != expected_count)
+    {
+        printf("%u Hz: %u messages decoded, %u expected\n", frequency, index, expected_count);
+        errors++;
+    }
+}
+
+
+static int run_test(uint32_t frequency)
+{
+    sim_clock = 0U;
+    sim_slept = 0U;
+    expected_count = 0U;
+    memset(&g_rtos_tickless, 0, sizeof(g_rtos_tickless));
+
+    rte_host_set_timestamp_source(sim_timestamp, frequency);
+
+    if (rte_host_init(BUFFER_WORDS, RTE_MODE_SINGLE_SHOT) != 0)
+    {
+        printf("Out of memory\n");
+        return 2;
+    }
+
+    uint32_t errors_before = errors;
+    run_sequence(frequency);
+
+    if (rte_host_dropped() != 0U)
+    {
+        printf("%u Hz: %u messages dropped - the buffer is too small\n", frequency, rte_host_dropped());
+        return 2;
+    }
+
+    check_buffer(frequency);
+
+    if (g_rtos_tickless.time != sim_slept)
+    {
+        printf("%u Hz: total sleep time %llu, expected %llu\n", frequency,
+               (unsigned long long)g_rtos_tickless.time, (unsigned long long)sim_slept);
+        errors++;
+    }
+
+    if (g_rtos_tickless.aborted != (CYCLES / 10U))
+    {
+        printf("%u Hz: %u aborted sleeps, expected %u\n", frequency,
+               g_rtos_tickless.aborted, CYCLES / 10U);
+        errors++;
+    }
+
+    printf("%u Hz: %u messages, %u sleeps, %u ticks stepped, %llu timestamp periods added - %s\n",
+           frequency, expected_count, g_rtos_tickless.sleeps, g_rtos_tickless.ticks,
+           (unsigned long long)g_rtos_tickless.time, (errors == errors_before) ? "OK" : "FAILED");
+    return 0;
+}
+
+
+int main(void)
+{
+    static const uint32_t frequencies[] = { 1000000U, 32768U };
+
+    printf("Sleep time from the %s\n",
+           (RTE_SIM_SLEEP_TIMER == 1) ? "low power timer" : "stepped ticks");
+
+    for (uint32_t i = 0U; i < (sizeof(frequencies) / sizeof(frequencies[0])); i++)
+    {
+        if (run_test(frequencies[i]) != 0)
+        {
+            rte_host_exit();
+            return 2;
+        }
+    }
+
+    rte_host_exit();
+    return (errors == 0U) ? 0 : 1;
+}
+
+/*==== End of file ====*/
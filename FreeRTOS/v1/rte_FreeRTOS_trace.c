@@ -184,6 +184,1606 @@ uint32_t rtos_get_timer_name(void* p_timer)
 #endif // ( configUSE_TIMERS == 1 )
 
 
+#if (RTE_TRACE_RTOS_ISR_IRQ == 1) || (RTE_TRACE_RTOS_QUEUE_LATENCY == 1)
+/**
+ * @brief Time between two cycle counter values. The 32-bit cycle counter
+ *        wraps after 2^32 cycles (e.g. 25 s at 168 MHz). The full counter
+ *        periods are restored with the tick count - the result is the value
+ *        closest to the time elapsed according to the ticks.
+ *
+ * @param cycles  Cycle counter difference (modulo 2^32)
+ * @param ticks   Number of ticks elapsed in the same time
+ * @return Elapsed time [CPU cycles]
+ */
+
+static uint64_t rtos_cycles_elapsed(uint32_t cycles, TickType_t ticks)
+{
+    uint64_t expected = ((uint64_t)ticks * RTE_RTOS_CYCLE_FREQUENCY) / configTICK_RATE_HZ;
+    uint64_t elapsed = cycles;
+
+    if (expected > elapsed)
+    {
+        elapsed += ((expected - elapsed + 0x80000000ULL) >> 32U) << 32U;
+    }
+
+    return elapsed;
+}
+#endif
+
+
+#if RTE_TRACE_RTOS_ISR_IRQ == 1
+/***
+ * IRQ-aware ISR trace with per-IRQ counters.
+ * The execution time of an ISR does not include the time spent in the nested
+ * (higher priority) ISRs. The counters are logged and cleared by
+ * rtos_isr_stats_dump() - on request or by rtos_isr_stats_poll() once per
+ * RTE_RTOS_ISR_STATS_PERIOD ticks. The counters are never logged by the
+ * ISR trace macros, so the logging does not add to the interrupt latency.
+ */
+
+typedef struct
+{
+    uint32_t count;         // Number of ISR executions in the current period
+    uint32_t cycles;        // Total execution time in the current period [CPU cycles]
+    uint32_t max_cycles;    // Longest execution time in the current period [CPU cycles]
+} rtos_irq_stats_t;
+
+static rtos_irq_stats_t rtos_irq_stats[RTE_RTOS_IRQ_COUNT];
+static uint32_t rtos_isr_start[RTE_RTOS_ISR_MAX_NESTING];   // ISR entry time
+static uint32_t rtos_isr_nested[RTE_RTOS_ISR_MAX_NESTING];  // Time spent in nested ISRs
+static uint16_t rtos_isr_irq[RTE_RTOS_ISR_MAX_NESTING];     // Exception number
+static uint32_t rtos_isr_depth;                             // Current ISR nesting depth
+static uint32_t rtos_isr_period_start;                      // Start of the counting period [CPU cycles]
+static TickType_t rtos_isr_period_tick;                     // Start of the counting period [ticks]
+
+
+/**
+ * @brief Called by traceISR_ENTER(). Remember the entry time and log the
+ *        exception number and nesting depth.
+ */
+
+void rtos_isr_enter(void)
+{
+    uint32_t irq = (uint32_t)RTE_RTOS_GET_IRQ_NUMBER();
+    UBaseType_t mask = taskENTER_CRITICAL_FROM_ISR();
+    uint32_t depth = rtos_isr_depth;
+
+    if (depth < RTE_RTOS_ISR_MAX_NESTING)
+    {
+        rtos_isr_start[depth] = RTE_RTOS_CYCLE_COUNTER();
+        rtos_isr_nested[depth] = 0U;
+        rtos_isr_irq[depth] = (uint16_t)irq;
+    }
+
+    rtos_isr_depth = depth + 1U;
+    taskEXIT_CRITICAL_FROM_ISR(mask);
+
+#if RTE_RTOS_ISR_EVENTS == 1
+    RTE_RTOS_MSG1(MSG1_RTOS_ISR_ENTER_IRQ, F_RTOS_ISR, RTE_PACK_ISR_IRQ(irq, depth, 0U));
+#endif
+}
+
+
+/**
+ * @brief Called by traceISR_EXIT() and traceISR_EXIT_TO_SCHEDULER().
+ *        Update the counters of the interrupt and log the exit.
+ *
+ * @param to_scheduler  1 - a context switch has been requested by the ISR
+ */
+
+void rtos_isr_exit(uint32_t to_scheduler)
+{
+    UBaseType_t mask = taskENTER_CRITICAL_FROM_ISR();
+    uint32_t now = RTE_RTOS_CYCLE_COUNTER();
+    uint32_t depth = rtos_isr_depth;
+    uint32_t irq = (uint32_t)RTE_RTOS_GET_IRQ_NUMBER();
+
+    if (depth != 0U)
+    {
+        depth--;
+        rtos_isr_depth = depth;
+
+        if (depth < RTE_RTOS_ISR_MAX_NESTING)
+        {
+            uint32_t elapsed = now - rtos_isr_start[depth];
+            uint32_t own = elapsed - rtos_isr_nested[depth];
+            uint32_t index = rtos_isr_irq[depth];
+
+            if (depth != 0U)
+            {
+                rtos_isr_nested[depth - 1U] += elapsed;
+            }
+
+            if (index >= RTE_RTOS_IRQ_COUNT)
+            {
+                index = RTE_RTOS_IRQ_COUNT - 1U;     // The last entry collects all the rest
+            }
+
+            rtos_irq_stats_t * p_stats = &rtos_irq_stats[index];
+            p_stats->count++;
+            p_stats->cycles += own;
+
+            if (own > p_stats->max_cycles)
+            {
+                p_stats->max_cycles = own;
+            }
+        }
+    }
+
+    taskEXIT_CRITICAL_FROM_ISR(mask);
+
+#if RTE_RTOS_ISR_EVENTS == 1
+    RTE_RTOS_MSG1(MSG1_RTOS_ISR_EXIT_IRQ, F_RTOS_ISR, RTE_PACK_ISR_IRQ(irq, depth, to_scheduler));
+#else
+    (void)irq;
+    (void)to_scheduler;
+#endif
+}
+
+
+/**
+ * @brief Log and clear the per-IRQ counters. The period length is logged
+ *        first, followed by one message for each interrupt that was active
+ *        in the period. The ISR load is logged in per mille of the period.
+ *        Must be called from a task (e.g. the idle hook) - not from an ISR.
+ */
+
+void rtos_isr_stats_dump(void)
+{
+    TickType_t tick = xTaskGetTickCount();
+    taskENTER_CRITICAL();
+    uint32_t now = RTE_RTOS_CYCLE_COUNTER();
+    uint64_t period = rtos_cycles_elapsed(now - rtos_isr_period_start, tick - rtos_isr_period_tick);
+    rtos_isr_period_start = now;
+    rtos_isr_period_tick = tick;
+    taskEXIT_CRITICAL();
+
+    RTE_RTOS_MSG2(MSG2_RTOS_ISR_STATS_PERIOD, F_RTOS_ISR, (uint32_t)period, (uint32_t)(period >> 32U));
+
+    for (uint32_t irq = 0U; irq < RTE_RTOS_IRQ_COUNT; irq++)
+    {
+        if (rtos_irq_stats[irq].count == 0U)
+        {
+            continue;
+        }
+
+        taskENTER_CRITICAL();
+        rtos_irq_stats_t stats = rtos_irq_stats[irq];
+        rtos_irq_stats[irq].count = 0U;
+        rtos_irq_stats[irq].cycles = 0U;
+        rtos_irq_stats[irq].max_cycles = 0U;
+        taskEXIT_CRITICAL();
+
+        uint64_t load = (period != 0U) ? (((uint64_t)stats.cycles * 1000U) / period) : 0U;
+
+        RTE_RTOS_MSG4(MSG4_RTOS_ISR_STATS, F_RTOS_ISR, RTE_PACK_ISR_STATS(irq, load),
+                      stats.count, stats.cycles, stats.max_cycles);
+    }
+}
+
+
+/**
+ * @brief Log the per-IRQ counters if RTE_RTOS_ISR_STATS_PERIOD ticks have
+ *        elapsed since the last dump. Call it from the idle hook
+ *        (vApplicationIdleHook()) or a low priority task.
+ */
+
+void rtos_isr_stats_poll(void)
+{
+#if RTE_RTOS_ISR_STATS_PERIOD > 0
+    if ((TickType_t)(xTaskGetTickCount() - rtos_isr_period_tick) >= (TickType_t)RTE_RTOS_ISR_STATS_PERIOD)
+    {
+        rtos_isr_stats_dump();
+    }
+#endif
+}
+#endif  // RTE_TRACE_RTOS_ISR_IRQ == 1
+
+
+#if RTE_TRACE_RTOS_HEAP_PROFILE == 1
+/***
+ * Heap profiler fed by traceMALLOC() and traceFREE().
+ * The malloc/free calls are not logged. The profiler keeps a size class
+ * histogram, live and peak bytes, a table of live allocations (address ->
+ * size, site, time) and a table of allocation sites (caller return address).
+ * Allocations that do not fit into the table of live allocations or of the
+ * sites are charged to the "other sites" entry (site address 0), the same as
+ * the frees of the allocations that are not in the table.
+ * A compact summary is logged on request with rtos_heap_profile_dump() or by
+ * rtos_heap_profile_poll() after RTE_RTOS_HEAP_SUMMARY_PERIOD heap operations.
+ * The summary is never logged by the heap functions - they are called with the
+ * scheduler suspended (which also protects the profiler data).
+ */
+
+#if ((RTE_RTOS_HEAP_ALLOCS & (RTE_RTOS_HEAP_ALLOCS - 1U)) != 0U) || ((RTE_RTOS_HEAP_SITES & (RTE_RTOS_HEAP_SITES - 1U)) != 0U)
+#error "RTE_RTOS_HEAP_ALLOCS and RTE_RTOS_HEAP_SITES must be powers of 2."
+#endif
+
+#define RTOS_HEAP_SIZE_CLASSES  16U                 // Class 0: 0-15 bytes, class n: 2^(n+3) - 2^(n+4)-1
+#define RTOS_HEAP_OTHER_SITE    RTE_RTOS_HEAP_SITES // Sites that did not fit into the table
+
+typedef struct
+{
+    void * address;         // NULL - free entry
+    uint32_t size;
+    uint32_t tick;          // Allocation time [ticks]
+    uint16_t site;          // Index in the site table
+} rtos_heap_alloc_t;
+
+typedef struct
+{
+    void * site;            // Caller return address, NULL - free entry
+    uint32_t live_count;    // Number of live allocations
+    uint32_t live_bytes;
+    uint32_t allocs;        // Total number of allocations
+    uint32_t changed;       // Changed since the last summary
+} rtos_heap_site_t;
+
+static rtos_heap_alloc_t rtos_heap_allocs[RTE_RTOS_HEAP_ALLOCS];
+static rtos_heap_site_t rtos_heap_sites[RTE_RTOS_HEAP_SITES + 1U];
+static uint16_t rtos_heap_histogram[RTOS_HEAP_SIZE_CLASSES];    // Allocations in the current period
+static uint32_t rtos_heap_live_bytes;
+static uint32_t rtos_heap_peak_bytes;
+static uint32_t rtos_heap_alloc_count;
+static uint32_t rtos_heap_free_count;
+static uint16_t rtos_heap_failed;           // Failed allocations
+static uint16_t rtos_heap_untracked;        // Allocations not in the table (table full)
+static uint32_t rtos_heap_operations;       // Heap operations since the last summary
+
+
+static inline uint32_t rtos_heap_hash(const void * p_value, uint32_t mask)
+{
+    return (((uint32_t)p_value >> 2U) * 2654435761UL >> 8U) & mask;
+}
+
+
+static uint32_t rtos_heap_size_class(uint32_t size)
+{
+    uint32_t size_class = 0U;
+    size >>= 4U;
+
+    while ((size != 0U) && (size_class < (RTOS_HEAP_SIZE_CLASSES - 1U)))
+    {
+        size >>= 1U;
+        size_class++;
+    }
+
+    return size_class;
+}
+
+
+/* Find or add an allocation site. */
+static uint32_t rtos_heap_site_index(void * pvCaller)
+{
+    uint32_t index = rtos_heap_hash(pvCaller, RTE_RTOS_HEAP_SITES - 1U);
+
+    for (uint32_t i = 0U; i < RTE_RTOS_HEAP_SITES; i++)
+    {
+        if (rtos_heap_sites[index].site == pvCaller)
+        {
+            return index;
+        }
+
+        if (rtos_heap_sites[index].site == NULL)
+        {
+            rtos_heap_sites[index].site = pvCaller;
+            return index;
+        }
+
+        index = (index + 1U) & (RTE_RTOS_HEAP_SITES - 1U);
+    }
+
+    return RTOS_HEAP_OTHER_SITE;
+}
+
+
+/* Find an allocation in the table - returns RTE_RTOS_HEAP_ALLOCS if not found. */
+static uint32_t rtos_heap_find(const void * pvAddress)
+{
+    uint32_t index = rtos_heap_hash(pvAddress, RTE_RTOS_HEAP_ALLOCS - 1U);
+
+    for (uint32_t i = 0U; i < RTE_RTOS_HEAP_ALLOCS; i++)
+    {
+        if (rtos_heap_allocs[index].address == pvAddress)
+        {
+            return index;
+        }
+
+        if (rtos_heap_allocs[index].address == NULL)
+        {
+            break;
+        }
+
+        index = (index + 1U) & (RTE_RTOS_HEAP_ALLOCS - 1U);
+    }
+
+    return RTE_RTOS_HEAP_ALLOCS;
+}
+
+
+/* Remove an entry - the following entries of the probe sequence are moved back
+ * so that no tombstones are needed. */
+static void rtos_heap_remove(uint32_t index)
+{
+    const uint32_t mask = RTE_RTOS_HEAP_ALLOCS - 1U;
+    uint32_t next = index;
+
+    for (uint32_t i = 1U; i < RTE_RTOS_HEAP_ALLOCS; i++)
+    {
+        next = (next + 1U) & mask;
+
+        if (rtos_heap_allocs[next].address == NULL)
+        {
+            break;
+        }
+
+        uint32_t home = rtos_heap_hash(rtos_heap_allocs[next].address, mask);
+
+        /* Move the entry if its home slot is not between the hole and its position */
+        if (((next - home) & mask) >= ((next - index) & mask))
+        {
+            rtos_heap_allocs[index] = rtos_heap_allocs[next];
+            index = next;
+        }
+    }
+
+    rtos_heap_allocs[index].address = NULL;
+}
+
+
+/**
+ * @brief Called by traceMALLOC().
+ *
+ * @param pvAddress  Allocated block (NULL - allocation failed)
+ * @param uiSize     Size as reported by the heap implementation
+ * @param pvCaller   Allocation site (return address of pvPortMalloc())
+ */
+
+void rtos_heap_malloc(void * pvAddress, size_t uiSize, void * pvCaller)
+{
+    if (pvAddress == NULL)
+    {
+        if (rtos_heap_failed != 0xFFFFU)
+        {
+            rtos_heap_failed++;
+        }
+
+        rtos_heap_operations++;
+        return;
+    }
+
+    uint32_t size = (uint32_t)uiSize;
+    uint32_t site = rtos_heap_site_index(pvCaller);
+    uint32_t size_class = rtos_heap_size_class(size);
+
+    rtos_heap_alloc_count++;
+    rtos_heap_live_bytes += size;
+
+    if (rtos_heap_live_bytes > rtos_heap_peak_bytes)
+    {
+        rtos_heap_peak_bytes = rtos_heap_live_bytes;
+    }
+
+    if (rtos_heap_histogram[size_class] != 0xFFFFU)
+    {
+        rtos_heap_histogram[size_class]++;
+    }
+
+    /* Add to the table of live allocations */
+    uint32_t index = rtos_heap_hash(pvAddress, RTE_RTOS_HEAP_ALLOCS - 1U);
+    uint32_t i;
+
+    for (i = 0U; i < RTE_RTOS_HEAP_ALLOCS; i++)
+    {
+        if (rtos_heap_allocs[index].address == NULL)
+        {
+            rtos_heap_allocs[index].address = pvAddress;
+            rtos_heap_allocs[index].size = size;
+            rtos_heap_allocs[index].tick = (uint32_t)xTaskGetTickCount();
+            rtos_heap_allocs[index].site = (uint16_t)site;
+            break;
+        }
+
+        index = (index + 1U) & (RTE_RTOS_HEAP_ALLOCS - 1U);
+    }
+
+    /* Its free will not be found in the table - charged to the other sites */
+    if (i == RTE_RTOS_HEAP_ALLOCS)
+    {
+        site = RTOS_HEAP_OTHER_SITE;
+
+        if (rtos_heap_untracked != 0xFFFFU)
+        {
+            rtos_heap_untracked++;
+        }
+    }
+
+    rtos_heap_site_t * p_site = &rtos_heap_sites[site];
+    p_site->live_count++;
+    p_site->live_bytes += size;
+    p_site->allocs++;
+    p_site->changed = 1U;
+    rtos_heap_operations++;
+}
+
+
+/**
+ * @brief Called by traceFREE(). The size of a tracked allocation is taken
+ *        from the table, since some heap implementations report 0 (heap_3).
+ */
+
+void rtos_heap_free(void * pvAddress, size_t uiSize)
+{
+    if (pvAddress == NULL)
+    {
+        return;
+    }
+
+    uint32_t size = (uint32_t)uiSize;
+    uint32_t index = rtos_heap_find(pvAddress);
+    rtos_heap_site_t * p_site = &rtos_heap_sites[RTOS_HEAP_OTHER_SITE];
+
+    if (index != RTE_RTOS_HEAP_ALLOCS)
+    {
+        size = rtos_heap_allocs[index].size;
+        p_site = &rtos_heap_sites[rtos_heap_allocs[index].site];
+        rtos_heap_remove(index);
+    }
+    else if ((size == 0U) && (p_site->live_count != 0U))
+    {
+        /* The heap does not report the block size (heap_3) - use the average
+         * size of the blocks charged to the other sites */
+        size = p_site->live_bytes / p_site->live_count;
+    }
+
+    rtos_heap_free_count++;
+    rtos_heap_live_bytes -= (size <= rtos_heap_live_bytes) ? size : rtos_heap_live_bytes;
+
+    if (p_site->live_count != 0U)
+    {
+        p_site->live_count--;
+        p_site->live_bytes -= (size <= p_site->live_bytes) ? size : p_site->live_bytes;
+        p_site->changed = 1U;
+    }
+
+    rtos_heap_operations++;
+}
+
+
+/**
+ * @brief Log the heap profiler summary: totals, size class histogram of the
+ *        allocations since the last summary, free space (optional) and all
+ *        allocation sites that changed since the last summary, with the age
+ *        of their oldest live allocation. Call it from a task.
+ */
+
+void rtos_heap_profile_dump(void)
+{
+    uint32_t oldest[RTE_RTOS_HEAP_SITES + 1U];
+    uint32_t now;
+
+    vTaskSuspendAll();
+    now = (uint32_t)xTaskGetTickCount();
+    rtos_heap_operations = 0U;
+
+    RTE_RTOS_MSG5(MSG5_RTOS_HEAP_SUMMARY, F_RTOS_MALLOC, rtos_heap_live_bytes, rtos_heap_peak_bytes,
+                  rtos_heap_alloc_count, rtos_heap_free_count,
+                  RTE_PACK_COUNTER_PAIR(rtos_heap_failed, rtos_heap_untracked));
+
+    RTE_RTOS_MSG8(MSG8_RTOS_HEAP_SIZE_HISTOGRAM, F_RTOS_MALLOC,
+                  RTE_PACK_COUNTER_PAIR(rtos_heap_histogram[0],  rtos_heap_histogram[1]),
+                  RTE_PACK_COUNTER_PAIR(rtos_heap_histogram[2],  rtos_heap_histogram[3]),
+                  RTE_PACK_COUNTER_PAIR(rtos_heap_histogram[4],  rtos_heap_histogram[5]),
+                  RTE_PACK_COUNTER_PAIR(rtos_heap_histogram[6],  rtos_heap_histogram[7]),
+                  RTE_PACK_COUNTER_PAIR(rtos_heap_histogram[8],  rtos_heap_histogram[9]),
+                  RTE_PACK_COUNTER_PAIR(rtos_heap_histogram[10], rtos_heap_histogram[11]),
+                  RTE_PACK_COUNTER_PAIR(rtos_heap_histogram[12], rtos_heap_histogram[13]),
+                  RTE_PACK_COUNTER_PAIR(rtos_heap_histogram[14], rtos_heap_histogram[15]));
+
+    for (uint32_t i = 0U; i < RTOS_HEAP_SIZE_CLASSES; i++)
+    {
+        rtos_heap_histogram[i] = 0U;
+    }
+
+#if RTE_RTOS_HEAP_FRAGMENTATION == 1
+    HeapStats_t heap_stats;
+    vPortGetHeapStats(&heap_stats);
+    RTE_RTOS_MSG3(MSG3_RTOS_HEAP_FREE_SPACE, F_RTOS_MALLOC, (uint32_t)heap_stats.xAvailableHeapSpaceInBytes,
+                  (uint32_t)heap_stats.xSizeOfLargestFreeBlockInBytes,
+                  (uint32_t)heap_stats.xMinimumEverFreeBytesRemaining);
+#endif
+
+    /* Age of the oldest live allocation of each site */
+    for (uint32_t i = 0U; i <= RTE_RTOS_HEAP_SITES; i++)
+    {
+        oldest[i] = 0U;
+    }
+
+    for (uint32_t i = 0U; i < RTE_RTOS_HEAP_ALLOCS; i++)
+    {
+        if (rtos_heap_allocs[i].address != NULL)
+        {
+            uint32_t age = now - rtos_heap_allocs[i].tick;
+            uint32_t site = rtos_heap_allocs[i].site;
+
+            if (age > oldest[site])
+            {
+                oldest[site] = age;
+            }
+        }
+    }
+
+    for (uint32_t i = 0U; i <= RTE_RTOS_HEAP_SITES; i++)
+    {
+        rtos_heap_site_t * p_site = &rtos_heap_sites[i];
+
+        /* Sites with live allocations are logged every time (the age changes) */
+        if ((p_site->changed != 0U) || (p_site->live_count != 0U))
+        {
+            RTE_RTOS_MSG5(MSG5_RTOS_HEAP_SITE, F_RTOS_MALLOC, (uint32_t)p_site->site,
+                          p_site->live_count, p_site->live_bytes, p_site->allocs, oldest[i]);
+            p_site->changed = 0U;
+        }
+    }
+
+    (void)xTaskResumeAll();
+}
+
+
+/**
+ * @brief Log the heap profiler summary if RTE_RTOS_HEAP_SUMMARY_PERIOD heap
+ *        operations have been done since the last summary. Call it from the
+ *        idle hook (vApplicationIdleHook()) or a low priority task.
+ */
+
+void rtos_heap_profile_poll(void)
+{
+#if RTE_RTOS_HEAP_SUMMARY_PERIOD > 0
+    if (rtos_heap_operations >= RTE_RTOS_HEAP_SUMMARY_PERIOD)
+    {
+        rtos_heap_profile_dump();
+    }
+#endif
+}
+#endif  // RTE_TRACE_RTOS_HEAP_PROFILE == 1
+
+
+#if RTE_TRACE_RTOS_STACK_MONITOR == 1
+/***
+ * Stack high-water mark monitor called by traceTASK_SWITCHED_OUT().
+ * On every switch-out, the saved stack pointer of the task is compared with
+ * the lowest value seen so far (cheap). Every RTE_RTOS_STACK_SCAN_PERIOD
+ * switch-outs of a task, the unused part of the stack is checked for the fill
+ * pattern - like uxTaskGetStackHighWaterMark() does, but only up to the
+ * current high-water mark, so the scan gets shorter as the mark moves.
+ * A message is logged only when the high-water mark of a task changes.
+ * Tasks are added to the table by traceTASK_CREATE() and removed by
+ * traceTASK_DELETE() - a task that deletes itself is switched out once more
+ * and must not be added again. The kernel calls the trace macros with the
+ * scheduler locked, which also protects the task table.
+ */
+
+#if (RTE_RTOS_STACK_TASKS & (RTE_RTOS_STACK_TASKS - 1U)) != 0U
+#error "RTE_RTOS_STACK_TASKS must be a power of 2."
+#endif
+
+#if portSTACK_GROWTH > 0
+#error "RTE_TRACE_RTOS_STACK_MONITOR supports ports with a descending stack only."
+#endif
+
+typedef struct
+{
+    void * tcb;             // NULL - free entry
+    uint32_t min_free;      // High-water mark - lowest free stack space [bytes]
+    uint32_t stack_size;    // [bytes], 0 - unknown
+    uint16_t switches;      // Switch-outs since the last fill pattern scan
+    uint16_t warned;        // 1 - the low stack warning has been logged
+} rtos_stack_task_t;
+
+static rtos_stack_task_t rtos_stack_tasks[RTE_RTOS_STACK_TASKS];
+
+
+static inline uint32_t rtos_stack_hash(const void * p_tcb)
+{
+    return (((uint32_t)((uintptr_t)p_tcb >> 2U) * 2654435761UL) >> 8U) & (RTE_RTOS_STACK_TASKS - 1U);
+}
+
+
+/* Find or add a task - returns NULL if the task is not found (add == 0) or the table is full. */
+static rtos_stack_task_t * rtos_stack_find(void * p_tcb, uint32_t add)
+{
+    uint32_t index = rtos_stack_hash(p_tcb);
+
+    for (uint32_t i = 0U; i < RTE_RTOS_STACK_TASKS; i++)
+    {
+        rtos_stack_task_t * p_task = &rtos_stack_tasks[index];
+
+        if (p_task->tcb == p_tcb)
+        {
+            return p_task;
+        }
+
+        if (p_task->tcb == NULL)
+        {
+            if (add == 0U)
+            {
+                break;
+            }
+
+            p_task->tcb = p_tcb;
+            return p_task;
+        }
+
+        index = (index + 1U) & (RTE_RTOS_STACK_TASKS - 1U);
+    }
+
+    return NULL;
+}
+
+
+/* Number of free bytes at the bottom of the stack that still contain the
+ * fill pattern. Only the first 'limit' bytes are checked. */
+static uint32_t rtos_stack_unused(const StackType_t * pxStack, uint32_t limit)
+{
+    const StackType_t fill = (StackType_t)(((StackType_t)~(StackType_t)0U / 0xFFU) * RTE_RTOS_STACK_FILL_BYTE);
+    uint32_t words = limit / (uint32_t)sizeof(StackType_t);
+    uint32_t count = 0U;
+
+    while ((count < words) && (pxStack[count] == fill))
+    {
+        count++;
+    }
+
+    return count * (uint32_t)sizeof(StackType_t);
+}
+
+
+static void rtos_stack_log(const rtos_stack_task_t * p_task)
+{
+    RTE_RTOS_MSG3(MSG3_RTOS_TASK_STACK, F_RTOS_TASKS, rtos_get_task_name(p_task->tcb),
+                  p_task->min_free, p_task->stack_size);
+}
+
+
+/**
+ * @brief Called by traceTASK_SWITCHED_OUT() after the context of the task
+ *        has been saved.
+ *
+ * @param p_tcb         Task being switched out
+ * @param pxStack       Lowest address of the task stack
+ * @param pxTopOfStack  Saved stack pointer
+ * @param pxEndOfStack  Highest address of the task stack (NULL - unknown)
+ */
+
+void rtos_stack_check(void * p_tcb, const void * pxStack, const volatile void * pxTopOfStack,
+                      const void * pxEndOfStack)
+{
+    if ((p_tcb == NULL) || (pxStack == NULL))
+    {
+        return;
+    }
+
+    rtos_stack_task_t * p_task = rtos_stack_find(p_tcb, 0U);
+
+    if (p_task == NULL)
+    {
+        return;     // Not created while the table had space or already deleted
+    }
+
+    uint32_t min_free = p_task->min_free;
+    uint32_t sp_free = 0U;      // Stack pointer below the stack - overflow
+
+    if ((uintptr_t)pxTopOfStack > (uintptr_t)pxStack)
+    {
+        sp_free = (uint32_t)((uintptr_t)pxTopOfStack - (uintptr_t)pxStack);
+    }
+
+    if (sp_free < min_free)
+    {
+        min_free = sp_free;
+    }
+
+    if (++p_task->switches >= RTE_RTOS_STACK_SCAN_PERIOD)
+    {
+        p_task->switches = 0U;
+        min_free = rtos_stack_unused((const StackType_t *)pxStack, min_free);
+    }
+
+    if (min_free != p_task->min_free)
+    {
+        if (pxEndOfStack != NULL)
+        {
+            p_task->stack_size = (uint32_t)((uintptr_t)pxEndOfStack - (uintptr_t)pxStack)
+                               + (uint32_t)sizeof(StackType_t);
+        }
+
+        p_task->min_free = min_free;
+        rtos_stack_log(p_task);
+
+        if ((min_free < RTE_RTOS_STACK_WARNING) && (p_task->warned == 0U))
+        {
+            p_task->warned = 1U;
+            RTE_RTOS_MSG2(MSG2_RTOS_TASK_STACK_LOW, F_RTOS_TASKS, rtos_get_task_name(p_tcb), min_free);
+        }
+    }
+}
+
+
+/**
+ * @brief Called by traceTASK_CREATE() - start monitoring the task. An entry
+ *        left by a task with the same TCB address (deletion not traced) is
+ *        reset, so the new task does not inherit its high-water mark.
+ */
+
+void rtos_stack_task_create(void * p_tcb)
+{
+    rtos_stack_task_t * p_task = rtos_stack_find(p_tcb, 1U);
+
+    if (p_task == NULL)
+    {
+        return;     // Table full - the task is not monitored
+    }
+
+    p_task->min_free = UINT32_MAX;
+    p_task->stack_size = 0U;
+    p_task->switches = RTE_RTOS_STACK_SCAN_PERIOD;  // Scan at the first switch-out
+    p_task->warned = 0U;
+}
+
+
+/**
+ * @brief Called by traceTASK_DELETE(). The TCB memory of the task can be
+ *        reused for a new task - remove the task from the table.
+ */
+
+void rtos_stack_task_delete(void * p_tcb)
+{
+    rtos_stack_task_t * p_task = rtos_stack_find(p_tcb, 0U);
+
+    if (p_task == NULL)
+    {
+        return;
+    }
+
+    /* Move the following entries of the probe sequence back (no tombstones) */
+    const uint32_t mask = RTE_RTOS_STACK_TASKS - 1U;
+    uint32_t index = (uint32_t)(p_task - rtos_stack_tasks);
+    uint32_t next = index;
+
+    for (uint32_t i = 1U; i < RTE_RTOS_STACK_TASKS; i++)
+    {
+        next = (next + 1U) & mask;
+
+        if (rtos_stack_tasks[next].tcb == NULL)
+        {
+            break;
+        }
+
+        uint32_t home = rtos_stack_hash(rtos_stack_tasks[next].tcb);
+
+        if (((next - home) & mask) >= ((next - index) & mask))
+        {
+            rtos_stack_tasks[index] = rtos_stack_tasks[next];
+            index = next;
+        }
+    }
+
+    rtos_stack_tasks[index].tcb = NULL;
+}
+
+
+/**
+ * @brief Log the high-water mark of all monitored tasks (per-task stack
+ *        report). Call it from a task.
+ */
+
+void rtos_stack_report(void)
+{
+    vTaskSuspendAll();
+
+    for (uint32_t i = 0U; i < RTE_RTOS_STACK_TASKS; i++)
+    {
+        if ((rtos_stack_tasks[i].tcb != NULL) && (rtos_stack_tasks[i].min_free != UINT32_MAX))
+        {
+            rtos_stack_log(&rtos_stack_tasks[i]);
+        }
+    }
+
+    (void)xTaskResumeAll();
+}
+#endif  // RTE_TRACE_RTOS_STACK_MONITOR == 1
+
+
+#if RTE_TRACE_RTOS_QUEUE_LATENCY == 1
+/***
+ * Send-to-receive latency of the items of selected queues.
+ * For each selected queue, a ring of RTE_RTOS_QUEUE_LATENCY_DEPTH entries
+ * mirrors the queue contents - the send sequence number and the enqueue time
+ * (RTE_RTOS_CYCLE_COUNTER) of every item. Items sent to the back are added at
+ * the end of the ring, items sent to the front at the start, and an overwrite
+ * replaces the item. A receive takes the first entry.
+ * Items that do not fit into the ring are counted as untracked. Items sent
+ * after them are not tracked either until all of them have been received -
+ * this keeps the ring in the same order as the queue.
+ * The tick count at the send restores the cycle counter wraps of items that
+ * wait longer than 2^32 cycles. The logged latencies saturate at UINT32_MAX.
+ * The kernel calls the trace macros in a critical section, which also
+ * protects the latency data.
+ */
+
+#if (RTE_RTOS_QUEUE_LATENCY_DEPTH & (RTE_RTOS_QUEUE_LATENCY_DEPTH - 1U)) != 0U
+#error "RTE_RTOS_QUEUE_LATENCY_DEPTH must be a power of 2."
+#endif
+
+#define RTOS_QUEUE_LATENCY_CLASSES  16U     // Class 0: 0 cycles, class n: 4^(n-1) - 4^n-1 cycles
+
+typedef struct
+{
+    void * queue;                                   // NULL - free entry
+    uint32_t send_time[RTE_RTOS_QUEUE_LATENCY_DEPTH];
+    uint32_t send_seq[RTE_RTOS_QUEUE_LATENCY_DEPTH];
+    TickType_t send_tick[RTE_RTOS_QUEUE_LATENCY_DEPTH];
+    uint32_t next_seq;                              // Sequence number of the next sent item
+    uint16_t first;                                 // Ring index of the oldest item
+    uint16_t count;                                 // Number of tracked items in the queue
+    uint32_t untracked_waiting;                     // Untracked items in the queue (after the tracked ones)
+
+    /* Statistics for the current period */
+    uint32_t received;
+    uint32_t max_latency;
+    uint64_t total_latency;
+    uint16_t overwritten;
+    uint16_t untracked;
+    uint16_t histogram[RTOS_QUEUE_LATENCY_CLASSES];
+} rtos_queue_latency_t;
+
+static rtos_queue_latency_t rtos_queue_latency[RTE_RTOS_QUEUE_LATENCY_QUEUES];
+
+
+static rtos_queue_latency_t * rtos_queue_latency_find(const void * pxQueue)
+{
+    for (uint32_t i = 0U; i < RTE_RTOS_QUEUE_LATENCY_QUEUES; i++)
+    {
+        if (rtos_queue_latency[i].queue == pxQueue)
+        {
+            return &rtos_queue_latency[i];
+        }
+    }
+
+    return NULL;
+}
+
+
+static uint32_t rtos_queue_latency_class(uint32_t cycles)
+{
+    uint32_t latency_class = 0U;
+
+    while ((cycles != 0U) && (latency_class < (RTOS_QUEUE_LATENCY_CLASSES - 1U)))
+    {
+        cycles >>= 2U;
+        latency_class++;
+    }
+
+    return latency_class;
+}
+
+
+/* Count an item that is not tracked (the counter saturates). */
+static void rtos_queue_latency_untracked(rtos_queue_latency_t * p_queue)
+{
+    if (p_queue->untracked != 0xFFFFU)
+    {
+        p_queue->untracked++;
+    }
+}
+
+
+/* Bring the ring in line with the number of items in the queue (e.g. after
+ * xQueueReset()) - the position of the untracked items is not known. */
+static void rtos_queue_latency_sync(rtos_queue_latency_t * p_queue, uint32_t waiting)
+{
+    if (((uint32_t)p_queue->count + p_queue->untracked_waiting) != waiting)
+    {
+        p_queue->count = 0U;
+        p_queue->untracked_waiting = waiting;
+    }
+}
+
+
+static void rtos_queue_latency_log(rtos_queue_latency_t * p_queue)
+{
+    uint64_t average = 0U;
+
+    if (p_queue->received != 0U)
+    {
+        average = p_queue->total_latency / p_queue->received;
+    }
+
+    RTE_RTOS_MSG5(MSG5_RTOS_QUEUE_LATENCY_STATS, F_RTOS_QUEUE, RTE_GET_QUEUE_NAME(p_queue->queue),
+                  p_queue->received, (average > UINT32_MAX) ? UINT32_MAX : (uint32_t)average, p_queue->max_latency,
+                  RTE_PACK_COUNTER_PAIR(p_queue->overwritten, p_queue->untracked));
+
+    RTE_RTOS_MSG8(MSG8_RTOS_QUEUE_LATENCY_HISTOGRAM, F_RTOS_QUEUE,
+                  RTE_PACK_COUNTER_PAIR(p_queue->histogram[0],  p_queue->histogram[1]),
+                  RTE_PACK_COUNTER_PAIR(p_queue->histogram[2],  p_queue->histogram[3]),
+                  RTE_PACK_COUNTER_PAIR(p_queue->histogram[4],  p_queue->histogram[5]),
+                  RTE_PACK_COUNTER_PAIR(p_queue->histogram[6],  p_queue->histogram[7]),
+                  RTE_PACK_COUNTER_PAIR(p_queue->histogram[8],  p_queue->histogram[9]),
+                  RTE_PACK_COUNTER_PAIR(p_queue->histogram[10], p_queue->histogram[11]),
+                  RTE_PACK_COUNTER_PAIR(p_queue->histogram[12], p_queue->histogram[13]),
+                  RTE_PACK_COUNTER_PAIR(p_queue->histogram[14], p_queue->histogram[15]));
+
+    p_queue->received = 0U;
+    p_queue->max_latency = 0U;
+    p_queue->total_latency = 0U;
+    p_queue->overwritten = 0U;
+    p_queue->untracked = 0U;
+
+    for (uint32_t i = 0U; i < RTOS_QUEUE_LATENCY_CLASSES; i++)
+    {
+        p_queue->histogram[i] = 0U;
+    }
+}
+
+
+/**
+ * @brief Enable the latency tracking for a queue. Call it after the queue has
+ *        been created (and added to the queue registry).
+ *
+ * @param pxQueue  Queue handle
+ * @return 1 - OK, 0 - no free entry (see RTE_RTOS_QUEUE_LATENCY_QUEUES)
+ */
+
+uint32_t rtos_queue_latency_enable(void * pxQueue)
+{
+    uint32_t enabled = 0U;
+
+    taskENTER_CRITICAL();
+    rtos_queue_latency_t * p_queue = rtos_queue_latency_find(pxQueue);
+
+    if (p_queue == NULL)
+    {
+        p_queue = rtos_queue_latency_find(NULL);
+
+        if (p_queue != NULL)
+        {
+            *p_queue = (rtos_queue_latency_t){ 0 };
+            p_queue->queue = pxQueue;
+            p_queue->untracked_waiting = (uint32_t)uxQueueMessagesWaitingFromISR((QueueHandle_t)pxQueue);
+        }
+    }
+
+    if (p_queue != NULL)
+    {
+        enabled = 1U;
+    }
+
+    taskEXIT_CRITICAL();
+    return enabled;
+}
+
+
+/**
+ * @brief Called by traceQUEUE_SEND() and traceQUEUE_SEND_FROM_ISR().
+ *
+ * @param pxQueue   Queue
+ * @param waiting   Number of items in the queue before the send
+ * @param length    Queue length
+ * @param position  xCopyPosition: 0 - back, 1 - front, 2 - overwrite
+ */
+
+void rtos_queue_latency_send(void * pxQueue, uint32_t waiting, uint32_t length, uint32_t position)
+{
+    rtos_queue_latency_t * p_queue = rtos_queue_latency_find(pxQueue);
+
+    if (p_queue == NULL)
+    {
+        return;
+    }
+
+    uint32_t now = RTE_RTOS_CYCLE_COUNTER();
+    uint32_t seq = p_queue->next_seq++;
+    rtos_queue_latency_sync(p_queue, waiting);
+
+    if ((waiting >= length) || (position == (uint32_t)queueOVERWRITE))
+    {
+        /* Overwrite - only for queues with one item */
+        if ((waiting != 0U) && (p_queue->overwritten != 0xFFFFU))
+        {
+            p_queue->overwritten++;
+        }
+
+        p_queue->count = 0U;
+        p_queue->untracked_waiting = 0U;
+    }
+
+    uint32_t index;
+
+    if (position == (uint32_t)queueSEND_TO_FRONT)
+    {
+        if (p_queue->count >= RTE_RTOS_QUEUE_LATENCY_DEPTH)
+        {
+            /* The newest tracked item becomes untracked */
+            p_queue->count--;
+            p_queue->untracked_waiting++;
+            rtos_queue_latency_untracked(p_queue);
+        }
+
+        p_queue->first = (uint16_t)((p_queue->first - 1U) & (RTE_RTOS_QUEUE_LATENCY_DEPTH - 1U));
+        index = p_queue->first;
+    }
+    else if ((p_queue->count >= RTE_RTOS_QUEUE_LATENCY_DEPTH) || (p_queue->untracked_waiting != 0U))
+    {
+        p_queue->untracked_waiting++;
+        rtos_queue_latency_untracked(p_queue);
+        return;
+    }
+    else
+    {
+        index = (p_queue->first + p_queue->count) & (RTE_RTOS_QUEUE_LATENCY_DEPTH - 1U);
+    }
+
+    p_queue->send_time[index] = now;
+    p_queue->send_tick[index] = xTaskGetTickCountFromISR();
+    p_queue->send_seq[index] = seq;
+    p_queue->count++;
+}
+
+
+/**
+ * @brief Called by traceQUEUE_RECEIVE() and traceQUEUE_RECEIVE_FROM_ISR().
+ *
+ * @param pxQueue   Queue
+ * @param waiting   Number of items in the queue before the receive
+ */
+
+void rtos_queue_latency_receive(void * pxQueue, uint32_t waiting)
+{
+    rtos_queue_latency_t * p_queue = rtos_queue_latency_find(pxQueue);
+
+    if (p_queue == NULL)
+    {
+        return;
+    }
+
+    uint32_t now = RTE_RTOS_CYCLE_COUNTER();
+    rtos_queue_latency_sync(p_queue, waiting);
+
+    if (p_queue->count == 0U)
+    {
+        if (p_queue->untracked_waiting != 0U)
+        {
+            p_queue->untracked_waiting--;
+        }
+
+        return;
+    }
+
+    uint32_t index = p_queue->first;
+    uint64_t elapsed = rtos_cycles_elapsed(now - p_queue->send_time[index],
+                                           xTaskGetTickCountFromISR() - p_queue->send_tick[index]);
+    uint32_t latency = (elapsed > UINT32_MAX) ? UINT32_MAX : (uint32_t)elapsed;
+    p_queue->first = (uint16_t)((index + 1U) & (RTE_RTOS_QUEUE_LATENCY_DEPTH - 1U));
+    p_queue->count--;
+
+    p_queue->received++;
+    p_queue->total_latency += elapsed;
+
+    if (latency > p_queue->max_latency)
+    {
+        p_queue->max_latency = latency;
+    }
+
+    uint32_t latency_class = rtos_queue_latency_class(latency);
+
+    if (p_queue->histogram[latency_class] < 0xFFFFU)
+    {
+        p_queue->histogram[latency_class]++;
+    }
+
+#if RTE_RTOS_QUEUE_LATENCY_EVENTS == 1
+    RTE_RTOS_MSG3(MSG3_RTOS_QUEUE_LATENCY, F_RTOS_QUEUE, RTE_GET_QUEUE_NAME(pxQueue),
+                  p_queue->send_seq[index], latency);
+#endif
+
+#if RTE_RTOS_QUEUE_LATENCY_PERIOD > 0
+    if (p_queue->received >= RTE_RTOS_QUEUE_LATENCY_PERIOD)
+    {
+        rtos_queue_latency_log(p_queue);
+    }
+#endif
+}
+
+
+/**
+ * @brief Log the latency statistics and histograms of all tracked queues
+ *        and start a new period. Call it from a task.
+ */
+
+void rtos_queue_latency_dump(void)
+{
+    taskENTER_CRITICAL();
+
+    for (uint32_t i = 0U; i < RTE_RTOS_QUEUE_LATENCY_QUEUES; i++)
+    {
+        if (rtos_queue_latency[i].queue != NULL)
+        {
+            rtos_queue_latency_log(&rtos_queue_latency[i]);
+        }
+    }
+
+    taskEXIT_CRITICAL();
+}
+#endif  // RTE_TRACE_RTOS_QUEUE_LATENCY == 1
+
+
+#if RTE_TRACE_RTOS_SNAPSHOT == 1
+/***
+ * Error-triggered snapshot. When armed, the first *_FAILED trace macro (or
+ * rtos_snapshot_error() call) with a message ID from the trigger table starts
+ * a countdown of post_ticks ticks. Logging is then stopped with
+ * rte_set_filter(0), so the circular buffer keeps the messages logged before
+ * and after the trigger until it is read. The system keeps running.
+ */
+
+rtos_snapshot_t g_rtos_snapshot;
+
+
+static uint32_t rtos_snapshot_is_trigger(uint32_t fmt_id)
+{
+    for (uint32_t i = 0U; i < RTE_RTOS_SNAPSHOT_TRIGGERS; i++)
+    {
+        uint32_t trigger = g_rtos_snapshot.triggers[i];
+
+        if ((trigger == fmt_id) || (trigger == RTE_RTOS_SNAPSHOT_ANY_ERROR))
+        {
+            return 1U;
+        }
+    }
+
+    return 0U;
+}
+
+
+/* Log the freeze point and stop logging. Called in a critical section. */
+static void rtos_snapshot_freeze(void)
+{
+    g_rtos_snapshot.freeze_tick = (uint32_t)xTaskGetTickCountFromISR();
+    RTE_RTOS_MSG2(MSG2_RTOS_SNAPSHOT_FREEZE, F_RTOS_BASIC, g_rtos_snapshot.trigger_id,
+                  g_rtos_snapshot.freeze_tick - g_rtos_snapshot.trigger_tick);
+    g_rtos_snapshot.filter = rte_get_filter();
+    g_rtos_snapshot.state = RTE_RTOS_SNAPSHOT_FROZEN;
+    rte_set_filter(0U);
+}
+
+
+/* Restore the message filter if logging has been stopped by the snapshot. */
+static void rtos_snapshot_unfreeze(void)
+{
+    if (g_rtos_snapshot.state == RTE_RTOS_SNAPSHOT_FROZEN)
+    {
+        rte_set_filter(g_rtos_snapshot.filter);
+    }
+}
+
+
+/**
+ * @brief Add a message ID to the trigger table.
+ *
+ * @param fmt_id  Message ID (e.g. MSG2_RTOS_QUEUE_SEND_FAILED) or
+ *                RTE_RTOS_SNAPSHOT_ANY_ERROR for all *_FAILED trace macros
+ * @return 1 - OK, 0 - the table is full
+ */
+
+uint32_t rtos_snapshot_trigger_add(uint32_t fmt_id)
+{
+    uint32_t added = 0U;
+    UBaseType_t mask = taskENTER_CRITICAL_FROM_ISR();
+
+    for (uint32_t i = 0U; i < RTE_RTOS_SNAPSHOT_TRIGGERS; i++)
+    {
+        if ((g_rtos_snapshot.triggers[i] == 0U) || (g_rtos_snapshot.triggers[i] == fmt_id))
+        {
+            g_rtos_snapshot.triggers[i] = fmt_id;
+            added = 1U;
+            break;
+        }
+    }
+
+    taskEXIT_CRITICAL_FROM_ISR(mask);
+    return added;
+}
+
+
+/**
+ * @brief Remove all message IDs from the trigger table.
+ */
+
+void rtos_snapshot_trigger_clear(void)
+{
+    UBaseType_t mask = taskENTER_CRITICAL_FROM_ISR();
+
+    for (uint32_t i = 0U; i < RTE_RTOS_SNAPSHOT_TRIGGERS; i++)
+    {
+        g_rtos_snapshot.triggers[i] = 0U;
+    }
+
+    taskEXIT_CRITICAL_FROM_ISR(mask);
+}
+
+
+/**
+ * @brief Arm the snapshot - wait for a trigger. If the buffer is frozen,
+ *        logging is enabled again (read the buffer first).
+ *
+ * @param post_ticks  Number of ticks logged after the trigger (0 - freeze at once)
+ */
+
+void rtos_snapshot_arm(uint32_t post_ticks)
+{
+    UBaseType_t mask = taskENTER_CRITICAL_FROM_ISR();
+    rtos_snapshot_unfreeze();
+    g_rtos_snapshot.post_ticks = post_ticks;
+    g_rtos_snapshot.state = RTE_RTOS_SNAPSHOT_ARMED;
+    taskEXIT_CRITICAL_FROM_ISR(mask);
+
+    RTE_RTOS_MSG1(MSG1_RTOS_SNAPSHOT_ARM, F_RTOS_BASIC, post_ticks);
+}
+
+
+/**
+ * @brief Disarm the snapshot. If the buffer is frozen, logging is enabled again.
+ */
+
+void rtos_snapshot_disarm(void)
+{
+    UBaseType_t mask = taskENTER_CRITICAL_FROM_ISR();
+    rtos_snapshot_unfreeze();
+    g_rtos_snapshot.state = RTE_RTOS_SNAPSHOT_DISARMED;
+    taskEXIT_CRITICAL_FROM_ISR(mask);
+}
+
+
+/**
+ * @brief Called by the *_FAILED trace macros after the error has been logged
+ *        and by rtos_assert_failed(). Can also be called by the application
+ *        for its own errors.
+ *
+ * @param fmt_id  Message ID of the logged error
+ */
+
+void rtos_snapshot_error(uint32_t fmt_id)
+{
+    if (g_rtos_snapshot.state != RTE_RTOS_SNAPSHOT_ARMED)
+    {
+        return;
+    }
+
+    UBaseType_t mask = taskENTER_CRITICAL_FROM_ISR();
+
+    if ((g_rtos_snapshot.state == RTE_RTOS_SNAPSHOT_ARMED) && (rtos_snapshot_is_trigger(fmt_id) != 0U))
+    {
+        g_rtos_snapshot.trigger_id = fmt_id;
+        g_rtos_snapshot.trigger_tick = (uint32_t)xTaskGetTickCountFromISR();
+        g_rtos_snapshot.countdown = g_rtos_snapshot.post_ticks;
+        g_rtos_snapshot.state = RTE_RTOS_SNAPSHOT_TRIGGERED;
+        RTE_RTOS_MSG2(MSG2_RTOS_SNAPSHOT_TRIGGER, F_RTOS_BASIC, fmt_id, g_rtos_snapshot.post_ticks);
+
+        if (g_rtos_snapshot.post_ticks == 0U)
+        {
+            rtos_snapshot_freeze();
+        }
+    }
+
+    taskEXIT_CRITICAL_FROM_ISR(mask);
+}
+
+
+/**
+ * @brief Post-trigger countdown. Called by traceTASK_INCREMENT_TICK() (one tick)
+ *        and traceINCREASE_TICK_COUNT() (ticks skipped in tickless idle), so
+ *        the window does not grow while the system sleeps.
+ *
+ * @param ticks  Number of ticks the tick count advanced
+ */
+
+void rtos_snapshot_tick(uint32_t ticks)
+{
+    if (g_rtos_snapshot.state != RTE_RTOS_SNAPSHOT_TRIGGERED)
+    {
+        return;
+    }
+
+    UBaseType_t mask = taskENTER_CRITICAL_FROM_ISR();
+
+    if (g_rtos_snapshot.state == RTE_RTOS_SNAPSHOT_TRIGGERED)
+    {
+        if (g_rtos_snapshot.countdown > ticks)
+        {
+            g_rtos_snapshot.countdown -= ticks;
+        }
+        else
+        {
+            g_rtos_snapshot.countdown = 0U;
+            rtos_snapshot_freeze();
+        }
+    }
+
+    taskEXIT_CRITICAL_FROM_ISR(mask);
+}
+#endif  // RTE_TRACE_RTOS_SNAPSHOT == 1
+
+
+/**
+ * @brief configASSERT() hook - log the address of the failed assertion and
+ *        trigger the snapshot (trigger ID MSG1_RTOS_ASSERT_FAILED). Used by the
+ *        default configASSERT() or called first in the application's handler.
+ */
+
+RTE_RTOS_NOINLINE void rtos_assert_failed(void)
+{
+    RTE_RTOS_MSG1(MSG1_RTOS_ASSERT_FAILED, F_RTOS_BASIC, (uint32_t)(uintptr_t)RTE_RTOS_CALLER_ADDRESS());
+    RTE_RTOS_ERROR(MSG1_RTOS_ASSERT_FAILED);
+}
+
+
+#if RTE_TRACE_RTOS_TICKLESS_COMP == 1
+/***
+ * Tickless idle timestamp compensation. The timestamp counter of most cores
+ * stops (or is stopped) in low power modes, so the timestamps of the messages
+ * logged after the wake-up would be too small by the sleep time. The sleep
+ * time is added to the long timestamp with the RTE_RTOS_TIMESTAMP_ADVANCE()
+ * port hook before the tick count is stepped by vTaskStepTick().
+ */
+
+#ifndef RTE_RTOS_TIMESTAMP_ADVANCE
+#error "RTE_RTOS_TIMESTAMP_ADVANCE(counts) must be defined for RTE_TRACE_RTOS_TICKLESS_COMP - see rte_FreeRTOS_trace.h."
+#endif
+
+#if configUSE_TICKLESS_IDLE == 0
+#warning "RTE_TRACE_RTOS_TICKLESS_COMP is enabled but configUSE_TICKLESS_IDLE is 0."
+#endif
+
+rtos_tickless_t g_rtos_tickless;
+
+
+/**
+ * @brief Called by traceLOW_POWER_IDLE_BEGIN() - before the port sleep function.
+ */
+
+void rtos_tickless_begin(void)
+{
+    g_rtos_tickless.sleeping = 1U;
+}
+
+
+/**
+ * @brief Called by traceINCREASE_TICK_COUNT() - after the wake-up, before the
+ *        tick count is stepped. Interrupts are disabled by the port.
+ *
+ * The sleep time is returned by the RTE_RTOS_SLEEP_TIME() port hook if it is
+ * defined - e.g. measured with a low power timer that runs during the sleep
+ * [timestamp counter periods]. Otherwise it is calculated from the number of
+ * stepped ticks. The resolution is then one tick, since the sleep can end
+ * between two ticks. The remainder of the conversion is kept so that the
+ * timestamp does not drift if the timestamp frequency is not a multiple of
+ * the tick rate.
+ *
+ * @param ticks  Number of ticks the tick count is stepped by
+ */
+
+void rtos_tickless_step(uint32_t ticks)
+{
+    uint64_t counts;
+
+#ifdef RTE_RTOS_SLEEP_TIME
+    counts = (uint64_t)RTE_RTOS_SLEEP_TIME();
+#else
+    uint64_t scaled = (uint64_t)ticks * (uint64_t)RTE_RTOS_TIMESTAMP_FREQUENCY
+                    + (uint64_t)g_rtos_tickless.remainder;
+    counts = scaled / (uint64_t)configTICK_RATE_HZ;
+    g_rtos_tickless.remainder = (uint32_t)(scaled % (uint64_t)configTICK_RATE_HZ);
+#endif
+
+    if (g_rtos_tickless.sleeping != 0U)
+    {
+        g_rtos_tickless.sleeping = 2U;      // Tick step done
+    }
+
+    g_rtos_tickless.sleeps++;
+    g_rtos_tickless.ticks += ticks;
+    g_rtos_tickless.time += counts;
+
+    if (counts != 0U)
+    {
+        RTE_RTOS_TIMESTAMP_ADVANCE(counts);
+    }
+}
+
+
+/**
+ * @brief Called by traceLOW_POWER_IDLE_END() - after the port sleep function.
+ */
+
+void rtos_tickless_end(void)
+{
+    if (g_rtos_tickless.sleeping == 1U)
+    {
+        g_rtos_tickless.aborted++;          // Sleep aborted - no tick step
+    }
+
+    g_rtos_tickless.sleeping = 0U;
+}
+#endif  // RTE_TRACE_RTOS_TICKLESS_COMP == 1
+
+
+#if RTE_TRACE_RTOS_OVERHEAD == 1
+/***
+ * Trace overhead self-measurement (instrumented build). The execution time of
+ * every RTE_RTOS_MSGx() call in the trace macros is added to the entry of its
+ * message ID. The time of the counter reads (measured by rtos_overhead_reset())
+ * is subtracted. The time of an interrupt that preempts a message is included
+ * in the time of that message - see the max. value.
+ */
+
+#if (RTE_RTOS_OVERHEAD_IDS & (RTE_RTOS_OVERHEAD_IDS - 1U)) != 0U
+#error "RTE_RTOS_OVERHEAD_IDS must be a power of 2."
+#endif
+
+#define RTE_RTOS_OVERHEAD_CALIBRATION   8U  // Number of empty measurements in rtos_overhead_reset()
+
+typedef struct
+{
+    uint32_t used;          // 1 - entry used by fmt_id (0 is also a valid message ID)
+    uint32_t fmt_id;        // Message ID
+    uint32_t count;         // Number of messages
+    uint32_t max_cycles;    // Longest execution time [cycles]
+    uint64_t cycles;        // Total execution time [cycles]
+} rtos_overhead_t;
+
+/* Two tables - rtos_overhead_dump() switches the measurement to the other one
+ * and logs the previous one, so the messages logged during the dump are not lost. */
+static rtos_overhead_t rtos_overhead[2][RTE_RTOS_OVERHEAD_IDS];
+static uint32_t rtos_overhead_active;       // Index of the table used by rtos_overhead_add()
+static uint32_t rtos_overhead_bias;         // Time of the counter reads [cycles]
+static uint32_t rtos_overhead_missed;       // Messages not measured - table full
+
+
+static inline uint32_t rtos_overhead_hash(uint32_t fmt_id)
+{
+    return ((fmt_id * 2654435761UL) >> 8U) & (RTE_RTOS_OVERHEAD_IDS - 1U);
+}
+
+
+/**
+ * @brief Clear a table. The table must not be in use by rtos_overhead_add().
+ */
+
+static void rtos_overhead_clear(rtos_overhead_t * p_table)
+{
+    for (uint32_t i = 0U; i < RTE_RTOS_OVERHEAD_IDS; i++)
+    {
+        p_table[i].used = 0U;
+        p_table[i].fmt_id = 0U;
+        p_table[i].count = 0U;
+        p_table[i].max_cycles = 0U;
+        p_table[i].cycles = 0U;
+    }
+}
+
+
+/**
+ * @brief Called by the instrumented RTE_RTOS_MSGx() macros.
+ *
+ * @param fmt_id  Message ID
+ * @param cycles  Execution time including the counter reads [cycles]
+ */
+
+void rtos_overhead_add(uint32_t fmt_id, uint32_t cycles)
+{
+    uint32_t index = rtos_overhead_hash(fmt_id);
+    cycles = (cycles > rtos_overhead_bias) ? (cycles - rtos_overhead_bias) : 0U;
+    UBaseType_t mask = taskENTER_CRITICAL_FROM_ISR();
+    rtos_overhead_t * p_table = rtos_overhead[rtos_overhead_active];
+
+    for (uint32_t i = 0U; i < RTE_RTOS_OVERHEAD_IDS; i++)
+    {
+        rtos_overhead_t * p_entry = &p_table[index];
+
+        if ((p_entry->used == 0U) || (p_entry->fmt_id == fmt_id))
+        {
+            p_entry->used = 1U;
+            p_entry->fmt_id = fmt_id;
+            p_entry->count++;
+            p_entry->cycles += cycles;
+
+            if (cycles > p_entry->max_cycles)
+            {
+                p_entry->max_cycles = cycles;
+            }
+
+            taskEXIT_CRITICAL_FROM_ISR(mask);
+            return;
+        }
+
+        index = (index + 1U) & (RTE_RTOS_OVERHEAD_IDS - 1U);
+    }
+
+    rtos_overhead_missed++;
+    taskEXIT_CRITICAL_FROM_ISR(mask);
+}
+
+
+/**
+ * @brief Clear the tables and measure the time of the counter reads.
+ *        Call it before the measurement, e.g. before the scheduler is started.
+ */
+
+void rtos_overhead_reset(void)
+{
+    uint32_t bias = UINT32_MAX;
+
+    for (uint32_t i = 0U; i < RTE_RTOS_OVERHEAD_CALIBRATION; i++)
+    {
+        uint32_t start = RTE_RTOS_OVERHEAD_COUNTER();
+        uint32_t cycles = RTE_RTOS_OVERHEAD_COUNTER() - start;
+
+        if (cycles < bias)
+        {
+            bias = cycles;
+        }
+    }
+
+    taskENTER_CRITICAL();
+    rtos_overhead_clear(rtos_overhead[0]);
+    rtos_overhead_clear(rtos_overhead[1]);
+    rtos_overhead_active = 0U;
+    rtos_overhead_missed = 0U;
+    rtos_overhead_bias = bias;
+    taskEXIT_CRITICAL();
+}
+
+
+/**
+ * @brief Log the table - one message per message ID - and clear it.
+ *        The measurement continues in the other table during the dump.
+ *        The dump messages are not measured. Call it from a task.
+ */
+
+void rtos_overhead_dump(void)
+{
+    taskENTER_CRITICAL();
+    rtos_overhead_t * p_table = rtos_overhead[rtos_overhead_active];
+    uint32_t missed = rtos_overhead_missed;
+    rtos_overhead_active ^= 1U;
+    rtos_overhead_missed = 0U;
+    taskEXIT_CRITICAL();
+
+    uint32_t entries = 0U;
+
+    for (uint32_t i = 0U; i < RTE_RTOS_OVERHEAD_IDS; i++)
+    {
+        entries += p_table[i].used;
+    }
+
+    RTE_MSG3(MSG3_RTOS_OVERHEAD_TABLE, F_RTOS_BASIC, entries, missed, rtos_overhead_bias);
+
+    for (uint32_t i = 0U; i < RTE_RTOS_OVERHEAD_IDS; i++)
+    {
+        const rtos_overhead_t * p_entry = &p_table[i];
+
+        if (p_entry->used != 0U)
+        {
+            RTE_MSG4(MSG4_RTOS_OVERHEAD, F_RTOS_BASIC, p_entry->fmt_id, p_entry->count,
+                     (uint32_t)(p_entry->cycles / p_entry->count), p_entry->max_cycles);
+        }
+    }
+
+    rtos_overhead_clear(p_table);
+}
+#endif  // RTE_TRACE_RTOS_OVERHEAD == 1
+
+
 #if (tskKERNEL_VERSION_MAJOR != (RTE_FREERTOS_VERSION / 10000)) || (tskKERNEL_VERSION_MINOR != ((RTE_FREERTOS_VERSION / 100) % 100))
 #error "The kernel version set in FreeRTOSConfig.h and in task.h are not consistent. Correct the version in FreeRTOSConfig.h."
 #endif
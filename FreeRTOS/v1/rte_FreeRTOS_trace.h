@@ -23,6 +23,7 @@ extern "C"
 
 #include "rtedbg.h"
 #include "rte_FreeRTOS_trace_fmt.h"     // Formatting definitions for the RTEdbg trace macros
+#include "rte_FreeRTOS_trace_pack.h"    // Packed data words (generated from rte_FreeRTOS_trace_schema.json)
 
 
 /***
@@ -60,6 +61,71 @@ extern "C"
 #define RTE_TRACE_RTOS_EXPERT    0      // Less important FreeRTOS events (for expert users)
 #endif
 
+
+/***
+ * Optional on-target analysis features. They are disabled by default.
+ * Put the definitions in the FreeRTOSConfig.h file - before the #include of this file.
+ */
+
+#ifndef RTE_TRACE_RTOS_ISR_IRQ
+#define RTE_TRACE_RTOS_ISR_IRQ   0      // ISR enter/exit with exception number and per-IRQ counters
+#endif
+#ifndef RTE_TRACE_RTOS_HEAP_PROFILE
+#define RTE_TRACE_RTOS_HEAP_PROFILE 0   // Heap profiler - periodic summaries instead of malloc/free messages
+#endif
+#ifndef RTE_TRACE_RTOS_STACK_MONITOR
+#define RTE_TRACE_RTOS_STACK_MONITOR 0  // Stack high-water mark monitor at task switch-out
+#endif
+#ifndef RTE_TRACE_RTOS_QUEUE_LATENCY
+#define RTE_TRACE_RTOS_QUEUE_LATENCY 0  // Send-to-receive latency of the items of selected queues
+#endif
+#ifndef RTE_TRACE_RTOS_SNAPSHOT
+#define RTE_TRACE_RTOS_SNAPSHOT  0      // Freeze the trace buffer after an error (pre/post-trigger window)
+#endif
+#ifndef RTE_TRACE_RTOS_TICKLESS_COMP
+#define RTE_TRACE_RTOS_TICKLESS_COMP 0  // Add the tickless idle sleep time to the timestamp
+#endif
+#ifndef RTE_TRACE_RTOS_OVERHEAD
+#define RTE_TRACE_RTOS_OVERHEAD  0      // Measure the execution time of every trace message (instrumented build)
+#endif
+
+
+/***
+ * Port hooks used by the optional features. The defaults are for Cortex-M
+ * cores with the DWT cycle counter enabled (CMSIS is required for __get_IPSR()).
+ */
+
+#ifndef RTE_RTOS_GET_IRQ_NUMBER
+#define RTE_RTOS_GET_IRQ_NUMBER()   (__get_IPSR() & 0x1FFU)     // Active exception number
+#endif
+
+#ifndef RTE_RTOS_CYCLE_COUNTER
+#define RTE_RTOS_CYCLE_COUNTER()    (*(volatile uint32_t *)0xE0001004UL)  // DWT->CYCCNT
+#endif
+
+#ifndef RTE_RTOS_CYCLE_FREQUENCY
+#define RTE_RTOS_CYCLE_FREQUENCY    (configCPU_CLOCK_HZ) // RTE_RTOS_CYCLE_COUNTER() frequency [Hz]
+#endif
+
+#ifndef RTE_RTOS_CALLER_ADDRESS
+#define RTE_RTOS_CALLER_ADDRESS()   __builtin_return_address(0)  // Return address of the current function
+#endif
+
+#ifndef RTE_RTOS_NOINLINE
+#define RTE_RTOS_NOINLINE           __attribute__((noinline))    // Keeps RTE_RTOS_CALLER_ADDRESS() in the caller
+#endif
+
+/* Tickless idle compensation - there is no default for RTE_RTOS_TIMESTAMP_ADVANCE(counts).
+ * It must add 'counts' (uint64_t, timestamp counter periods) to the long timestamp
+ * of the timestamp driver. RTE_RTOS_SLEEP_TIME() is optional - see rtos_tickless_step(). */
+#ifndef RTE_RTOS_TIMESTAMP_FREQUENCY
+#define RTE_RTOS_TIMESTAMP_FREQUENCY    g_rtedbg.timestamp_frequency    // [Hz]
+#endif
+
+#ifndef RTE_RTOS_OVERHEAD_COUNTER
+#define RTE_RTOS_OVERHEAD_COUNTER() RTE_RTOS_CYCLE_COUNTER()    // Trace overhead measurement
+#endif
+
 /* Fallback to F_RTOS_TASKS message filter if a particular filter is not defined. */
 #if !defined F_RTOS_MALLOC
 #define F_RTOS_MALLOC  F_RTOS_BASIC
@@ -81,6 +147,10 @@ extern "C"
 #define F_RTOS_EXPERT   F_RTOS_TASKS
 #endif
 
+#if !defined F_RTOS_ISR
+#define F_RTOS_ISR      F_RTOS_EXPERT
+#endif
+
 
 /* The FreeRTOS version has to be defined in the FreeRTOSConfig.h.
  * We can't use the tskKERNEL_VERSION_MAJOR and tskKERNEL_VERSION_MINOR values because
@@ -111,6 +181,237 @@ uint32_t rtos_get_timer_name(void * p_timer);
 uint32_t string_to_uint32(const char* p_name);
 uint32_t rtos_get_task_name(void * p_tcb);
 
+#if RTE_TRACE_RTOS_ISR_IRQ == 1
+#ifndef RTE_RTOS_IRQ_COUNT
+#define RTE_RTOS_IRQ_COUNT          128U    // Per-IRQ counters for exception numbers 0 .. N-1
+#endif
+#ifndef RTE_RTOS_ISR_MAX_NESTING
+#define RTE_RTOS_ISR_MAX_NESTING    8U      // Max. ISR nesting depth with execution time measurement
+#endif
+#ifndef RTE_RTOS_ISR_EVENTS
+#define RTE_RTOS_ISR_EVENTS         1       // 1 - log ISR enter/exit, 0 - per-IRQ counters only
+#endif
+#ifndef RTE_RTOS_ISR_STATS_PERIOD
+#define RTE_RTOS_ISR_STATS_PERIOD   (configTICK_RATE_HZ) // Counter dump period [ticks] - see rtos_isr_stats_poll(), 0 - on request only
+#endif
+
+#if defined(configNUMBER_OF_CORES) && (configNUMBER_OF_CORES > 1)
+#error "RTE_TRACE_RTOS_ISR_IRQ is supported for single core FreeRTOS ports only."
+#endif
+
+void rtos_isr_enter(void);
+void rtos_isr_exit(uint32_t to_scheduler);
+void rtos_isr_stats_dump(void);
+void rtos_isr_stats_poll(void);
+#endif  // RTE_TRACE_RTOS_ISR_IRQ == 1
+
+#if RTE_TRACE_RTOS_HEAP_PROFILE == 1
+#ifndef RTE_RTOS_HEAP_ALLOCS
+#define RTE_RTOS_HEAP_ALLOCS        128U    // Max. number of tracked live allocations (power of 2)
+#endif
+#ifndef RTE_RTOS_HEAP_SITES
+#define RTE_RTOS_HEAP_SITES         32U     // Max. number of allocation sites (power of 2)
+#endif
+#ifndef RTE_RTOS_HEAP_SUMMARY_PERIOD
+#define RTE_RTOS_HEAP_SUMMARY_PERIOD 64U    // Summary after N malloc/free calls - see rtos_heap_profile_poll(), 0 - on request only
+#endif
+#ifndef RTE_RTOS_HEAP_FRAGMENTATION
+#define RTE_RTOS_HEAP_FRAGMENTATION 0       // 1 - log free space info with vPortGetHeapStats() (heap_4, heap_5)
+#endif
+
+void rtos_heap_malloc(void * pvAddress, size_t uiSize, void * pvCaller);
+void rtos_heap_free(void * pvAddress, size_t uiSize);
+void rtos_heap_profile_dump(void);
+void rtos_heap_profile_poll(void);
+#endif  // RTE_TRACE_RTOS_HEAP_PROFILE == 1
+
+#if RTE_TRACE_RTOS_STACK_MONITOR == 1
+#ifndef RTE_RTOS_STACK_TASKS
+#define RTE_RTOS_STACK_TASKS        16U     // Max. number of monitored tasks (power of 2)
+#endif
+#ifndef RTE_RTOS_STACK_SCAN_PERIOD
+#define RTE_RTOS_STACK_SCAN_PERIOD  16U     // Scan the stack fill pattern every N switch-outs of a task
+#endif
+#ifndef RTE_RTOS_STACK_WARNING
+#define RTE_RTOS_STACK_WARNING      64U     // Report a task once when its free stack drops below N bytes
+#endif
+#ifndef RTE_RTOS_STACK_FILL_BYTE
+#define RTE_RTOS_STACK_FILL_BYTE    0xA5U   // Must be the same as tskSTACK_FILL_BYTE in tasks.c
+#endif
+
+/* The stack end is known to the kernel only if configRECORD_STACK_HIGH_ADDRESS is 1.
+ * Otherwise, the stack size is reported as 0. */
+#if defined(configRECORD_STACK_HIGH_ADDRESS) && (configRECORD_STACK_HIGH_ADDRESS == 1)
+#define RTE_RTOS_STACK_END(pxTCB)   ((pxTCB)->pxEndOfStack)
+#else
+#define RTE_RTOS_STACK_END(pxTCB)   NULL
+#endif
+
+// (void *) is used to avoid the need to include various FreeRTOS headers in this file.
+void rtos_stack_check(void * p_tcb, const void * pxStack, const volatile void * pxTopOfStack,
+                      const void * pxEndOfStack);
+void rtos_stack_task_create(void * p_tcb);
+void rtos_stack_task_delete(void * p_tcb);
+void rtos_stack_report(void);
+#endif  // RTE_TRACE_RTOS_STACK_MONITOR == 1
+
+#if RTE_TRACE_RTOS_QUEUE_LATENCY == 1
+#ifndef RTE_RTOS_QUEUE_LATENCY_QUEUES
+#define RTE_RTOS_QUEUE_LATENCY_QUEUES 4U    // Max. number of queues with latency tracking
+#endif
+#ifndef RTE_RTOS_QUEUE_LATENCY_DEPTH
+#define RTE_RTOS_QUEUE_LATENCY_DEPTH 16U    // Tracked items per queue (power of 2)
+#endif
+#ifndef RTE_RTOS_QUEUE_LATENCY_EVENTS
+#define RTE_RTOS_QUEUE_LATENCY_EVENTS 1     // 1 - log the latency of every item, 0 - histogram only
+#endif
+#ifndef RTE_RTOS_QUEUE_LATENCY_PERIOD
+#define RTE_RTOS_QUEUE_LATENCY_PERIOD 256U  // Log the histogram every N received items, 0 - on request only
+#endif
+
+// (void *) is used to avoid the need to include various FreeRTOS headers in this file.
+uint32_t rtos_queue_latency_enable(void * pxQueue);
+void rtos_queue_latency_send(void * pxQueue, uint32_t waiting, uint32_t length, uint32_t position);
+void rtos_queue_latency_receive(void * pxQueue, uint32_t waiting);
+void rtos_queue_latency_dump(void);
+
+/* Called in the kernel before the item is copied to/from the queue.
+ * xQueueGiveFromISR() has no xCopyPosition - from FreeRTOS v11 on it calls
+ * traceQUEUE_GIVE_FROM_ISR(), which passes queueSEND_TO_BACK. Before v11 it
+ * calls traceQUEUE_SEND_FROM_ISR(), so the position of the items sent from an
+ * ISR is not known - they are tracked as queueSEND_TO_BACK and an overwrite
+ * is recognized by a full queue. */
+#if RTE_FREERTOS_VERSION >= 110000
+#define RTE_RTOS_ISR_COPY_POSITION  xCopyPosition
+#else
+#define RTE_RTOS_ISR_COPY_POSITION  0U
+#endif
+
+#define RTE_RTOS_QUEUE_LATENCY_SEND(pxQueue, position) \
+    rtos_queue_latency_send((pxQueue), (uint32_t)(pxQueue)->uxMessagesWaiting, \
+                            (uint32_t)(pxQueue)->uxLength, (uint32_t)(position))
+#define RTE_RTOS_QUEUE_LATENCY_RECEIVE(pxQueue) \
+    rtos_queue_latency_receive((pxQueue), (uint32_t)(pxQueue)->uxMessagesWaiting)
+#else
+#define RTE_RTOS_QUEUE_LATENCY_SEND(pxQueue, position)
+#define RTE_RTOS_QUEUE_LATENCY_RECEIVE(pxQueue)
+#endif  // RTE_TRACE_RTOS_QUEUE_LATENCY == 1
+
+#if RTE_TRACE_RTOS_SNAPSHOT == 1
+#ifndef RTE_RTOS_SNAPSHOT_TRIGGERS
+#define RTE_RTOS_SNAPSHOT_TRIGGERS  8U      // Max. number of trigger message IDs
+#endif
+#define RTE_RTOS_SNAPSHOT_ANY_ERROR 0xFFFFFFFFUL    // Trigger ID - any *_FAILED trace macro
+
+/* Snapshot state - see rtos_snapshot_t.state */
+#define RTE_RTOS_SNAPSHOT_DISARMED  0U
+#define RTE_RTOS_SNAPSHOT_ARMED     1U      // Waiting for a trigger
+#define RTE_RTOS_SNAPSHOT_TRIGGERED 2U      // Post-trigger countdown running
+#define RTE_RTOS_SNAPSHOT_FROZEN    3U      // Logging stopped - the buffer holds the snapshot
+
+/* The structure is global so that the state of the snapshot can be checked
+ * with a debugger or together with the data logging structure. */
+typedef struct
+{
+    volatile uint32_t state;
+    uint32_t post_ticks;                    // Post-trigger window [ticks]
+    volatile uint32_t countdown;            // Ticks until freeze
+    uint32_t trigger_id;                    // Message ID that triggered the snapshot
+    uint32_t trigger_tick;                  // Tick count at the trigger
+    uint32_t freeze_tick;                   // Tick count at the freeze
+    uint32_t filter;                        // Message filter before the freeze
+    uint32_t triggers[RTE_RTOS_SNAPSHOT_TRIGGERS];  // Trigger message IDs, 0 - unused
+} rtos_snapshot_t;
+
+extern rtos_snapshot_t g_rtos_snapshot;
+
+uint32_t rtos_snapshot_trigger_add(uint32_t fmt_id);
+void rtos_snapshot_trigger_clear(void);
+void rtos_snapshot_arm(uint32_t post_ticks);
+void rtos_snapshot_disarm(void);
+void rtos_snapshot_error(uint32_t fmt_id);
+void rtos_snapshot_tick(uint32_t ticks);
+
+#define RTE_RTOS_ERROR(fmt_id)          rtos_snapshot_error(fmt_id)
+#define RTE_RTOS_SNAPSHOT_TICKS(ticks)  rtos_snapshot_tick(ticks)
+#else
+#define RTE_RTOS_ERROR(fmt_id)
+#define RTE_RTOS_SNAPSHOT_TICKS(ticks)
+#endif  // RTE_TRACE_RTOS_SNAPSHOT == 1
+
+/* configASSERT() hook - logs the address of the failed assertion and triggers the snapshot. */
+void rtos_assert_failed(void);
+
+#if RTE_TRACE_RTOS_TICKLESS_COMP == 1
+/* The structure is global so that the sleep statistics can be checked with a debugger. */
+typedef struct
+{
+    volatile uint32_t sleeping;             // 0 - awake, 1 - in tickless idle, 2 - tick count stepped
+    uint32_t sleeps;                        // Number of sleeps with a tick step
+    uint32_t aborted;                       // Number of sleeps without a tick step
+    uint32_t ticks;                         // Total number of stepped ticks
+    uint64_t time;                          // Total time added to the timestamp [timestamp periods]
+    uint32_t remainder;                     // Remainder of the tick to timestamp conversion
+} rtos_tickless_t;
+
+extern rtos_tickless_t g_rtos_tickless;
+
+void rtos_tickless_begin(void);
+void rtos_tickless_step(uint32_t ticks);
+void rtos_tickless_end(void);
+#endif  // RTE_TRACE_RTOS_TICKLESS_COMP == 1
+
+/***
+ * Message macros of the trace macros and of the helper functions. In the
+ * instrumented build (RTE_TRACE_RTOS_OVERHEAD == 1), every RTE_RTOS_MSGx() call
+ * (including the evaluation of its arguments, e.g. the name lookup) is
+ * bracketed with RTE_RTOS_OVERHEAD_COUNTER() reads. The RTE_MSGx() macros of
+ * the library are not changed - the messages of the application are not measured.
+ */
+#if RTE_TRACE_RTOS_OVERHEAD == 1
+#ifndef RTE_RTOS_OVERHEAD_IDS
+#define RTE_RTOS_OVERHEAD_IDS   128U    // Max. number of measured message IDs (power of 2, two tables)
+#endif
+
+void rtos_overhead_add(uint32_t fmt_id, uint32_t cycles);
+void rtos_overhead_reset(void);
+void rtos_overhead_dump(void);
+
+#define RTE_RTOS_MEASURE(fmt_id, call) \
+    do { \
+        uint32_t rte_start_ = RTE_RTOS_OVERHEAD_COUNTER(); \
+        call; \
+        rtos_overhead_add((fmt_id), RTE_RTOS_OVERHEAD_COUNTER() - rte_start_); \
+    } while (0)
+#else
+#define RTE_RTOS_MEASURE(fmt_id, call)  call
+#endif  // RTE_TRACE_RTOS_OVERHEAD == 1
+
+#define RTE_RTOS_MSG0(fmt_id, filter) \
+    RTE_RTOS_MEASURE((fmt_id), RTE_MSG0((fmt_id), (filter)))
+#define RTE_RTOS_MSG1(fmt_id, filter, d1) \
+    RTE_RTOS_MEASURE((fmt_id), RTE_MSG1((fmt_id), (filter), (d1)))
+#define RTE_RTOS_MSG2(fmt_id, filter, d1, d2) \
+    RTE_RTOS_MEASURE((fmt_id), RTE_MSG2((fmt_id), (filter), (d1), (d2)))
+#define RTE_RTOS_MSG3(fmt_id, filter, d1, d2, d3) \
+    RTE_RTOS_MEASURE((fmt_id), RTE_MSG3((fmt_id), (filter), (d1), (d2), (d3)))
+#define RTE_RTOS_MSG4(fmt_id, filter, d1, d2, d3, d4) \
+    RTE_RTOS_MEASURE((fmt_id), RTE_MSG4((fmt_id), (filter), (d1), (d2), (d3), (d4)))
+#define RTE_RTOS_MSG5(fmt_id, filter, d1, d2, d3, d4, d5) \
+    RTE_RTOS_MEASURE((fmt_id), RTE_MSG5((fmt_id), (filter), (d1), (d2), (d3), (d4), (d5)))
+#define RTE_RTOS_MSG6(fmt_id, filter, d1, d2, d3, d4, d5, d6) \
+    RTE_RTOS_MEASURE((fmt_id), RTE_MSG6((fmt_id), (filter), (d1), (d2), (d3), (d4), (d5), (d6)))
+#define RTE_RTOS_MSG7(fmt_id, filter, d1, d2, d3, d4, d5, d6, d7) \
+    RTE_RTOS_MEASURE((fmt_id), RTE_MSG7((fmt_id), (filter), (d1), (d2), (d3), (d4), (d5), (d6), (d7)))
+#define RTE_RTOS_MSG8(fmt_id, filter, d1, d2, d3, d4, d5, d6, d7, d8) \
+    RTE_RTOS_MEASURE((fmt_id), RTE_MSG8((fmt_id), (filter), (d1), (d2), (d3), (d4), (d5), (d6), (d7), (d8)))
+#define RTE_RTOS_EXT_MSG3_1(fmt_id, filter, d1, d2, d3, ext) \
+    RTE_RTOS_MEASURE((fmt_id), RTE_EXT_MSG3_1((fmt_id), (filter), (d1), (d2), (d3), (ext)))
+#ifdef RTE_MSGN
+#define RTE_RTOS_MSGN(fmt_id, filter, address, length) \
+    RTE_RTOS_MEASURE((fmt_id), RTE_MSGN((fmt_id), (filter), (address), (length)))
+#endif
+
 
 /***
  * Macro definitions for the FreeRTOS trace using the RTEdbg toolkit.
@@ -120,33 +421,71 @@ uint32_t rtos_get_task_name(void * p_tcb);
 /* Called after a task has been selected to run.  pxCurrentTCB holds a pointer
  * to the task control block of the selected task. */
 #define traceTASK_SWITCHED_IN() \
-    RTE_MSG1(MSG1_RTOS_TASK_SWITCHED_IN, F_RTOS_BASIC, rtos_get_task_name(pxCurrentTCB))
+    RTE_RTOS_MSG1(MSG1_RTOS_TASK_SWITCHED_IN, F_RTOS_BASIC, rtos_get_task_name(pxCurrentTCB))
 #endif  // RTE_TRACE_RTOS_BASIC == 1
 
 #if RTE_TRACE_RTOS_EXPERT == 1
 /* Called after all idle tasks and timer task (if enabled) have been created
  * successfully, just before the scheduler is started. */
 #define traceSTARTING_SCHEDULER(xIdleTaskHandles) \
-    RTE_MSG0(MSG0_RTOS_STARTING_SCHEDULER, F_RTOS_EXPERT)
+    RTE_RTOS_MSG0(MSG0_RTOS_STARTING_SCHEDULER, F_RTOS_EXPERT)
 #endif // RTE_TRACE_RTOS_EXPERT == 1
 
 
 #if RTE_TRACE_RTOS_TASKS == 1
+#if RTE_TRACE_RTOS_TICKLESS_COMP == 1
+/* The sleep time is added to the timestamp first - the message is logged with the wake-up time. */
+#define traceINCREASE_TICK_COUNT(x) \
+    do { \
+        rtos_tickless_step((uint32_t)(x)); \
+        RTE_RTOS_MSG1(MSG1_RTOS_INCREASE_TICK_COUNT, F_RTOS_TASKS, (uint32_t)(x)); \
+        RTE_RTOS_SNAPSHOT_TICKS((uint32_t)(x)); \
+    } while (0)
+
+#define traceLOW_POWER_IDLE_BEGIN() \
+    do { \
+        RTE_RTOS_MSG0(MSG0_RTOS_LOW_POWER_IDLE_BEGIN, F_RTOS_TASKS); \
+        rtos_tickless_begin(); \
+    } while (0)
+
+#define traceLOW_POWER_IDLE_END() \
+    do { \
+        rtos_tickless_end(); \
+        RTE_RTOS_MSG0(MSG0_RTOS_LOW_POWER_IDLE_END, F_RTOS_TASKS); \
+    } while (0)
+#else
 /* Called before stepping the tick count after waking from tickless idle sleep.  x = ticks to jump */
 #define traceINCREASE_TICK_COUNT(x) \
-    RTE_MSG1(MSG1_RTOS_INCREASE_TICK_COUNT, F_RTOS_TASKS, (uint32_t)(x))
+    do { \
+        RTE_RTOS_MSG1(MSG1_RTOS_INCREASE_TICK_COUNT, F_RTOS_TASKS, (uint32_t)(x)); \
+        RTE_RTOS_SNAPSHOT_TICKS((uint32_t)(x)); \
+    } while (0)
 	
 /* Called immediately before entering tickless idle. */
 #define traceLOW_POWER_IDLE_BEGIN() \
-    RTE_MSG0(MSG0_RTOS_LOW_POWER_IDLE_BEGIN, F_RTOS_TASKS)
+    RTE_RTOS_MSG0(MSG0_RTOS_LOW_POWER_IDLE_BEGIN, F_RTOS_TASKS)
 
 /* Called when returning to the Idle task after a tickless idle. */
 #define traceLOW_POWER_IDLE_END() \
-    RTE_MSG0(MSG0_RTOS_LOW_POWER_IDLE_END, F_RTOS_TASKS)
+    RTE_RTOS_MSG0(MSG0_RTOS_LOW_POWER_IDLE_END, F_RTOS_TASKS)
+#endif  // RTE_TRACE_RTOS_TICKLESS_COMP == 1
+
+#elif RTE_TRACE_RTOS_TICKLESS_COMP == 1
+/* Timestamp compensation only */
+#define traceINCREASE_TICK_COUNT(x) \
+    do { \
+        rtos_tickless_step((uint32_t)(x)); \
+        RTE_RTOS_SNAPSHOT_TICKS((uint32_t)(x)); \
+    } while (0)
+#define traceLOW_POWER_IDLE_BEGIN()     rtos_tickless_begin()
+#define traceLOW_POWER_IDLE_END()       rtos_tickless_end()
+
+#elif RTE_TRACE_RTOS_SNAPSHOT == 1
+/* Post-trigger countdown - the ticks skipped in tickless idle */
+#define traceINCREASE_TICK_COUNT(x)     rtos_snapshot_tick((uint32_t)(x))
 #endif  // RTE_TRACE_RTOS_TASKS == 1
 
 
-#if RTE_TRACE_RTOS_EXPERT == 1
 /* Called before a task has been selected to run.  pxCurrentTCB holds a pointer
  * to the task control block of the task being switched out.
  *
@@ -154,9 +493,27 @@ uint32_t rtos_get_task_name(void * p_tcb);
  * executed before, so it is not necessary to record the name of the executed task
  * with this macro.
  */
+#if RTE_TRACE_RTOS_STACK_MONITOR == 1
+/* The context of the task has already been saved - pxTopOfStack is the stack
+ * pointer of the task being switched out. */
+#define RTE_RTOS_STACK_CHECK() \
+    rtos_stack_check(pxCurrentTCB, pxCurrentTCB->pxStack, pxCurrentTCB->pxTopOfStack, \
+                     RTE_RTOS_STACK_END(pxCurrentTCB))
+
+#if RTE_TRACE_RTOS_EXPERT == 1
 #define traceTASK_SWITCHED_OUT() \
-    RTE_MSG1(MSG1_RTOS_TASK_SWITCHED_OUT, F_RTOS_EXPERT , rtos_get_task_name(pxCurrentTCB))
-#endif // RTE_TRACE_RTOS_EXPERT == 1
+    do { \
+        RTE_RTOS_MSG1(MSG1_RTOS_TASK_SWITCHED_OUT, F_RTOS_EXPERT , rtos_get_task_name(pxCurrentTCB)); \
+        RTE_RTOS_STACK_CHECK(); \
+    } while (0)
+#else
+#define traceTASK_SWITCHED_OUT()    RTE_RTOS_STACK_CHECK()
+#endif  // RTE_TRACE_RTOS_EXPERT == 1
+
+#elif RTE_TRACE_RTOS_EXPERT == 1
+#define traceTASK_SWITCHED_OUT() \
+    RTE_RTOS_MSG1(MSG1_RTOS_TASK_SWITCHED_OUT, F_RTOS_EXPERT , rtos_get_task_name(pxCurrentTCB))
+#endif // RTE_TRACE_RTOS_STACK_MONITOR == 1
 
 
 #if RTE_TRACE_RTOS_TASKS == 1
@@ -166,7 +523,7 @@ uint32_t rtos_get_task_name(void * p_tcb);
  * will inherit (the priority of the task that is attempting to obtain the
  * muted. */
 #define traceTASK_PRIORITY_INHERIT(pxTCBOfMutexHolder, uxInheritedPriority) \
-    RTE_MSG2(MSG2_RTOS_TASK_PRIORITY_INHERIT, F_RTOS_TASKS, rtos_get_task_name(pxTCBOfMutexHolder), \
+    RTE_RTOS_MSG2(MSG2_RTOS_TASK_PRIORITY_INHERIT, F_RTOS_TASKS, rtos_get_task_name(pxTCBOfMutexHolder), \
             (uint32_t)(uxInheritedPriority))
 
 /* Called when a task releases a mutex, the holding of which had resulted in
@@ -174,7 +531,7 @@ uint32_t rtos_get_task_name(void * p_tcb);
  * pxTCBOfMutexHolder is a pointer to the TCB of the task that is releasing the
  * mutex.  uxOriginalPriority is the task's configured (base) priority. */
 #define traceTASK_PRIORITY_DISINHERIT(pxTCBOfMutexHolder, uxOriginalPriority) \
-    RTE_MSG2(MSG2_RTOS_TASK_PRIORITY_DISINHERIT, F_RTOS_TASKS, rtos_get_task_name(pxTCBOfMutexHolder), \
+    RTE_RTOS_MSG2(MSG2_RTOS_TASK_PRIORITY_DISINHERIT, F_RTOS_TASKS, rtos_get_task_name(pxTCBOfMutexHolder), \
             (uint32_t)(uxOriginalPriority))
 
 /* Task is about to block because it cannot read from a
@@ -182,14 +539,14 @@ uint32_t rtos_get_task_name(void * p_tcb);
  * upon which the read was attempted.  pxCurrentTCB points to the TCB of the
  * task that attempted the read. */
 #define traceBLOCKING_ON_QUEUE_RECEIVE(pxQueue) \
-    RTE_MSG1(MSG1_RTOS_BLOCKING_ON_QUEUE_RECEIVE, F_RTOS_TASKS, RTE_GET_QUEUE_NAME(pxQueue))
+    RTE_RTOS_MSG1(MSG1_RTOS_BLOCKING_ON_QUEUE_RECEIVE, F_RTOS_TASKS, RTE_GET_QUEUE_NAME(pxQueue))
 
 /* Task is about to block because it cannot read from a
  * queue/mutex/semaphore.  pxQueue is a pointer to the queue/mutex/semaphore
  * upon which the read was attempted.  pxCurrentTCB points to the TCB of the
  * task that attempted the read. */
 #define traceBLOCKING_ON_QUEUE_PEEK(pxQueue) \
-    RTE_MSG1(MSG1_RTOS_BLOCKING_ON_QUEUE_PEEK, F_RTOS_TASKS, RTE_GET_QUEUE_NAME(pxQueue))
+    RTE_RTOS_MSG1(MSG1_RTOS_BLOCKING_ON_QUEUE_PEEK, F_RTOS_TASKS, RTE_GET_QUEUE_NAME(pxQueue))
 
 /* Task is about to block because it cannot write to a
  * queue/mutex/semaphore.  pxQueue is a pointer to the queue/mutex/semaphore
@@ -197,7 +554,7 @@ uint32_t rtos_get_task_name(void * p_tcb);
  * task that attempted the write. 
  * xCopyPosition: 0 - queueSEND_TO_BACK, 1 - queueSEND_TO_FRONT, 2 - queueOVERWRITE */
 #define traceBLOCKING_ON_QUEUE_SEND(pxQueue) \
-    RTE_MSG2(MSG2_RTOS_BLOCKING_ON_QUEUE_SEND, F_RTOS_TASKS, \
+    RTE_RTOS_MSG2(MSG2_RTOS_BLOCKING_ON_QUEUE_SEND, F_RTOS_TASKS, \
             RTE_GET_QUEUE_NAME(pxQueue), (uint32_t)(xCopyPosition))
 #endif  // RTE_TRACE_RTOS_TASKS == 1
 
@@ -208,240 +565,346 @@ uint32_t rtos_get_task_name(void * p_tcb);
  * not essential for the basic functionality of the current RTEdbg trace implementation.
  */
 #define traceMOVED_TASK_TO_READY_STATE(pxTCB) \
-    RTE_MSG1(MSG1_RTOS_MOVED_TASK_TO_READY_STATE, F_RTOS_EXPERT, rtos_get_task_name(pxTCB))
+    RTE_RTOS_MSG1(MSG1_RTOS_MOVED_TASK_TO_READY_STATE, F_RTOS_EXPERT, rtos_get_task_name(pxTCB))
 
 #define tracePOST_MOVED_TASK_TO_READY_STATE(pxTCB) \
-    RTE_MSG1(MSG1_RTOS_POST_MOVED_TASK_TO_READY_STATE, F_RTOS_EXPERT, rtos_get_task_name(pxTCB))
+    RTE_RTOS_MSG1(MSG1_RTOS_POST_MOVED_TASK_TO_READY_STATE, F_RTOS_EXPERT, rtos_get_task_name(pxTCB))
 
 #define traceMOVED_TASK_TO_DELAYED_LIST() \
-    RTE_MSG1(MSG1_RTOS_MOVED_TASK_TO_DELAYED_LIST, F_RTOS_EXPERT, rtos_get_task_name(pxCurrentTCB))
+    RTE_RTOS_MSG1(MSG1_RTOS_MOVED_TASK_TO_DELAYED_LIST, F_RTOS_EXPERT, rtos_get_task_name(pxCurrentTCB))
 
 #define traceMOVED_TASK_TO_OVERFLOW_DELAYED_LIST() \
-    RTE_MSG1(MSG1_RTOS_MOVED_TASK_TO_OVERFLOW_DELAYED_LIST, F_RTOS_EXPERT, \
-             rtos_get_task_name(pxCurrentTCB))
+    RTE_RTOS_MSG1(MSG1_RTOS_MOVED_TASK_TO_OVERFLOW_DELAYED_LIST, F_RTOS_EXPERT, \
+                  rtos_get_task_name(pxCurrentTCB))
 #endif  // RTE_TRACE_RTOS_EXPERT == 1
 
 
 #if RTE_TRACE_RTOS_EXPERT == 1
 #define traceQUEUE_REGISTRY_ADD(xQueue, pcQueueName) \
-    RTE_MSG2(MSG2_RTOS_QUEUE_REGISTRY_ADD, F_RTOS_EXPERT , (uint32_t)xQueue, \
-             string_to_uint32(pcQueueName))
+    RTE_RTOS_MSG2(MSG2_RTOS_QUEUE_REGISTRY_ADD, F_RTOS_EXPERT , (uint32_t)xQueue, \
+                  string_to_uint32(pcQueueName))
 #endif // RTE_TRACE_RTOS_EXPERT == 1
 
 
 #if RTE_TRACE_RTOS_QUEUE == 1
 #define traceQUEUE_CREATE(pxNewQueue) \
-    RTE_MSG2(MSG2_RTOS_QUEUE_CREATE, F_RTOS_QUEUE, RTE_GET_QUEUE_NAME(pxNewQueue), (uint32_t)ucQueueType)
+    RTE_RTOS_MSG2(MSG2_RTOS_QUEUE_CREATE, F_RTOS_QUEUE, RTE_GET_QUEUE_NAME(pxNewQueue), (uint32_t)ucQueueType)
 
 /* ucQueueType: 0 - queueQUEUE_TYPE_BASE, 1 - queueQUEUE_TYPE_MUTEX, 
  * 2 - queueQUEUE_TYPE_COUNTING_SEMAPHORE, 3 - queueQUEUE_TYPE_BINARY_SEMAPHORE,
  * 4 - queueQUEUE_TYPE_RECURSIVE_MUTEX, 5 - queueQUEUE_TYPE_SET */
 #define traceQUEUE_CREATE_FAILED(ucQueueType) \
-    RTE_MSG1(MSG1_RTOS_QUEUE_CREATE_FAILED, F_RTOS_QUEUE, (uint32_t)(ucQueueType))
+    do { \
+        RTE_RTOS_MSG1(MSG1_RTOS_QUEUE_CREATE_FAILED, F_RTOS_QUEUE, (uint32_t)(ucQueueType)); \
+        RTE_RTOS_ERROR(MSG1_RTOS_QUEUE_CREATE_FAILED); \
+    } while (0)
 
 #define traceCREATE_MUTEX(pxNewQueue) \
-    RTE_MSG1(MSG1_RTOS_CREATE_MUTEX, F_RTOS_QUEUE, RTE_GET_QUEUE_NAME(pxNewQueue))
+    RTE_RTOS_MSG1(MSG1_RTOS_CREATE_MUTEX, F_RTOS_QUEUE, RTE_GET_QUEUE_NAME(pxNewQueue))
 
 #define traceCREATE_MUTEX_FAILED() \
-    RTE_MSG0(MSG0_RTOS_CREATE_MUTEX_FAILED, F_RTOS_QUEUE)
+    do { \
+        RTE_RTOS_MSG0(MSG0_RTOS_CREATE_MUTEX_FAILED, F_RTOS_QUEUE); \
+        RTE_RTOS_ERROR(MSG0_RTOS_CREATE_MUTEX_FAILED); \
+    } while (0)
 
 #define traceGIVE_MUTEX_RECURSIVE(pxMutex) \
-    RTE_MSG1(MSG1_RTOS_GIVE_MUTEX_RECURSIVE, F_RTOS_QUEUE, RTE_GET_QUEUE_NAME(pxMutex))
+    RTE_RTOS_MSG1(MSG1_RTOS_GIVE_MUTEX_RECURSIVE, F_RTOS_QUEUE, RTE_GET_QUEUE_NAME(pxMutex))
 
 #define traceGIVE_MUTEX_RECURSIVE_FAILED(pxMutex) \
-    RTE_MSG1(MSG1_RTOS_GIVE_MUTEX_RECURSIVE_FAILED, F_RTOS_QUEUE, RTE_GET_QUEUE_NAME(pxMutex))
+    do { \
+        RTE_RTOS_MSG1(MSG1_RTOS_GIVE_MUTEX_RECURSIVE_FAILED, F_RTOS_QUEUE, RTE_GET_QUEUE_NAME(pxMutex)); \
+        RTE_RTOS_ERROR(MSG1_RTOS_GIVE_MUTEX_RECURSIVE_FAILED); \
+    } while (0)
 
 #define traceTAKE_MUTEX_RECURSIVE(pxMutex) \
-    RTE_MSG1(MSG1_RTOS_TAKE_MUTEX_RECURSIVE, F_RTOS_QUEUE, RTE_GET_QUEUE_NAME(pxMutex))
+    RTE_RTOS_MSG1(MSG1_RTOS_TAKE_MUTEX_RECURSIVE, F_RTOS_QUEUE, RTE_GET_QUEUE_NAME(pxMutex))
 
 #define traceTAKE_MUTEX_RECURSIVE_FAILED(pxMutex) \
-    RTE_MSG1(MSG1_RTOS_TAKE_MUTEX_RECURSIVE_FAILED, F_RTOS_QUEUE, RTE_GET_QUEUE_NAME(pxMutex))
+    do { \
+        RTE_RTOS_MSG1(MSG1_RTOS_TAKE_MUTEX_RECURSIVE_FAILED, F_RTOS_QUEUE, RTE_GET_QUEUE_NAME(pxMutex)); \
+        RTE_RTOS_ERROR(MSG1_RTOS_TAKE_MUTEX_RECURSIVE_FAILED); \
+    } while (0)
 
 #define traceCREATE_COUNTING_SEMAPHORE() \
-    RTE_MSG3(MSG3_RTOS_CREATE_COUNTING_SEMAPHORE, F_RTOS_QUEUE, \
+    RTE_RTOS_MSG3(MSG3_RTOS_CREATE_COUNTING_SEMAPHORE, F_RTOS_QUEUE, \
             (uint32_t)(xHandle), (uint32_t)(uxMaxCount), (uint32_t)(uxInitialCount))
 
 #define traceCREATE_COUNTING_SEMAPHORE_FAILED() \
-    RTE_MSG0(MSG0_RTOS_CREATE_COUNTING_SEMAPHORE_FAILED, F_RTOS_QUEUE)
+    do { \
+        RTE_RTOS_MSG0(MSG0_RTOS_CREATE_COUNTING_SEMAPHORE_FAILED, F_RTOS_QUEUE); \
+        RTE_RTOS_ERROR(MSG0_RTOS_CREATE_COUNTING_SEMAPHORE_FAILED); \
+    } while (0)
 #endif  // RTE_TRACE_RTOS_QUEUE == 1
 
 #if RTE_TRACE_RTOS_BASIC == 1
-/* xCopyPosition: 0 - queueSEND_TO_BACK, 1 - queueSEND_TO_FRONT, 2 - queueOVERWRITE 
- * Packed into 32 bits: xCopyPosition (4 bits, bits 28-31), xTicksToWait (28 bits, bits 0-27) */
+/* xCopyPosition: 0 - queueSEND_TO_BACK, 1 - queueSEND_TO_FRONT, 2 - queueOVERWRITE */
 #define traceQUEUE_SEND(pxQueue) \
-    RTE_MSG2(MSG2_RTOS_QUEUE_SEND, F_RTOS_BASIC, \
-        RTE_GET_QUEUE_NAME(pxQueue), pxQueue->uxMessagesWaiting)
+    do { \
+        RTE_RTOS_MSG2(MSG2_RTOS_QUEUE_SEND, F_RTOS_BASIC, \
+            RTE_GET_QUEUE_NAME(pxQueue), pxQueue->uxMessagesWaiting); \
+        RTE_RTOS_QUEUE_LATENCY_SEND(pxQueue, xCopyPosition); \
+    } while (0)
 
 #define traceQUEUE_SEND_FAILED(pxQueue) \
-    RTE_MSG2(MSG2_RTOS_QUEUE_SEND_FAILED, F_RTOS_BASIC, \
-             RTE_GET_QUEUE_NAME(pxQueue), \
-             (((uint32_t)xTicksToWait > 0x0FFFFFFFU ? 0x0FFFFFFFU : (uint32_t)xTicksToWait) | \
-             (((uint32_t)xCopyPosition & 0xFU) << 28U)))
+    do { \
+        RTE_RTOS_MSG2(MSG2_RTOS_QUEUE_SEND_FAILED, F_RTOS_BASIC, \
+                      RTE_GET_QUEUE_NAME(pxQueue), RTE_PACK_QUEUE_SEND_FAILED(xTicksToWait, xCopyPosition)); \
+        RTE_RTOS_ERROR(MSG2_RTOS_QUEUE_SEND_FAILED); \
+    } while (0)
 
 #define traceQUEUE_RECEIVE(pxQueue) \
-    RTE_MSG2(MSG2_RTOS_QUEUE_RECEIVE, F_RTOS_BASIC, RTE_GET_QUEUE_NAME(pxQueue), \
-            (((uint32_t)((xTicksToWait > 0xFFFFU) ? 0xFFFFU : xTicksToWait)) | \
-            (uint32_t)(((pxQueue->uxMessagesWaiting > 0xFFFFU) ? 0xFFFFU : pxQueue->uxMessagesWaiting) << 16U)))
+    do { \
+        RTE_RTOS_MSG2(MSG2_RTOS_QUEUE_RECEIVE, F_RTOS_BASIC, RTE_GET_QUEUE_NAME(pxQueue), \
+                      RTE_PACK_QUEUE_RECEIVE(xTicksToWait, pxQueue->uxMessagesWaiting)); \
+        RTE_RTOS_QUEUE_LATENCY_RECEIVE(pxQueue); \
+    } while (0)
 
 #define traceQUEUE_PEEK(pxQueue) \
-    RTE_MSG2(MSG2_RTOS_QUEUE_PEEK, F_RTOS_BASIC, RTE_GET_QUEUE_NAME(pxQueue), \
+    RTE_RTOS_MSG2(MSG2_RTOS_QUEUE_PEEK, F_RTOS_BASIC, RTE_GET_QUEUE_NAME(pxQueue), \
             (uint32_t)xTicksToWait)
 
 #define traceQUEUE_PEEK_FAILED(pxQueue) \
-    RTE_MSG2(MSG2_RTOS_QUEUE_PEEK_FAILED, F_RTOS_BASIC, RTE_GET_QUEUE_NAME(pxQueue), \
-            (uint32_t)xTicksToWait)
+    do { \
+        RTE_RTOS_MSG2(MSG2_RTOS_QUEUE_PEEK_FAILED, F_RTOS_BASIC, RTE_GET_QUEUE_NAME(pxQueue), \
+                (uint32_t)xTicksToWait); \
+        RTE_RTOS_ERROR(MSG2_RTOS_QUEUE_PEEK_FAILED); \
+    } while (0)
 
 #define traceQUEUE_PEEK_FROM_ISR(pxQueue) \
-    RTE_MSG1(MSG1_RTOS_QUEUE_PEEK_FROM_ISR, F_RTOS_BASIC, RTE_GET_QUEUE_NAME(pxQueue))
+    RTE_RTOS_MSG1(MSG1_RTOS_QUEUE_PEEK_FROM_ISR, F_RTOS_BASIC, RTE_GET_QUEUE_NAME(pxQueue))
 
 #define traceQUEUE_RECEIVE_FAILED(pxQueue) \
-    RTE_MSG2(MSG2_RTOS_QUEUE_RECEIVE_FAILED, F_RTOS_BASIC, RTE_GET_QUEUE_NAME(pxQueue), \
-            (uint32_t)xTicksToWait)
+    do { \
+        RTE_RTOS_MSG2(MSG2_RTOS_QUEUE_RECEIVE_FAILED, F_RTOS_BASIC, RTE_GET_QUEUE_NAME(pxQueue), \
+                (uint32_t)xTicksToWait); \
+        RTE_RTOS_ERROR(MSG2_RTOS_QUEUE_RECEIVE_FAILED); \
+    } while (0)
+
+#define RTE_RTOS_QUEUE_SEND_FROM_ISR(pxQueue, position) \
+    do { \
+        RTE_RTOS_MSG2(MSG2_RTOS_QUEUE_SEND_FROM_ISR, F_RTOS_BASIC, \
+                      RTE_GET_QUEUE_NAME(pxQueue), pxQueue->uxMessagesWaiting); \
+        RTE_RTOS_QUEUE_LATENCY_SEND(pxQueue, position); \
+    } while (0)
 
 #define traceQUEUE_SEND_FROM_ISR(pxQueue) \
-    RTE_MSG2(MSG2_RTOS_QUEUE_SEND_FROM_ISR, F_RTOS_BASIC, \
-             RTE_GET_QUEUE_NAME(pxQueue), pxQueue->uxMessagesWaiting)
+    RTE_RTOS_QUEUE_SEND_FROM_ISR(pxQueue, RTE_RTOS_ISR_COPY_POSITION)
+
+#define traceQUEUE_GIVE_FROM_ISR(pxQueue)   RTE_RTOS_QUEUE_SEND_FROM_ISR(pxQueue, 0U)
 
 #define traceQUEUE_SEND_FROM_ISR_FAILED(pxQueue) \
-    RTE_MSG1(MSG1_RTOS_QUEUE_SEND_FROM_ISR_FAILED, F_RTOS_BASIC, RTE_GET_QUEUE_NAME(pxQueue))
+    do { \
+        RTE_RTOS_MSG1(MSG1_RTOS_QUEUE_SEND_FROM_ISR_FAILED, F_RTOS_BASIC, RTE_GET_QUEUE_NAME(pxQueue)); \
+        RTE_RTOS_ERROR(MSG1_RTOS_QUEUE_SEND_FROM_ISR_FAILED); \
+    } while (0)
 
 #define traceQUEUE_RECEIVE_FROM_ISR(pxQueue) \
-    RTE_MSG2(MSG2_RTOS_QUEUE_RECEIVE_FROM_ISR, F_RTOS_BASIC, \
-             RTE_GET_QUEUE_NAME(pxQueue), pxQueue->uxMessagesWaiting)
+    do { \
+        RTE_RTOS_MSG2(MSG2_RTOS_QUEUE_RECEIVE_FROM_ISR, F_RTOS_BASIC, \
+                      RTE_GET_QUEUE_NAME(pxQueue), pxQueue->uxMessagesWaiting); \
+        RTE_RTOS_QUEUE_LATENCY_RECEIVE(pxQueue); \
+    } while (0)
 
 #define traceQUEUE_RECEIVE_FROM_ISR_FAILED(pxQueue) \
-    RTE_MSG1(MSG1_RTOS_QUEUE_RECEIVE_FROM_ISR_FAILED, F_RTOS_BASIC, RTE_GET_QUEUE_NAME(pxQueue))
+    do { \
+        RTE_RTOS_MSG1(MSG1_RTOS_QUEUE_RECEIVE_FROM_ISR_FAILED, F_RTOS_BASIC, RTE_GET_QUEUE_NAME(pxQueue)); \
+        RTE_RTOS_ERROR(MSG1_RTOS_QUEUE_RECEIVE_FROM_ISR_FAILED); \
+    } while (0)
 
 #define traceQUEUE_DELETE(pxQueue) \
-    RTE_MSG1(MSG1_RTOS_QUEUE_DELETE, F_RTOS_BASIC, RTE_GET_QUEUE_NAME(pxQueue))
+    RTE_RTOS_MSG1(MSG1_RTOS_QUEUE_DELETE, F_RTOS_BASIC, RTE_GET_QUEUE_NAME(pxQueue))
 
 #define traceQUEUE_PEEK_FROM_ISR_FAILED(pxQueue) \
-    RTE_MSG1(MSG1_RTOS_QUEUE_PEEK_FROM_ISR_FAILED, F_RTOS_BASIC, RTE_GET_QUEUE_NAME(pxQueue))
+    do { \
+        RTE_RTOS_MSG1(MSG1_RTOS_QUEUE_PEEK_FROM_ISR_FAILED, F_RTOS_BASIC, RTE_GET_QUEUE_NAME(pxQueue)); \
+        RTE_RTOS_ERROR(MSG1_RTOS_QUEUE_PEEK_FROM_ISR_FAILED); \
+    } while (0)
+
+#elif RTE_TRACE_RTOS_QUEUE_LATENCY == 1
+#define traceQUEUE_SEND(pxQueue)                RTE_RTOS_QUEUE_LATENCY_SEND(pxQueue, xCopyPosition)
+#define traceQUEUE_RECEIVE(pxQueue)             RTE_RTOS_QUEUE_LATENCY_RECEIVE(pxQueue)
+#define traceQUEUE_SEND_FROM_ISR(pxQueue)       RTE_RTOS_QUEUE_LATENCY_SEND(pxQueue, RTE_RTOS_ISR_COPY_POSITION)
+#define traceQUEUE_GIVE_FROM_ISR(pxQueue)       RTE_RTOS_QUEUE_LATENCY_SEND(pxQueue, 0U)
+#define traceQUEUE_RECEIVE_FROM_ISR(pxQueue)    RTE_RTOS_QUEUE_LATENCY_RECEIVE(pxQueue)
 #endif  // RTE_TRACE_RTOS_BASIC == 1
 
 
 #if RTE_TRACE_RTOS_TASKS == 1    
+#if RTE_TRACE_RTOS_STACK_MONITOR == 1
 #define traceTASK_CREATE(pxNewTCB) \
-    RTE_MSG1(MSG1_RTOS_TASK_CREATE, F_RTOS_TASKS, rtos_get_task_name(pxNewTCB))
+    do { \
+        RTE_RTOS_MSG1(MSG1_RTOS_TASK_CREATE, F_RTOS_TASKS, rtos_get_task_name(pxNewTCB)); \
+        rtos_stack_task_create(pxNewTCB); \
+    } while (0)
+#else
+#define traceTASK_CREATE(pxNewTCB) \
+    RTE_RTOS_MSG1(MSG1_RTOS_TASK_CREATE, F_RTOS_TASKS, rtos_get_task_name(pxNewTCB))
+#endif  // RTE_TRACE_RTOS_STACK_MONITOR == 1
 
 #define traceTASK_CREATE_FAILED() \
-    RTE_MSG0(MSG0_RTOS_TASK_CREATE_FAILED, F_RTOS_TASKS)
+    do { \
+        RTE_RTOS_MSG0(MSG0_RTOS_TASK_CREATE_FAILED, F_RTOS_TASKS); \
+        RTE_RTOS_ERROR(MSG0_RTOS_TASK_CREATE_FAILED); \
+    } while (0)
 
+#if RTE_TRACE_RTOS_STACK_MONITOR == 1
 #define traceTASK_DELETE(pxTaskToDelete) \
-    RTE_MSG1(MSG1_RTOS_TASK_DELETE, F_RTOS_TASKS, rtos_get_task_name(pxTaskToDelete))
+    do { \
+        RTE_RTOS_MSG1(MSG1_RTOS_TASK_DELETE, F_RTOS_TASKS, rtos_get_task_name(pxTaskToDelete)); \
+        rtos_stack_task_delete(pxTaskToDelete); \
+    } while (0)
+#else
+#define traceTASK_DELETE(pxTaskToDelete) \
+    RTE_RTOS_MSG1(MSG1_RTOS_TASK_DELETE, F_RTOS_TASKS, rtos_get_task_name(pxTaskToDelete))
+#endif  // RTE_TRACE_RTOS_STACK_MONITOR == 1
+
+#elif RTE_TRACE_RTOS_STACK_MONITOR == 1
+/* Only the created tasks are monitored. The memory of a deleted task can be
+ * reused for a new task. */
+#define traceTASK_CREATE(pxNewTCB)          rtos_stack_task_create(pxNewTCB)
+#define traceTASK_DELETE(pxTaskToDelete)    rtos_stack_task_delete(pxTaskToDelete)
 #endif  // RTE_TRACE_RTOS_TASKS == 1
 
 #if RTE_TRACE_RTOS_BASIC == 1
 #define traceTASK_DELAY_UNTIL(x) \
-    RTE_MSG1(MSG1_RTOS_TASK_DELAY_UNTIL, F_RTOS_BASIC, (uint32_t)(x))
+    RTE_RTOS_MSG1(MSG1_RTOS_TASK_DELAY_UNTIL, F_RTOS_BASIC, (uint32_t)(x))
 
 #define traceTASK_DELAY() \
-    RTE_MSG1(MSG1_RTOS_TASK_DELAY, F_RTOS_BASIC, (uint32_t)xTicksToDelay)
+    RTE_RTOS_MSG1(MSG1_RTOS_TASK_DELAY, F_RTOS_BASIC, (uint32_t)xTicksToDelay)
 
 #define traceTASK_PRIORITY_SET(pxTask, uxNewPriority) \
-    RTE_MSG2(MSG2_RTOS_TASK_PRIORITY_SET, F_RTOS_BASIC, rtos_get_task_name(pxTask), \
+    RTE_RTOS_MSG2(MSG2_RTOS_TASK_PRIORITY_SET, F_RTOS_BASIC, rtos_get_task_name(pxTask), \
             (uint32_t)(uxNewPriority))
 
 #define traceTASK_SUSPEND(pxTaskToSuspend) \
-    RTE_MSG1(MSG1_RTOS_TASK_SUSPEND, F_RTOS_BASIC, rtos_get_task_name(pxTaskToSuspend))
+    RTE_RTOS_MSG1(MSG1_RTOS_TASK_SUSPEND, F_RTOS_BASIC, rtos_get_task_name(pxTaskToSuspend))
 
 #define traceTASK_RESUME(pxTaskToResume) \
-    RTE_MSG1(MSG1_RTOS_TASK_RESUME, F_RTOS_BASIC, rtos_get_task_name(pxTaskToResume))
+    RTE_RTOS_MSG1(MSG1_RTOS_TASK_RESUME, F_RTOS_BASIC, rtos_get_task_name(pxTaskToResume))
 
 #define traceTASK_RESUME_FROM_ISR(pxTaskToResume) \
-    RTE_MSG1(MSG1_RTOS_TASK_RESUME_FROM_ISR, F_RTOS_BASIC, rtos_get_task_name(pxTaskToResume))
+    RTE_RTOS_MSG1(MSG1_RTOS_TASK_RESUME_FROM_ISR, F_RTOS_BASIC, rtos_get_task_name(pxTaskToResume))
 #endif  // RTE_TRACE_RTOS_BASIC == 1
 
 #if RTE_TRACE_RTOS_TASKS == 1
+#if RTE_TRACE_RTOS_SNAPSHOT == 1
 #define traceTASK_INCREMENT_TICK(xTickCount) \
-    RTE_MSG1(MSG1_RTOS_TASK_INCREMENT_TICK, F_RTOS_TASKS, (uint32_t)(xTickCount))
+    do { \
+        RTE_RTOS_MSG1(MSG1_RTOS_TASK_INCREMENT_TICK, F_RTOS_TASKS, (uint32_t)(xTickCount)); \
+        rtos_snapshot_tick(1U); \
+    } while (0)
+#else
+#define traceTASK_INCREMENT_TICK(xTickCount) \
+    RTE_RTOS_MSG1(MSG1_RTOS_TASK_INCREMENT_TICK, F_RTOS_TASKS, (uint32_t)(xTickCount))
+#endif  // RTE_TRACE_RTOS_SNAPSHOT == 1
+
+#elif RTE_TRACE_RTOS_SNAPSHOT == 1
+/* Post-trigger countdown */
+#define traceTASK_INCREMENT_TICK(xTickCount)    rtos_snapshot_tick(1U)
 #endif  // RTE_TRACE_RTOS_TASKS == 1
 
 
 #if ( configUSE_TIMERS == 1 )
 #if RTE_TRACE_RTOS_TIMER == 1  
 #define traceTIMER_CREATE(pxNewTimer) \
-    RTE_MSG2(MSG2_RTOS_TIMER_CREATE, F_RTOS_TIMER, rtos_get_timer_name(pxNewTimer), \
+    RTE_RTOS_MSG2(MSG2_RTOS_TIMER_CREATE, F_RTOS_TIMER, rtos_get_timer_name(pxNewTimer), \
             (uint32_t)xTimerPeriodInTicks)
 
 #define traceTIMER_CREATE_FAILED() \
-    RTE_MSG0(MSG0_RTOS_TIMER_CREATE_FAILED, F_RTOS_TIMER)
+    do { \
+        RTE_RTOS_MSG0(MSG0_RTOS_TIMER_CREATE_FAILED, F_RTOS_TIMER); \
+        RTE_RTOS_ERROR(MSG0_RTOS_TIMER_CREATE_FAILED); \
+    } while (0)
 
 #define traceTIMER_COMMAND_SEND(pxTimer, xCommandID, xOptionalValue, xStatus) \
-    RTE_EXT_MSG3_1(EXT_MSG3_1_RTOS_TIMER_COMMAND_SEND, F_RTOS_TIMER, rtos_get_timer_name(pxTimer), \
+    RTE_RTOS_EXT_MSG3_1(EXT_MSG3_1_RTOS_TIMER_COMMAND_SEND, F_RTOS_TIMER, rtos_get_timer_name(pxTimer), \
              (uint32_t)(xCommandID), (uint32_t)(xOptionalValue), (uint32_t)(xStatus))
 
 #define traceTIMER_EXPIRED(pxTimer) \
-    RTE_MSG1(MSG1_RTOS_TIMER_EXPIRED, F_RTOS_TIMER, rtos_get_timer_name(pxTimer))
+    RTE_RTOS_MSG1(MSG1_RTOS_TIMER_EXPIRED, F_RTOS_TIMER, rtos_get_timer_name(pxTimer))
 
 #define traceTIMER_COMMAND_RECEIVED(pxTimer, xMessageID, xMessageValue) \
-    RTE_MSG3(MSG3_RTOS_TIMER_COMMAND_RECEIVED, F_RTOS_TIMER, rtos_get_timer_name(pxTimer), \
+    RTE_RTOS_MSG3(MSG3_RTOS_TIMER_COMMAND_RECEIVED, F_RTOS_TIMER, rtos_get_timer_name(pxTimer), \
             (uint32_t)(xMessageID), (uint32_t)(xMessageValue))
 #endif  // RTE_TRACE_RTOS_TIMER == 1
 #endif // ( configUSE_TIMERS == 1 )
 
 
-#if RTE_TRACE_RTOS_MALLOC == 1
+#if RTE_TRACE_RTOS_HEAP_PROFILE == 1
+/* Malloc and free are not logged. The heap profiler logs periodic summaries
+ * from a task - see rtos_heap_profile_poll(). The macros are called from
+ * pvPortMalloc() and vPortFree(), so the return address is the allocation site. */
 #define traceMALLOC(pvAddress, uiSize) \
-    RTE_MSG2(MSG2_RTOS_MALLOC, F_RTOS_MALLOC, (uint32_t)(pvAddress), (uint32_t)(uiSize))
+    rtos_heap_malloc((pvAddress), (size_t)(uiSize), RTE_RTOS_CALLER_ADDRESS())
 
 #define traceFREE(pvAddress, uiSize) \
-    RTE_MSG2(MSG2_RTOS_FREE, F_RTOS_MALLOC, (uint32_t)(pvAddress), (uint32_t)(uiSize))
-#endif  // RTE_TRACE_RTOS_MALLOC == 1
+    rtos_heap_free((pvAddress), (size_t)(uiSize))
+
+#elif RTE_TRACE_RTOS_MALLOC == 1
+#define traceMALLOC(pvAddress, uiSize) \
+    RTE_RTOS_MSG2(MSG2_RTOS_MALLOC, F_RTOS_MALLOC, (uint32_t)(pvAddress), (uint32_t)(uiSize))
+
+#define traceFREE(pvAddress, uiSize) \
+    RTE_RTOS_MSG2(MSG2_RTOS_FREE, F_RTOS_MALLOC, (uint32_t)(pvAddress), (uint32_t)(uiSize))
+#endif  // RTE_TRACE_RTOS_HEAP_PROFILE == 1
 
 
 #if RTE_TRACE_RTOS_TASKS == 1    
 #define traceEVENT_GROUP_CREATE(xEventGroup) \
-    RTE_MSG1(MSG1_RTOS_EVENT_GROUP_CREATE, F_RTOS_TASKS, (uint32_t)(xEventGroup))
+    RTE_RTOS_MSG1(MSG1_RTOS_EVENT_GROUP_CREATE, F_RTOS_TASKS, (uint32_t)(xEventGroup))
 
 #define traceEVENT_GROUP_CREATE_FAILED() \
-    RTE_MSG0(MSG0_RTOS_EVENT_GROUP_CREATE_FAILED, F_RTOS_TASKS)
+    do { \
+        RTE_RTOS_MSG0(MSG0_RTOS_EVENT_GROUP_CREATE_FAILED, F_RTOS_TASKS); \
+        RTE_RTOS_ERROR(MSG0_RTOS_EVENT_GROUP_CREATE_FAILED); \
+    } while (0)
 
 #define traceEVENT_GROUP_SYNC_BLOCK(xEventGroup, uxBitsToSet, uxBitsToWaitFor) \
-    RTE_MSG3(MSG3_RTOS_EVENT_GROUP_SYNC_BLOCK, F_RTOS_TASKS, (uint32_t)(xEventGroup), \
+    RTE_RTOS_MSG3(MSG3_RTOS_EVENT_GROUP_SYNC_BLOCK, F_RTOS_TASKS, (uint32_t)(xEventGroup), \
             (uint32_t)(uxBitsToSet), (uint32_t)(uxBitsToWaitFor))
 
 #define traceEVENT_GROUP_SYNC_END(xEventGroup, uxBitsToSet, uxBitsToWaitFor, xTimeoutOccurred) \
-    RTE_MSG4(MSG4_RTOS_EVENT_GROUP_SYNC_END, F_RTOS_TASKS, (uint32_t)(xEventGroup), \
+    RTE_RTOS_MSG4(MSG4_RTOS_EVENT_GROUP_SYNC_END, F_RTOS_TASKS, (uint32_t)(xEventGroup), \
             (uint32_t)(uxBitsToSet), (uint32_t)(uxBitsToWaitFor), (uint32_t)(xTimeoutOccurred))
 
 #define traceEVENT_GROUP_WAIT_BITS_BLOCK(xEventGroup, uxBitsToWaitFor) \
-    RTE_MSG2(MSG2_RTOS_EVENT_GROUP_WAIT_BITS_BLOCK, F_RTOS_TASKS, (uint32_t)(xEventGroup), \
+    RTE_RTOS_MSG2(MSG2_RTOS_EVENT_GROUP_WAIT_BITS_BLOCK, F_RTOS_TASKS, (uint32_t)(xEventGroup), \
             (uint32_t)(uxBitsToWaitFor))
 
 #define traceEVENT_GROUP_WAIT_BITS_END(xEventGroup, uxBitsToWaitFor, xTimeoutOccurred) \
-    RTE_MSG3(MSG3_RTOS_EVENT_GROUP_WAIT_BITS_END, F_RTOS_TASKS, (uint32_t)(xEventGroup), \
+    RTE_RTOS_MSG3(MSG3_RTOS_EVENT_GROUP_WAIT_BITS_END, F_RTOS_TASKS, (uint32_t)(xEventGroup), \
             (uint32_t)(uxBitsToWaitFor), (uint32_t)(xTimeoutOccurred))
 
 #define traceEVENT_GROUP_CLEAR_BITS(xEventGroup, uxBitsToClear) \
-    RTE_MSG2(MSG2_RTOS_EVENT_GROUP_CLEAR_BITS, F_RTOS_TASKS, (uint32_t)(xEventGroup), \
+    RTE_RTOS_MSG2(MSG2_RTOS_EVENT_GROUP_CLEAR_BITS, F_RTOS_TASKS, (uint32_t)(xEventGroup), \
             (uint32_t)(uxBitsToClear))
 
 #define traceEVENT_GROUP_CLEAR_BITS_FROM_ISR(xEventGroup, uxBitsToClear) \
-    RTE_MSG2(MSG2_RTOS_EVENT_GROUP_CLEAR_BITS_FROM_ISR, F_RTOS_TASKS, (uint32_t)(xEventGroup), \
+    RTE_RTOS_MSG2(MSG2_RTOS_EVENT_GROUP_CLEAR_BITS_FROM_ISR, F_RTOS_TASKS, (uint32_t)(xEventGroup), \
             (uint32_t)(uxBitsToClear))
 
 #define traceEVENT_GROUP_SET_BITS(xEventGroup, uxBitsToSet) \
-    RTE_MSG2(MSG2_RTOS_EVENT_GROUP_SET_BITS, F_RTOS_TASKS, (uint32_t)(xEventGroup), \
+    RTE_RTOS_MSG2(MSG2_RTOS_EVENT_GROUP_SET_BITS, F_RTOS_TASKS, (uint32_t)(xEventGroup), \
             (uint32_t)(uxBitsToSet))
 
 #define traceEVENT_GROUP_SET_BITS_FROM_ISR(xEventGroup, uxBitsToSet) \
-    RTE_MSG2(MSG2_RTOS_EVENT_GROUP_SET_BITS_FROM_ISR, F_RTOS_TASKS, (uint32_t)(xEventGroup), \
+    RTE_RTOS_MSG2(MSG2_RTOS_EVENT_GROUP_SET_BITS_FROM_ISR, F_RTOS_TASKS, (uint32_t)(xEventGroup), \
             (uint32_t)(uxBitsToSet))
 
 #define traceEVENT_GROUP_DELETE(xEventGroup) \
-    RTE_MSG1(MSG1_RTOS_EVENT_GROUP_DELETE, F_RTOS_TASKS, (uint32_t)(xEventGroup))
+    RTE_RTOS_MSG1(MSG1_RTOS_EVENT_GROUP_DELETE, F_RTOS_TASKS, (uint32_t)(xEventGroup))
 #endif  // RTE_TRACE_RTOS_TASKS == 1
 
 
 #if ( configUSE_TIMERS == 1 )
 #if RTE_TRACE_RTOS_TIMER == 1
 #define tracePEND_FUNC_CALL(xFunctionToPend, pvParameter1, ulParameter2, ret) \
-    RTE_MSG4(MSG4_RTOS_PEND_FUNC_CALL, F_RTOS_TIMER, (uint32_t)(xFunctionToPend), \
+    RTE_RTOS_MSG4(MSG4_RTOS_PEND_FUNC_CALL, F_RTOS_TIMER, (uint32_t)(xFunctionToPend), \
             (uint32_t)(pvParameter1), (uint32_t)(ulParameter2), (uint32_t)(ret))
 
 #define tracePEND_FUNC_CALL_FROM_ISR(xFunctionToPend, pvParameter1, ulParameter2, ret) \
-    RTE_MSG4(MSG4_RTOS_PEND_FUNC_CALL_FROM_ISR, F_RTOS_TIMER, (uint32_t)(xFunctionToPend), \
+    RTE_RTOS_MSG4(MSG4_RTOS_PEND_FUNC_CALL_FROM_ISR, F_RTOS_TIMER, (uint32_t)(xFunctionToPend), \
             (uint32_t)(pvParameter1), (uint32_t)(ulParameter2), (uint32_t)(ret))
 #endif  // RTE_TRACE_RTOS_TIMER == 1
 #endif  // ( configUSE_TIMERS == 1 )
@@ -449,145 +912,238 @@ uint32_t rtos_get_task_name(void * p_tcb);
 
 #if RTE_TRACE_RTOS_BASIC == 1
 #if RTE_FREERTOS_VERSION >= 100400
-/* Packed: uxIndexToWait (16 bits, bits 0-15), xClearCountOnExit (1 bit, bit 16) */
+/* The packed data words are defined in rte_FreeRTOS_trace_pack.h. */
 #define traceTASK_NOTIFY_TAKE_BLOCK(uxIndexToWait) \
-    RTE_MSG3(MSG3_RTOS_TASK_NOTIFY_TAKE_BLOCK1, F_RTOS_BASIC, rtos_get_task_name(pxCurrentTCB), \
-            (uint32_t)(((uxIndexToWait) & 0xFFFFU) | (uint32_t)(xClearCountOnExit << 16U)), \
-            (uint32_t)xTicksToWait)
+    RTE_RTOS_MSG3(MSG3_RTOS_TASK_NOTIFY_TAKE_BLOCK1, F_RTOS_BASIC, rtos_get_task_name(pxCurrentTCB), \
+                  RTE_PACK_NOTIFY_TAKE1(uxIndexToWait, xClearCountOnExit), (uint32_t)xTicksToWait)
 
-/* Packed: uxIndexToWait (16 bits, bits 0-15), xClearCountOnExit (bits 16-31) */
 #define traceTASK_NOTIFY_TAKE(uxIndexToWait) \
-    RTE_MSG3(MSG3_RTOS_TASK_NOTIFY_TAKE1, F_RTOS_BASIC, rtos_get_task_name(pxCurrentTCB), \
-            (uint32_t)(((uxIndexToWait) & 0xFFFFU) | (uint32_t)(xClearCountOnExit << 16U)), \
-            (uint32_t)xTicksToWait)
+    RTE_RTOS_MSG3(MSG3_RTOS_TASK_NOTIFY_TAKE1, F_RTOS_BASIC, rtos_get_task_name(pxCurrentTCB), \
+                  RTE_PACK_NOTIFY_TAKE1(uxIndexToWait, xClearCountOnExit), (uint32_t)xTicksToWait)
 
-/* Packed: uxIndexToWait (8 bits, bits 24-31), xTicksToWait (24 bits, bits 0-23) */
 #define traceTASK_NOTIFY_WAIT_BLOCK(uxIndexToWait) \
-    RTE_MSG4(MSG4_RTOS_TASK_NOTIFY_WAIT_BLOCK1, F_RTOS_BASIC, rtos_get_task_name(pxCurrentTCB), \
-             (uint32_t)((uxIndexToWait) & 0xFFU) | (((uint32_t)(xTicksToWait & 0x00FFFFFFU)) << 8U), \
-            (uint32_t)ulBitsToClearOnEntry, (uint32_t)ulBitsToClearOnExit)
+    RTE_RTOS_MSG4(MSG4_RTOS_TASK_NOTIFY_WAIT_BLOCK1, F_RTOS_BASIC, rtos_get_task_name(pxCurrentTCB), \
+                  RTE_PACK_NOTIFY_WAIT1(uxIndexToWait, xTicksToWait), \
+                  (uint32_t)ulBitsToClearOnEntry, (uint32_t)ulBitsToClearOnExit)
 
-/* Packed: uxIndexToWait (8 bits, bits 24-31), xTicksToWait (24 bits, bits 0-23) */
 #define traceTASK_NOTIFY_WAIT(uxIndexToWait) \
-    RTE_MSG4(MSG4_RTOS_TASK_NOTIFY_WAIT1, F_RTOS_BASIC, rtos_get_task_name(pxCurrentTCB), \
-            ((uint32_t)(uxIndexToWait) & 0xFFU) | (uint32_t)((xTicksToWait & 0x00FFFFFFU) << 8U), \
-            (uint32_t)ulBitsToClearOnEntry, (uint32_t)ulBitsToClearOnExit)
+    RTE_RTOS_MSG4(MSG4_RTOS_TASK_NOTIFY_WAIT1, F_RTOS_BASIC, rtos_get_task_name(pxCurrentTCB), \
+                  RTE_PACK_NOTIFY_WAIT1(uxIndexToWait, xTicksToWait), \
+                  (uint32_t)ulBitsToClearOnEntry, (uint32_t)ulBitsToClearOnExit)
 
-/* Packed: uxIndexToNotify (16 bits, bits 16-31), eAction (16 bits, bits 0-15) */
 #define traceTASK_NOTIFY(uxIndexToNotify) \
-    RTE_MSG3(MSG3_RTOS_TASK_NOTIFY1, F_RTOS_BASIC, rtos_get_task_name(xTaskToNotify), \
-             ((uint32_t)(uxIndexToNotify) & 0xFFFFU) | (((uint32_t)(eAction & 0xFFFFU) << 16U)), \
-             (uint32_t)ulValue)
+    RTE_RTOS_MSG3(MSG3_RTOS_TASK_NOTIFY1, F_RTOS_BASIC, rtos_get_task_name(xTaskToNotify), \
+                  RTE_PACK_NOTIFY1(uxIndexToNotify, eAction), (uint32_t)ulValue)
 
-/* Packed: uxIndexToNotify (16 bits, bits 16-31), eAction (16 bits, bits 0-15) */
 #define traceTASK_NOTIFY_FROM_ISR(uxIndexToNotify) \
-    RTE_MSG3(MSG3_RTOS_TASK_NOTIFY_FROM_ISR1, F_RTOS_BASIC, rtos_get_task_name(xTaskToNotify), \
-            ((uint32_t)(uxIndexToNotify) & 0xFFFFU) | (((uint32_t)(eAction & 0xFFFFU) << 16U)), \
-             (uint32_t)ulValue)
+    RTE_RTOS_MSG3(MSG3_RTOS_TASK_NOTIFY_FROM_ISR1, F_RTOS_BASIC, rtos_get_task_name(xTaskToNotify), \
+                  RTE_PACK_NOTIFY1(uxIndexToNotify, eAction), (uint32_t)ulValue)
 
 #define traceTASK_NOTIFY_GIVE_FROM_ISR(uxIndexToNotify) \
-    RTE_MSG2(MSG2_RTOS_TASK_NOTIFY_GIVE_FROM_ISR1, F_RTOS_BASIC, rtos_get_task_name(xTaskToNotify), \
+    RTE_RTOS_MSG2(MSG2_RTOS_TASK_NOTIFY_GIVE_FROM_ISR1, F_RTOS_BASIC, rtos_get_task_name(xTaskToNotify), \
             (uint32_t)(uxIndexToNotify))
 
 #else   // RTE_FREERTOS_VERSION < 110000
-/* Packed: xClearCountOnExit (1 bit, bit 31), xTicksToWait (31 bits, bits 0-30) */
 #define traceTASK_NOTIFY_TAKE_BLOCK() \
-    RTE_MSG2(MSG2_RTOS_TASK_NOTIFY_TAKE_BLOCK2, F_RTOS_BASIC, rtos_get_task_name(pxCurrentTCB), \
-             ((uint32_t)(xClearCountOnExit & 1U)) | \
-             (((uint32_t)xTicksToWait > 0x7FFFFFFFU ? 0x7FFFFFFFU : (uint32_t)xTicksToWait) << 1U))
+    RTE_RTOS_MSG2(MSG2_RTOS_TASK_NOTIFY_TAKE_BLOCK2, F_RTOS_BASIC, rtos_get_task_name(pxCurrentTCB), \
+                  RTE_PACK_NOTIFY_TAKE2(xClearCountOnExit, xTicksToWait))
 
-/* Packed: xClearCountOnExit (1 bit, bit 31), xTicksToWait (31 bits, bits 0-30) */
 #define traceTASK_NOTIFY_TAKE() \
-    RTE_MSG2(MSG2_RTOS_TASK_NOTIFY_TAKE2, F_RTOS_BASIC, rtos_get_task_name(pxCurrentTCB), \
-             (((uint32_t)xClearCountOnExit & 1U) | \
-             (((uint32_t)xTicksToWait > 0x7FFFFFFFU ? 0x7FFFFFFFU : (uint32_t)xTicksToWait) << 1U)))
+    RTE_RTOS_MSG2(MSG2_RTOS_TASK_NOTIFY_TAKE2, F_RTOS_BASIC, rtos_get_task_name(pxCurrentTCB), \
+                  RTE_PACK_NOTIFY_TAKE2(xClearCountOnExit, xTicksToWait))
 
 #define traceTASK_NOTIFY_WAIT_BLOCK() \
-    RTE_MSG4(MSG4_RTOS_TASK_NOTIFY_WAIT_BLOCK2, F_RTOS_BASIC, rtos_get_task_name(pxCurrentTCB), \
+    RTE_RTOS_MSG4(MSG4_RTOS_TASK_NOTIFY_WAIT_BLOCK2, F_RTOS_BASIC, rtos_get_task_name(pxCurrentTCB), \
             (uint32_t)xTicksToWait, (uint32_t)ulBitsToClearOnEntry, (uint32_t)ulBitsToClearOnExit)
 
 #define traceTASK_NOTIFY_WAIT() \
-    RTE_MSG4(MSG4_RTOS_TASK_NOTIFY_WAIT2, F_RTOS_BASIC, rtos_get_task_name(pxCurrentTCB), \
+    RTE_RTOS_MSG4(MSG4_RTOS_TASK_NOTIFY_WAIT2, F_RTOS_BASIC, rtos_get_task_name(pxCurrentTCB), \
             (uint32_t)xTicksToWait, (uint32_t)ulBitsToClearOnEntry, (uint32_t)ulBitsToClearOnExit)
 
 #define traceTASK_NOTIFY() \
-    RTE_MSG3(MSG3_RTOS_TASK_NOTIFY2, F_RTOS_BASIC, rtos_get_task_name(xTaskToNotify), \
+    RTE_RTOS_MSG3(MSG3_RTOS_TASK_NOTIFY2, F_RTOS_BASIC, rtos_get_task_name(xTaskToNotify), \
             (uint32_t)eAction, (uint32_t)ulValue)
 
 #define traceTASK_NOTIFY_FROM_ISR() \
-    RTE_MSG3(MSG3_RTOS_TASK_NOTIFY_FROM_ISR2, F_RTOS_BASIC, rtos_get_task_name(xTaskToNotify), \
+    RTE_RTOS_MSG3(MSG3_RTOS_TASK_NOTIFY_FROM_ISR2, F_RTOS_BASIC, rtos_get_task_name(xTaskToNotify), \
             (uint32_t)eAction, (uint32_t)ulValue)
 
 #define traceTASK_NOTIFY_GIVE_FROM_ISR() \
-    RTE_MSG1(MSG1_RTOS_TASK_NOTIFY_GIVE_FROM_ISR2, F_RTOS_BASIC, rtos_get_task_name(xTaskToNotify))
+    RTE_RTOS_MSG1(MSG1_RTOS_TASK_NOTIFY_GIVE_FROM_ISR2, F_RTOS_BASIC, rtos_get_task_name(xTaskToNotify))
 #endif  // RTE_FREERTOS_VERSION => 110000
 #endif  // RTE_TRACE_RTOS_BASIC == 1
 
 
-#if RTE_TRACE_RTOS_EXPERT == 1
+#if RTE_TRACE_RTOS_ISR_IRQ == 1
+/* The exception number of the active interrupt is logged and the execution
+ * time (without nested ISRs) is accumulated in the per-IRQ counters. The
+ * counters are logged from a task - see rtos_isr_stats_poll(). */
 #define traceISR_EXIT_TO_SCHEDULER() \
-    RTE_MSG0(MSG0_RTOS_ISR_EXIT_TO_SCHEDULER, F_RTOS_EXPERT)
+    rtos_isr_exit(1U)
 
 #define traceISR_EXIT() \
-    RTE_MSG0(MSG0_RTOS_ISR_EXIT, F_RTOS_EXPERT)
+    rtos_isr_exit(0U)
 
 #define traceISR_ENTER() \
-    RTE_MSG0(MSG0_RTOS_ISR_ENTER, F_RTOS_EXPERT)
-#endif // RTE_TRACE_RTOS_EXPERT == 1
+    rtos_isr_enter()
+
+#elif RTE_TRACE_RTOS_EXPERT == 1
+#define traceISR_EXIT_TO_SCHEDULER() \
+    RTE_RTOS_MSG0(MSG0_RTOS_ISR_EXIT_TO_SCHEDULER, F_RTOS_EXPERT)
+
+#define traceISR_EXIT() \
+    RTE_RTOS_MSG0(MSG0_RTOS_ISR_EXIT, F_RTOS_EXPERT)
+
+#define traceISR_ENTER() \
+    RTE_RTOS_MSG0(MSG0_RTOS_ISR_ENTER, F_RTOS_EXPERT)
+#endif // RTE_TRACE_RTOS_ISR_IRQ == 1
 
 #if configUSE_STREAM_BUFFERS == 1
 #if RTE_TRACE_RTOS_STREAMS == 1
 /* xStreamBufferType: 0 - sbTYPE_STREAM_BUFFER, 1 - sbTYPE_MESSAGE_BUFFER, 2 - sbTYPE_STREAM_BATCHING_BUFFER */
 #define traceSTREAM_BUFFER_CREATE_FAILED(xStreamBufferType) \
-    RTE_MSG1(MSG1_RTOS_STREAM_BUFFER_CREATE_FAILED, F_RTOS_STREAMS, (uint32_t)(xStreamBufferType))
+    do { \
+        RTE_RTOS_MSG1(MSG1_RTOS_STREAM_BUFFER_CREATE_FAILED, F_RTOS_STREAMS, (uint32_t)(xStreamBufferType)); \
+        RTE_RTOS_ERROR(MSG1_RTOS_STREAM_BUFFER_CREATE_FAILED); \
+    } while (0)
 
 #define traceSTREAM_BUFFER_CREATE_STATIC_FAILED(xReturn, xStreamBufferType) \
-    RTE_MSG1(MSG1_RTOS_STREAM_BUFFER_CREATE_STATIC_FAILED, F_RTOS_STREAMS, \
-            (uint32_t)(xStreamBufferType))
+    do { \
+        RTE_RTOS_MSG1(MSG1_RTOS_STREAM_BUFFER_CREATE_STATIC_FAILED, F_RTOS_STREAMS, \
+                (uint32_t)(xStreamBufferType)); \
+        RTE_RTOS_ERROR(MSG1_RTOS_STREAM_BUFFER_CREATE_STATIC_FAILED); \
+    } while (0)
 
 #define traceSTREAM_BUFFER_CREATE(pxStreamBuffer, xStreamBufferType) \
-    RTE_MSG2(MSG2_RTOS_STREAM_BUFFER_CREATE, F_RTOS_STREAMS, (uint32_t)(pxStreamBuffer), \
+    RTE_RTOS_MSG2(MSG2_RTOS_STREAM_BUFFER_CREATE, F_RTOS_STREAMS, (uint32_t)(pxStreamBuffer), \
             (uint32_t)(xStreamBufferType))
 
 #define traceSTREAM_BUFFER_DELETE(xStreamBuffer) \
-    RTE_MSG1(MSG1_RTOS_STREAM_BUFFER_DELETE, F_RTOS_STREAMS, (uint32_t)(xStreamBuffer))
+    RTE_RTOS_MSG1(MSG1_RTOS_STREAM_BUFFER_DELETE, F_RTOS_STREAMS, (uint32_t)(xStreamBuffer))
 
 #define traceSTREAM_BUFFER_RESET(xStreamBuffer) \
-    RTE_MSG1(MSG1_RTOS_STREAM_BUFFER_RESET, F_RTOS_STREAMS, (uint32_t)(xStreamBuffer))
+    RTE_RTOS_MSG1(MSG1_RTOS_STREAM_BUFFER_RESET, F_RTOS_STREAMS, (uint32_t)(xStreamBuffer))
 
 #define traceSTREAM_BUFFER_RESET_FROM_ISR(xStreamBuffer) \
-    RTE_MSG1(MSG1_RTOS_STREAM_BUFFER_RESET_FROM_ISR, F_RTOS_STREAMS, (uint32_t)(xStreamBuffer))
+    RTE_RTOS_MSG1(MSG1_RTOS_STREAM_BUFFER_RESET_FROM_ISR, F_RTOS_STREAMS, (uint32_t)(xStreamBuffer))
 
 #define traceBLOCKING_ON_STREAM_BUFFER_SEND(xStreamBuffer) \
-    RTE_MSG1(MSG1_RTOS_BLOCKING_ON_STREAM_BUFFER_SEND, F_RTOS_STREAMS, (uint32_t)(xStreamBuffer))
+    RTE_RTOS_MSG1(MSG1_RTOS_BLOCKING_ON_STREAM_BUFFER_SEND, F_RTOS_STREAMS, (uint32_t)(xStreamBuffer))
 
 #define traceSTREAM_BUFFER_SEND(xStreamBuffer, xBytesSent) \
-    RTE_MSG2(MSG2_RTOS_STREAM_BUFFER_SEND, F_RTOS_STREAMS, (uint32_t)(xStreamBuffer), \
+    RTE_RTOS_MSG2(MSG2_RTOS_STREAM_BUFFER_SEND, F_RTOS_STREAMS, (uint32_t)(xStreamBuffer), \
             (uint32_t)(xBytesSent))
 
 #define traceSTREAM_BUFFER_SEND_FAILED(xStreamBuffer) \
-    RTE_MSG1(MSG1_RTOS_STREAM_BUFFER_SEND_FAILED, F_RTOS_STREAMS, (uint32_t)(xStreamBuffer))
+    do { \
+        RTE_RTOS_MSG1(MSG1_RTOS_STREAM_BUFFER_SEND_FAILED, F_RTOS_STREAMS, (uint32_t)(xStreamBuffer)); \
+        RTE_RTOS_ERROR(MSG1_RTOS_STREAM_BUFFER_SEND_FAILED); \
+    } while (0)
 
 #define traceSTREAM_BUFFER_SEND_FROM_ISR(xStreamBuffer, xBytesSent) \
-    RTE_MSG2(MSG2_RTOS_STREAM_BUFFER_SEND_FROM_ISR, F_RTOS_STREAMS, (uint32_t)(xStreamBuffer), \
+    RTE_RTOS_MSG2(MSG2_RTOS_STREAM_BUFFER_SEND_FROM_ISR, F_RTOS_STREAMS, (uint32_t)(xStreamBuffer), \
             (uint32_t)(xBytesSent))
 
 #define traceBLOCKING_ON_STREAM_BUFFER_RECEIVE(xStreamBuffer) \
-    RTE_MSG1(MSG1_RTOS_BLOCKING_ON_STREAM_BUFFER_RECEIVE, F_RTOS_STREAMS, (uint32_t)(xStreamBuffer))
+    RTE_RTOS_MSG1(MSG1_RTOS_BLOCKING_ON_STREAM_BUFFER_RECEIVE, F_RTOS_STREAMS, (uint32_t)(xStreamBuffer))
 
 #define traceSTREAM_BUFFER_RECEIVE(xStreamBuffer, xReceivedLength) \
-    RTE_MSG2(MSG2_RTOS_STREAM_BUFFER_RECEIVE, F_RTOS_STREAMS, (uint32_t)(xStreamBuffer), \
+    RTE_RTOS_MSG2(MSG2_RTOS_STREAM_BUFFER_RECEIVE, F_RTOS_STREAMS, (uint32_t)(xStreamBuffer), \
             (uint32_t)(xReceivedLength))
 
 #define traceSTREAM_BUFFER_RECEIVE_FAILED(xStreamBuffer) \
-    RTE_MSG1(MSG1_RTOS_STREAM_BUFFER_RECEIVE_FAILED, F_RTOS_STREAMS, (uint32_t)(xStreamBuffer))
+    do { \
+        RTE_RTOS_MSG1(MSG1_RTOS_STREAM_BUFFER_RECEIVE_FAILED, F_RTOS_STREAMS, (uint32_t)(xStreamBuffer)); \
+        RTE_RTOS_ERROR(MSG1_RTOS_STREAM_BUFFER_RECEIVE_FAILED); \
+    } while (0)
 
 #define traceSTREAM_BUFFER_RECEIVE_FROM_ISR(xStreamBuffer, xReceivedLength) \
-    RTE_MSG2(MSG2_RTOS_STREAM_BUFFER_RECEIVE_FROM_ISR, F_RTOS_STREAMS, (uint32_t)(xStreamBuffer), \
+    RTE_RTOS_MSG2(MSG2_RTOS_STREAM_BUFFER_RECEIVE_FROM_ISR, F_RTOS_STREAMS, (uint32_t)(xStreamBuffer), \
             (uint32_t)(xReceivedLength))
 #endif  // RTE_TRACE_RTOS_STREAMS == 1
 #endif  // configUSE_STREAM_BUFFERS == 1
 
+#if RTE_TRACE_RTOS_SNAPSHOT == 1
+/* The errors of the disabled groups are not logged but still trigger the snapshot.
+ * The trace macros of the enabled groups are defined above. */
+#ifndef traceQUEUE_CREATE_FAILED
+#define traceQUEUE_CREATE_FAILED(ucQueueType)   RTE_RTOS_ERROR(MSG1_RTOS_QUEUE_CREATE_FAILED)
+#endif
+#ifndef traceCREATE_MUTEX_FAILED
+#define traceCREATE_MUTEX_FAILED()              RTE_RTOS_ERROR(MSG0_RTOS_CREATE_MUTEX_FAILED)
+#endif
+#ifndef traceGIVE_MUTEX_RECURSIVE_FAILED
+#define traceGIVE_MUTEX_RECURSIVE_FAILED(pxMutex) \
+    RTE_RTOS_ERROR(MSG1_RTOS_GIVE_MUTEX_RECURSIVE_FAILED)
+#endif
+#ifndef traceTAKE_MUTEX_RECURSIVE_FAILED
+#define traceTAKE_MUTEX_RECURSIVE_FAILED(pxMutex) \
+    RTE_RTOS_ERROR(MSG1_RTOS_TAKE_MUTEX_RECURSIVE_FAILED)
+#endif
+#ifndef traceCREATE_COUNTING_SEMAPHORE_FAILED
+#define traceCREATE_COUNTING_SEMAPHORE_FAILED() \
+    RTE_RTOS_ERROR(MSG0_RTOS_CREATE_COUNTING_SEMAPHORE_FAILED)
+#endif
+#ifndef traceQUEUE_SEND_FAILED
+#define traceQUEUE_SEND_FAILED(pxQueue)         RTE_RTOS_ERROR(MSG2_RTOS_QUEUE_SEND_FAILED)
+#endif
+#ifndef traceQUEUE_PEEK_FAILED
+#define traceQUEUE_PEEK_FAILED(pxQueue)         RTE_RTOS_ERROR(MSG2_RTOS_QUEUE_PEEK_FAILED)
+#endif
+#ifndef traceQUEUE_RECEIVE_FAILED
+#define traceQUEUE_RECEIVE_FAILED(pxQueue)      RTE_RTOS_ERROR(MSG2_RTOS_QUEUE_RECEIVE_FAILED)
+#endif
+#ifndef traceQUEUE_SEND_FROM_ISR_FAILED
+#define traceQUEUE_SEND_FROM_ISR_FAILED(pxQueue) \
+    RTE_RTOS_ERROR(MSG1_RTOS_QUEUE_SEND_FROM_ISR_FAILED)
+#endif
+#ifndef traceQUEUE_RECEIVE_FROM_ISR_FAILED
+#define traceQUEUE_RECEIVE_FROM_ISR_FAILED(pxQueue) \
+    RTE_RTOS_ERROR(MSG1_RTOS_QUEUE_RECEIVE_FROM_ISR_FAILED)
+#endif
+#ifndef traceQUEUE_PEEK_FROM_ISR_FAILED
+#define traceQUEUE_PEEK_FROM_ISR_FAILED(pxQueue) \
+    RTE_RTOS_ERROR(MSG1_RTOS_QUEUE_PEEK_FROM_ISR_FAILED)
+#endif
+#ifndef traceTASK_CREATE_FAILED
+#define traceTASK_CREATE_FAILED()               RTE_RTOS_ERROR(MSG0_RTOS_TASK_CREATE_FAILED)
+#endif
+#ifndef traceTIMER_CREATE_FAILED
+#define traceTIMER_CREATE_FAILED()              RTE_RTOS_ERROR(MSG0_RTOS_TIMER_CREATE_FAILED)
+#endif
+#ifndef traceEVENT_GROUP_CREATE_FAILED
+#define traceEVENT_GROUP_CREATE_FAILED()        RTE_RTOS_ERROR(MSG0_RTOS_EVENT_GROUP_CREATE_FAILED)
+#endif
+#ifndef traceSTREAM_BUFFER_CREATE_FAILED
+#define traceSTREAM_BUFFER_CREATE_FAILED(xStreamBufferType) \
+    RTE_RTOS_ERROR(MSG1_RTOS_STREAM_BUFFER_CREATE_FAILED)
+#endif
+#ifndef traceSTREAM_BUFFER_CREATE_STATIC_FAILED
+#define traceSTREAM_BUFFER_CREATE_STATIC_FAILED(xReturn, xStreamBufferType) \
+    RTE_RTOS_ERROR(MSG1_RTOS_STREAM_BUFFER_CREATE_STATIC_FAILED)
+#endif
+#ifndef traceSTREAM_BUFFER_SEND_FAILED
+#define traceSTREAM_BUFFER_SEND_FAILED(xStreamBuffer) \
+    RTE_RTOS_ERROR(MSG1_RTOS_STREAM_BUFFER_SEND_FAILED)
+#endif
+#ifndef traceSTREAM_BUFFER_RECEIVE_FAILED
+#define traceSTREAM_BUFFER_RECEIVE_FAILED(xStreamBuffer) \
+    RTE_RTOS_ERROR(MSG1_RTOS_STREAM_BUFFER_RECEIVE_FAILED)
+#endif
+
+/* Default configASSERT() - define configASSERT() before this file is included
+ * to use the application's handler (call rtos_assert_failed() in it). */
+#ifndef configASSERT
+#define configASSERT(x) \
+    do { \
+        if ((x) == 0) \
+        { \
+            rtos_assert_failed(); \
+        } \
+    } while (0)
+#endif
+#endif  // RTE_TRACE_RTOS_SNAPSHOT == 1
+
 #ifdef __cplusplus
 }
 #endif
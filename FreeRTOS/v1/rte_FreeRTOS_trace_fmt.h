@@ -23,6 +23,15 @@
 /*  # RTOS_errors.log: Stores all messages that report FreeRTOS detected errors.    */
 /*    This file captures messages from FreeRTOS trace macros containing the keyword */
 /*    FAILED in their name.                                                         */
+/*  # RTOS_isr.log: Per-IRQ execution counts, execution times and ISR load (only    */
+/*    if RTE_TRACE_RTOS_ISR_IRQ is enabled).                                        */
+/*  # RTOS_heap.csv: Heap profiler summaries (only if RTE_TRACE_RTOS_HEAP_PROFILE   */
+/*    is enabled). Input for the Host/Scripts/rte_heap_report.py leak and           */
+/*    fragmentation report.                                                         */
+/*  # RTOS_stack.log: Task stack high-water marks (only if                          */
+/*    RTE_TRACE_RTOS_STACK_MONITOR is enabled).                                     */
+/*  # RTOS_queue_latency.log: Send-to-receive latency of queue items (only if      */
+/*    RTE_TRACE_RTOS_QUEUE_LATENCY is enabled).                                     */
 /*  # RTOS_timing.vcd: Timing information is exported separately to a VCD (Value    */
 /*    Change Dump) file. This standard format allows the data to be visualized and  */
 /*    analyzed graphically using common VCD viewers, such as GTKWave.               */
@@ -34,6 +43,11 @@
 // OUT_FILE(RTOS_MAIN, "RTOS_main.log", "w", "FreeRTOS event trace\nNote: The name Queue can also mean a semaphore or a mutex, since the mechanism of queues is used for all of them.\n\nMSG #     Time\n- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -\n")
 // OUT_FILE(RTOS_ERRORS, "RTOS_errors.log", "w", "Errors Reported During FreeRTOS Execution\n\n")
 // OUT_FILE(RTOS_TASKS, "RTOS_tasks.log", "w", "Execution times of FreeRTOS tasks, including time spent in the RTOS kernel, ISRs, and exception handlers.\n\nMSG #  Time[ms] Task name Run time [ms]\n- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -\n")
+// OUT_FILE(RTOS_ISR, "RTOS_isr.log", "w", "ISR load report - execution times without nested ISRs.\nIRQ - exception number (IRQn + 16 on Cortex-M)\n")
+// OUT_FILE(RTOS_HEAP, "RTOS_heap.csv", "w", "record;time;values\n")
+// OUT_FILE(RTOS_STACK, "RTOS_stack.log", "w", "Task stack high-water marks - lowest free stack space (stack size 0 - unknown)\n\nMSG #  Time[ms] Task name  Min. free  Stack size [bytes]\n- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -\n")
+// OUT_FILE(RTOS_QUEUE_LATENCY, "RTOS_queue_latency.log", "w", "Queue item latency (send to receive) [CPU cycles]\nHistogram class 0: 0 cycles, class n: 4^(n-1) to 4^n-1 cycles\n\n")
+// OUT_FILE(RTOS_OVERHEAD, "RTOS_overhead.log", "w", "Trace overhead per message ID - execution time of the RTE_RTOS_MSGx() calls [cycles]\n")
 // OUT_FILE(RTOS_TIMING, "RTOS_timing.vcd", "w")
 
 /*-------------- Define the message filter names ---------------*/
@@ -47,6 +61,7 @@
 // FILTER(F_RTOS_QUEUE,   "FreeRTOS Addditional Queue, Semaphore and Mutex trace")
 // FILTER(F_RTOS_STREAMS, "FreeRTOS Streams")
 // FILTER(F_RTOS_EXPERT,  "FreeRTOS Expert")
+// FILTER(F_RTOS_ISR,     "FreeRTOS ISR trace and per-IRQ counters")
 
 /* Keep track of the last task's name to display its execution time when the next task begins. */
 // MEMO(M_LAST_TASK_NAME)
@@ -195,6 +210,22 @@
 // >>RTOS_MAIN "%N %t QueueReceive from Queue%[32s]s successful, ticks to wait %[16u]u, %[16u]u items in queue\n"
 // >RTOS_TIMING "f Queue%[32s]s_items=%[48:16u](-1)u"
 
+/*---- Queue item latency (RTE_TRACE_RTOS_QUEUE_LATENCY == 1) ----*/
+// MSG3_RTOS_QUEUE_LATENCY
+// >>RTOS_MAIN "%N %t Queue%[32s]s item #%u received after %u cycles\n"
+// >RTOS_TIMING "f Queue%[0:32s]s_latency=%[64:32u]u"
+
+// MSG5_RTOS_QUEUE_LATENCY_STATS
+// >>RTOS_MAIN "%N %t Queue%[32s]s latency: %u items, average %u cycles, max %u cycles, "
+// >>RTOS_MAIN "%[16u]u overwritten, %[16u]u untracked\n"
+// >RTOS_QUEUE_LATENCY "%N %t Queue%[0:32s]4s: %[32:32u]u items, average %[64:32u]u, max %[96:32u]u cycles, "
+// >RTOS_QUEUE_LATENCY "%[128:16u]u overwritten, %[144:16u]u untracked\n"
+// >RTOS_TIMING "f Queue%[0:32s]s_latency_max=%[96:32u]u"
+
+// MSG8_RTOS_QUEUE_LATENCY_HISTOGRAM
+// >RTOS_QUEUE_LATENCY "   Histogram: %[16u]u %[16u]u %[16u]u %[16u]u %[16u]u %[16u]u %[16u]u %[16u]u"
+// >RTOS_QUEUE_LATENCY " %[16u]u %[16u]u %[16u]u %[16u]u %[16u]u %[16u]u %[16u]u %[16u]u\n"
+
 // MSG2_RTOS_QUEUE_PEEK
 // >>RTOS_MAIN "%N %t QueuePeek from Queue%[32s]s successful, ticks to wait %u\n"
 // >RTOS_TIMING "b Queue%[32s]s_peek=P"
@@ -265,6 +296,16 @@
 // >>RTOS_MAIN "%N %t TaskDelete Task%[32s]s successful\n"
 // >RTOS_TIMING "s Kernel=Task%[32s]s deleted"
 
+/*---- Stack high-water marks (RTE_TRACE_RTOS_STACK_MONITOR == 1) ----*/
+// MSG3_RTOS_TASK_STACK
+// >>RTOS_MAIN "%N %t Task%[32s]s stack: min. free %u bytes, stack size %u bytes\n"
+// >RTOS_STACK "%N %t Task%[0:32s]4s %[32:32u]10u %[64:32u]11u\n"
+// >RTOS_TIMING "f Task%[0:32s]s_stack=%[32:32u]u"
+
+// MSG2_RTOS_TASK_STACK_LOW
+// >>RTOS_MAIN "%N %t Task%[32s]s stack low: only %u bytes free\n"
+// >RTOS_ERRORS "%N %t Task%[0:32s]s stack low: only %[32:32u]u bytes free\n"
+
 // MSG1_RTOS_TASK_DELAY_UNTIL
 // >>RTOS_MAIN "%N %t TaskDelayUntil %u\n"
 // >RTOS_TIMING "s Task%[M_LAST_TASK_NAME]s_DelayUntil=%u"
@@ -323,6 +364,26 @@
 // >>RTOS_MAIN "%N %t Free: address 0x%08X, size %u bytes\n"
 // >RTOS_TIMING "f Malloc_Free=%[32:32u](*-1.)d"
 
+/*---- Heap profiler summaries (RTE_TRACE_RTOS_HEAP_PROFILE == 1) ----*/
+// MSG5_RTOS_HEAP_SUMMARY
+// >>RTOS_MAIN "%N %t Heap: live %u bytes, peak %u bytes, %u allocs, %u frees, "
+// >>RTOS_MAIN "%[16u]u failed, %[16u]u untracked\n"
+// >RTOS_HEAP "S;%t;%u;%u;%u;%u;%[16u]u;%[16u]u\n"
+// >RTOS_TIMING "f Heap_live=%[0:32u]u"
+// >RTOS_TIMING "f Heap_peak=%[32:32u]u"
+
+// MSG8_RTOS_HEAP_SIZE_HISTOGRAM
+// >RTOS_HEAP "H;%t;%[16u]u;%[16u]u;%[16u]u;%[16u]u;%[16u]u;%[16u]u;%[16u]u;%[16u]u"
+// >RTOS_HEAP ";%[16u]u;%[16u]u;%[16u]u;%[16u]u;%[16u]u;%[16u]u;%[16u]u;%[16u]u\n"
+
+// MSG3_RTOS_HEAP_FREE_SPACE
+// >>RTOS_MAIN "%N %t Heap: free %u bytes, largest free block %u bytes, min. ever free %u bytes\n"
+// >RTOS_HEAP "F;%t;%u;%u;%u\n"
+// >RTOS_TIMING "f Heap_largest_free=%[32:32u]u"
+
+// MSG5_RTOS_HEAP_SITE
+// >RTOS_HEAP "A;%t;0x%08X;%u;%u;%u;%u\n"
+
 // MSG1_RTOS_EVENT_GROUP_CREATE
 // >>RTOS_MAIN "%N %t Event group created: address 0x%08X\n"
 // >RTOS_TIMING "s EventGroup_%08X=Created"
@@ -465,6 +526,24 @@
 // >>RTOS_MAIN "%N %t RTOS Tick ISR enter\n"
 // >RTOS_TIMING "b RTOStickIRQ=P"
 
+/*---- ISR trace with the exception number (RTE_TRACE_RTOS_ISR_IRQ == 1) ----*/
+// MSG1_RTOS_ISR_ENTER_IRQ
+// >>RTOS_MAIN "%N %t ISR enter: IRQ %[0:16u]u, nesting level %[16:15u]u\n"
+// >RTOS_TIMING "b IRQ%[0:16u]u=1"
+
+// MSG1_RTOS_ISR_EXIT_IRQ
+// >>RTOS_MAIN "%N %t ISR %[31:1u]{exit|exit to scheduler}Y: IRQ %[0:16u]u, nesting level %[16:15u]u\n"
+// >RTOS_TIMING "b IRQ%[0:16u]u=0"
+
+// MSG2_RTOS_ISR_STATS_PERIOD
+// >RTOS_ISR "\n%N %t Period %[0:64u]llu CPU cycles\n"
+// >RTOS_ISR "  IRQ   Load    Count      Cycles  Max cycles\n"
+
+// MSG4_RTOS_ISR_STATS
+// >RTOS_ISR "%[0:16u]5u %[16:16u](*0.1)5.1f%% %8u %11u %11u\n"
+// >RTOS_TIMING "f IRQ%[0:16u]u_load=%[16:16u](*0.1).1f"
+// >RTOS_TIMING "f IRQ%[0:16u]u_max_cycles=%[96:32u]u"
+
 /*---- Trace FreeRTOS stream and message buffer operations. ----*/
 // MSG1_RTOS_STREAM_BUFFER_CREATE_FAILED
 // >>RTOS_MAIN "%N %t Stream buffer create failed: "
@@ -537,4 +616,35 @@
 // >>RTOS_MAIN "%N %t Stream buffer 0x%08X receive from ISR, ReceivedLength %u\n"
 // >RTOS_TIMING "f Stream_%08X_bytes=-%u"
 
+/*---- Error-triggered snapshot (RTE_TRACE_RTOS_SNAPSHOT == 1) ----*/
+// MSG1_RTOS_SNAPSHOT_ARM
+// >>RTOS_MAIN "%N %t Snapshot armed, post-trigger window %u ticks\n"
+// >RTOS_TIMING "s Snapshot=Armed"
+
+// MSG2_RTOS_SNAPSHOT_TRIGGER
+// >>RTOS_MAIN "%N %t Snapshot triggered by message ID %u, logging stops in %u ticks\n"
+// >RTOS_ERRORS "%N %t Snapshot triggered by message ID %u, logging stops in %u ticks\n"
+// >RTOS_TIMING "s Snapshot=Triggered"
+
+// MSG2_RTOS_SNAPSHOT_FREEZE
+// >>RTOS_MAIN "%N %t Snapshot: logging stopped %[32:32u]u ticks after the trigger (message ID %[0:32u]u)\n"
+// >RTOS_ERRORS "%N %t Snapshot: logging stopped %[32:32u]u ticks after the trigger (message ID %[0:32u]u)\n"
+// >RTOS_TIMING "s Snapshot=Frozen"
+
+/*---- configASSERT() hook - rtos_assert_failed() ----*/
+// MSG1_RTOS_ASSERT_FAILED
+// >>RTOS_MAIN "%N %t configASSERT() failed at 0x%08X\n"
+// >RTOS_ERRORS "%N %t configASSERT() failed at 0x%08X\n"
+// >RTOS_TIMING "b RTOSerror=P"
+// >RTOS_TIMING "s RTOSerrorText=configASSERT() failed at %08X"
+
+/*---- Trace overhead self-measurement (RTE_TRACE_RTOS_OVERHEAD == 1) ----*/
+// MSG3_RTOS_OVERHEAD_TABLE
+// >>RTOS_MAIN "%N %t Trace overhead: %u message IDs, %u messages not measured\n"
+// >RTOS_OVERHEAD "\n%N %t %[0:32u]u message IDs, %[32:32u]u messages not measured (table full), counter read %[64:32u]u cycles\n"
+// >RTOS_OVERHEAD "   ID      Count   Average       Max\n"
+
+// MSG4_RTOS_OVERHEAD
+// >RTOS_OVERHEAD "%5u %10u %9u %9u\n"
+
 #endif
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) Branko Premzel.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/*******************************************************************************
+ * @file    rte_FreeRTOS_trace_pack.h
+ * @author  Branko Premzel
+ * @brief   Packing of several values into one data word - all packed data
+ *          words of rte_FreeRTOS_trace.h and rte_FreeRTOS_trace.c. The
+ *          Expert messages (rte_FreeRTOS_trace2.h) have no packed words.
+ * @note    Generated by Host/Scripts/rte_trace_gen.py from
+ *          rte_FreeRTOS_trace_schema.json - do not edit. The format
+ *          definitions of the same messages are generated from the schema.
+ ******************************************************************************/
+
+#ifndef RTE_FREERTOS_TRACE_PACK_H
+#define RTE_FREERTOS_TRACE_PACK_H
+
+#define RTE_PACK_SAT(value, max)    (((value) > (max)) ? (uint32_t)(max) : (uint32_t)(value))
+#define RTE_PACK_MASK(value, mask)  ((uint32_t)(value) & (uint32_t)(mask))
+
+/* Ticks to wait and copy position (queueSEND_TO_BACK, queueSEND_TO_FRONT, queueOVERWRITE)
+ * ticks (bits 0-27, saturated), copy_position (bits 28-31, masked)
+ * Used by: MSG2_RTOS_QUEUE_SEND_FAILED */
+#define RTE_PACK_QUEUE_SEND_FAILED(ticks, copy_position) \
+    (RTE_PACK_SAT((ticks), 0xFFFFFFFU) | (RTE_PACK_MASK((copy_position), 0xFU) << 28U))
+
+/* Ticks to wait and number of items in the queue
+ * ticks (bits 0-15, saturated), items (bits 16-31, saturated)
+ * Used by: MSG2_RTOS_QUEUE_RECEIVE */
+#define RTE_PACK_QUEUE_RECEIVE(ticks, items) \
+    (RTE_PACK_SAT((ticks), 0xFFFFU) | (RTE_PACK_SAT((items), 0xFFFFU) << 16U))
+
+/* Notification index and xClearCountOnExit (FreeRTOS 10.4.0 and later)
+ * index (bits 0-15, masked), clear_count (bits 16-31, masked)
+ * Used by: MSG3_RTOS_TASK_NOTIFY_TAKE_BLOCK1, MSG3_RTOS_TASK_NOTIFY_TAKE1 */
+#define RTE_PACK_NOTIFY_TAKE1(index, clear_count) \
+    (RTE_PACK_MASK((index), 0xFFFFU) | (RTE_PACK_MASK((clear_count), 0xFFFFU) << 16U))
+
+/* xClearCountOnExit and ticks to wait (before FreeRTOS 10.4.0)
+ * clear_count (bit 0, masked), ticks (bits 1-31, saturated)
+ * Used by: MSG2_RTOS_TASK_NOTIFY_TAKE_BLOCK2, MSG2_RTOS_TASK_NOTIFY_TAKE2 */
+#define RTE_PACK_NOTIFY_TAKE2(clear_count, ticks) \
+    (RTE_PACK_MASK((clear_count), 0x1U) | (RTE_PACK_SAT((ticks), 0x7FFFFFFFU) << 1U))
+
+/* Notification index and ticks to wait (FreeRTOS 10.4.0 and later)
+ * index (bits 0-7, masked), ticks (bits 8-31, masked)
+ * Used by: MSG4_RTOS_TASK_NOTIFY_WAIT_BLOCK1, MSG4_RTOS_TASK_NOTIFY_WAIT1 */
+#define RTE_PACK_NOTIFY_WAIT1(index, ticks) \
+    (RTE_PACK_MASK((index), 0xFFU) | (RTE_PACK_MASK((ticks), 0xFFFFFFU) << 8U))
+
+/* Notification index and eAction (FreeRTOS 10.4.0 and later)
+ * index (bits 0-15, masked), action (bits 16-31, masked)
+ * Used by: MSG3_RTOS_TASK_NOTIFY1, MSG3_RTOS_TASK_NOTIFY_FROM_ISR1 */
+#define RTE_PACK_NOTIFY1(index, action) \
+    (RTE_PACK_MASK((index), 0xFFFFU) | (RTE_PACK_MASK((action), 0xFFFFU) << 16U))
+
+/* Exception number, nesting level and exit to the scheduler (RTE_TRACE_RTOS_ISR_IRQ)
+ * irq (bits 0-15, masked), depth (bits 16-30, saturated), to_scheduler (bit 31, masked)
+ * Used by: MSG1_RTOS_ISR_ENTER_IRQ, MSG1_RTOS_ISR_EXIT_IRQ */
+#define RTE_PACK_ISR_IRQ(irq, depth, to_scheduler) \
+    (RTE_PACK_MASK((irq), 0xFFFFU) | (RTE_PACK_SAT((depth), 0x7FFFU) << 16U) | (RTE_PACK_MASK((to_scheduler), 0x1U) << 31U))
+
+/* Exception number and CPU load [0.1 %] (RTE_TRACE_RTOS_ISR_IRQ)
+ * irq (bits 0-15, masked), load (bits 16-31, saturated)
+ * Used by: MSG4_RTOS_ISR_STATS */
+#define RTE_PACK_ISR_STATS(irq, load) \
+    (RTE_PACK_MASK((irq), 0xFFFFU) | (RTE_PACK_SAT((load), 0xFFFFU) << 16U))
+
+/* Two uint16_t counters - error counters and histogram bins (heap profile, queue latency). The counters saturate where they are counted.
+ * low (bits 0-15, masked), high (bits 16-31, masked)
+ * Used by: MSG5_RTOS_QUEUE_LATENCY_STATS, MSG8_RTOS_QUEUE_LATENCY_HISTOGRAM, MSG5_RTOS_HEAP_SUMMARY, MSG8_RTOS_HEAP_SIZE_HISTOGRAM */
+#define RTE_PACK_COUNTER_PAIR(low, high) \
+    (RTE_PACK_MASK((low), 0xFFFFU) | (RTE_PACK_MASK((high), 0xFFFFU) << 16U))
+
+#endif  // RTE_FREERTOS_TRACE_PACK_H
+
+/*==== End of file ====*/